@@ -134,6 +134,8 @@ namespace polyfem
 			args["states"],
 			level,
 			max_threads <= 0 ? std::numeric_limits<unsigned int>::max() : max_threads);
+		// the states reset the affinity to their own settings
+		utils::NThread::get().set_affinity(utils::thread_affinity_from_string(args["solver"]["thread_affinity"]));
 
 		utils::GeogramUtils::instance().set_logger(adjoint_logger());
 	}
@@ -585,6 +585,7 @@ namespace polyfem
 
 		mesh->prepare_mesh();
 
+		out_geom.clear_vis_mesh_cache();
 		bases.clear();
 		pressure_bases.clear();
 		geom_bases_.clear();
@@ -806,6 +807,10 @@ namespace polyfem
 				quadrature::Quadrature b_quad;
 				bases[i].compute_quadrature(b_quad);
 				pressure_bases[i].set_quadrature([b_quad](quadrature::Quadrature &quad) { quad = b_quad; });
+				if (bases[i].reference_key.empty() || pressure_bases[i].reference_key.empty())
+					pressure_bases[i].reference_key.clear();
+				else
+					pressure_bases[i].reference_key += "|" + bases[i].reference_key;
 			}
 		}
 
@@ -906,15 +911,25 @@ namespace polyfem
 		const int prev_bases = n_bases;
 		n_bases += obstacle.n_vertices();
 
+		// the node numbering and collision mesh of a snapshot are only valid for the bases it was written with
+		use_snapshot_discretization = input_snapshot && check_snapshot_nodes();
+
 		{
 			igl::Timer timer2;
 			logger().debug("Building node mapping...");
 			timer2.start();
-			build_node_mapping();
+			if (use_snapshot_discretization && input_snapshot->has("in_node_to_node"))
+			{
+				in_node_to_node = input_snapshot->imatrix("in_node_to_node");
+				in_primitive_to_primitive = input_snapshot->imatrix("in_primitive_to_primitive");
+			}
+			else
+				build_node_mapping();
 			problem->update_nodes(in_node_to_node);
 			mesh->update_nodes(in_node_to_node);
 			timer2.stop();
-			logger().debug("Done (took {}s)", timer2.getElapsedTime());
+			timings.building_node_mapping_time = timer2.getElapsedTime();
+			logger().debug("Done (took {}s)", timings.building_node_mapping_time);
 		}
 
 		logger().info("Building collision mesh...");
@@ -923,6 +938,8 @@ namespace polyfem
 			build_periodic_collision_mesh();
 		logger().info("Done!");
 
+		igl::Timer bc_timer;
+		bc_timer.start();
 		const int prev_b_size = local_boundary.size();
 		problem->setup_bc(*mesh, n_bases - obstacle.n_vertices(),
 						  bases, geom_bases(), pressure_bases,
@@ -934,68 +951,39 @@ namespace polyfem
 						  pressure_boundary_nodes,
 						  dirichlet_nodes, neumann_nodes);
 
+		if (use_snapshot_discretization)
+			check_snapshot_boundary();
+
 		// setp nodal values
 		{
+			// position of every node, taken from the first element referencing it
+			std::vector<const RowVectorNd *> node_positions(n_bases, nullptr);
+			for (const auto &bs : bases)
+				for (const auto &b : bs.bases)
+					for (const auto &lg : b.global())
+						if (lg.index >= 0 && lg.index < n_bases && node_positions[lg.index] == nullptr)
+							node_positions[lg.index] = &lg.node;
+
 			dirichlet_nodes_position.resize(dirichlet_nodes.size());
 			for (int n = 0; n < dirichlet_nodes.size(); ++n)
 			{
 				const int n_id = dirichlet_nodes[n];
-				bool found = false;
-				for (const auto &bs : bases)
-				{
-					for (const auto &b : bs.bases)
-					{
-						for (const auto &lg : b.global())
-						{
-							if (lg.index == n_id)
-							{
-								dirichlet_nodes_position[n] = lg.node;
-								found = true;
-								break;
-							}
-						}
-
-						if (found)
-							break;
-					}
-
-					if (found)
-						break;
-				}
-
-				assert(found);
+				assert(n_id >= 0 && n_id < n_bases && node_positions[n_id]);
+				if (n_id >= 0 && n_id < n_bases && node_positions[n_id])
+					dirichlet_nodes_position[n] = *node_positions[n_id];
 			}
 
 			neumann_nodes_position.resize(neumann_nodes.size());
 			for (int n = 0; n < neumann_nodes.size(); ++n)
 			{
 				const int n_id = neumann_nodes[n];
-				bool found = false;
-				for (const auto &bs : bases)
-				{
-					for (const auto &b : bs.bases)
-					{
-						for (const auto &lg : b.global())
-						{
-							if (lg.index == n_id)
-							{
-								neumann_nodes_position[n] = lg.node;
-								found = true;
-								break;
-							}
-						}
-
-						if (found)
-							break;
-					}
-
-					if (found)
-						break;
-				}
-
-				assert(found);
+				assert(n_id >= 0 && n_id < n_bases && node_positions[n_id]);
+				if (n_id >= 0 && n_id < n_bases && node_positions[n_id])
+					neumann_nodes_position[n] = *node_positions[n_id];
 			}
 		}
+		bc_timer.stop();
+		timings.setting_up_bc_time = bc_timer.getElapsedTime();
 
 		const bool has_neumann = local_neumann_boundary.size() > 0 || local_boundary.size() < prev_b_size;
 		use_avg_pressure = !has_neumann;
@@ -1090,16 +1078,36 @@ namespace polyfem
 
 		ass_vals_cache.clear();
 		mass_ass_vals_cache.clear();
+		timings.building_cache_time = 0;
 		if (n_bases <= args["solver"]["advanced"]["cache_size"])
 		{
 			timer.start();
 			logger().info("Building cache...");
-			ass_vals_cache.init(mesh->is_volume(), bases, curret_bases);
-			mass_ass_vals_cache.init(mesh->is_volume(), bases, curret_bases, true);
+			const std::string cache_layout = args["solver"]["advanced"]["cache_layout"];
+			AssemblyValsCache::Layout layout = AssemblyValsCache::Layout::FULL;
+			if (cache_layout == "packed")
+				layout = AssemblyValsCache::Layout::PACKED;
+			else if (cache_layout == "reference")
+				layout = AssemblyValsCache::Layout::REFERENCE;
+
+			ass_vals_cache.init(mesh->is_volume(), bases, curret_bases, false, layout);
+			mass_ass_vals_cache.init(mesh->is_volume(), bases, curret_bases, true, layout);
 			if (mixed_assembler != nullptr)
-				pressure_ass_vals_cache.init(mesh->is_volume(), pressure_bases, curret_bases);
+				pressure_ass_vals_cache.init(mesh->is_volume(), pressure_bases, curret_bases, false, layout);
 
-			logger().info(" took {}s", timer.getElapsedTime());
+			timer.stop();
+			timings.building_cache_time = timer.getElapsedTime();
+			logger().info(" took {}s", timings.building_cache_time);
+			logger().debug("Cache memory {}MB ({} layout)", (ass_vals_cache.memory() + mass_ass_vals_cache.memory()) / (1024. * 1024.), cache_layout);
+		}
+
+		if (args["solver"]["advanced"]["element_coloring"])
+		{
+			timer.start();
+			logger().info("Coloring elements...");
+			ass_vals_cache.init_coloring(bases);
+			mass_ass_vals_cache.init_coloring(bases);
+			logger().info(" took {}s, {} colors", timer.getElapsedTime(), ass_vals_cache.coloring().n_colors());
 		}
 
 		out_geom.build_grid(*mesh, args["output"]["advanced"]["sol_on_grid"]);
@@ -1411,10 +1419,35 @@ namespace polyfem
 
 	void State::build_collision_mesh()
 	{
-		build_collision_mesh(
-			*mesh, n_bases, bases, geom_bases(), total_local_boundary, obstacle,
-			args, [this](const std::string &p) { return resolve_input_path(p); },
-			in_node_to_node, collision_mesh);
+		CollisionMeshData data;
+		if (use_snapshot_discretization && input_snapshot->has("collision_mesh/vertices"))
+		{
+			data.vertices = input_snapshot->matrix("collision_mesh/vertices");
+			data.codim_vertices = input_snapshot->imatrix("collision_mesh/codim_vertices");
+			data.edges = input_snapshot->imatrix("collision_mesh/edges");
+			data.faces = input_snapshot->imatrix("collision_mesh/faces");
+			data.num_fe_vertices = input_snapshot->imatrix("collision_mesh/num_fe_vertices")(0);
+
+			const auto displacement_map = input_snapshot->matrix("collision_mesh/displacement_map");
+			data.displacement_map_entries.reserve(displacement_map.rows());
+			for (int i = 0; i < displacement_map.rows(); ++i)
+				data.displacement_map_entries.emplace_back(int(displacement_map(i, 0)), int(displacement_map(i, 1)), displacement_map(i, 2));
+
+			logger().debug("Collision mesh loaded from snapshot {}", input_snapshot->path());
+		}
+		else
+		{
+			build_collision_mesh_data(
+				*mesh, n_bases, bases, geom_bases(), total_local_boundary, obstacle,
+				args, in_node_to_node, data);
+		}
+
+		build_collision_mesh(data, n_bases, collision_mesh);
+
+		if (!args["output"]["data"]["snapshot"].get<std::string>().empty())
+			collision_mesh_data = std::move(data);
+		else
+			collision_mesh_data = CollisionMeshData();
 	}
 
 	void State::build_collision_mesh(
@@ -1429,10 +1462,35 @@ namespace polyfem
 		const Eigen::VectorXi &in_node_to_node,
 		ipc::CollisionMesh &collision_mesh)
 	{
-		Eigen::MatrixXd collision_vertices;
-		Eigen::VectorXi collision_codim_vids;
-		Eigen::MatrixXi collision_edges, collision_triangles;
-		std::vector<Eigen::Triplet<double>> displacement_map_entries;
+		CollisionMeshData data;
+		build_collision_mesh_data(
+			mesh, n_bases, bases, geom_bases, total_local_boundary, obstacle,
+			args, in_node_to_node, data);
+		build_collision_mesh(data, n_bases, collision_mesh);
+	}
+
+	void State::build_collision_mesh_data(
+		const mesh::Mesh &mesh,
+		const int n_bases,
+		const std::vector<basis::ElementBases> &bases,
+		const std::vector<basis::ElementBases> &geom_bases,
+		const std::vector<mesh::LocalBoundary> &total_local_boundary,
+		const mesh::Obstacle &obstacle,
+		const json &args,
+		const Eigen::VectorXi &in_node_to_node,
+		CollisionMeshData &data)
+	{
+		Eigen::MatrixXd &collision_vertices = data.vertices;
+		Eigen::VectorXi &collision_codim_vids = data.codim_vertices;
+		Eigen::MatrixXi &collision_edges = data.edges;
+		Eigen::MatrixXi &collision_triangles = data.faces;
+		std::vector<Eigen::Triplet<double>> &displacement_map_entries = data.displacement_map_entries;
+
+		collision_vertices.resize(0, 0);
+		collision_codim_vids.resize(0);
+		collision_edges.resize(0, 0);
+		collision_triangles.resize(0, 0);
+		displacement_map_entries.clear();
 
 		if (args.contains("/contact/collision_mesh"_json_pointer)
 			&& args.at("/contact/collision_mesh/enabled"_json_pointer).get<bool>())
@@ -1505,22 +1563,32 @@ namespace polyfem
 			}
 		}
 
+		data.num_fe_vertices = num_fe_collision_vertices;
+	}
+
+	void State::build_collision_mesh(
+		const CollisionMeshData &data,
+		const int n_bases,
+		ipc::CollisionMesh &collision_mesh)
+	{
+		const int num_fe_collision_vertices = data.num_fe_vertices;
+
 		std::vector<bool> is_on_surface = ipc::CollisionMesh::construct_is_on_surface(
-			collision_vertices.rows(), collision_edges);
-		for (const int vid : collision_codim_vids)
+			data.vertices.rows(), data.edges);
+		for (const int vid : data.codim_vertices)
 		{
 			is_on_surface[vid] = true;
 		}
 
 		Eigen::SparseMatrix<double> displacement_map;
-		if (!displacement_map_entries.empty())
+		if (!data.displacement_map_entries.empty())
 		{
-			displacement_map.resize(collision_vertices.rows(), n_bases);
-			displacement_map.setFromTriplets(displacement_map_entries.begin(), displacement_map_entries.end());
+			displacement_map.resize(data.vertices.rows(), n_bases);
+			displacement_map.setFromTriplets(data.displacement_map_entries.begin(), data.displacement_map_entries.end());
 		}
 
 		collision_mesh = ipc::CollisionMesh(
-			is_on_surface, collision_vertices, collision_edges, collision_triangles,
+			is_on_surface, data.vertices, data.edges, data.faces,
 			displacement_map);
 
 		collision_mesh.can_collide = [&collision_mesh, num_fe_collision_vertices](size_t vi, size_t vj) {
@@ -1811,6 +1879,9 @@ namespace polyfem
 			}
 		}
 
+		// waits for the time steps still being written
+		out_geom.flush_writes();
+
 		timer.stop();
 		timings.solving_time = timer.getElapsedTime();
 		logger().info(" took {}s", timings.solving_time);
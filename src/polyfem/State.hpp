@@ -31,6 +31,7 @@
 #include <polyfem/assembler/PeriodicBoundary.hpp>
 
 #include <polyfem/io/OutData.hpp>
+#include <polyfem/io/Snapshot.hpp>
 
 #include <polysolve/linear/Solver.hpp>
 
@@ -540,6 +541,20 @@ namespace polyfem
 		/// index mapping from periodic 2x2 collision mesh to FE periodic mesh
 		Eigen::VectorXi periodic_collision_mesh_to_basis;
 
+		/// @brief vertices, edges, faces, and displacement map the collision mesh is built from
+		struct CollisionMeshData
+		{
+			Eigen::MatrixXd vertices;
+			Eigen::VectorXi codim_vertices;
+			Eigen::MatrixXi edges;
+			Eigen::MatrixXi faces;
+			std::vector<Eigen::Triplet<double>> displacement_map_entries;
+			/// the obstacle vertices are after the first num_fe_vertices vertices
+			int num_fe_vertices = 0;
+		};
+		/// @brief data of the collision mesh, only kept when snapshots are written
+		CollisionMeshData collision_mesh_data;
+
 		/// @brief extracts the boundary mesh for collision, called in build_basis
 		static void build_collision_mesh(
 			const mesh::Mesh &mesh,
@@ -553,6 +568,24 @@ namespace polyfem
 			const Eigen::VectorXi &in_node_to_node,
 			ipc::CollisionMesh &collision_mesh);
 
+		/// @brief extracts the vertices, edges, and faces of the collision mesh (including the obstacles)
+		static void build_collision_mesh_data(
+			const mesh::Mesh &mesh,
+			const int n_bases,
+			const std::vector<basis::ElementBases> &bases,
+			const std::vector<basis::ElementBases> &geom_bases,
+			const std::vector<mesh::LocalBoundary> &total_local_boundary,
+			const mesh::Obstacle &obstacle,
+			const json &args,
+			const Eigen::VectorXi &in_node_to_node,
+			CollisionMeshData &data);
+
+		/// @brief builds the collision mesh from its vertices, edges, and faces
+		static void build_collision_mesh(
+			const CollisionMeshData &data,
+			const int n_bases,
+			ipc::CollisionMesh &collision_mesh);
+
 		/// @brief extracts the boundary mesh for collision, called in build_basis
 		void build_collision_mesh();
 		void build_periodic_collision_mesh();
@@ -642,6 +675,27 @@ namespace polyfem
 		/// @param t current time to restart at
 		void save_restart_json(const double t0, const double dt, const int t) const;
 
+		/// @brief Save a binary snapshot (processed mesh, node numbering, boundary, collision mesh,
+		/// and time integrator history) for restarting the simulation at time t
+		/// @param path snapshot file
+		/// @param t current time step
+		void save_snapshot(const std::string &path, const double t0, const double dt, const int t) const;
+
+		/// snapshot to restart from, nullptr if /input/data/snapshot is empty
+		std::shared_ptr<io::SnapshotReader> input_snapshot;
+
+	private:
+		/// creates the mesh from the snapshot, returns false if the snapshot does not contain the mesh
+		bool load_mesh_from_snapshot(const bool non_conforming);
+		/// checks that the current bases have the same nodes (at the same positions) as the snapshot
+		bool check_snapshot_nodes() const;
+		/// warns if the boundary nodes differ from the ones in the snapshot (e.g., the boundary conditions changed)
+		void check_snapshot_boundary() const;
+		/// the node numbering and collision mesh are taken from the snapshot, set in build_basis
+		bool use_snapshot_discretization = false;
+
+	public:
+
 		//-----------PATH management
 		/// Get the root path for the state (e.g., args["root_path"] or ".")
 		/// @return root path
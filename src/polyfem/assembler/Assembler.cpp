@@ -80,6 +80,221 @@ namespace polyfem::assembler
 			}
 		};
 
+		class LocalThreadElementStorage
+		{
+		public:
+			ElementAssemblyValues vals;
+			QuadratureVector da;
+		};
+
+		/// builds the (compressed, column major) sparsity pattern of the n_basis * size matrix
+		/// coupling all the nodes of each element, values are set to zero
+		void build_sparsity_pattern(const int n_basis, const int size, const std::vector<ElementBases> &bases, StiffnessMatrix &mat)
+		{
+			typedef StiffnessMatrix::StorageIndex StorageIndex;
+
+			std::vector<std::vector<int>> node_elements(n_basis);
+			for (int e = 0; e < bases.size(); ++e)
+			{
+				for (const Basis &b : bases[e].bases)
+				{
+					for (const auto &g : b.global())
+					{
+						auto &elements = node_elements[g.index];
+						if (elements.empty() || elements.back() != e)
+							elements.push_back(e);
+					}
+				}
+			}
+
+			std::vector<std::vector<int>> node_neighbours(n_basis);
+			maybe_parallel_for(n_basis, [&](int start, int end, int thread_id) {
+				for (int n = start; n < end; ++n)
+				{
+					auto &neighbours = node_neighbours[n];
+					for (const int e : node_elements[n])
+						for (const Basis &b : bases[e].bases)
+							for (const auto &g : b.global())
+								neighbours.push_back(g.index);
+
+					std::sort(neighbours.begin(), neighbours.end());
+					neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+				}
+			});
+			node_elements.clear();
+
+			const long n = long(n_basis) * size;
+			mat.resize(n, n);
+
+			std::vector<StorageIndex> outer(n + 1);
+			outer[0] = 0;
+			for (int node = 0; node < n_basis; ++node)
+				for (int d = 0; d < size; ++d)
+					outer[node * size + d + 1] = outer[node * size + d] + StorageIndex(node_neighbours[node].size() * size);
+
+			mat.resizeNonZeros(outer.back());
+			std::copy(outer.begin(), outer.end(), mat.outerIndexPtr());
+			std::fill(mat.valuePtr(), mat.valuePtr() + outer.back(), 0);
+
+			StorageIndex *inner = mat.innerIndexPtr();
+			maybe_parallel_for(n_basis, [&](int start, int end, int thread_id) {
+				for (int node = start; node < end; ++node)
+				{
+					for (int d = 0; d < size; ++d)
+					{
+						StorageIndex k = outer[node * size + d];
+						for (const int other : node_neighbours[node])
+							for (int d2 = 0; d2 < size; ++d2)
+								inner[k++] = other * size + d2;
+					}
+				}
+			});
+		}
+
+		/// index of entry (row, col) in the values of a compressed column major matrix, the entry must exist
+		inline long sparse_index(const StiffnessMatrix &mat, const int row, const int col)
+		{
+			const auto *inner = mat.innerIndexPtr();
+			const auto *begin = inner + mat.outerIndexPtr()[col];
+			const auto *end = inner + mat.outerIndexPtr()[col + 1];
+			const auto *it = std::lower_bound(begin, end, row);
+			assert(it != end && *it == row);
+			return it - inner;
+		}
+
+		/// true if the element is integrated with the sum-factorized kernels: tensor-product bases, the
+		/// (stiffness) quadrature they were built for, and an assembler with a flux. Any other quadrature
+		/// (eg a user quadrature order with the same number of points) uses the dense kernels.
+		bool use_sum_factorization(const Assembler &assembler, const AssemblyValsCache &cache, const ElementBases &bases, const ElementAssemblyValues &vals)
+		{
+			return assembler.has_flux() && !cache.is_mass() && bases.tensor_basis != nullptr
+				   && bases.tensor_basis->is_quadrature(vals.quadrature);
+		}
+
+		/// local gradient of the energy with sum factorization, res(j, m) = sum_q da_q sum_b flux_q(m, b) d phi_j / d x_b
+		/// the bases gradients are never formed, only the solution gradient and the flux at the quadrature points
+		void sum_factorized_gradient(
+			const Assembler &assembler,
+			const TensorProductBasis &tensor_basis,
+			const ElementAssemblyValues &vals,
+			const QuadratureVector &da,
+			const double t,
+			const Eigen::MatrixXd &local_disp,
+			Eigen::MatrixXd &res)
+		{
+			const int dim = tensor_basis.dim();
+			const int size = local_disp.cols();
+			const int n_pts = da.size();
+
+			Eigen::MatrixXd grad_u, flux;
+			tensor_basis.interpolate_grad(local_disp, grad_u);
+			for (int p = 0; p < n_pts; ++p)
+				for (int m = 0; m < size; ++m)
+					grad_u.block(p, m * dim, 1, dim) = (grad_u.block(p, m * dim, 1, dim) * vals.jac_it[p]).eval();
+
+			assembler.compute_flux(t, vals, grad_u, flux);
+
+			// back to the reference element, weighted by the quadrature
+			for (int p = 0; p < n_pts; ++p)
+				for (int m = 0; m < size; ++m)
+					flux.block(p, m * dim, 1, dim) = (da(p) * flux.block(p, m * dim, 1, dim) * vals.jac_it[p].transpose()).eval();
+
+			tensor_basis.integrate_grad(flux, res);
+		}
+
+		/// local stiffness of a linear assembler with sum factorization, res(i * size + m, j * size + n) couples
+		/// the component m of basis i and the component n of basis j. Since the flux is linear, the material
+		/// tangent at the quadrature points is the flux of the unit gradients
+		void sum_factorized_stiffness(
+			const Assembler &assembler,
+			const TensorProductBasis &tensor_basis,
+			const ElementAssemblyValues &vals,
+			const QuadratureVector &da,
+			const double t,
+			Eigen::MatrixXd &res)
+		{
+			const int dim = tensor_basis.dim();
+			const int size = assembler.size();
+			const int n_cols = size * dim;
+			const int n_pts = da.size();
+			const int n_loc_bases = tensor_basis.n_bases();
+
+			// maps the reference gradient (as a row) of a field at p to the weighted reference flux
+			std::vector<Eigen::MatrixXd> tangent(n_pts, Eigen::MatrixXd::Zero(n_cols, n_cols));
+			Eigen::MatrixXd unit(n_pts, n_cols), flux;
+			for (int k = 0; k < n_cols; ++k)
+			{
+				unit.setZero();
+				unit.col(k).setOnes();
+				assembler.compute_flux(t, vals, unit, flux);
+
+				for (int p = 0; p < n_pts; ++p)
+					tangent[p].row(k) = flux.row(p);
+			}
+
+			Eigen::MatrixXd jac(n_cols, n_cols);
+			for (int p = 0; p < n_pts; ++p)
+			{
+				jac.setZero();
+				for (int m = 0; m < size; ++m)
+					jac.block(m * dim, m * dim, dim, dim) = vals.jac_it[p];
+
+				tangent[p] = (da(p) * jac * tangent[p] * jac.transpose()).eval();
+			}
+
+			res.resize(n_loc_bases * size, n_loc_bases * size);
+
+			Eigen::MatrixXd unit_basis = Eigen::MatrixXd::Zero(n_loc_bases, 1);
+			Eigen::MatrixXd basis_grad, ref_flux(n_pts, n_cols), local;
+			for (int j = 0; j < n_loc_bases; ++j)
+			{
+				unit_basis(j) = 1;
+				tensor_basis.interpolate_grad(unit_basis, basis_grad);
+				unit_basis(j) = 0;
+
+				for (int n = 0; n < size; ++n)
+				{
+					for (int p = 0; p < n_pts; ++p)
+						ref_flux.row(p) = basis_grad.row(p) * tangent[p].middleRows(n * dim, dim);
+
+					tensor_basis.integrate_grad(ref_flux, local);
+					res.col(j * size + n) = local.transpose().reshaped();
+				}
+			}
+		}
+
+		/// assembles a global vector element by element, assemble_element(e, vals, da, out) adds the
+		/// contribution of element e to out. Uses the element coloring of the cache when available.
+		template <typename AssembleElement>
+		void assemble_vector(const AssemblyValsCache &cache, const int n_elements, const AssembleElement &assemble_element, Eigen::MatrixXd &out)
+		{
+			if (!cache.coloring().empty())
+			{
+				// elements of the same color do not share nodes, scatter directly in out
+				auto storage = create_thread_storage(LocalThreadElementStorage());
+
+				cache.coloring().parallel_for([&](int e, int thread_id) {
+					LocalThreadElementStorage &local_storage = get_local_thread_storage(storage, thread_id);
+					assemble_element(e, local_storage.vals, local_storage.da, out);
+				});
+
+				return;
+			}
+
+			auto storage = create_thread_storage(LocalThreadVecStorage(out.size()));
+
+			maybe_parallel_for(n_elements, [&](int start, int end, int thread_id) {
+				LocalThreadVecStorage &local_storage = get_local_thread_storage(storage, thread_id);
+
+				for (int e = start; e < end; ++e)
+					assemble_element(e, local_storage.vals, local_storage.da, local_storage.vec);
+			});
+
+			// Serially merge local storages
+			for (const LocalThreadVecStorage &local_storage : storage)
+				out += local_storage.vec;
+		}
+
 		class LocalThreadScalarStorage
 		{
 		public:
@@ -177,95 +392,125 @@ namespace polyfem::assembler
 			stiffness.resize(n_basis * size(), n_basis * size());
 			stiffness.setZero();
 
-			auto storage = create_thread_storage(LocalThreadMatStorage(buffer_size, stiffness.rows(), stiffness.cols()));
-
 			const int n_bases = int(bases.size());
 			igl::Timer timer;
 			timer.start();
 			assert(cache.is_mass() == is_mass);
 
-			// (potentially parallel) loop over elements
-			// Note that n_bases is the number of elements since ach ElementBases object stores
-			// all local basis functions on a given element
-			maybe_parallel_for(n_bases, [&](int start, int end, int thread_id) {
-				LocalThreadMatStorage &local_storage = get_local_thread_storage(storage, thread_id);
+			// computes the local stiffness of element e and calls add_value(e, gi, gj, value) for every entry
+			const auto assemble_element = [&](const int e, ElementAssemblyValues &vals, QuadratureVector &da, const auto &add_value) {
+				// compute geometric mapping
+				// evaluate and store basis functions/their gradients at quadrature points
+				cache.compute(e, is_volume, bases[e], gbases[e], vals);
 
-				for (int e = start; e < end; ++e)
-				{
-					ElementAssemblyValues &vals = local_storage.vals;
-					// igl::Timer timer; timer.start();
-					// vals.compute(e, is_volume, bases[e], gbases[e]);
+				const Quadrature &quadrature = vals.quadrature;
 
-					// compute geometric mapping
-					// evaluate and store basis functions/their gradients at quadrature points
-					cache.compute(e, is_volume, bases[e], gbases[e], vals);
+				assert(MAX_QUAD_POINTS == -1 || quadrature.weights.size() < MAX_QUAD_POINTS);
+				da = vals.det.array() * quadrature.weights.array();
+				const int n_loc_bases = int(vals.basis_values.size());
 
-					const Quadrature &quadrature = vals.quadrature;
+				// on tensor-product elements (or if the assembler supports it) the whole local stiffness is computed at once
+				Eigen::MatrixXd local_stiffness;
+				if (use_sum_factorization(*this, cache, bases[e], vals))
+					sum_factorized_stiffness(*this, *bases[e].tensor_basis, vals, da, t, local_stiffness);
+				else if (!assemble_local(vals, da, t, local_stiffness))
+					local_stiffness.resize(0, 0);
 
-					assert(MAX_QUAD_POINTS == -1 || quadrature.weights.size() < MAX_QUAD_POINTS);
-					local_storage.da = vals.det.array() * quadrature.weights.array();
-					const int n_loc_bases = int(vals.basis_values.size());
+				for (int i = 0; i < n_loc_bases; ++i)
+				{
+					const auto &global_i = vals.basis_values[i].global;
 
-					for (int i = 0; i < n_loc_bases; ++i)
+					// loop over other bases up to the current one, taking advantage of symmetry
+					for (int j = 0; j <= i; ++j)
 					{
-						// const AssemblyValues &values_i = vals.basis_values[i];
-						// const Eigen::MatrixXd &gradi = values_i.grad_t_m;
-						const auto &global_i = vals.basis_values[i].global;
+						const auto &global_j = vals.basis_values[j].global;
 
-						// loop over other bases up to the current one, taking advantage of symmetry
-						for (int j = 0; j <= i; ++j)
+						// compute local entry in stiffness matrix
+						Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 9, 1> stiffness_val;
+						if (local_stiffness.size() > 0)
 						{
-							// const AssemblyValues &values_j = vals.basis_values[j];
-							// const Eigen::MatrixXd &gradj = values_j.grad_t_m;
-							const auto &global_j = vals.basis_values[j].global;
-
-							// compute local entry in stiffness matrix
-							const auto stiffness_val = assemble(LinearAssemblerData(vals, t, i, j, local_storage.da));
-							assert(stiffness_val.size() == size() * size());
-
-							// igl::Timer t1; t1.start();
-							// loop over dimensions of the problem
+							stiffness_val.resize(size() * size());
 							for (int n = 0; n < size(); ++n)
-							{
 								for (int m = 0; m < size(); ++m)
+									stiffness_val(n * size() + m) = local_stiffness(i * size() + m, j * size() + n);
+						}
+						else
+							stiffness_val = assemble(LinearAssemblerData(vals, t, i, j, da));
+						assert(stiffness_val.size() == size() * size());
+
+						// loop over dimensions of the problem
+						for (int n = 0; n < size(); ++n)
+						{
+							for (int m = 0; m < size(); ++m)
+							{
+								const double local_value = stiffness_val(n * size() + m);
+
+								// loop over the global nodes corresponding to local element (useful for non-conforming cases)
+								for (size_t ii = 0; ii < global_i.size(); ++ii)
 								{
-									const double local_value = stiffness_val(n * size() + m);
+									const auto gi = global_i[ii].index * size() + m;
+									const auto wi = global_i[ii].val;
 
-									// loop over the global nodes corresponding to local element (useful for non-conforming cases)
-									for (size_t ii = 0; ii < global_i.size(); ++ii)
+									for (size_t jj = 0; jj < global_j.size(); ++jj)
 									{
-										const auto gi = global_i[ii].index * size() + m;
-										const auto wi = global_i[ii].val;
+										const auto gj = global_j[jj].index * size() + n;
+										const auto wj = global_j[jj].val;
 
-										for (size_t jj = 0; jj < global_j.size(); ++jj)
+										// add local value to the global matrix (weighted by corresponding nodes)
+										add_value(e, gi, gj, local_value * wi * wj);
+										if (j < i)
 										{
-											const auto gj = global_j[jj].index * size() + n;
-											const auto wj = global_j[jj].val;
-
-											// add local value to the global matrix (weighted by corresponding nodes)
-											local_storage.cache->add_value(e, gi, gj, local_value * wi * wj);
-											if (j < i)
-											{
-												local_storage.cache->add_value(e, gj, gi, local_value * wj * wi);
-											}
-
-											if (local_storage.cache->entries_size() >= max_triplets_size)
-											{
-												local_storage.cache->prune();
-												logger().trace("cleaning memory. Current storage: {}. mat nnz: {}", local_storage.cache->capacity(), local_storage.cache->non_zeros());
-											}
+											add_value(e, gj, gi, local_value * wj * wi);
 										}
 									}
 								}
 							}
-
-							// t1.stop();
-							// if (!vals.has_parameterization) { std::cout << "-- t1: " << t1.getElapsedTime() << std::endl; }
 						}
 					}
+				}
+			};
 
-					// timer.stop();
-					// if (!vals.has_parameterization) { std::cout << "-- Timer: " << timer.getElapsedTime() << std::endl; }
+			if (!cache.coloring().empty())
+			{
+				// elements of the same color do not share nodes, build the sparsity pattern
+				// from the connectivity and scatter directly in the values of the matrix
+				build_sparsity_pattern(n_basis, size(), bases, stiffness);
+				double *values = stiffness.valuePtr();
+
+				auto storage = create_thread_storage(LocalThreadElementStorage());
+
+				cache.coloring().parallel_for([&](int e, int thread_id) {
+					LocalThreadElementStorage &local_storage = get_local_thread_storage(storage, thread_id);
+
+					assemble_element(e, local_storage.vals, local_storage.da, [&](int, int gi, int gj, double value) {
+						values[sparse_index(stiffness, gi, gj)] += value;
+					});
+				});
+
+				timer.stop();
+				logger().trace("done colored assembly {}s...", timer.getElapsedTime());
+				return;
+			}
+
+			auto storage = create_thread_storage(LocalThreadMatStorage(buffer_size, stiffness.rows(), stiffness.cols()));
+
+			// (potentially parallel) loop over elements
+			// Note that n_bases is the number of elements since ach ElementBases object stores
+			// all local basis functions on a given element
+			maybe_parallel_for(n_bases, [&](int start, int end, int thread_id) {
+				LocalThreadMatStorage &local_storage = get_local_thread_storage(storage, thread_id);
+
+				for (int e = start; e < end; ++e)
+				{
+					assemble_element(e, local_storage.vals, local_storage.da, [&](int el, int gi, int gj, double value) {
+						local_storage.cache->add_value(el, gi, gj, value);
+
+						if (local_storage.cache->entries_size() >= max_triplets_size)
+						{
+							local_storage.cache->prune();
+							logger().trace("cleaning memory. Current storage: {}. mat nnz: {}", local_storage.cache->capacity(), local_storage.cache->non_zeros());
+						}
+					});
 				}
 			});
 
@@ -582,64 +827,96 @@ namespace polyfem::assembler
 		const Eigen::MatrixXd &displacement,
 		const Eigen::MatrixXd &displacement_prev,
 		Eigen::MatrixXd &rhs) const
+	{
+		assemble_gradient_and_energies(is_volume, n_basis, bases, gbases, cache, t, dt, displacement, displacement_prev, rhs, nullptr);
+	}
+
+	double NLAssembler::assemble_energy_and_gradient(
+		const bool is_volume,
+		const int n_basis,
+		const std::vector<ElementBases> &bases,
+		const std::vector<ElementBases> &gbases,
+		const AssemblyValsCache &cache,
+		const double t,
+		const double dt,
+		const Eigen::MatrixXd &displacement,
+		const Eigen::MatrixXd &displacement_prev,
+		Eigen::MatrixXd &rhs) const
+	{
+		Eigen::VectorXd energies(bases.size());
+		assemble_gradient_and_energies(is_volume, n_basis, bases, gbases, cache, t, dt, displacement, displacement_prev, rhs, &energies);
+		return energies.sum();
+	}
+
+	void NLAssembler::assemble_gradient_and_energies(
+		const bool is_volume,
+		const int n_basis,
+		const std::vector<ElementBases> &bases,
+		const std::vector<ElementBases> &gbases,
+		const AssemblyValsCache &cache,
+		const double t,
+		const double dt,
+		const Eigen::MatrixXd &displacement,
+		const Eigen::MatrixXd &displacement_prev,
+		Eigen::MatrixXd &rhs,
+		Eigen::VectorXd *energies) const
 	{
 		rhs.resize(n_basis * size(), 1);
 		rhs.setZero();
 
-		auto storage = create_thread_storage(LocalThreadVecStorage(rhs.size()));
-
 		const int n_bases = int(bases.size());
+		assert(energies == nullptr || energies->size() == n_bases);
 
-		maybe_parallel_for(n_bases, [&](int start, int end, int thread_id) {
-			LocalThreadVecStorage &local_storage = get_local_thread_storage(storage, thread_id);
+		// computes the local gradient of element e and adds it to out
+		const auto assemble_element = [&](const int e, ElementAssemblyValues &vals, QuadratureVector &da, Eigen::MatrixXd &out) {
+			cache.compute(e, is_volume, bases[e], gbases[e], vals);
 
-			for (int e = start; e < end; ++e)
-			{
-				// igl::Timer timer; timer.start();
+			const Quadrature &quadrature = vals.quadrature;
 
-				ElementAssemblyValues &vals = local_storage.vals;
-				// vals.compute(e, is_volume, bases[e], gbases[e]);
-				cache.compute(e, is_volume, bases[e], gbases[e], vals);
+			assert(MAX_QUAD_POINTS == -1 || quadrature.weights.size() < MAX_QUAD_POINTS);
+			da = vals.det.array() * quadrature.weights.array();
+			const int n_loc_bases = int(vals.basis_values.size());
 
-				const Quadrature &quadrature = vals.quadrature;
+			Eigen::VectorXd val;
+			if (use_sum_factorization(*this, cache, bases[e], vals))
+			{
+				Eigen::MatrixXd local_disp = Eigen::MatrixXd::Zero(n_loc_bases, size()), local_grad;
+				for (int j = 0; j < n_loc_bases; ++j)
+					for (const auto &g : vals.basis_values[j].global)
+						for (int m = 0; m < size(); ++m)
+							local_disp(j, m) += g.val * displacement(g.index * size() + m);
 
-				assert(MAX_QUAD_POINTS == -1 || quadrature.weights.size() < MAX_QUAD_POINTS);
-				local_storage.da = vals.det.array() * quadrature.weights.array();
-				const int n_loc_bases = int(vals.basis_values.size());
+				sum_factorized_gradient(*this, *bases[e].tensor_basis, vals, da, t, local_disp, local_grad);
+				val = local_grad.transpose().reshaped();
+			}
+			else
+				val = assemble_gradient(NonLinearAssemblerData(vals, t, dt, displacement, displacement_prev, da));
+			assert(val.size() == n_loc_bases * size());
 
-				const auto val = assemble_gradient(NonLinearAssemblerData(vals, t, dt, displacement, displacement_prev, local_storage.da));
-				assert(val.size() == n_loc_bases * size());
+			// the energy of each element is stored at its index, no race and the sum does not depend on the threads
+			if (energies != nullptr)
+				(*energies)(e) = compute_energy(NonLinearAssemblerData(vals, t, dt, displacement, displacement_prev, da));
 
-				for (int j = 0; j < n_loc_bases; ++j)
+			for (int j = 0; j < n_loc_bases; ++j)
+			{
+				const auto &global_j = vals.basis_values[j].global;
+
+				for (int m = 0; m < size(); ++m)
 				{
-					const auto &global_j = vals.basis_values[j].global;
+					const double local_value = val(j * size() + m);
 
-					// igl::Timer t1; t1.start();
-					for (int m = 0; m < size(); ++m)
+					for (size_t jj = 0; jj < global_j.size(); ++jj)
 					{
-						const double local_value = val(j * size() + m);
+						const auto gj = global_j[jj].index * size() + m;
+						const auto wj = global_j[jj].val;
 
-						for (size_t jj = 0; jj < global_j.size(); ++jj)
-						{
-							const auto gj = global_j[jj].index * size() + m;
-							const auto wj = global_j[jj].val;
-
-							local_storage.vec(gj) += local_value * wj;
-						}
+						out(gj) += local_value * wj;
 					}
-
-					// t1.stop();
-					// if (!vals.has_parameterization) { std::cout << "-- t1: " << t1.getElapsedTime() << std::endl; }
 				}
-
-				// timer.stop();
-				// if (!vals.has_parameterization) { std::cout << "-- Timer: " << timer.getElapsedTime() << std::endl; }
 			}
-		});
+		};
 
-		// Serially merge local storages
-		for (const LocalThreadVecStorage &local_storage : storage)
-			rhs += local_storage.vec;
+		assemble_vector(cache, n_bases, assemble_element, rhs);
 	}
 
 	void NLAssembler::assemble_hessian(
@@ -666,49 +943,96 @@ namespace polyfem::assembler
 		mat_cache.init(n_basis * size());
 		mat_cache.set_zero();
 
-		auto storage = create_thread_storage(LocalThreadMatStorage(buffer_size, mat_cache));
+		// computes the local hessian of element e, vals and da are thread local buffers
+		const auto compute_local_hessian = [&](const int e, ElementAssemblyValues &vals, QuadratureVector &da) {
+			cache.compute(e, is_volume, bases[e], gbases[e], vals);
+
+			const Quadrature &quadrature = vals.quadrature;
+
+			assert(MAX_QUAD_POINTS == -1 || quadrature.weights.size() < MAX_QUAD_POINTS);
+			da = vals.det.array() * quadrature.weights.array();
+
+			Eigen::MatrixXd stiffness_val = assemble_hessian(NonLinearAssemblerData(vals, t, dt, displacement, displacement_prev, da));
+			assert(stiffness_val.rows() == vals.basis_values.size() * size());
+			assert(stiffness_val.cols() == vals.basis_values.size() * size());
+
+			if (project_to_psd)
+				stiffness_val = ipc::project_to_psd(stiffness_val);
+
+			return stiffness_val;
+		};
 
 		const int n_bases = int(bases.size());
 		igl::Timer timer;
 		timer.start();
 
+		SparseMatrixCache *sparse_mat_cache = dynamic_cast<SparseMatrixCache *>(&mat_cache);
+		if (sparse_mat_cache != nullptr && sparse_mat_cache->is_pattern_cached())
+		{
+			// The sparsity pattern and the element to value-slot map are fixed after the first assembly,
+			// scatter the local hessians directly in the cached values (no per-thread matrix copies).
+			auto storage = create_thread_storage(LocalThreadElementStorage());
+
+			maybe_parallel_for(n_bases, [&](int start, int end, int thread_id) {
+				LocalThreadElementStorage &local_storage = get_local_thread_storage(storage, thread_id);
+
+				for (int e = start; e < end; ++e)
+				{
+					ElementAssemblyValues &vals = local_storage.vals;
+					const Eigen::MatrixXd stiffness_val = compute_local_hessian(e, vals, local_storage.da);
+					const int n_loc_bases = int(vals.basis_values.size());
+
+					// same traversal order as the first assembly (see below), local_index identifies the value slot
+					int local_index = 0;
+					for (int i = 0; i < n_loc_bases; ++i)
+					{
+						const auto &global_i = vals.basis_values[i].global;
+
+						for (int j = 0; j < n_loc_bases; ++j)
+						{
+							const auto &global_j = vals.basis_values[j].global;
+
+							for (int n = 0; n < size(); ++n)
+							{
+								for (int m = 0; m < size(); ++m)
+								{
+									const double local_value = stiffness_val(i * size() + m, j * size() + n);
+
+									for (size_t ii = 0; ii < global_i.size(); ++ii)
+									{
+										const auto wi = global_i[ii].val;
+
+										for (size_t jj = 0; jj < global_j.size(); ++jj)
+										{
+											const auto wj = global_j[jj].val;
+											sparse_mat_cache->add_element_value(e, local_index++, local_value * wi * wj);
+										}
+									}
+								}
+							}
+						}
+					}
+				}
+			});
+
+			timer.stop();
+			logger().trace("done direct assembly {}s...", timer.getElapsedTime());
+
+			hess = mat_cache.get_matrix();
+			return;
+		}
+
+		auto storage = create_thread_storage(LocalThreadMatStorage(buffer_size, mat_cache));
+
 		maybe_parallel_for(n_bases, [&](int start, int end, int thread_id) {
 			LocalThreadMatStorage &local_storage = get_local_thread_storage(storage, thread_id);
 
 			for (int e = start; e < end; ++e)
 			{
 				ElementAssemblyValues &vals = local_storage.vals;
-				cache.compute(e, is_volume, bases[e], gbases[e], vals);
-
-				const Quadrature &quadrature = vals.quadrature;
-
-				assert(MAX_QUAD_POINTS == -1 || quadrature.weights.size() < MAX_QUAD_POINTS);
-				local_storage.da = vals.det.array() * quadrature.weights.array();
+				const Eigen::MatrixXd stiffness_val = compute_local_hessian(e, vals, local_storage.da);
 				const int n_loc_bases = int(vals.basis_values.size());
 
-				auto stiffness_val = assemble_hessian(NonLinearAssemblerData(vals, t, dt, displacement, displacement_prev, local_storage.da));
-				assert(stiffness_val.rows() == n_loc_bases * size());
-				assert(stiffness_val.cols() == n_loc_bases * size());
-
-				if (project_to_psd)
-					stiffness_val = ipc::project_to_psd(stiffness_val);
-
-				// bool has_nan = false;
-				// for(int k = 0; k < stiffness_val.size(); ++k)
-				// {
-				// 	if(std::isnan(stiffness_val(k)))
-				// 	{
-				// 		has_nan = true;
-				// 		break;
-				// 	}
-				// }
-
-				// if(has_nan)
-				// {
-				// 	local_storage.entries.emplace_back(0, 0, std::nan(""));
-				// 	break;
-				// }
-
 				for (int i = 0; i < n_loc_bases; ++i)
 				{
 					const auto &global_i = vals.basis_values[i].global;
@@ -770,4 +1094,123 @@ namespace polyfem::assembler
 		logger().trace("done merge assembly {}s...", timer.getElapsedTime());
 	}
 
+	void NLAssembler::assemble_hessian_apply(
+		const bool is_volume,
+		const int n_basis,
+		const bool project_to_psd,
+		const std::vector<ElementBases> &bases,
+		const std::vector<ElementBases> &gbases,
+		const AssemblyValsCache &cache,
+		const double t,
+		const double dt,
+		const Eigen::MatrixXd &displacement,
+		const Eigen::MatrixXd &displacement_prev,
+		const Eigen::MatrixXd &v,
+		Eigen::MatrixXd &out) const
+	{
+		assert(v.size() == n_basis * size());
+		out.resize(n_basis * size(), 1);
+		out.setZero();
+
+		// gathers v on element e, applies the local hessian, and adds the result to res
+		const auto assemble_element = [&](const int e, ElementAssemblyValues &vals, QuadratureVector &da, Eigen::MatrixXd &res) {
+			cache.compute(e, is_volume, bases[e], gbases[e], vals);
+
+			const Quadrature &quadrature = vals.quadrature;
+
+			assert(MAX_QUAD_POINTS == -1 || quadrature.weights.size() < MAX_QUAD_POINTS);
+			da = vals.det.array() * quadrature.weights.array();
+			const int n_loc_bases = int(vals.basis_values.size());
+
+			Eigen::MatrixXd stiffness_val = assemble_hessian(NonLinearAssemblerData(vals, t, dt, displacement, displacement_prev, da));
+			assert(stiffness_val.rows() == n_loc_bases * size());
+			assert(stiffness_val.cols() == n_loc_bases * size());
+
+			if (project_to_psd)
+				stiffness_val = ipc::project_to_psd(stiffness_val);
+
+			Eigen::VectorXd local_v = Eigen::VectorXd::Zero(n_loc_bases * size());
+			for (int j = 0; j < n_loc_bases; ++j)
+			{
+				const auto &global_j = vals.basis_values[j].global;
+				for (int n = 0; n < size(); ++n)
+					for (size_t jj = 0; jj < global_j.size(); ++jj)
+						local_v(j * size() + n) += global_j[jj].val * v(global_j[jj].index * size() + n);
+			}
+
+			const Eigen::VectorXd local_out = stiffness_val * local_v;
+
+			for (int i = 0; i < n_loc_bases; ++i)
+			{
+				const auto &global_i = vals.basis_values[i].global;
+				for (int m = 0; m < size(); ++m)
+					for (size_t ii = 0; ii < global_i.size(); ++ii)
+						res(global_i[ii].index * size() + m) += global_i[ii].val * local_out(i * size() + m);
+			}
+		};
+
+		assemble_vector(cache, int(bases.size()), assemble_element, out);
+	}
+
+	void NLAssembler::assemble_hessian_diagonal(
+		const bool is_volume,
+		const int n_basis,
+		const bool project_to_psd,
+		const std::vector<ElementBases> &bases,
+		const std::vector<ElementBases> &gbases,
+		const AssemblyValsCache &cache,
+		const double t,
+		const double dt,
+		const Eigen::MatrixXd &displacement,
+		const Eigen::MatrixXd &displacement_prev,
+		Eigen::MatrixXd &diag) const
+	{
+		diag.resize(n_basis * size(), 1);
+		diag.setZero();
+
+		// adds the entries of the local hessian of element e that land on the diagonal
+		const auto assemble_element = [&](const int e, ElementAssemblyValues &vals, QuadratureVector &da, Eigen::MatrixXd &res) {
+			cache.compute(e, is_volume, bases[e], gbases[e], vals);
+
+			const Quadrature &quadrature = vals.quadrature;
+
+			assert(MAX_QUAD_POINTS == -1 || quadrature.weights.size() < MAX_QUAD_POINTS);
+			da = vals.det.array() * quadrature.weights.array();
+			const int n_loc_bases = int(vals.basis_values.size());
+
+			Eigen::MatrixXd stiffness_val = assemble_hessian(NonLinearAssemblerData(vals, t, dt, displacement, displacement_prev, da));
+			assert(stiffness_val.rows() == n_loc_bases * size());
+			assert(stiffness_val.cols() == n_loc_bases * size());
+
+			if (project_to_psd)
+				stiffness_val = ipc::project_to_psd(stiffness_val);
+
+			for (int i = 0; i < n_loc_bases; ++i)
+			{
+				const auto &global_i = vals.basis_values[i].global;
+
+				for (int j = 0; j < n_loc_bases; ++j)
+				{
+					const auto &global_j = vals.basis_values[j].global;
+
+					for (int m = 0; m < size(); ++m)
+					{
+						const double local_value = stiffness_val(i * size() + m, j * size() + m);
+
+						for (size_t ii = 0; ii < global_i.size(); ++ii)
+						{
+							for (size_t jj = 0; jj < global_j.size(); ++jj)
+							{
+								if (global_i[ii].index == global_j[jj].index)
+									res(global_i[ii].index * size() + m) += local_value * global_i[ii].val * global_j[jj].val;
+							}
+						}
+					}
+				}
+			}
+		};
+
+		assemble_vector(cache, int(bases.size()), assemble_element, diag);
+	}
+
 } // namespace polyfem::assembler
@@ -109,6 +109,23 @@ namespace polyfem::assembler
 			const Eigen::MatrixXd &displacement_prev,
 			Eigen::MatrixXd &rhs) const { log_and_throw_error("Assemble grad not implemented by {}!", name()); }
 
+		// assemble energy and its gradient (rhs) at once, returns the energy
+		virtual double assemble_energy_and_gradient(
+			const bool is_volume,
+			const int n_basis,
+			const std::vector<basis::ElementBases> &bases,
+			const std::vector<basis::ElementBases> &gbases,
+			const AssemblyValsCache &cache,
+			const double t,
+			const double dt,
+			const Eigen::MatrixXd &displacement,
+			const Eigen::MatrixXd &displacement_prev,
+			Eigen::MatrixXd &rhs) const
+		{
+			assemble_gradient(is_volume, n_basis, bases, gbases, cache, t, dt, displacement, displacement_prev, rhs);
+			return assemble_energy(is_volume, bases, gbases, cache, t, dt, displacement, displacement_prev);
+		}
+
 		// assemble hessian of energy (grad)
 		virtual void assemble_hessian(
 			const bool is_volume,
@@ -124,6 +141,35 @@ namespace polyfem::assembler
 			utils::MatrixCache &mat_cache,
 			StiffnessMatrix &grad) const { log_and_throw_error("Assemble hessian not implemented by {}!", name()); }
 
+		// hessian of energy times v, without assembling the hessian
+		virtual void assemble_hessian_apply(
+			const bool is_volume,
+			const int n_basis,
+			const bool project_to_psd,
+			const std::vector<basis::ElementBases> &bases,
+			const std::vector<basis::ElementBases> &gbases,
+			const AssemblyValsCache &cache,
+			const double t,
+			const double dt,
+			const Eigen::MatrixXd &displacement,
+			const Eigen::MatrixXd &displacement_prev,
+			const Eigen::MatrixXd &v,
+			Eigen::MatrixXd &out) const { log_and_throw_error("Assemble hessian apply not implemented by {}!", name()); }
+
+		// diagonal of the hessian of energy, without assembling the hessian
+		virtual void assemble_hessian_diagonal(
+			const bool is_volume,
+			const int n_basis,
+			const bool project_to_psd,
+			const std::vector<basis::ElementBases> &bases,
+			const std::vector<basis::ElementBases> &gbases,
+			const AssemblyValsCache &cache,
+			const double t,
+			const double dt,
+			const Eigen::MatrixXd &displacement,
+			const Eigen::MatrixXd &displacement_prev,
+			Eigen::MatrixXd &diag) const { log_and_throw_error("Assemble hessian diagonal not implemented by {}!", name()); }
+
 		// plotting (eg von mises), assembler is the name of the formulation
 		virtual void compute_scalar_value(
 			const OutputData &data,
@@ -144,6 +190,18 @@ namespace polyfem::assembler
 			const Eigen::MatrixXd &displacement,
 			Eigen::MatrixXd &tensor) const { log_and_throw_error("Not implemented!"); }
 
+		// true if compute_flux is implemented, enables the sum-factorized kernels on tensor-product elements
+		virtual bool has_flux() const { return false; }
+
+		// flux at the quadrature points of vals: derivative of the energy density w.r.t. the solution gradient (eg the first Piola-Kirchhoff stress)
+		// grad_u and flux are #quadrature points x (size * dim), row p stores d u_m / d x_b in the column m * dim + b
+		// only for energies depending on the solution gradient alone, for linear assemblers the flux is linear in grad_u
+		virtual void compute_flux(
+			const double t,
+			const ElementAssemblyValues &vals,
+			const Eigen::MatrixXd &grad_u,
+			Eigen::MatrixXd &flux) const { log_and_throw_error("Flux not implemented by {}!", name()); }
+
 		virtual void compute_dstress_dmu_dlambda(
 			const OptAssemblerData &data,
 			Eigen::MatrixXd &dstress_dmu,
@@ -231,7 +289,14 @@ namespace polyfem::assembler
 
 		/// local assembly function that defines the bilinear form (LHS)
 		/// computes and returns a single local stiffness value
+		/// on tensor-product elements of assemblers with a flux the local
+		/// stiffness is instead computed with sum factorization
 		virtual Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 9, 1> assemble(const LinearAssemblerData &data) const = 0;
+
+		/// optional local assembly of the whole element at once, for bilinear forms with per element work (eg material parameters)
+		/// local(i * size + m, j * size + n) is entry (n, m) of assemble(LinearAssemblerData(vals, t, i, j, da))
+		/// @return false if not implemented, then the entries are computed with assemble
+		virtual bool assemble_local(const ElementAssemblyValues &vals, const QuadratureVector &da, const double t, Eigen::MatrixXd &local) const { return false; }
 	};
 
 	// non-linear assembler (eg neohookean elasticity)
@@ -263,6 +328,7 @@ namespace polyfem::assembler
 			const Eigen::MatrixXd &displacement_prev) const override;
 
 		// assemble gradient of energy (rhs)
+		// sum-factorized on tensor-product elements if the assembler has a flux
 		void assemble_gradient(
 			const bool is_volume,
 			const int n_basis,
@@ -275,6 +341,19 @@ namespace polyfem::assembler
 			const Eigen::MatrixXd &displacement_prev,
 			Eigen::MatrixXd &rhs) const override;
 
+		// assemble energy and gradient in one pass over the elements, the element values are computed once
+		double assemble_energy_and_gradient(
+			const bool is_volume,
+			const int n_basis,
+			const std::vector<basis::ElementBases> &bases,
+			const std::vector<basis::ElementBases> &gbases,
+			const AssemblyValsCache &cache,
+			const double t,
+			const double dt,
+			const Eigen::MatrixXd &displacement,
+			const Eigen::MatrixXd &displacement_prev,
+			Eigen::MatrixXd &rhs) const override;
+
 		// assemble hessian of energy (grad)
 		void assemble_hessian(
 			const bool is_volume,
@@ -290,6 +369,35 @@ namespace polyfem::assembler
 			utils::MatrixCache &mat_cache,
 			StiffnessMatrix &grad) const override;
 
+		// hessian of energy times v, the local hessians are applied to v and never scattered
+		void assemble_hessian_apply(
+			const bool is_volume,
+			const int n_basis,
+			const bool project_to_psd,
+			const std::vector<basis::ElementBases> &bases,
+			const std::vector<basis::ElementBases> &gbases,
+			const AssemblyValsCache &cache,
+			const double t,
+			const double dt,
+			const Eigen::MatrixXd &displacement,
+			const Eigen::MatrixXd &displacement_prev,
+			const Eigen::MatrixXd &v,
+			Eigen::MatrixXd &out) const override;
+
+		// diagonal of the hessian of energy (eg for Jacobi preconditioning)
+		void assemble_hessian_diagonal(
+			const bool is_volume,
+			const int n_basis,
+			const bool project_to_psd,
+			const std::vector<basis::ElementBases> &bases,
+			const std::vector<basis::ElementBases> &gbases,
+			const AssemblyValsCache &cache,
+			const double t,
+			const double dt,
+			const Eigen::MatrixXd &displacement,
+			const Eigen::MatrixXd &displacement_prev,
+			Eigen::MatrixXd &diag) const override;
+
 		virtual bool is_linear() const override { return false; }
 
 	protected:
@@ -297,6 +405,21 @@ namespace polyfem::assembler
 		virtual double compute_energy(const NonLinearAssemblerData &data) const = 0;
 		virtual Eigen::VectorXd assemble_gradient(const NonLinearAssemblerData &data) const = 0;
 		virtual Eigen::MatrixXd assemble_hessian(const NonLinearAssemblerData &data) const = 0;
+
+	private:
+		// assembles the gradient, and the energy of every element if energies is not null
+		void assemble_gradient_and_energies(
+			const bool is_volume,
+			const int n_basis,
+			const std::vector<basis::ElementBases> &bases,
+			const std::vector<basis::ElementBases> &gbases,
+			const AssemblyValsCache &cache,
+			const double t,
+			const double dt,
+			const Eigen::MatrixXd &displacement,
+			const Eigen::MatrixXd &displacement_prev,
+			Eigen::MatrixXd &rhs,
+			Eigen::VectorXd *energies) const;
 	};
 
 	class ElasticityAssembler : virtual public Assembler
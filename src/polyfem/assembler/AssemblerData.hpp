@@ -109,16 +109,31 @@ namespace polyfem::assembler
 			const basis::ElementBases &bs,
 			const basis::ElementBases &gbs,
 			const Eigen::MatrixXd &local_pts,
-			const Eigen::MatrixXd &fun)
-			: t(t), el_id(el_id), bs(bs), gbs(gbs), local_pts(local_pts), fun(fun)
+			const Eigen::MatrixXd &fun,
+			const ElementAssemblyValues *vals = nullptr)
+			: t(t), el_id(el_id), bs(bs), gbs(gbs), local_pts(local_pts), fun(fun), vals(vals)
 		{
 		}
 
+		/// values of the element at local_pts, the precomputed ones if available otherwise computed in tmp
+		const ElementAssemblyValues &element_values(const bool is_volume, ElementAssemblyValues &tmp) const
+		{
+			if (vals)
+			{
+				assert(vals->element_id == el_id && vals->val.rows() == local_pts.rows());
+				return *vals;
+			}
+			tmp.compute(el_id, is_volume, local_pts, bs, gbs);
+			return tmp;
+		}
+
 		const double t;
 		const int el_id;
 		const basis::ElementBases &bs;
 		const basis::ElementBases &gbs;
 		const Eigen::MatrixXd &local_pts;
 		const Eigen::MatrixXd &fun;
+		/// optional precomputed values at local_pts (e.g., cached between the time steps)
+		const ElementAssemblyValues *vals;
 	};
 } // namespace polyfem::assembler
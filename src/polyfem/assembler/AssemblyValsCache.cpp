@@ -1,6 +1,9 @@
 #include "AssemblyValsCache.hpp"
 
 #include <polyfem/utils/MaybeParallelFor.hpp>
+#include <polyfem/utils/Logger.hpp>
+
+#include <unordered_map>
 
 namespace polyfem
 {
@@ -8,31 +11,158 @@ namespace polyfem
 
 	namespace assembler
 	{
-		void AssemblyValsCache::init(const bool is_volume, const std::vector<ElementBases> &bases, const std::vector<ElementBases> &gbases, const bool is_mass)
+		namespace
+		{
+			/// geometric mapping at the quadrature points, same as ElementAssemblyValues::finalize2d/3d
+			template <int DIM>
+			void map_reference(const ElementBases &gbasis, const std::vector<AssemblyValues> &gbasis_values, Eigen::MatrixXd &val, Eigen::VectorXd &det, Eigen::VectorXd &jac_it)
+			{
+				const int n_pts = gbasis_values.empty() ? 0 : gbasis_values[0].val.rows();
+
+				val.setZero(n_pts, DIM);
+				det.resize(n_pts);
+				jac_it.resize(n_pts * DIM * DIM);
+
+				Eigen::Matrix<double, DIM, DIM> tmp;
+				for (long k = 0; k < n_pts; ++k)
+				{
+					tmp.setZero();
+					for (int j = 0; j < gbasis_values.size(); ++j)
+					{
+						const Basis &b = gbasis.bases[j];
+						for (std::size_t ii = 0; ii < b.global().size(); ++ii)
+						{
+							val.row(k) += gbasis_values[j].val(k) * b.global()[ii].node * b.global()[ii].val;
+							for (int d = 0; d < DIM; ++d)
+								tmp.row(d) += gbasis_values[j].grad(k, d) * b.global()[ii].node * b.global()[ii].val;
+						}
+					}
+
+					det(k) = tmp.determinant();
+					Eigen::Map<Eigen::Matrix<double, DIM, DIM>>(jac_it.data() + k * DIM * DIM) = tmp.inverse().transpose();
+				}
+			}
+		} // namespace
+
+		void AssemblyValsCache::init(const bool is_volume, const std::vector<ElementBases> &bases, const std::vector<ElementBases> &gbases, const bool is_mass, const Layout layout)
 		{
 			is_mass_ = is_mass;
+			layout_ = layout;
 			const int n_bases = bases.size();
-			cache.resize(n_bases);
+			cache.clear();
+			packed_cache.clear();
+			references_.clear();
+			mapped_cache_.clear();
+
+			if (layout_ == Layout::REFERENCE)
+			{
+				if (init_reference(bases, gbases))
+					return;
+
+				logger().warn("Some elements have element specific bases, using the full cache layout");
+				layout_ = Layout::FULL;
+			}
+
+			const bool packed = layout_ == Layout::PACKED;
+			if (packed)
+				packed_cache.resize(n_bases);
+			else
+				cache.resize(n_bases);
 
 			// loop over elements
 			utils::maybe_parallel_for(n_bases, [&](int start, int end, int thread_id) {
+				ElementAssemblyValues tmp;
 				for (int e = start; e < end; ++e)
 				{
+					ElementAssemblyValues &vals = packed ? tmp : cache[e];
 					if (is_mass_)
 					{
-						auto &quadrature = cache[e].quadrature;
+						auto &quadrature = vals.quadrature;
 						bases[e].compute_mass_quadrature(quadrature);
-						cache[e].compute(e, is_volume, quadrature.points, bases[e], gbases[e]);
+						vals.compute(e, is_volume, quadrature.points, bases[e], gbases[e]);
 					}
 					else
-						cache[e].compute(e, is_volume, bases[e], gbases[e]);
+						vals.compute(e, is_volume, bases[e], gbases[e]);
+
+					if (packed)
+						packed_cache[e].pack(vals);
 				}
 			});
 		}
 
+		bool AssemblyValsCache::init_reference(const std::vector<ElementBases> &bases, const std::vector<ElementBases> &gbases)
+		{
+			const int n_bases = bases.size();
+			mapped_cache_.resize(n_bases);
+
+			// evaluates the bases once per distinct reference element
+			std::unordered_map<std::string, int> reference_ids;
+			for (int e = 0; e < n_bases; ++e)
+			{
+				const ElementBases &basis = bases[e];
+				const ElementBases &gbasis = gbases[e];
+				const bool same_geometry = &basis == &gbasis;
+				if (basis.reference_key.empty() || gbasis.reference_key.empty() || !gbasis.has_parameterization)
+				{
+					mapped_cache_.clear();
+					references_.clear();
+					return false;
+				}
+
+				const std::string key = same_geometry ? basis.reference_key : (basis.reference_key + "/" + gbasis.reference_key);
+				const auto it = reference_ids.find(key);
+				if (it != reference_ids.end())
+				{
+					mapped_cache_[e].reference = it->second;
+					continue;
+				}
+
+				mapped_cache_[e].reference = references_.size();
+				reference_ids[key] = references_.size();
+				references_.emplace_back();
+
+				ReferenceValues &ref = references_.back();
+				if (is_mass_)
+					basis.compute_mass_quadrature(ref.quadrature);
+				else
+					basis.compute_quadrature(ref.quadrature);
+
+				basis.evaluate_bases(ref.quadrature.points, ref.basis_values);
+				basis.evaluate_grads(ref.quadrature.points, ref.basis_values);
+				if (!same_geometry)
+				{
+					gbasis.evaluate_bases(ref.quadrature.points, ref.gbasis_values);
+					gbasis.evaluate_grads(ref.quadrature.points, ref.gbasis_values);
+				}
+			}
+
+			// per element only the geometric mapping is stored
+			utils::maybe_parallel_for(n_bases, [&](int start, int end, int thread_id) {
+				for (int e = start; e < end; ++e)
+				{
+					MappedValues &m = mapped_cache_[e];
+					const ReferenceValues &ref = references_[m.reference];
+					const auto &gbasis_values = ref.gbasis_values.empty() ? ref.basis_values : ref.gbasis_values;
+
+					if (ref.quadrature.points.cols() == 3)
+						map_reference<3>(gbases[e], gbasis_values, m.val, m.det, m.jac_it);
+					else
+						map_reference<2>(gbases[e], gbasis_values, m.val, m.det, m.jac_it);
+				}
+			});
+
+			logger().debug("{} reference elements for {} elements", references_.size(), n_bases);
+
+			return true;
+		}
+
 		void AssemblyValsCache::compute(const int el_index, const bool is_volume, const ElementBases &basis, const ElementBases &gbasis, ElementAssemblyValues &vals) const
 		{
-			if (cache.empty())
+			if (!mapped_cache_.empty())
+				compute_reference(el_index, basis, vals);
+			else if (!packed_cache.empty())
+				packed_cache[el_index].unpack(vals);
+			else if (cache.empty())
 			{
 				if (is_mass_)
 				{
@@ -46,6 +176,65 @@ namespace polyfem
 			else
 				vals = cache[el_index];
 		}
+
+		void AssemblyValsCache::compute_reference(const int el_index, const ElementBases &basis, ElementAssemblyValues &vals) const
+		{
+			const MappedValues &m = mapped_cache_[el_index];
+			const ReferenceValues &ref = references_[m.reference];
+			const int n_pts = m.det.size();
+			const int dim = m.val.cols();
+
+			vals.element_id = el_index;
+			vals.has_parameterization = true;
+			vals.quadrature = ref.quadrature;
+			vals.val = m.val;
+			vals.det = m.det;
+
+			vals.jac_it.resize(n_pts);
+			for (int k = 0; k < n_pts; ++k)
+				vals.jac_it[k] = Eigen::Map<const Eigen::MatrixXd>(m.jac_it.data() + k * dim * dim, dim, dim);
+
+			// grad_t_m is not stored, it is recomputed from the reference gradients
+			assert(basis.bases.size() == ref.basis_values.size());
+			vals.basis_values.resize(ref.basis_values.size());
+			for (int j = 0; j < ref.basis_values.size(); ++j)
+			{
+				const AssemblyValues &r = ref.basis_values[j];
+				AssemblyValues &v = vals.basis_values[j];
+
+				v.global = basis.bases[j].global();
+				v.val = r.val;
+				v.grad = r.grad;
+				v.grad_t_m.resize(n_pts, dim);
+				for (int k = 0; k < n_pts; ++k)
+					v.grad_t_m.row(k) = r.grad.row(k) * vals.jac_it[k];
+			}
+
+			vals.grad_t_m_table.resize(0);
+		}
+
+		size_t AssemblyValsCache::memory() const
+		{
+			size_t res = 0;
+			for (const auto &vals : cache)
+				res += vals.memory();
+			for (const auto &vals : packed_cache)
+				res += vals.memory();
+
+			for (const auto &ref : references_)
+			{
+				res += sizeof(double) * (ref.quadrature.points.size() + ref.quadrature.weights.size());
+				for (const auto &v : ref.basis_values)
+					res += sizeof(double) * (v.val.size() + v.grad.size());
+				for (const auto &v : ref.gbasis_values)
+					res += sizeof(double) * (v.val.size() + v.grad.size());
+			}
+			res += mapped_cache_.capacity() * sizeof(MappedValues);
+			for (const auto &m : mapped_cache_)
+				res += sizeof(double) * (m.val.size() + m.det.size() + m.jac_it.size());
+
+			return res;
+		}
 	} // namespace assembler
 
 } // namespace polyfem
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <polyfem/assembler/ElementAssemblyValues.hpp>
+#include <polyfem/assembler/ElementColoring.hpp>
 
 namespace polyfem
 {
@@ -10,25 +11,77 @@ namespace polyfem
 		class AssemblyValsCache
 		{
 		public:
+			/// how the values are stored in the cache
+			enum class Layout
+			{
+				FULL,     ///< one ElementAssemblyValues per element
+				PACKED,   ///< one contiguous buffer per element
+				REFERENCE ///< basis values shared by the elements with the same reference element, only the geometric mapping per element
+			};
+
 			/// computes the basis evaluation and geometric mapping
 			/// for each of the given ElementBases in bases
-			/// initializes cache member
-			void init(const bool is_volume, const std::vector<basis::ElementBases> &bases, const std::vector<basis::ElementBases> &gbases, const bool is_mass = false);
+			/// initializes the cache with the given layout
+			void init(const bool is_volume, const std::vector<basis::ElementBases> &bases, const std::vector<basis::ElementBases> &gbases, const bool is_mass = false, const Layout layout = Layout::FULL);
 
 			/// retrieves cached basis evaluation and geometric for the given element
 			/// if it doesn't exist, computes and caches it (modifies cache member in the latter case)
 			void compute(const int el_index, const bool is_volume, const basis::ElementBases &basis, const basis::ElementBases &gbasis, ElementAssemblyValues &vals) const;
 
+			/// computes an element coloring from the bases connectivity, used by the assemblers
+			/// to scatter directly in the global vector/matrix (independent of the cached values)
+			void init_coloring(const std::vector<basis::ElementBases> &bases) { coloring_.init(bases); }
+
 			void clear()
 			{
 				cache.clear();
+				packed_cache.clear();
+				references_.clear();
+				mapped_cache_.clear();
+				coloring_.clear();
 			}
 
 			inline bool is_mass() const { return is_mass_; }
+			inline Layout layout() const { return layout_; }
+
+			/// element coloring, empty if init_coloring has not been called
+			inline const ElementColoring &coloring() const { return coloring_; }
+
+			/// number of distinct reference elements, 0 if the layout is not REFERENCE
+			inline int n_references() const { return references_.size(); }
+
+			/// heap memory used by the cached values (in bytes)
+			size_t memory() const;
 
 		private:
-			std::vector<ElementAssemblyValues> cache; ///< vector of basis values and geometric mapping with one entry per element
+			/// basis (and geometric basis) values and gradients at the quadrature points of a reference element
+			struct ReferenceValues
+			{
+				quadrature::Quadrature quadrature;
+				std::vector<AssemblyValues> basis_values;
+				std::vector<AssemblyValues> gbasis_values; ///< empty if the geometric bases are the bases
+			};
+
+			/// per element geometric mapping of the REFERENCE layout
+			struct MappedValues
+			{
+				int reference = -1;     ///< index in references_
+				Eigen::MatrixXd val;    ///< mapped quadrature points
+				Eigen::VectorXd det;    ///< jacobian determinant at the quadrature points
+				Eigen::VectorXd jac_it; ///< inverse transpose jacobians, dim x dim column major per quadrature point
+			};
+
+			/// builds references_ and mapped_cache_, returns false if some elements have no reference key
+			bool init_reference(const std::vector<basis::ElementBases> &bases, const std::vector<basis::ElementBases> &gbases);
+			void compute_reference(const int el_index, const basis::ElementBases &basis, ElementAssemblyValues &vals) const;
+
+			std::vector<ElementAssemblyValues> cache;              ///< vector of basis values and geometric mapping with one entry per element
+			std::vector<PackedElementAssemblyValues> packed_cache; ///< same as cache but each element is stored in a contiguous buffer
+			std::vector<ReferenceValues> references_;              ///< values of the distinct reference elements (REFERENCE layout)
+			std::vector<MappedValues> mapped_cache_;               ///< geometric mapping with one entry per element (REFERENCE layout)
+			ElementColoring coloring_;                             ///< element coloring for race-free parallel assembly
 			bool is_mass_;
+			Layout layout_ = Layout::FULL;
 		};
 	} // namespace assembler
 } // namespace polyfem
@@ -21,6 +21,21 @@ namespace polyfem
 			det.setConstant(1); // volume (det of the geometric mapping)
 			for (std::size_t j = 0; j < basis_values.size(); ++j)
 				basis_values[j].grad_t_m = basis_values[j].grad; // / scaling
+
+			grad_t_m_table.resize(0);
+		}
+
+		size_t ElementAssemblyValues::memory() const
+		{
+			size_t res = sizeof(double) * (quadrature.points.size() + quadrature.weights.size() + val.size() + det.size() + grad_t_m_table.size());
+			res += jac_it.capacity() * sizeof(jac_it[0]);
+			res += basis_values.capacity() * sizeof(AssemblyValues);
+			for (const AssemblyValues &v : basis_values)
+			{
+				res += sizeof(double) * (v.val.size() + v.grad.size() + v.grad_t_m.size());
+				res += v.global.capacity() * sizeof(basis::Local2Global);
+			}
+			return res;
 		}
 
 		bool ElementAssemblyValues::is_geom_mapping_positive(const Eigen::MatrixXd &dx, const Eigen::MatrixXd &dy, const Eigen::MatrixXd &dz) const
@@ -99,6 +114,8 @@ namespace polyfem
 				for (std::size_t j = 0; j < basis_values.size(); ++j)
 					basis_values[j].grad_t_m.row(k) = basis_values[j].grad.row(k) * jac_it[k];
 			}
+
+			grad_t_m_table.resize(0);
 		}
 
 		void ElementAssemblyValues::finalize2d(const ElementBases &gbasis, const std::vector<AssemblyValues> &gbasis_values)
@@ -140,6 +157,8 @@ namespace polyfem
 				for (std::size_t j = 0; j < basis_values.size(); ++j)
 					basis_values[j].grad_t_m.row(k) = basis_values[j].grad.row(k) * jac_it[k];
 			}
+
+			grad_t_m_table.resize(0);
 		}
 
 		void ElementAssemblyValues::compute(const int el_index, const bool is_volume, const ElementBases &basis, const ElementBases &gbasis)
@@ -263,5 +282,117 @@ namespace polyfem
 
 			return is_volume ? is_geom_mapping_positive(dxmv, dymv, dzmv) : is_geom_mapping_positive(dxmv, dymv);
 		}
+
+		void PackedElementAssemblyValues::pack(const ElementAssemblyValues &vals)
+		{
+			element_id_ = vals.element_id;
+			has_parameterization_ = vals.has_parameterization;
+			n_pts_ = vals.det.size();
+			n_bases_ = vals.basis_values.size();
+			dim_ = n_bases_ == 0 ? 0 : vals.basis_values[0].grad.cols();
+			pts_dim_ = vals.quadrature.points.cols();
+			val_dim_ = vals.val.cols();
+
+			assert(vals.quadrature.points.rows() == n_pts_);
+			assert(vals.jac_it.size() == n_pts_);
+
+			jac_dim_ = n_pts_ == 0 ? 0 : vals.jac_it[0].rows();
+			data_.resize(n_pts_ * (pts_dim_ + 1 + val_dim_ + 1 + jac_dim_ * jac_dim_ + n_bases_ * (1 + 2 * dim_)));
+
+			auto it = data_.begin();
+			const auto copy = [&it](const double *ptr, const int size) { it = std::copy(ptr, ptr + size, it); };
+
+			copy(vals.quadrature.points.data(), vals.quadrature.points.size());
+			copy(vals.quadrature.weights.data(), vals.quadrature.weights.size());
+			copy(vals.val.data(), vals.val.size());
+			copy(vals.det.data(), vals.det.size());
+			for (const auto &j : vals.jac_it)
+			{
+				assert(j.rows() == jac_dim_ && j.cols() == jac_dim_);
+				copy(j.data(), j.size());
+			}
+
+			for (int q = 0; q < n_pts_; ++q)
+				for (int j = 0; j < n_bases_; ++j)
+					*it++ = vals.basis_values[j].val(q);
+			for (int q = 0; q < n_pts_; ++q)
+				for (int j = 0; j < n_bases_; ++j)
+					for (int d = 0; d < dim_; ++d)
+						*it++ = vals.basis_values[j].grad(q, d);
+
+			for (int q = 0; q < n_pts_; ++q)
+				for (int j = 0; j < n_bases_; ++j)
+					for (int d = 0; d < dim_; ++d)
+						*it++ = vals.basis_values[j].grad_t_m(q, d);
+			assert(it == data_.end());
+
+			global_.clear();
+			global_offsets_.resize(n_bases_ + 1);
+			global_offsets_[0] = 0;
+			for (int j = 0; j < n_bases_; ++j)
+			{
+				const auto &g = vals.basis_values[j].global;
+				global_.insert(global_.end(), g.begin(), g.end());
+				global_offsets_[j + 1] = global_.size();
+			}
+			global_.shrink_to_fit();
+		}
+
+		void PackedElementAssemblyValues::unpack(ElementAssemblyValues &vals) const
+		{
+			vals.element_id = element_id_;
+			vals.has_parameterization = has_parameterization_;
+
+			const double *ptr = data_.data();
+
+			vals.quadrature.points = Eigen::Map<const Eigen::MatrixXd>(ptr, n_pts_, pts_dim_);
+			ptr += vals.quadrature.points.size();
+			vals.quadrature.weights = Eigen::Map<const Eigen::VectorXd>(ptr, n_pts_);
+			ptr += n_pts_;
+			vals.val = Eigen::Map<const Eigen::MatrixXd>(ptr, n_pts_, val_dim_);
+			ptr += vals.val.size();
+			vals.det = Eigen::Map<const Eigen::VectorXd>(ptr, n_pts_);
+			ptr += n_pts_;
+
+			vals.jac_it.resize(n_pts_);
+			for (int q = 0; q < n_pts_; ++q)
+			{
+				vals.jac_it[q] = Eigen::Map<const Eigen::MatrixXd>(ptr, jac_dim_, jac_dim_);
+				ptr += jac_dim_ * jac_dim_;
+			}
+
+			vals.basis_values.resize(n_bases_);
+			for (int j = 0; j < n_bases_; ++j)
+			{
+				AssemblyValues &v = vals.basis_values[j];
+				v.global.assign(global_.begin() + global_offsets_[j], global_.begin() + global_offsets_[j + 1]);
+				v.val.resize(n_pts_, 1);
+				v.grad.resize(n_pts_, dim_);
+				v.grad_t_m.resize(n_pts_, dim_);
+			}
+
+			for (int q = 0; q < n_pts_; ++q)
+				for (int j = 0; j < n_bases_; ++j)
+					vals.basis_values[j].val(q) = *ptr++;
+			for (int q = 0; q < n_pts_; ++q)
+				for (int j = 0; j < n_bases_; ++j)
+					for (int d = 0; d < dim_; ++d)
+						vals.basis_values[j].grad(q, d) = *ptr++;
+
+			vals.grad_t_m_table = Eigen::Map<const Eigen::VectorXd>(ptr, n_pts_ * n_bases_ * dim_);
+			for (int q = 0; q < n_pts_; ++q)
+				for (int j = 0; j < n_bases_; ++j)
+					for (int d = 0; d < dim_; ++d)
+						vals.basis_values[j].grad_t_m(q, d) = *ptr++;
+
+			assert(ptr == data_.data() + data_.size());
+		}
+
+		size_t PackedElementAssemblyValues::memory() const
+		{
+			return data_.capacity() * sizeof(double)
+				   + global_.capacity() * sizeof(basis::Local2Global)
+				   + global_offsets_.capacity() * sizeof(int);
+		}
 	} // namespace assembler
 } // namespace polyfem
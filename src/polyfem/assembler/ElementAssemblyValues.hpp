@@ -13,6 +13,8 @@ namespace polyfem
 		class ElementAssemblyValues
 		{
 		public:
+			typedef Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> RowMatrixXd;
+
 			// m = number of quadrature points
 
 			// vector of basis values and gradients at quadrature points for this element
@@ -34,6 +36,36 @@ namespace polyfem
 			// only poly elements have no parameterization
 			bool has_parameterization = true;
 
+			// J^{-T}*∇φ of all the bases packed contiguously per quadrature point, laid out as [qp × basis × dim]
+			// only filled by the packed cache (where it is the storage of the gradients), empty otherwise
+			Eigen::VectorXd grad_t_m_table; // R^{m * n_bases * dim}
+
+			/// gradients J^{-T}*∇φ of all the bases at quadrature point q as a (n_bases x dim) matrix,
+			/// read from grad_t_m_table if it is filled, gathered from the basis_values otherwise
+			template <typename Derived>
+			void grad_t_m_at(const int q, Eigen::MatrixBase<Derived> &out) const
+			{
+				const int n_bases = basis_values.size();
+				if (n_bases == 0)
+				{
+					out.derived().resize(0, out.cols());
+					return;
+				}
+
+				const int dim = basis_values[0].grad_t_m.cols();
+				out.derived().resize(n_bases, dim);
+				if (grad_t_m_table.size() > 0)
+				{
+					assert(grad_t_m_table.size() == det.size() * n_bases * dim);
+					out = Eigen::Map<const RowMatrixXd>(grad_t_m_table.data() + q * n_bases * dim, n_bases, dim);
+				}
+				else
+				{
+					for (int j = 0; j < n_bases; ++j)
+						out.row(j) = basis_values[j].grad_t_m.row(q);
+				}
+			}
+
 			/// computes the per element values at the local (ref el) points (pts)
 			/// sets basis_values, jac_it, val, and det members
 			void compute(const int el_index, const bool is_volume, const Eigen::MatrixXd &pts, const basis::ElementBases &basis, const basis::ElementBases &gbasis);
@@ -44,6 +76,9 @@ namespace polyfem
 			/// check if the element is flipped
 			bool is_geom_mapping_positive(const bool is_volume, const basis::ElementBases &gbasis) const;
 
+			/// heap memory used by the per basis and per quadrature point values (in bytes)
+			size_t memory() const;
+
 		private:
 			std::vector<AssemblyValues> g_basis_values_cache_;
 
@@ -59,5 +94,35 @@ namespace polyfem
 			bool is_geom_mapping_positive(const Eigen::MatrixXd &dx, const Eigen::MatrixXd &dy, const Eigen::MatrixXd &dz) const;
 			bool is_geom_mapping_positive(const Eigen::MatrixXd &dx, const Eigen::MatrixXd &dy) const;
 		};
+
+		/// ElementAssemblyValues stored in a single contiguous buffer, the basis values and gradients are
+		/// laid out as [qp × basis] and [qp × basis × dim]. Used by AssemblyValsCache to avoid the
+		/// per basis allocations of the values of every element.
+		class PackedElementAssemblyValues
+		{
+		public:
+			/// copies all the values of vals in the packed buffer
+			void pack(const ElementAssemblyValues &vals);
+			/// restores vals, reusing its memory when the sizes match
+			void unpack(ElementAssemblyValues &vals) const;
+
+			/// heap memory used (in bytes)
+			size_t memory() const;
+
+		private:
+			int element_id_ = -1;
+			bool has_parameterization_ = true;
+			int n_pts_ = 0;   ///< number of quadrature points
+			int n_bases_ = 0; ///< number of local bases
+			int dim_ = 0;     ///< dimension of the gradients
+			int pts_dim_ = 0; ///< dimension of the quadrature points
+			int val_dim_ = 0; ///< dimension of the mapped points
+			int jac_dim_ = 0; ///< size of the inverse transpose jacobians
+
+			/// [points | weights | val | det | jac_it | basis val | basis grad | basis grad_t_m]
+			std::vector<double> data_;
+			std::vector<basis::Local2Global> global_; ///< local to global of all the bases
+			std::vector<int> global_offsets_;         ///< start of the local to global of each basis in global_
+		};
 	} // namespace assembler
 } // namespace polyfem
@@ -0,0 +1,84 @@
+#include "ElementColoring.hpp"
+
+#include <polyfem/utils/MaybeParallelFor.hpp>
+#include <polyfem/utils/Logger.hpp>
+
+#include <algorithm>
+
+namespace polyfem::assembler
+{
+	void ElementColoring::init(const std::vector<basis::ElementBases> &bases)
+	{
+		clear();
+
+		const int n_elements = bases.size();
+		if (n_elements == 0)
+			return;
+
+		// global node to elements adjacency
+		std::vector<std::vector<int>> node_elements;
+		for (int e = 0; e < n_elements; ++e)
+		{
+			for (const basis::Basis &b : bases[e].bases)
+			{
+				for (const auto &g : b.global())
+				{
+					if (g.index >= node_elements.size())
+						node_elements.resize(g.index + 1);
+					auto &elements = node_elements[g.index];
+					if (elements.empty() || elements.back() != e)
+						elements.push_back(e);
+				}
+			}
+		}
+
+		// greedy coloring, each element takes the smallest color not used by its neighbours
+		element_color_.assign(n_elements, -1);
+		std::vector<int> color_used_by; // last element marking each color
+		int n_colors = 0;
+		for (int e = 0; e < n_elements; ++e)
+		{
+			for (const basis::Basis &b : bases[e].bases)
+			{
+				for (const auto &g : b.global())
+				{
+					for (const int other : node_elements[g.index])
+					{
+						const int c = element_color_[other];
+						if (c >= 0)
+							color_used_by[c] = e;
+					}
+				}
+			}
+
+			int c = 0;
+			while (c < n_colors && color_used_by[c] == e)
+				++c;
+
+			if (c == n_colors)
+			{
+				++n_colors;
+				color_used_by.push_back(-1);
+			}
+
+			element_color_[e] = c;
+		}
+
+		colors_.resize(n_colors);
+		for (int e = 0; e < n_elements; ++e)
+			colors_[element_color_[e]].push_back(e);
+
+		logger().debug("Element coloring: {} elements, {} colors", n_elements, n_colors);
+	}
+
+	void ElementColoring::parallel_for(const std::function<void(int e, int thread_id)> &body) const
+	{
+		for (const std::vector<int> &elements : colors_)
+		{
+			utils::maybe_parallel_for(elements.size(), [&](int start, int end, int thread_id) {
+				for (int i = start; i < end; ++i)
+					body(elements[i], thread_id);
+			});
+		}
+	}
+} // namespace polyfem::assembler
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <polyfem/basis/ElementBases.hpp>
+
+#include <functional>
+#include <vector>
+
+namespace polyfem::assembler
+{
+	/// Greedy coloring of the elements such that two elements with the same color
+	/// do not share any global node. Elements of one color can be assembled
+	/// concurrently directly into the global vector/matrix without races.
+	class ElementColoring
+	{
+	public:
+		/// builds the coloring from the element to global node connectivity of the bases
+		void init(const std::vector<basis::ElementBases> &bases);
+
+		void clear()
+		{
+			colors_.clear();
+			element_color_.clear();
+		}
+
+		inline bool empty() const { return colors_.empty(); }
+		inline int n_colors() const { return colors_.size(); }
+		inline int n_elements() const { return element_color_.size(); }
+
+		/// list of elements with the given color
+		inline const std::vector<int> &elements(const int color) const { return colors_[color]; }
+		/// color of element e
+		inline int color(const int e) const { return element_color_[e]; }
+
+		/// loops over all elements one color after the other,
+		/// the elements of a color are processed in parallel
+		void parallel_for(const std::function<void(int e, int thread_id)> &body) const;
+
+	private:
+		std::vector<std::vector<int>> colors_; ///< elements of each color
+		std::vector<int> element_color_;       ///< color of each element
+	};
+} // namespace polyfem::assembler
@@ -250,8 +250,8 @@ namespace polyfem::assembler
 
 		all.resize(local_pts.rows(), all_size);
 
-		ElementAssemblyValues vals;
-		vals.compute(el_id, size() == 3, local_pts, bs, gbs);
+		ElementAssemblyValues tmp_vals;
+		const ElementAssemblyValues &vals = data.element_values(size() == 3, tmp_vals);
 		const auto I = Eigen::MatrixXd::Identity(size(), size());
 
 		for (long p = 0; p < local_pts.rows(); ++p)
@@ -344,18 +344,12 @@ namespace polyfem::assembler
 		Eigen::Matrix<double, n_basis, dim> G(data.vals.basis_values.size(), size());
 		G.setZero();
 
+		Eigen::Matrix<double, n_basis, dim> delF_delU(data.vals.basis_values.size(), size());
+
 		for (long p = 0; p < n_pts; ++p)
 		{
-			Eigen::Matrix<double, n_basis, dim> grad(data.vals.basis_values.size(), size());
-
-			for (size_t i = 0; i < data.vals.basis_values.size(); ++i)
-			{
-				grad.row(i) = data.vals.basis_values[i].grad.row(p);
-			}
-
-			const Eigen::Matrix<double, dim, dim> jac_it = data.vals.jac_it[p];
-
-			const Eigen::Matrix<double, n_basis, dim> delF_delU = grad * jac_it;
+			// J^{-T} grad phi of all the bases at p
+			data.vals.grad_t_m_at(p, delF_delU);
 
 			// Id + grad d
 			def_grad = local_disp.transpose() * delF_delU + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
@@ -401,26 +395,22 @@ namespace polyfem::assembler
 
 		Eigen::Matrix<double, dim, dim> def_grad(size(), size());
 
+		Eigen::Matrix<double, n_basis, dim> delF_delU(data.vals.basis_values.size(), size());
+
 		for (long p = 0; p < n_pts; ++p)
 		{
-			Eigen::Matrix<double, n_basis, dim> grad(data.vals.basis_values.size(), size());
-
-			for (size_t i = 0; i < data.vals.basis_values.size(); ++i)
-			{
-				grad.row(i) = data.vals.basis_values[i].grad.row(p);
-			}
-
-			Eigen::Matrix<double, dim, dim> jac_it = data.vals.jac_it[p];
+			// J^{-T} grad phi of all the bases at p
+			data.vals.grad_t_m_at(p, delF_delU);
 
 			// Id + grad d
-			def_grad = local_disp.transpose() * grad * jac_it + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
+			def_grad = local_disp.transpose() * delF_delU + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
 
 			double lambda, mu;
 			params_.lambda_mu(data.vals.quadrature.points.row(p), data.vals.val.row(p), data.t, data.vals.element_id, lambda, mu);
 
 			Eigen::Matrix<double, dim * dim, dim * dim> hessian_temp = compute_stiffness_from_def_grad(def_grad, lambda, mu);
 
-			Eigen::Matrix<double, dim * dim, N> delF_delU_tensor(jac_it.size(), grad.size());
+			Eigen::Matrix<double, dim * dim, N> delF_delU_tensor(size() * size(), delF_delU.size());
 
 			for (size_t i = 0; i < local_disp.rows(); ++i)
 			{
@@ -428,8 +418,7 @@ namespace polyfem::assembler
 				{
 					Eigen::Matrix<double, dim, dim> temp(size(), size());
 					temp.setZero();
-					temp.row(j) = grad.row(i);
-					temp = temp * jac_it;
+					temp.row(j) = delF_delU.row(i);
 					Eigen::Matrix<double, dim * dim, 1> temp_flattened(Eigen::Map<Eigen::Matrix<double, dim * dim, 1>>(temp.data(), temp.size()));
 					delF_delU_tensor.col(i * size() + j) = temp_flattened;
 				}
@@ -41,8 +41,8 @@ namespace polyfem::assembler
 
 		Eigen::Matrix<Diff, Eigen::Dynamic, Eigen::Dynamic, 0, 3, 3> def_grad(size(), size());
 
-		ElementAssemblyValues vals;
-		vals.compute(el_id, size() == 3, local_pts, bs, gbs);
+		ElementAssemblyValues tmp_vals;
+		const ElementAssemblyValues &vals = data.element_values(size() == 3, tmp_vals);
 
 		for (long p = 0; p < local_pts.rows(); ++p)
 		{
@@ -126,6 +126,38 @@ namespace polyfem::assembler
 			[&](const NonLinearAssemblerData &data) { return compute_energy_aux<DScalar2<double, Eigen::VectorXd, Eigen::MatrixXd>>(data); });
 	}
 
+	template <typename Derived>
+	void GenericElastic<Derived>::compute_flux(
+		const double t,
+		const ElementAssemblyValues &vals,
+		const Eigen::MatrixXd &grad_u,
+		Eigen::MatrixXd &flux) const
+	{
+		typedef DScalar1<double, Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 9, 1>> Diff;
+
+		assert(grad_u.cols() == size() * size());
+		flux.resize(grad_u.rows(), grad_u.cols());
+
+		// only the size^2 entries of F are variables, instead of all the element dofs
+		DiffScalarBase::setVariableCount(size() * size());
+		DefGradMatrix<Diff> def_grad(size(), size());
+
+		for (long p = 0; p < grad_u.rows(); ++p)
+		{
+			for (int i = 0; i < size(); ++i)
+				for (int j = 0; j < size(); ++j)
+					def_grad(i, j) = Diff(i + j * size(), grad_u(p, i * size() + j) + (i == j ? 1 : 0));
+
+			const Diff energy = derived().elastic_energy(vals.val.row(p), t, vals.element_id, def_grad);
+
+			// P_ij = dW(F) / dF_ij
+			const auto &grad = energy.getGradient();
+			for (int i = 0; i < size(); ++i)
+				for (int j = 0; j < size(); ++j)
+					flux(p, i * size() + j) = grad(i + j * size());
+		}
+	}
+
 	template <typename Derived>
 	void GenericElastic<Derived>::compute_stress_grad_multiply_mat(
 		const OptAssemblerData &data,
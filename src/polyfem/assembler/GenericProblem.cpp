@@ -70,6 +70,22 @@ namespace polyfem
 			return val;
 		}
 
+		void TensorBCValue::eval(const Eigen::MatrixXd &pts, const int dim, const double t, Eigen::VectorXd &out, const int el_id) const
+		{
+			value[dim].evaluate(pts, t, out, el_id);
+
+			if (interpolation.empty())
+			{
+			}
+			else if (interpolation.size() == 1)
+				out *= interpolation[0]->eval(t);
+			else
+			{
+				assert(dim < interpolation.size());
+				out *= interpolation[dim]->eval(t);
+			}
+		}
+
 		double ScalarBCValue::eval(const RowVectorNd &pts, const double t) const
 		{
 			assert(pts.size() == 2 || pts.size() == 3);
@@ -77,6 +93,12 @@ namespace polyfem
 			return value(x, y, z, t) * interpolation->eval(t);
 		}
 
+		void ScalarBCValue::eval(const Eigen::MatrixXd &pts, const double t, Eigen::VectorXd &out) const
+		{
+			value.evaluate(pts, t, out);
+			out *= interpolation->eval(t);
+		}
+
 		GenericTensorProblem::GenericTensorProblem(const std::string &name)
 			: Problem(name), is_all_(false)
 		{
@@ -182,14 +204,11 @@ namespace polyfem
 				return;
 			}
 
-			const bool planar = pts.cols() == 2;
-			for (int i = 0; i < pts.rows(); ++i)
+			Eigen::VectorXd tmp;
+			for (int j = 0; j < pts.cols(); ++j)
 			{
-				for (int j = 0; j < pts.cols(); ++j)
-				{
-					double x = pts(i, 0), y = pts(i, 1), z = planar ? 0 : pts(i, 2);
-					val(i, j) = rhs_[j](x, y, z, t);
-				}
+				rhs_[j].evaluate(pts, t, tmp);
+				val.col(j) = tmp;
 			}
 		}
 
@@ -221,30 +240,61 @@ namespace polyfem
 		{
 			val = Eigen::MatrixXd::Zero(pts.rows(), mesh.dimension());
 
-			for (long i = 0; i < pts.rows(); ++i)
+			// the points usually belong to a single boundary primitive, in that case they are evaluated as a block
+			const TensorBCValue *block_bc = nullptr;
+			if (is_all_)
+			{
+				assert(displacements_.size() == 1);
+				block_bc = &displacements_[0];
+			}
+			else if (pts.rows() > 0)
 			{
-				if (is_all_)
+				const int id = mesh.get_boundary_id(global_ids(0));
+				bool same_id = true;
+				for (long i = 1; i < pts.rows() && same_id; ++i)
+					same_id = mesh.get_boundary_id(global_ids(i)) == id;
+
+				if (same_id)
 				{
-					assert(displacements_.size() == 1);
-					for (int d = 0; d < val.cols(); ++d)
+					for (size_t b = 0; b < boundary_ids_.size(); ++b)
 					{
-						val(i, d) = displacements_[0].eval(pts.row(i), d, t);
+						if (id == boundary_ids_[b])
+						{
+							block_bc = &displacements_[b];
+							break;
+						}
 					}
+
+					// no matching boundary, the values are zero
+					if (block_bc == nullptr)
+						return;
 				}
-				else
+			}
+
+			if (block_bc)
+			{
+				Eigen::VectorXd tmp;
+				for (int d = 0; d < val.cols(); ++d)
 				{
-					const int id = mesh.get_boundary_id(global_ids(i));
-					for (size_t b = 0; b < boundary_ids_.size(); ++b)
+					block_bc->eval(pts, d, t, tmp);
+					val.col(d) = tmp;
+				}
+				return;
+			}
+
+			for (long i = 0; i < pts.rows(); ++i)
+			{
+				const int id = mesh.get_boundary_id(global_ids(i));
+				for (size_t b = 0; b < boundary_ids_.size(); ++b)
+				{
+					if (id == boundary_ids_[b])
 					{
-						if (id == boundary_ids_[b])
+						for (int d = 0; d < val.cols(); ++d)
 						{
-							for (int d = 0; d < val.cols(); ++d)
-							{
-								val(i, d) = displacements_[b].eval(pts.row(i), d, t);
-							}
-
-							break;
+							val(i, d) = displacements_[b].eval(pts.row(i), d, t);
 						}
+
+						break;
 					}
 				}
 			}
@@ -314,16 +364,13 @@ namespace polyfem
 		void GenericTensorProblem::exact(const Eigen::MatrixXd &pts, const double t, Eigen::MatrixXd &val) const
 		{
 			assert(has_exact_sol());
-			const bool planar = pts.cols() == 2;
 			val.resize(pts.rows(), pts.cols());
 
-			for (int i = 0; i < pts.rows(); ++i)
+			Eigen::VectorXd tmp;
+			for (int j = 0; j < pts.cols(); ++j)
 			{
-				for (int j = 0; j < pts.cols(); ++j)
-				{
-					double x = pts(i, 0), y = pts(i, 1), z = planar ? 0 : pts(i, 2);
-					val(i, j) = exact_[j](x, y, z, t);
-				}
+				exact_[j].evaluate(pts, t, tmp);
+				val.col(j) = tmp;
 			}
 		}
 
@@ -1315,35 +1362,33 @@ namespace polyfem
 				val.setZero();
 				return;
 			}
-			const bool planar = pts.cols() == 2;
-			for (int i = 0; i < pts.rows(); ++i)
-			{
-				double x = pts(i, 0), y = pts(i, 1), z = planar ? 0 : pts(i, 2);
-				val(i) = rhs_(x, y, z, t);
-			}
+			Eigen::VectorXd tmp;
+			rhs_.evaluate(pts, t, tmp);
+			val.col(0) = tmp;
 		}
 
 		void GenericScalarProblem::dirichlet_bc(const mesh::Mesh &mesh, const Eigen::MatrixXi &global_ids, const Eigen::MatrixXd &uv, const Eigen::MatrixXd &pts, const double t, Eigen::MatrixXd &val) const
 		{
 			val = Eigen::MatrixXd::Zero(pts.rows(), 1);
 
+			if (is_all_)
+			{
+				assert(dirichlet_.size() == 1);
+				Eigen::VectorXd tmp;
+				dirichlet_[0].eval(pts, t, tmp);
+				val.col(0) = tmp;
+				return;
+			}
+
 			for (long i = 0; i < pts.rows(); ++i)
 			{
 				const int id = mesh.get_boundary_id(global_ids(i));
-				if (is_all_)
-				{
-					assert(dirichlet_.size() == 1);
-					val(i) = dirichlet_[0].eval(pts.row(i), t);
-				}
-				else
+				for (size_t b = 0; b < boundary_ids_.size(); ++b)
 				{
-					for (size_t b = 0; b < boundary_ids_.size(); ++b)
+					if (id == boundary_ids_[b])
 					{
-						if (id == boundary_ids_[b])
-						{
-							val(i) = dirichlet_[b].eval(pts.row(i), t);
-							break;
-						}
+						val(i) = dirichlet_[b].eval(pts.row(i), t);
+						break;
 					}
 				}
 			}
@@ -1404,14 +1449,11 @@ namespace polyfem
 		void GenericScalarProblem::exact(const Eigen::MatrixXd &pts, const double t, Eigen::MatrixXd &val) const
 		{
 			assert(has_exact_sol());
-			const bool planar = pts.cols() == 2;
 			val.resize(pts.rows(), 1);
 
-			for (int i = 0; i < pts.rows(); ++i)
-			{
-				double x = pts(i, 0), y = pts(i, 1), z = pts.cols() == 2 ? 0 : pts(i, 2);
-				val(i) = exact_(x, y, z, t);
-			}
+			Eigen::VectorXd tmp;
+			exact_.evaluate(pts, t, tmp);
+			val.col(0) = tmp;
 		}
 
 		void GenericScalarProblem::exact_grad(const Eigen::MatrixXd &pts, const double t, Eigen::MatrixXd &val) const
@@ -21,6 +21,8 @@ namespace polyfem
 			}
 
 			double eval(const RowVectorNd &pts, const int dim, const double t, const int el_id = -1) const;
+			/// evaluates the dim-th component at every row of pts
+			void eval(const Eigen::MatrixXd &pts, const int dim, const double t, Eigen::VectorXd &out, const int el_id = -1) const;
 		};
 
 		struct ScalarBCValue
@@ -34,6 +36,8 @@ namespace polyfem
 			}
 
 			double eval(const RowVectorNd &pts, const double t) const;
+			/// evaluates the value at every row of pts
+			void eval(const Eigen::MatrixXd &pts, const double t, Eigen::VectorXd &out) const;
 		};
 
 		class GenericTensorProblem : public Problem
@@ -52,6 +56,7 @@ namespace polyfem
 				}
 				return true;
 			}
+			bool is_rhs_thread_safe() const override { return true; }
 
 			void dirichlet_bc(const mesh::Mesh &mesh, const Eigen::MatrixXi &global_ids, const Eigen::MatrixXd &uv, const Eigen::MatrixXd &pts, const double t, Eigen::MatrixXd &val) const override;
 			void neumann_bc(const mesh::Mesh &mesh, const Eigen::MatrixXi &global_ids, const Eigen::MatrixXd &uv, const Eigen::MatrixXd &pts, const Eigen::MatrixXd &normals, const double t, Eigen::MatrixXd &val) const override;
@@ -160,6 +165,7 @@ namespace polyfem
 
 			void rhs(const assembler::Assembler &assembler, const Eigen::MatrixXd &pts, const double t, Eigen::MatrixXd &val) const override;
 			bool is_rhs_zero() const override { return rhs_.is_zero(); }
+			bool is_rhs_thread_safe() const override { return true; }
 
 			void dirichlet_bc(const mesh::Mesh &mesh, const Eigen::MatrixXi &global_ids, const Eigen::MatrixXd &uv, const Eigen::MatrixXd &pts, const double t, Eigen::MatrixXd &val) const override;
 			void neumann_bc(const mesh::Mesh &mesh, const Eigen::MatrixXi &global_ids, const Eigen::MatrixXd &uv, const Eigen::MatrixXd &pts, const Eigen::MatrixXd &normals, const double t, Eigen::MatrixXd &val) const override;
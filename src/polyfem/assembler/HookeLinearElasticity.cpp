@@ -215,8 +215,8 @@ namespace polyfem::assembler
 
 		all.resize(local_pts.rows(), all_size);
 
-		ElementAssemblyValues vals;
-		vals.compute(el_id, size() == 3, local_pts, bs, gbs);
+		ElementAssemblyValues tmp_vals;
+		const ElementAssemblyValues &vals = data.element_values(size() == 3, tmp_vals);
 
 		for (long p = 0; p < local_pts.rows(); ++p)
 		{
@@ -72,8 +72,8 @@ namespace polyfem::assembler
 
 		Eigen::MatrixXd displacement_grad(size(), size());
 
-		ElementAssemblyValues vals;
-		vals.compute(el_id, size() == 3, local_pts, bs, gbs);
+		ElementAssemblyValues tmp_vals;
+		const ElementAssemblyValues &vals = data.element_values(size() == 3, tmp_vals);
 
 		for (long p = 0; p < local_pts.rows(); ++p)
 		{
@@ -37,6 +37,10 @@ namespace polyfem
 										 const Eigen::MatrixXd &displacement,
 										 Eigen::MatrixXd &tensor) const override;
 
+			/// the flux is the gradient itself, enables the sum-factorized stiffness
+			bool has_flux() const override { return true; }
+			void compute_flux(const double t, const ElementAssemblyValues &vals, const Eigen::MatrixXd &grad_u, Eigen::MatrixXd &flux) const override { flux = grad_u; }
+
 			/// kernel of the pde, used in kernel problem
 			Eigen::Matrix<AutodiffScalarGrad, Eigen::Dynamic, 1, 0, 3, 1> kernel(const int dim, const AutodiffGradPt &rvect, const AutodiffScalarGrad &r) const override;
 		};
@@ -175,6 +175,32 @@ namespace polyfem
 			}
 		}
 
+		void LinearElasticity::compute_flux(const double t,
+											const ElementAssemblyValues &vals,
+											const Eigen::MatrixXd &grad_u,
+											Eigen::MatrixXd &flux) const
+		{
+			assert(grad_u.cols() == size() * size());
+			flux.resize(grad_u.rows(), grad_u.cols());
+
+			Eigen::VectorXd lambdas, mus;
+			params_.lambda_mu(vals.quadrature.points, vals.val, t, vals.element_id, lambdas, mus);
+
+			Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0, 3, 3> strain(size(), size());
+			for (long p = 0; p < grad_u.rows(); ++p)
+			{
+				for (int i = 0; i < size(); ++i)
+					for (int j = 0; j < size(); ++j)
+						strain(i, j) = (grad_u(p, i * size() + j) + grad_u(p, j * size() + i)) / 2;
+
+				// sigma = 2 mu eps + lambda tr(eps) Id
+				const double trace = strain.trace();
+				for (int i = 0; i < size(); ++i)
+					for (int j = 0; j < size(); ++j)
+						flux(p, i * size() + j) = 2 * mus(p) * strain(i, j) + (i == j ? lambdas(p) * trace : 0);
+			}
+		}
+
 		void LinearElasticity::assign_stress_tensor(
 			const OutputData &data,
 			const int all_size,
@@ -194,8 +220,8 @@ namespace polyfem
 
 			Eigen::MatrixXd displacement_grad(size(), size());
 
-			ElementAssemblyValues vals;
-			vals.compute(el_id, size() == 3, local_pts, bs, gbs);
+			ElementAssemblyValues tmp_vals;
+			const ElementAssemblyValues &vals = data.element_values(size() == 3, tmp_vals);
 
 			for (long p = 0; p < local_pts.rows(); ++p)
 			{
@@ -22,6 +22,32 @@ namespace polyfem::assembler
 		return res;
 	}
 
+	bool Mass::assemble_local(const ElementAssemblyValues &vals, const QuadratureVector &da, const double t, Eigen::MatrixXd &local) const
+	{
+		const int n_pts = da.size();
+		const int n_loc_bases = vals.basis_values.size();
+
+		// the density is evaluated once for all the quadrature points of the element
+		Eigen::VectorXd rho_da;
+		density_.evaluate(vals.quadrature.points, vals.val, t, vals.element_id, rho_da);
+		rho_da.array() *= da.array();
+
+		Eigen::MatrixXd phi(n_pts, n_loc_bases);
+		for (int i = 0; i < n_loc_bases; ++i)
+			phi.col(i) = vals.basis_values[i].val;
+
+		// phi_i * phi_j weighted by rho and the quadrature weights
+		const Eigen::MatrixXd scalar_mass = phi.transpose() * rho_da.asDiagonal() * phi;
+
+		local.setZero(n_loc_bases * size(), n_loc_bases * size());
+		for (int i = 0; i < n_loc_bases; ++i)
+			for (int j = 0; j < n_loc_bases; ++j)
+				for (int d = 0; d < size(); ++d)
+					local(i * size() + d, j * size() + d) = scalar_mass(i, j);
+
+		return true;
+	}
+
 	Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 3, 1> Mass::compute_rhs(const AutodiffHessianPt &pt) const
 	{
 		assert(false);
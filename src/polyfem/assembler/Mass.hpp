@@ -17,6 +17,9 @@ namespace polyfem::assembler
 		Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 9, 1>
 		assemble(const LinearAssemblerData &data) const override;
 
+		/// local mass matrix of the whole element, the density is evaluated once per element
+		bool assemble_local(const ElementAssemblyValues &vals, const QuadratureVector &da, const double t, Eigen::MatrixXd &local) const override;
+
 		/// uses autodiff to compute the rhs for a fabricated solution
 		/// in this case it just return pt.getHessian().trace()
 		/// pt is the evaluation of the solution at a point
@@ -347,6 +347,43 @@ namespace polyfem::assembler
 		assert(!std::isinf(mu));
 	}
 
+	void LameParameters::lambda_mu(const Eigen::MatrixXd &param, const Eigen::MatrixXd &p, double t, int el_id, Eigen::VectorXd &lambda, Eigen::VectorXd &mu) const
+	{
+		assert(lambda_or_E_.size() == 1 || el_id < lambda_or_E_.size());
+		assert(mu_or_nu_.size() == 1 || el_id < mu_or_nu_.size());
+		assert(size_ == 2 || size_ == 3);
+		assert(param.rows() == p.rows());
+
+		if (lambda_mat_.size() > el_id && mu_mat_.size() > el_id)
+		{
+			lambda.setConstant(p.rows(), lambda_mat_(el_id));
+			mu.setConstant(p.rows(), mu_mat_(el_id));
+			return;
+		}
+
+		const auto &tmp1 = lambda_or_E_.size() == 1 ? lambda_or_E_[0] : lambda_or_E_[el_id];
+		const auto &tmp2 = mu_or_nu_.size() == 1 ? mu_or_nu_[0] : mu_or_nu_[el_id];
+
+		tmp1.evaluate(p, t, lambda, el_id);
+		tmp2.evaluate(p, t, mu, el_id);
+
+		if (!is_lambda_mu_)
+		{
+			for (int i = 0; i < p.rows(); ++i)
+			{
+				const double llambda = lambda(i);
+				const double mmu = mu(i);
+				lambda(i) = convert_to_lambda(size_ == 3, llambda, mmu);
+				mu(i) = convert_to_mu(llambda, mmu);
+			}
+		}
+
+		assert(!lambda.hasNaN());
+		assert(!mu.hasNaN());
+		assert(lambda.allFinite());
+		assert(mu.allFinite());
+	}
+
 	void LameParameters::add_multimaterial(const int index, const json &params, const bool is_volume, const std::string &stress_unit)
 	{
 		const int size = is_volume ? 3 : 2;
@@ -407,6 +444,16 @@ namespace polyfem::assembler
 		return res;
 	}
 
+	void Density::evaluate(const Eigen::MatrixXd &param, const Eigen::MatrixXd &p, double t, int el_id, Eigen::VectorXd &out) const
+	{
+		assert(rho_.size() == 1 || el_id < rho_.size());
+		assert(param.rows() == p.rows());
+
+		const auto &tmp = rho_.size() == 1 ? rho_[0] : rho_[el_id];
+		tmp.evaluate(p, t, out, el_id);
+		assert(out.allFinite());
+	}
+
 	void Density::add_multimaterial(const int index, const json &params, const std::string &density_unit)
 	{
 		for (int i = rho_.size(); i <= index; ++i)
@@ -82,6 +82,8 @@ namespace polyfem::assembler
 				t,
 				el_id, lambda, mu);
 		}
+		/// lambda and mu at every row of p (the points of one element), param are the corresponding local points
+		void lambda_mu(const Eigen::MatrixXd &param, const Eigen::MatrixXd &p, double t, int el_id, Eigen::VectorXd &lambda, Eigen::VectorXd &mu) const;
 
 		Eigen::MatrixXd lambda_mat_, mu_mat_;
 
@@ -110,6 +112,8 @@ namespace polyfem::assembler
 						   p(0), p(1), p.size() == 3 ? p(2) : 0.0,
 						   t, el_id);
 		}
+		/// density at every row of p (the points of one element), param are the corresponding local points
+		virtual void evaluate(const Eigen::MatrixXd &param, const Eigen::MatrixXd &p, double t, int el_id, Eigen::VectorXd &out) const;
 
 	private:
 		void set_rho(const json &rho);
@@ -131,5 +135,10 @@ namespace polyfem::assembler
 		{
 			return 1.0;
 		}
+
+		void evaluate(const Eigen::MatrixXd &param, const Eigen::MatrixXd &p, double t, int el_id, Eigen::VectorXd &out) const override
+		{
+			out.setOnes(p.rows());
+		}
 	};
 } // namespace polyfem::assembler
\ No newline at end of file
@@ -177,8 +177,8 @@ namespace polyfem::assembler
 
 		all.resize(local_pts.rows(), all_size);
 
-		ElementAssemblyValues vals;
-		vals.compute(el_id, size() == 3, local_pts, bs, gbs);
+		ElementAssemblyValues tmp_vals;
+		const ElementAssemblyValues &vals = data.element_values(size() == 3, tmp_vals);
 		const auto I = Eigen::MatrixXd::Identity(size(), size());
 
 		for (long p = 0; p < local_pts.rows(); ++p)
@@ -427,19 +427,15 @@ namespace polyfem::assembler
 		Eigen::Matrix<double, n_basis, dim> G(data.vals.basis_values.size(), size());
 		G.setZero();
 
+		Eigen::Matrix<double, n_basis, dim> delF_delU(data.vals.basis_values.size(), size());
+
 		for (long p = 0; p < n_pts; ++p)
 		{
-			Eigen::Matrix<double, n_basis, dim> grad(data.vals.basis_values.size(), size());
-
-			for (size_t i = 0; i < data.vals.basis_values.size(); ++i)
-			{
-				grad.row(i) = data.vals.basis_values[i].grad.row(p);
-			}
-
-			Eigen::Matrix<double, dim, dim> jac_it = data.vals.jac_it[p];
+			// J^{-T} grad phi of all the bases at p
+			data.vals.grad_t_m_at(p, delF_delU);
 
 			// Id + grad d
-			def_grad = local_disp.transpose() * grad * jac_it + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
+			def_grad = local_disp.transpose() * delF_delU + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
 			def_grad_T = def_grad.transpose();
 
 			const double t = 0;
@@ -451,7 +447,6 @@ namespace polyfem::assembler
 			Eigen::Matrix<double, dim, dim> gradient_temp;
 			autogen::generate_gradient_templated<dim>(c1, c2, c3, d1, def_grad_T, gradient_temp);
 
-			Eigen::Matrix<double, n_basis, dim> delF_delU = grad * jac_it;
 			Eigen::Matrix<double, n_basis, dim> gradient = delF_delU * gradient_temp.transpose();
 			G.noalias() += gradient * data.da(p);
 		}
@@ -487,19 +482,15 @@ namespace polyfem::assembler
 
 		Eigen::Matrix<double, dim, dim> def_grad(size(), size());
 
+		Eigen::Matrix<double, n_basis, dim> delF_delU(data.vals.basis_values.size(), size());
+
 		for (long p = 0; p < n_pts; ++p)
 		{
-			Eigen::Matrix<double, n_basis, dim> grad(data.vals.basis_values.size(), size());
-
-			for (size_t i = 0; i < data.vals.basis_values.size(); ++i)
-			{
-				grad.row(i) = data.vals.basis_values[i].grad.row(p);
-			}
-
-			Eigen::Matrix<double, dim, dim> jac_it = data.vals.jac_it[p];
+			// J^{-T} grad phi of all the bases at p
+			data.vals.grad_t_m_at(p, delF_delU);
 
 			// Id + grad d
-			def_grad = local_disp.transpose() * grad * jac_it + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
+			def_grad = local_disp.transpose() * delF_delU + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
 
 			const double t = 0;
 			const double c1 = c1_(data.vals.val.row(p), t, data.vals.element_id);
@@ -535,7 +526,7 @@ namespace polyfem::assembler
 			}
 			*/
 
-			Eigen::Matrix<double, dim * dim, N> delF_delU_tensor(jac_it.size(), grad.size());
+			Eigen::Matrix<double, dim * dim, N> delF_delU_tensor(size() * size(), delF_delU.size());
 
 			for (size_t i = 0; i < local_disp.rows(); ++i)
 			{
@@ -543,8 +534,7 @@ namespace polyfem::assembler
 				{
 					Eigen::Matrix<double, dim, dim> temp(size(), size());
 					temp.setZero();
-					temp.row(j) = grad.row(i);
-					temp = temp * jac_it;
+					temp.row(j) = delF_delU.row(i);
 					Eigen::Matrix<double, dim * dim, 1> temp_flattened(Eigen::Map<Eigen::Matrix<double, dim * dim, 1>>(temp.data(), temp.size()));
 					delF_delU_tensor.col(i * size() + j) = temp_flattened;
 				}
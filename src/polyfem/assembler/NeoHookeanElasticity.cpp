@@ -113,6 +113,33 @@ namespace polyfem::assembler
 		return gradient;
 	}
 
+	void NeoHookeanElasticity::compute_flux(const double t,
+											const ElementAssemblyValues &vals,
+											const Eigen::MatrixXd &grad_u,
+											Eigen::MatrixXd &flux) const
+	{
+		assert(grad_u.cols() == size() * size());
+		flux.resize(grad_u.rows(), grad_u.cols());
+
+		Eigen::VectorXd lambdas, mus;
+		params_.lambda_mu(vals.quadrature.points, vals.val, t, vals.element_id, lambdas, mus);
+
+		Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0, 3, 3> def_grad(size(), size());
+		for (long p = 0; p < grad_u.rows(); ++p)
+		{
+			for (int i = 0; i < size(); ++i)
+				for (int j = 0; j < size(); ++j)
+					def_grad(i, j) = grad_u(p, i * size() + j) + (i == j ? 1 : 0);
+
+			// P = mu (F - F^-T) + lambda log(J) F^-T
+			const Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, 0, 3, 3> FmT = def_grad.inverse().transpose();
+			const double log_det_j = std::log(def_grad.determinant());
+			for (int i = 0; i < size(); ++i)
+				for (int j = 0; j < size(); ++j)
+					flux(p, i * size() + j) = mus(p) * (def_grad(i, j) - FmT(i, j)) + lambdas(p) * log_det_j * FmT(i, j);
+		}
+	}
+
 	void NeoHookeanElasticity::compute_stiffness_value(const double t,
 													   const assembler::ElementAssemblyValues &vals,
 													   const Eigen::MatrixXd &local_pts,
@@ -267,8 +294,8 @@ namespace polyfem::assembler
 
 		all.resize(local_pts.rows(), all_size);
 
-		ElementAssemblyValues vals;
-		vals.compute(el_id, size() == 3, local_pts, bs, gbs);
+		ElementAssemblyValues tmp_vals;
+		const ElementAssemblyValues &vals = data.element_values(size() == 3, tmp_vals);
 		const auto I = Eigen::MatrixXd::Identity(size(), size());
 
 		for (long p = 0; p < local_pts.rows(); ++p)
@@ -317,6 +344,10 @@ namespace polyfem::assembler
 		T energy = T(0.0);
 
 		const int n_pts = data.da.size();
+		// material parameters of the whole element, the expressions are evaluated as a block
+		Eigen::VectorXd lambdas, mus;
+		params_.lambda_mu(data.vals.quadrature.points, data.vals.val, data.t, data.vals.element_id, lambdas, mus);
+
 		for (long p = 0; p < n_pts; ++p)
 		{
 			compute_disp_grad_at_quad(data, local_disp, p, size(), def_grad);
@@ -325,8 +356,7 @@ namespace polyfem::assembler
 			for (int d = 0; d < size(); ++d)
 				def_grad(d, d) += T(1);
 
-			double lambda, mu;
-			params_.lambda_mu(data.vals.quadrature.points.row(p), data.vals.val.row(p), data.t, data.vals.element_id, lambda, mu);
+			const double lambda = lambdas(p), mu = mus(p);
 
 			const T log_det_j = log(polyfem::utils::determinant(def_grad));
 			const T val = mu / 2 * ((def_grad.transpose() * def_grad).trace() - size() - 2 * log_det_j) + lambda / 2 * log_det_j * log_det_j;
@@ -389,23 +419,22 @@ namespace polyfem::assembler
 		}
 
 		Eigen::Matrix<double, dim, dim> def_grad(size(), size());
+		Eigen::Matrix<double, n_basis, dim> delF_delU(data.vals.basis_values.size(), size());
 
 		Eigen::Matrix<double, n_basis, dim> G(data.vals.basis_values.size(), size());
 		G.setZero();
 
+		// material parameters of the whole element, the expressions are evaluated as a block
+		Eigen::VectorXd lambdas, mus;
+		params_.lambda_mu(data.vals.quadrature.points, data.vals.val, data.t, data.vals.element_id, lambdas, mus);
+
 		for (long p = 0; p < n_pts; ++p)
 		{
-			Eigen::Matrix<double, n_basis, dim> grad(data.vals.basis_values.size(), size());
-
-			for (size_t i = 0; i < data.vals.basis_values.size(); ++i)
-			{
-				grad.row(i) = data.vals.basis_values[i].grad.row(p);
-			}
-
-			Eigen::Matrix<double, dim, dim> jac_it = data.vals.jac_it[p];
+			// J^{-T} grad phi of all the bases at p
+			data.vals.grad_t_m_at(p, delF_delU);
 
 			// Id + grad d
-			def_grad = local_disp.transpose() * grad * jac_it + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
+			def_grad = local_disp.transpose() * delF_delU + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
 
 			const double J = def_grad.determinant();
 			const double log_det_j = log(J);
@@ -438,10 +467,7 @@ namespace polyfem::assembler
 				delJ_delF.col(2) = cross<dim>(u, v);
 			}
 
-			double lambda, mu;
-			params_.lambda_mu(data.vals.quadrature.points.row(p), data.vals.val.row(p), data.t, data.vals.element_id, lambda, mu);
-
-			Eigen::Matrix<double, n_basis, dim> delF_delU = grad * jac_it;
+			const double lambda = lambdas(p), mu = mus(p);
 
 			Eigen::Matrix<double, dim, dim> gradient_temp = mu * def_grad - mu * (1 / J) * delJ_delF + lambda * log_det_j * (1 / J) * delJ_delF;
 			Eigen::Matrix<double, n_basis, dim> gradient = delF_delU * gradient_temp.transpose();
@@ -481,20 +507,19 @@ namespace polyfem::assembler
 		}
 
 		Eigen::Matrix<double, dim, dim> def_grad(size(), size());
+		Eigen::Matrix<double, n_basis, dim> delF_delU(data.vals.basis_values.size(), size());
+
+		// material parameters of the whole element, the expressions are evaluated as a block
+		Eigen::VectorXd lambdas, mus;
+		params_.lambda_mu(data.vals.quadrature.points, data.vals.val, data.t, data.vals.element_id, lambdas, mus);
 
 		for (long p = 0; p < n_pts; ++p)
 		{
-			Eigen::Matrix<double, n_basis, dim> grad(data.vals.basis_values.size(), size());
-
-			for (size_t i = 0; i < data.vals.basis_values.size(); ++i)
-			{
-				grad.row(i) = data.vals.basis_values[i].grad.row(p);
-			}
-
-			Eigen::Matrix<double, dim, dim> jac_it = data.vals.jac_it[p];
+			// J^{-T} grad phi of all the bases at p
+			data.vals.grad_t_m_at(p, delF_delU);
 
 			// Id + grad d
-			def_grad = local_disp.transpose() * grad * jac_it + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
+			def_grad = local_disp.transpose() * delF_delU + Eigen::Matrix<double, dim, dim>::Identity(size(), size());
 
 			const double J = def_grad.determinant();
 			double log_det_j = log(J);
@@ -538,8 +563,7 @@ namespace polyfem::assembler
 				del2J_delF2.template block<dim, dim>(6, 3) = hat<dim>(u);
 			}
 
-			double lambda, mu;
-			params_.lambda_mu(data.vals.quadrature.points.row(p), data.vals.val.row(p), data.t, data.vals.element_id, lambda, mu);
+			const double lambda = lambdas(p), mu = mus(p);
 
 			Eigen::Matrix<double, dim * dim, dim * dim> id = Eigen::Matrix<double, dim * dim, dim * dim>::Identity(size() * size(), size() * size());
 
@@ -547,7 +571,7 @@ namespace polyfem::assembler
 
 			Eigen::Matrix<double, dim * dim, dim * dim> hessian_temp = (mu * id) + (((mu + lambda * (1 - log_det_j)) / (J * J)) * (g_j * g_j.transpose())) + (((lambda * log_det_j - mu) / (J)) * del2J_delF2);
 
-			Eigen::Matrix<double, dim * dim, N> delF_delU_tensor(jac_it.size(), grad.size());
+			Eigen::Matrix<double, dim * dim, N> delF_delU_tensor(size() * size(), delF_delU.size());
 
 			for (size_t i = 0; i < local_disp.rows(); ++i)
 			{
@@ -555,8 +579,7 @@ namespace polyfem::assembler
 				{
 					Eigen::Matrix<double, dim, dim> temp(size(), size());
 					temp.setZero();
-					temp.row(j) = grad.row(i);
-					temp = temp * jac_it;
+					temp.row(j) = delF_delU.row(i);
 					Eigen::Matrix<double, dim * dim, 1> temp_flattened(Eigen::Map<Eigen::Matrix<double, dim * dim, 1>>(temp.data(), temp.size()));
 					delF_delU_tensor.col(i * size() + j) = temp_flattened;
 				}
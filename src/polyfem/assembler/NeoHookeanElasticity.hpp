@@ -31,6 +31,13 @@ namespace polyfem::assembler
 									 const Eigen::MatrixXd &displacement,
 									 Eigen::MatrixXd &tensor) const override;
 
+		// first Piola-Kirchhoff stress at the quadrature points, used by the sum-factorized kernels
+		bool has_flux() const override { return true; }
+		void compute_flux(const double t,
+						  const ElementAssemblyValues &vals,
+						  const Eigen::MatrixXd &grad_u,
+						  Eigen::MatrixXd &flux) const override;
+
 		void compute_stress_grad_multiply_mat(const OptAssemblerData &data,
 											  const Eigen::MatrixXd &mat,
 											  Eigen::MatrixXd &stress,
@@ -7,6 +7,8 @@
 #include <ipc/utils/eigen_ext.hpp>
 #include <polysolve/linear/Solver.hpp>
 
+#include <mutex>
+
 namespace polyfem
 {
 	using namespace polysolve;
@@ -29,6 +31,13 @@ namespace polyfem
 					val = 0;
 				}
 			};
+
+			class LocalThreadRhsStorage
+			{
+			public:
+				Eigen::MatrixXd rhs_fun;
+				ElementAssemblyValues vals;
+			};
 		} // namespace
 
 		RhsAssembler::RhsAssembler(const Assembler &assembler, const Mesh &mesh, const Obstacle &obstacle,
@@ -64,12 +73,12 @@ namespace polyfem
 			rhs = Eigen::MatrixXd::Zero(n_basis_ * size_, 1);
 			if (!problem_.is_rhs_zero())
 			{
-				Eigen::MatrixXd rhs_fun;
-
 				const int n_elements = int(bases_.size());
-				ElementAssemblyValues vals;
-				for (int e = 0; e < n_elements; ++e)
-				{
+				const bool rhs_thread_safe = problem_.is_rhs_thread_safe();
+				std::mutex rhs_mutex;
+
+				// integrates the rhs function against the local bases of element e and adds it to out
+				const auto assemble_element = [&](const int e, ElementAssemblyValues &vals, Eigen::MatrixXd &rhs_fun, Eigen::MatrixXd &out) {
 					// vals.compute(e, mesh_.is_volume(), bases_[e], gbases_[e]);
 
 					// compute geometric mapping
@@ -79,7 +88,13 @@ namespace polyfem
 					const Quadrature &quadrature = vals.quadrature;
 
 					// compute rhs values in physical space
-					problem_.rhs(assembler_, vals.val, t, rhs_fun);
+					if (rhs_thread_safe)
+						problem_.rhs(assembler_, vals.val, t, rhs_fun);
+					else
+					{
+						std::lock_guard<std::mutex> lock(rhs_mutex);
+						problem_.rhs(assembler_, vals.val, t, rhs_fun);
+					}
 
 					for (int d = 0; d < size_; ++d)
 					{
@@ -104,9 +119,26 @@ namespace polyfem
 							const double rhs_value = (rhs_fun.col(d).array() * v.val.array()).sum();
 							for (std::size_t ii = 0; ii < v.global.size(); ++ii)
 								// add local contribution to the global rhs vector (with some weight for non-conforming bases)
-								rhs(v.global[ii].index * size_ + d) += rhs_value * v.global[ii].val;
+								out(v.global[ii].index * size_ + d) += rhs_value * v.global[ii].val;
 						}
 					}
+				};
+
+				if (!ass_vals_cache_.coloring().empty())
+				{
+					// elements of the same color do not share nodes, scatter directly in rhs
+					auto storage = create_thread_storage(LocalThreadRhsStorage());
+					ass_vals_cache_.coloring().parallel_for([&](int e, int thread_id) {
+						LocalThreadRhsStorage &local_storage = get_local_thread_storage(storage, thread_id);
+						assemble_element(e, local_storage.vals, local_storage.rhs_fun, rhs);
+					});
+				}
+				else
+				{
+					Eigen::MatrixXd rhs_fun;
+					ElementAssemblyValues vals;
+					for (int e = 0; e < n_elements; ++e)
+						assemble_element(e, vals, rhs_fun, rhs);
 				}
 			}
 		}
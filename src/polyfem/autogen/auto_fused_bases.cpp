@@ -0,0 +1,4178 @@
+#include "auto_fused_bases.hpp"
+
+#include <cassert>
+
+namespace polyfem {
+namespace autogen {
+namespace {
+void p_0_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 1);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0.setOnes();
+		val.col(0) = result_0.matrix();
+	}
+}
+
+void p_1_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 3);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = -x - y + 1;
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = x;
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = y;
+		val.col(2) = result_0.matrix();
+	}
+}
+
+void p_2_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 6);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = (x + y - 1) * (2 * x + 2 * y - 1);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = x * (2 * x - 1);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = y * (2 * y - 1);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = -4 * x * (x + y - 1);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = 4 * x * y;
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = -4 * y * (x + y - 1);
+		val.col(5) = result_0.matrix();
+	}
+}
+
+void p_3_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 10);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		result_0 = -27.0 / 2.0 * helper_0 * y + 9 * helper_0 - 27.0 / 2.0 * helper_1 * x + 9 * helper_1 - 9.0 / 2.0 * pow(x, 3) + 18 * x * y - 11.0 / 2.0 * x - 9.0 / 2.0 * pow(y, 3) - 11.0 / 2.0 * y + 1;
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 2.0) * x * (9 * pow(x, 2) - 9 * x + 2);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 2.0) * y * (9 * pow(y, 2) - 9 * y + 2);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * x * (x + y - 1) * (3 * x + 3 * y - 2);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = -9.0 / 2.0 * x * (3 * pow(x, 2) + 3 * x * y - 4 * x - y + 1);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * x * y * (3 * x - 1);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * x * y * (3 * y - 1);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = -9.0 / 2.0 * y * (3 * x * y - x + 3 * pow(y, 2) - 4 * y + 1);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * y * (x + y - 1) * (3 * x + 3 * y - 2);
+		val.col(8) = result_0.matrix();
+	}
+	{
+		result_0 = -27 * x * y * (x + y - 1);
+		val.col(9) = result_0.matrix();
+	}
+}
+
+void p_4_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 15);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(x, 3);
+		const auto helper_2 = pow(y, 2);
+		const auto helper_3 = pow(y, 3);
+		result_0 = 64 * helper_0 * helper_2 - 80 * helper_0 * y + (70.0 / 3.0) * helper_0 + (128.0 / 3.0) * helper_1 * y - 80.0 / 3.0 * helper_1 - 80 * helper_2 * x + (70.0 / 3.0) * helper_2 + (128.0 / 3.0) * helper_3 * x - 80.0 / 3.0 * helper_3 + (32.0 / 3.0) * pow(x, 4) + (140.0 / 3.0) * x * y - 25.0 / 3.0 * x + (32.0 / 3.0) * pow(y, 4) - 25.0 / 3.0 * y + 1;
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 3.0) * x * (32 * pow(x, 3) - 48 * pow(x, 2) + 22 * x - 3);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 3.0) * y * (32 * pow(y, 3) - 48 * pow(y, 2) + 22 * y - 3);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		result_0 = -16.0 / 3.0 * x * (24 * helper_0 * y - 18 * helper_0 + 24 * helper_1 * x - 18 * helper_1 + 8 * pow(x, 3) - 36 * x * y + 13 * x + 8 * pow(y, 3) + 13 * y - 3);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 32 * pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		result_0 = 4 * x * (helper_0 * y - helper_0 + 16 * helper_1 * x - 4 * helper_1 + 16 * pow(x, 3) - 36 * x * y + 19 * x + 7 * y - 3);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = pow(x, 2);
+		result_0 = -16.0 / 3.0 * x * (8 * helper_0 * y - 14 * helper_0 + 8 * pow(x, 3) - 6 * x * y + 7 * x + y - 1);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = (16.0 / 3.0) * x * y * (8 * pow(x, 2) - 6 * x + 1);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 4 * x;
+		result_0 = helper_0 * y * (-helper_0 + 16 * x * y - 4 * y + 1);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		result_0 = (16.0 / 3.0) * x * y * (8 * pow(y, 2) - 6 * y + 1);
+		val.col(8) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = pow(y, 2);
+		result_0 = -16.0 / 3.0 * y * (8 * helper_0 * x - 14 * helper_0 - 6 * x * y + x + 8 * pow(y, 3) + 7 * y - 1);
+		val.col(9) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = 32 * pow(y, 2);
+		result_0 = 4 * y * (16 * helper_0 * y - 4 * helper_0 + helper_1 * x - helper_1 - 36 * x * y + 7 * x + 16 * pow(y, 3) + 19 * y - 3);
+		val.col(10) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		result_0 = -16.0 / 3.0 * y * (24 * helper_0 * y - 18 * helper_0 + 24 * helper_1 * x - 18 * helper_1 + 8 * pow(x, 3) - 36 * x * y + 13 * x + 8 * pow(y, 3) + 13 * y - 3);
+		val.col(11) = result_0.matrix();
+	}
+	{
+		result_0 = 32 * x * y * (x + y - 1) * (4 * x + 4 * y - 3);
+		val.col(12) = result_0.matrix();
+	}
+	{
+		result_0 = -32 * x * y * (4 * y - 1) * (x + y - 1);
+		val.col(13) = result_0.matrix();
+	}
+	{
+		result_0 = -32 * x * y * (4 * x - 1) * (x + y - 1);
+		val.col(14) = result_0.matrix();
+	}
+}
+
+void p_0_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 2);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		result_0.setZero();
+		val.col(0) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(1) = result_0.matrix();
+		}
+	}
+}
+
+void p_1_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 6);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		result_0.setConstant(-1);
+		val.col(0) = result_0.matrix();
+		}
+		{
+		result_0.setConstant(-1);
+		val.col(1) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setOnes();
+		val.col(2) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(3) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(4) = result_0.matrix();
+		}
+		{
+		result_0.setOnes();
+		val.col(5) = result_0.matrix();
+		}
+	}
+}
+
+void p_2_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 12);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		result_0 = 4 * x + 4 * y - 3;
+		val.col(0) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * x + 4 * y - 3;
+		val.col(1) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 4 * x - 1;
+		val.col(2) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(3) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(4) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * y - 1;
+		val.col(5) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 4 * (-2 * x - y + 1);
+		val.col(6) = result_0.matrix();
+		}
+		{
+		result_0 = -4 * x;
+		val.col(7) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 4 * y;
+		val.col(8) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * x;
+		val.col(9) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -4 * y;
+		val.col(10) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * (-x - 2 * y + 1);
+		val.col(11) = result_0.matrix();
+		}
+	}
+}
+
+void p_3_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 20);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		result_0 = -27.0 / 2.0 * pow(x, 2) - 27 * x * y + 18 * x - 27.0 / 2.0 * pow(y, 2) + 18 * y - 11.0 / 2.0;
+		val.col(0) = result_0.matrix();
+		}
+		{
+		result_0 = -27.0 / 2.0 * pow(x, 2) - 27 * x * y + 18 * x - 27.0 / 2.0 * pow(y, 2) + 18 * y - 11.0 / 2.0;
+		val.col(1) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (27.0 / 2.0) * pow(x, 2) - 9 * x + 1;
+		val.col(2) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(3) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(4) = result_0.matrix();
+		}
+		{
+		result_0 = (27.0 / 2.0) * pow(y, 2) - 9 * y + 1;
+		val.col(5) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 9 * ((9.0 / 2.0) * pow(x, 2) + 6 * x * y - 5 * x + (3.0 / 2.0) * pow(y, 2) - 5.0 / 2.0 * y + 1);
+		val.col(6) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * x * (6 * x + 6 * y - 5);
+		val.col(7) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 9 * (-9.0 / 2.0 * pow(x, 2) - 3 * x * y + 4 * x + (1.0 / 2.0) * y - 1.0 / 2.0);
+		val.col(8) = result_0.matrix();
+		}
+		{
+		result_0 = -9.0 / 2.0 * x * (3 * x - 1);
+		val.col(9) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (9.0 / 2.0) * y * (6 * x - 1);
+		val.col(10) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * x * (3 * x - 1);
+		val.col(11) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (9.0 / 2.0) * y * (3 * y - 1);
+		val.col(12) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * x * (6 * y - 1);
+		val.col(13) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -9.0 / 2.0 * y * (3 * y - 1);
+		val.col(14) = result_0.matrix();
+		}
+		{
+		result_0 = 9 * (-3 * x * y + (1.0 / 2.0) * x - 9.0 / 2.0 * pow(y, 2) + 4 * y - 1.0 / 2.0);
+		val.col(15) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (9.0 / 2.0) * y * (6 * x + 6 * y - 5);
+		val.col(16) = result_0.matrix();
+		}
+		{
+		result_0 = 9 * ((3.0 / 2.0) * pow(x, 2) + 6 * x * y - 5.0 / 2.0 * x + (9.0 / 2.0) * pow(y, 2) - 5 * y + 1);
+		val.col(17) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -27 * y * (2 * x + y - 1);
+		val.col(18) = result_0.matrix();
+		}
+		{
+		result_0 = -27 * x * (x + 2 * y - 1);
+		val.col(19) = result_0.matrix();
+		}
+	}
+}
+
+void p_4_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 30);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		result_0 = 128 * helper_0 * y - 80 * helper_0 + 128 * helper_1 * x - 80 * helper_1 + (128.0 / 3.0) * pow(x, 3) - 160 * x * y + (140.0 / 3.0) * x + (128.0 / 3.0) * pow(y, 3) + (140.0 / 3.0) * y - 25.0 / 3.0;
+		val.col(0) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		result_0 = 128 * helper_0 * y - 80 * helper_0 + 128 * helper_1 * x - 80 * helper_1 + (128.0 / 3.0) * pow(x, 3) - 160 * x * y + (140.0 / 3.0) * x + (128.0 / 3.0) * pow(y, 3) + (140.0 / 3.0) * y - 25.0 / 3.0;
+		val.col(1) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (128.0 / 3.0) * pow(x, 3) - 48 * pow(x, 2) + (44.0 / 3.0) * x - 1;
+		val.col(2) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(3) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(4) = result_0.matrix();
+		}
+		{
+		result_0 = (128.0 / 3.0) * pow(y, 3) - 48 * pow(y, 2) + (44.0 / 3.0) * y - 1;
+		val.col(5) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		result_0 = -384 * helper_0 * y + 288 * helper_0 - 256 * helper_1 * x + 96 * helper_1 - 512.0 / 3.0 * pow(x, 3) + 384 * x * y - 416.0 / 3.0 * x - 128.0 / 3.0 * pow(y, 3) - 208.0 / 3.0 * y + 16;
+		val.col(6) = result_0.matrix();
+		}
+		{
+		result_0 = -16.0 / 3.0 * x * (24 * pow(x, 2) + 48 * x * y - 36 * x + 24 * pow(y, 2) - 36 * y + 13);
+		val.col(7) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 96 * pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		result_0 = 4 * helper_0 * y - 4 * helper_0 + 128 * helper_1 * x - 16 * helper_1 + 256 * pow(x, 3) - 288 * x * y + 152 * x + 28 * y - 12;
+		val.col(8) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * x * (32 * pow(x, 2) + 32 * x * y - 36 * x - 8 * y + 7);
+		val.col(9) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = pow(x, 2);
+		result_0 = -128 * helper_0 * y + 224 * helper_0 - 512.0 / 3.0 * pow(x, 3) + 64 * x * y - 224.0 / 3.0 * x - 16.0 / 3.0 * y + 16.0 / 3.0;
+		val.col(10) = result_0.matrix();
+		}
+		{
+		result_0 = -16.0 / 3.0 * x * (8 * pow(x, 2) - 6 * x + 1);
+		val.col(11) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (16.0 / 3.0) * y * (24 * pow(x, 2) - 12 * x + 1);
+		val.col(12) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * x * (8 * pow(x, 2) - 6 * x + 1);
+		val.col(13) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 4 * y;
+		result_0 = helper_0 * (-helper_0 + 32 * x * y - 8 * x + 1);
+		val.col(14) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 4 * x;
+		result_0 = helper_0 * (-helper_0 + 32 * x * y - 8 * y + 1);
+		val.col(15) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (16.0 / 3.0) * y * (8 * pow(y, 2) - 6 * y + 1);
+		val.col(16) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * x * (24 * pow(y, 2) - 12 * y + 1);
+		val.col(17) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -16.0 / 3.0 * y * (8 * pow(y, 2) - 6 * y + 1);
+		val.col(18) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = pow(y, 2);
+		result_0 = -128 * helper_0 * x + 224 * helper_0 + 64 * x * y - 16.0 / 3.0 * x - 512.0 / 3.0 * pow(y, 3) - 224.0 / 3.0 * y + 16.0 / 3.0;
+		val.col(19) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 4 * y * (32 * x * y - 8 * x + 32 * pow(y, 2) - 36 * y + 7);
+		val.col(20) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = 96 * pow(y, 2);
+		result_0 = 128 * helper_0 * y - 16 * helper_0 + 4 * helper_1 * x - 4 * helper_1 - 288 * x * y + 28 * x + 256 * pow(y, 3) + 152 * y - 12;
+		val.col(21) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -16.0 / 3.0 * y * (24 * pow(x, 2) + 48 * x * y - 36 * x + 24 * pow(y, 2) - 36 * y + 13);
+		val.col(22) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		result_0 = -256 * helper_0 * y + 96 * helper_0 - 384 * helper_1 * x + 288 * helper_1 - 128.0 / 3.0 * pow(x, 3) + 384 * x * y - 208.0 / 3.0 * x - 512.0 / 3.0 * pow(y, 3) - 416.0 / 3.0 * y + 16;
+		val.col(23) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 32 * y * (12 * pow(x, 2) + 16 * x * y - 14 * x + 4 * pow(y, 2) - 7 * y + 3);
+		val.col(24) = result_0.matrix();
+		}
+		{
+		result_0 = 32 * x * (4 * pow(x, 2) + 16 * x * y - 7 * x + 12 * pow(y, 2) - 14 * y + 3);
+		val.col(25) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -32 * y * (8 * x * y - 2 * x + 4 * pow(y, 2) - 5 * y + 1);
+		val.col(26) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * x * (8 * x * y - x + 12 * pow(y, 2) - 10 * y + 1);
+		val.col(27) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -32 * y * (12 * pow(x, 2) + 8 * x * y - 10 * x - y + 1);
+		val.col(28) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * x * (4 * pow(x, 2) + 8 * x * y - 5 * x - 2 * y + 1);
+		val.col(29) = result_0.matrix();
+		}
+	}
+}
+
+void p_0_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 1);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0.setOnes();
+		val.col(0) = result_0.matrix();
+	}
+}
+
+void p_1_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 4);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = -x - y - z + 1;
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = x;
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = y;
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = z;
+		val.col(3) = result_0.matrix();
+	}
+}
+
+void p_2_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 10);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = (x + y + z - 1) * (2 * x + 2 * y + 2 * z - 1);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = x * (2 * x - 1);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = y * (2 * y - 1);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = z * (2 * z - 1);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = -4 * x * (x + y + z - 1);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = 4 * x * y;
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = -4 * y * (x + y + z - 1);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = -4 * z * (x + y + z - 1);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		result_0 = 4 * x * z;
+		val.col(8) = result_0.matrix();
+	}
+	{
+		result_0 = 4 * y * z;
+		val.col(9) = result_0.matrix();
+	}
+}
+
+void p_3_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 20);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		const auto helper_2 = pow(z, 2);
+		const auto helper_3 = (27.0 / 2.0) * x;
+		const auto helper_4 = (27.0 / 2.0) * y;
+		const auto helper_5 = (27.0 / 2.0) * z;
+		result_0 = -helper_0 * helper_4 - helper_0 * helper_5 + 9 * helper_0 - helper_1 * helper_3 - helper_1 * helper_5 + 9 * helper_1 - helper_2 * helper_3 - helper_2 * helper_4 + 9 * helper_2 - 9.0 / 2.0 * pow(x, 3) - 27 * x * y * z + 18 * x * y + 18 * x * z - 11.0 / 2.0 * x - 9.0 / 2.0 * pow(y, 3) + 18 * y * z - 11.0 / 2.0 * y - 9.0 / 2.0 * pow(z, 3) - 11.0 / 2.0 * z + 1;
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 2.0) * x * (9 * pow(x, 2) - 9 * x + 2);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 2.0) * y * (9 * pow(y, 2) - 9 * y + 2);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 2.0) * z * (9 * pow(z, 2) - 9 * z + 2);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * x * (x + y + z - 1) * (3 * x + 3 * y + 3 * z - 2);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 3 * x;
+		result_0 = -9.0 / 2.0 * x * (helper_0 * y + helper_0 * z + 3 * pow(x, 2) - 4 * x - y - z + 1);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * x * y * (3 * x - 1);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * x * y * (3 * y - 1);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 3 * y;
+		result_0 = -9.0 / 2.0 * y * (helper_0 * x + helper_0 * z - x + 3 * pow(y, 2) - 4 * y - z + 1);
+		val.col(8) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * y * (x + y + z - 1) * (3 * x + 3 * y + 3 * z - 2);
+		val.col(9) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * z * (x + y + z - 1) * (3 * x + 3 * y + 3 * z - 2);
+		val.col(10) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 3 * z;
+		result_0 = -9.0 / 2.0 * z * (helper_0 * x + helper_0 * y - x - y + 3 * pow(z, 2) - 4 * z + 1);
+		val.col(11) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * x * z * (3 * x - 1);
+		val.col(12) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * x * z * (3 * z - 1);
+		val.col(13) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * y * z * (3 * y - 1);
+		val.col(14) = result_0.matrix();
+	}
+	{
+		result_0 = (9.0 / 2.0) * y * z * (3 * z - 1);
+		val.col(15) = result_0.matrix();
+	}
+	{
+		result_0 = -27 * x * y * (x + y + z - 1);
+		val.col(16) = result_0.matrix();
+	}
+	{
+		result_0 = -27 * x * z * (x + y + z - 1);
+		val.col(17) = result_0.matrix();
+	}
+	{
+		result_0 = 27 * x * y * z;
+		val.col(18) = result_0.matrix();
+	}
+	{
+		result_0 = -27 * y * z * (x + y + z - 1);
+		val.col(19) = result_0.matrix();
+	}
+}
+
+void p_4_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 35);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		const auto helper_0 = x + y + z - 1;
+		const auto helper_1 = x * y;
+		const auto helper_2 = pow(y, 2);
+		const auto helper_3 = 9 * x;
+		const auto helper_4 = pow(z, 2);
+		const auto helper_5 = pow(x, 2);
+		const auto helper_6 = 9 * y;
+		const auto helper_7 = 9 * z;
+		const auto helper_8 = 26 * helper_0;
+		const auto helper_9 = helper_8 * z;
+		const auto helper_10 = 13 * pow(helper_0, 2);
+		const auto helper_11 = 13 * helper_0;
+		result_0 = (1.0 / 3.0) * helper_0 * (3 * pow(helper_0, 3) + helper_1 * helper_8 + 18 * helper_1 * z + helper_10 * x + helper_10 * y + helper_10 * z + helper_11 * helper_2 + helper_11 * helper_4 + helper_11 * helper_5 + helper_2 * helper_3 + helper_2 * helper_7 + helper_3 * helper_4 + helper_4 * helper_6 + helper_5 * helper_6 + helper_5 * helper_7 + helper_9 * x + helper_9 * y + 3 * pow(x, 3) + 3 * pow(y, 3) + 3 * pow(z, 3));
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 3.0) * x * (32 * pow(x, 3) - 48 * pow(x, 2) + 22 * x - 3);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 3.0) * y * (32 * pow(y, 3) - 48 * pow(y, 2) + 22 * y - 3);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = (1.0 / 3.0) * z * (32 * pow(z, 3) - 48 * pow(z, 2) + 22 * z - 3);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 36 * x;
+		const auto helper_1 = y * z;
+		const auto helper_2 = pow(x, 2);
+		const auto helper_3 = pow(y, 2);
+		const auto helper_4 = pow(z, 2);
+		const auto helper_5 = 24 * x;
+		const auto helper_6 = 24 * y;
+		const auto helper_7 = 24 * z;
+		result_0 = -16.0 / 3.0 * x * (-helper_0 * y - helper_0 * z + 48 * helper_1 * x - 36 * helper_1 + helper_2 * helper_6 + helper_2 * helper_7 - 18 * helper_2 + helper_3 * helper_5 + helper_3 * helper_7 - 18 * helper_3 + helper_4 * helper_5 + helper_4 * helper_6 - 18 * helper_4 + 8 * pow(x, 3) + 13 * x + 8 * pow(y, 3) + 13 * y + 8 * pow(z, 3) + 13 * z - 3);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 2 * y;
+		const auto helper_1 = 2 * z;
+		const auto helper_2 = x + y + z - 1;
+		const auto helper_3 = helper_2 * x;
+		result_0 = 4 * helper_3 * (-helper_0 * helper_2 + helper_0 * x - helper_0 * z - helper_1 * helper_2 + helper_1 * x + 3 * pow(helper_2, 2) + 10 * helper_3 + 3 * pow(x, 2) - pow(y, 2) - pow(z, 2));
+		val.col(5) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 6 * x;
+		const auto helper_1 = pow(x, 2);
+		const auto helper_2 = 8 * helper_1;
+		result_0 = -16.0 / 3.0 * x * (-helper_0 * y - helper_0 * z - 14 * helper_1 + helper_2 * y + helper_2 * z + 8 * pow(x, 3) + 7 * x + y + z - 1);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = (16.0 / 3.0) * x * y * (8 * pow(x, 2) - 6 * x + 1);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 4 * x;
+		result_0 = helper_0 * y * (-helper_0 + 16 * x * y - 4 * y + 1);
+		val.col(8) = result_0.matrix();
+	}
+	{
+		result_0 = (16.0 / 3.0) * x * y * (8 * pow(y, 2) - 6 * y + 1);
+		val.col(9) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 6 * y;
+		const auto helper_1 = pow(y, 2);
+		const auto helper_2 = 8 * helper_1;
+		result_0 = -16.0 / 3.0 * y * (-helper_0 * x - helper_0 * z - 14 * helper_1 + helper_2 * x + helper_2 * z + x + 8 * pow(y, 3) + 7 * y + z - 1);
+		val.col(10) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 2 * y;
+		const auto helper_1 = 2 * x;
+		const auto helper_2 = x + y + z - 1;
+		const auto helper_3 = helper_2 * y;
+		result_0 = -4 * helper_3 * (-helper_0 * x - helper_0 * z + helper_1 * helper_2 + helper_1 * z - 3 * pow(helper_2, 2) + 2 * helper_2 * z - 10 * helper_3 + pow(x, 2) - 3 * pow(y, 2) + pow(z, 2));
+		val.col(11) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 36 * x;
+		const auto helper_1 = y * z;
+		const auto helper_2 = pow(x, 2);
+		const auto helper_3 = pow(y, 2);
+		const auto helper_4 = pow(z, 2);
+		const auto helper_5 = 24 * x;
+		const auto helper_6 = 24 * y;
+		const auto helper_7 = 24 * z;
+		result_0 = -16.0 / 3.0 * y * (-helper_0 * y - helper_0 * z + 48 * helper_1 * x - 36 * helper_1 + helper_2 * helper_6 + helper_2 * helper_7 - 18 * helper_2 + helper_3 * helper_5 + helper_3 * helper_7 - 18 * helper_3 + helper_4 * helper_5 + helper_4 * helper_6 - 18 * helper_4 + 8 * pow(x, 3) + 13 * x + 8 * pow(y, 3) + 13 * y + 8 * pow(z, 3) + 13 * z - 3);
+		val.col(12) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 36 * x;
+		const auto helper_1 = y * z;
+		const auto helper_2 = pow(x, 2);
+		const auto helper_3 = pow(y, 2);
+		const auto helper_4 = pow(z, 2);
+		const auto helper_5 = 24 * x;
+		const auto helper_6 = 24 * y;
+		const auto helper_7 = 24 * z;
+		result_0 = -16.0 / 3.0 * z * (-helper_0 * y - helper_0 * z + 48 * helper_1 * x - 36 * helper_1 + helper_2 * helper_6 + helper_2 * helper_7 - 18 * helper_2 + helper_3 * helper_5 + helper_3 * helper_7 - 18 * helper_3 + helper_4 * helper_5 + helper_4 * helper_6 - 18 * helper_4 + 8 * pow(x, 3) + 13 * x + 8 * pow(y, 3) + 13 * y + 8 * pow(z, 3) + 13 * z - 3);
+		val.col(13) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 2 * x;
+		const auto helper_1 = 2 * z;
+		const auto helper_2 = x + y + z - 1;
+		const auto helper_3 = helper_2 * z;
+		result_0 = -4 * helper_3 * (helper_0 * helper_2 + helper_0 * y - helper_1 * x - helper_1 * y - 3 * pow(helper_2, 2) + 2 * helper_2 * y - 10 * helper_3 + pow(x, 2) + pow(y, 2) - 3 * pow(z, 2));
+		val.col(14) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 6 * z;
+		const auto helper_1 = pow(z, 2);
+		const auto helper_2 = 8 * helper_1;
+		result_0 = -16.0 / 3.0 * z * (-helper_0 * x - helper_0 * y - 14 * helper_1 + helper_2 * x + helper_2 * y + x + y + 8 * pow(z, 3) + 7 * z - 1);
+		val.col(15) = result_0.matrix();
+	}
+	{
+		result_0 = (16.0 / 3.0) * x * z * (8 * pow(x, 2) - 6 * x + 1);
+		val.col(16) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 4 * x;
+		result_0 = helper_0 * z * (-helper_0 + 16 * x * z - 4 * z + 1);
+		val.col(17) = result_0.matrix();
+	}
+	{
+		result_0 = (16.0 / 3.0) * x * z * (8 * pow(z, 2) - 6 * z + 1);
+		val.col(18) = result_0.matrix();
+	}
+	{
+		result_0 = (16.0 / 3.0) * y * z * (8 * pow(y, 2) - 6 * y + 1);
+		val.col(19) = result_0.matrix();
+	}
+	{
+		const auto helper_0 = 4 * y;
+		result_0 = helper_0 * z * (-helper_0 + 16 * y * z - 4 * z + 1);
+		val.col(20) = result_0.matrix();
+	}
+	{
+		result_0 = (16.0 / 3.0) * y * z * (8 * pow(z, 2) - 6 * z + 1);
+		val.col(21) = result_0.matrix();
+	}
+	{
+		result_0 = 32 * x * y * (x + y + z - 1) * (4 * x + 4 * y + 4 * z - 3);
+		val.col(22) = result_0.matrix();
+	}
+	{
+		result_0 = -32 * x * y * (4 * y - 1) * (x + y + z - 1);
+		val.col(23) = result_0.matrix();
+	}
+	{
+		result_0 = -32 * x * y * (4 * x - 1) * (x + y + z - 1);
+		val.col(24) = result_0.matrix();
+	}
+	{
+		result_0 = 32 * x * z * (x + y + z - 1) * (4 * x + 4 * y + 4 * z - 3);
+		val.col(25) = result_0.matrix();
+	}
+	{
+		result_0 = -32 * x * z * (4 * z - 1) * (x + y + z - 1);
+		val.col(26) = result_0.matrix();
+	}
+	{
+		result_0 = -32 * x * z * (4 * x - 1) * (x + y + z - 1);
+		val.col(27) = result_0.matrix();
+	}
+	{
+		result_0 = 32 * x * y * z * (4 * x - 1);
+		val.col(28) = result_0.matrix();
+	}
+	{
+		result_0 = 32 * x * y * z * (4 * z - 1);
+		val.col(29) = result_0.matrix();
+	}
+	{
+		result_0 = 32 * x * y * z * (4 * y - 1);
+		val.col(30) = result_0.matrix();
+	}
+	{
+		result_0 = -32 * y * z * (4 * y - 1) * (x + y + z - 1);
+		val.col(31) = result_0.matrix();
+	}
+	{
+		result_0 = -32 * y * z * (4 * z - 1) * (x + y + z - 1);
+		val.col(32) = result_0.matrix();
+	}
+	{
+		result_0 = 32 * y * z * (x + y + z - 1) * (4 * x + 4 * y + 4 * z - 3);
+		val.col(33) = result_0.matrix();
+	}
+	{
+		result_0 = -256 * x * y * z * (x + y + z - 1);
+		val.col(34) = result_0.matrix();
+	}
+}
+
+void p_0_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 3);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		result_0.setZero();
+		val.col(0) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(1) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(2) = result_0.matrix();
+		}
+	}
+}
+
+void p_1_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 12);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		result_0.setConstant(-1);
+		val.col(0) = result_0.matrix();
+		}
+		{
+		result_0.setConstant(-1);
+		val.col(1) = result_0.matrix();
+		}
+		{
+		result_0.setConstant(-1);
+		val.col(2) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setOnes();
+		val.col(3) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(4) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(5) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(6) = result_0.matrix();
+		}
+		{
+		result_0.setOnes();
+		val.col(7) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(8) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(9) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(10) = result_0.matrix();
+		}
+		{
+		result_0.setOnes();
+		val.col(11) = result_0.matrix();
+		}
+	}
+}
+
+void p_2_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 30);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		result_0 = 4 * x + 4 * y + 4 * z - 3;
+		val.col(0) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * x + 4 * y + 4 * z - 3;
+		val.col(1) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * x + 4 * y + 4 * z - 3;
+		val.col(2) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 4 * x - 1;
+		val.col(3) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(4) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(5) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(6) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * y - 1;
+		val.col(7) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(8) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(9) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(10) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * z - 1;
+		val.col(11) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 4 * (-2 * x - y - z + 1);
+		val.col(12) = result_0.matrix();
+		}
+		{
+		result_0 = -4 * x;
+		val.col(13) = result_0.matrix();
+		}
+		{
+		result_0 = -4 * x;
+		val.col(14) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 4 * y;
+		val.col(15) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * x;
+		val.col(16) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(17) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -4 * y;
+		val.col(18) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * (-x - 2 * y - z + 1);
+		val.col(19) = result_0.matrix();
+		}
+		{
+		result_0 = -4 * y;
+		val.col(20) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -4 * z;
+		val.col(21) = result_0.matrix();
+		}
+		{
+		result_0 = -4 * z;
+		val.col(22) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * (-x - y - 2 * z + 1);
+		val.col(23) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 4 * z;
+		val.col(24) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(25) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * x;
+		val.col(26) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(27) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * z;
+		val.col(28) = result_0.matrix();
+		}
+		{
+		result_0 = 4 * y;
+		val.col(29) = result_0.matrix();
+		}
+	}
+}
+
+void p_3_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 60);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		const auto helper_0 = 27 * x;
+		result_0 = -helper_0 * y - helper_0 * z - 27.0 / 2.0 * pow(x, 2) + 18 * x - 27.0 / 2.0 * pow(y, 2) - 27 * y * z + 18 * y - 27.0 / 2.0 * pow(z, 2) + 18 * z - 11.0 / 2.0;
+		val.col(0) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 27 * x;
+		result_0 = -helper_0 * y - helper_0 * z - 27.0 / 2.0 * pow(x, 2) + 18 * x - 27.0 / 2.0 * pow(y, 2) - 27 * y * z + 18 * y - 27.0 / 2.0 * pow(z, 2) + 18 * z - 11.0 / 2.0;
+		val.col(1) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 27 * x;
+		result_0 = -helper_0 * y - helper_0 * z - 27.0 / 2.0 * pow(x, 2) + 18 * x - 27.0 / 2.0 * pow(y, 2) - 27 * y * z + 18 * y - 27.0 / 2.0 * pow(z, 2) + 18 * z - 11.0 / 2.0;
+		val.col(2) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (27.0 / 2.0) * pow(x, 2) - 9 * x + 1;
+		val.col(3) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(4) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(5) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(6) = result_0.matrix();
+		}
+		{
+		result_0 = (27.0 / 2.0) * pow(y, 2) - 9 * y + 1;
+		val.col(7) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(8) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(9) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(10) = result_0.matrix();
+		}
+		{
+		result_0 = (27.0 / 2.0) * pow(z, 2) - 9 * z + 1;
+		val.col(11) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 6 * x;
+		result_0 = 9 * helper_0 * y + 9 * helper_0 * z + (81.0 / 2.0) * pow(x, 2) - 45 * x + (27.0 / 2.0) * pow(y, 2) + 27 * y * z - 45.0 / 2.0 * y + (27.0 / 2.0) * pow(z, 2) - 45.0 / 2.0 * z + 9;
+		val.col(12) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * x * (6 * x + 6 * y + 6 * z - 5);
+		val.col(13) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * x * (6 * x + 6 * y + 6 * z - 5);
+		val.col(14) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 3 * x;
+		result_0 = -9 * helper_0 * y - 9 * helper_0 * z - 81.0 / 2.0 * pow(x, 2) + 36 * x + (9.0 / 2.0) * y + (9.0 / 2.0) * z - 9.0 / 2.0;
+		val.col(15) = result_0.matrix();
+		}
+		{
+		result_0 = -9.0 / 2.0 * x * (3 * x - 1);
+		val.col(16) = result_0.matrix();
+		}
+		{
+		result_0 = -9.0 / 2.0 * x * (3 * x - 1);
+		val.col(17) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (9.0 / 2.0) * y * (6 * x - 1);
+		val.col(18) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * x * (3 * x - 1);
+		val.col(19) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(20) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (9.0 / 2.0) * y * (3 * y - 1);
+		val.col(21) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * x * (6 * y - 1);
+		val.col(22) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(23) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -9.0 / 2.0 * y * (3 * y - 1);
+		val.col(24) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 3 * y;
+		result_0 = -9 * helper_0 * x - 9 * helper_0 * z + (9.0 / 2.0) * x - 81.0 / 2.0 * pow(y, 2) + 36 * y + (9.0 / 2.0) * z - 9.0 / 2.0;
+		val.col(25) = result_0.matrix();
+		}
+		{
+		result_0 = -9.0 / 2.0 * y * (3 * y - 1);
+		val.col(26) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (9.0 / 2.0) * y * (6 * x + 6 * y + 6 * z - 5);
+		val.col(27) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 6 * y;
+		result_0 = 9 * helper_0 * x + 9 * helper_0 * z + (27.0 / 2.0) * pow(x, 2) + 27 * x * z - 45.0 / 2.0 * x + (81.0 / 2.0) * pow(y, 2) - 45 * y + (27.0 / 2.0) * pow(z, 2) - 45.0 / 2.0 * z + 9;
+		val.col(28) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * y * (6 * x + 6 * y + 6 * z - 5);
+		val.col(29) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (9.0 / 2.0) * z * (6 * x + 6 * y + 6 * z - 5);
+		val.col(30) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * z * (6 * x + 6 * y + 6 * z - 5);
+		val.col(31) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 6 * z;
+		result_0 = 9 * helper_0 * x + 9 * helper_0 * y + (27.0 / 2.0) * pow(x, 2) + 27 * x * y - 45.0 / 2.0 * x + (27.0 / 2.0) * pow(y, 2) - 45.0 / 2.0 * y + (81.0 / 2.0) * pow(z, 2) - 45 * z + 9;
+		val.col(32) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -9.0 / 2.0 * z * (3 * z - 1);
+		val.col(33) = result_0.matrix();
+		}
+		{
+		result_0 = -9.0 / 2.0 * z * (3 * z - 1);
+		val.col(34) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 3 * z;
+		result_0 = -9 * helper_0 * x - 9 * helper_0 * y + (9.0 / 2.0) * x + (9.0 / 2.0) * y - 81.0 / 2.0 * pow(z, 2) + 36 * z - 9.0 / 2.0;
+		val.col(35) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (9.0 / 2.0) * z * (6 * x - 1);
+		val.col(36) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(37) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * x * (3 * x - 1);
+		val.col(38) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (9.0 / 2.0) * z * (3 * z - 1);
+		val.col(39) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(40) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * x * (6 * z - 1);
+		val.col(41) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(42) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * z * (6 * y - 1);
+		val.col(43) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * y * (3 * y - 1);
+		val.col(44) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(45) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * z * (3 * z - 1);
+		val.col(46) = result_0.matrix();
+		}
+		{
+		result_0 = (9.0 / 2.0) * y * (6 * z - 1);
+		val.col(47) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -27 * y * (2 * x + y + z - 1);
+		val.col(48) = result_0.matrix();
+		}
+		{
+		result_0 = -27 * x * (x + 2 * y + z - 1);
+		val.col(49) = result_0.matrix();
+		}
+		{
+		result_0 = -27 * x * y;
+		val.col(50) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -27 * z * (2 * x + y + z - 1);
+		val.col(51) = result_0.matrix();
+		}
+		{
+		result_0 = -27 * x * z;
+		val.col(52) = result_0.matrix();
+		}
+		{
+		result_0 = -27 * x * (x + y + 2 * z - 1);
+		val.col(53) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 27 * y * z;
+		val.col(54) = result_0.matrix();
+		}
+		{
+		result_0 = 27 * x * z;
+		val.col(55) = result_0.matrix();
+		}
+		{
+		result_0 = 27 * x * y;
+		val.col(56) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -27 * y * z;
+		val.col(57) = result_0.matrix();
+		}
+		{
+		result_0 = -27 * z * (x + 2 * y + z - 1);
+		val.col(58) = result_0.matrix();
+		}
+		{
+		result_0 = -27 * y * (x + y + 2 * z - 1);
+		val.col(59) = result_0.matrix();
+		}
+	}
+}
+
+void p_4_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 105);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{
+		const auto helper_0 = 160 * x;
+		const auto helper_1 = y * z;
+		const auto helper_2 = pow(x, 2);
+		const auto helper_3 = pow(y, 2);
+		const auto helper_4 = pow(z, 2);
+		const auto helper_5 = 128 * x;
+		const auto helper_6 = 128 * y;
+		const auto helper_7 = 128 * z;
+		result_0 = -helper_0 * y - helper_0 * z + 256 * helper_1 * x - 160 * helper_1 + helper_2 * helper_6 + helper_2 * helper_7 - 80 * helper_2 + helper_3 * helper_5 + helper_3 * helper_7 - 80 * helper_3 + helper_4 * helper_5 + helper_4 * helper_6 - 80 * helper_4 + (128.0 / 3.0) * pow(x, 3) + (140.0 / 3.0) * x + (128.0 / 3.0) * pow(y, 3) + (140.0 / 3.0) * y + (128.0 / 3.0) * pow(z, 3) + (140.0 / 3.0) * z - 25.0 / 3.0;
+		val.col(0) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 160 * x;
+		const auto helper_1 = y * z;
+		const auto helper_2 = pow(x, 2);
+		const auto helper_3 = pow(y, 2);
+		const auto helper_4 = pow(z, 2);
+		const auto helper_5 = 128 * x;
+		const auto helper_6 = 128 * y;
+		const auto helper_7 = 128 * z;
+		result_0 = -helper_0 * y - helper_0 * z + 256 * helper_1 * x - 160 * helper_1 + helper_2 * helper_6 + helper_2 * helper_7 - 80 * helper_2 + helper_3 * helper_5 + helper_3 * helper_7 - 80 * helper_3 + helper_4 * helper_5 + helper_4 * helper_6 - 80 * helper_4 + (128.0 / 3.0) * pow(x, 3) + (140.0 / 3.0) * x + (128.0 / 3.0) * pow(y, 3) + (140.0 / 3.0) * y + (128.0 / 3.0) * pow(z, 3) + (140.0 / 3.0) * z - 25.0 / 3.0;
+		val.col(1) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 160 * x;
+		const auto helper_1 = y * z;
+		const auto helper_2 = pow(x, 2);
+		const auto helper_3 = pow(y, 2);
+		const auto helper_4 = pow(z, 2);
+		const auto helper_5 = 128 * x;
+		const auto helper_6 = 128 * y;
+		const auto helper_7 = 128 * z;
+		result_0 = -helper_0 * y - helper_0 * z + 256 * helper_1 * x - 160 * helper_1 + helper_2 * helper_6 + helper_2 * helper_7 - 80 * helper_2 + helper_3 * helper_5 + helper_3 * helper_7 - 80 * helper_3 + helper_4 * helper_5 + helper_4 * helper_6 - 80 * helper_4 + (128.0 / 3.0) * pow(x, 3) + (140.0 / 3.0) * x + (128.0 / 3.0) * pow(y, 3) + (140.0 / 3.0) * y + (128.0 / 3.0) * pow(z, 3) + (140.0 / 3.0) * z - 25.0 / 3.0;
+		val.col(2) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (128.0 / 3.0) * pow(x, 3) - 48 * pow(x, 2) + (44.0 / 3.0) * x - 1;
+		val.col(3) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(4) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(5) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(6) = result_0.matrix();
+		}
+		{
+		result_0 = (128.0 / 3.0) * pow(y, 3) - 48 * pow(y, 2) + (44.0 / 3.0) * y - 1;
+		val.col(7) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(8) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(9) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(10) = result_0.matrix();
+		}
+		{
+		result_0 = (128.0 / 3.0) * pow(z, 3) - 48 * pow(z, 2) + (44.0 / 3.0) * z - 1;
+		val.col(11) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		const auto helper_2 = pow(z, 2);
+		const auto helper_3 = 16 * x;
+		const auto helper_4 = 24 * helper_0;
+		result_0 = 288 * helper_0 - 16 * helper_1 * helper_3 - 128 * helper_1 * z + 96 * helper_1 - 16 * helper_2 * helper_3 - 128 * helper_2 * y + 96 * helper_2 - 16 * helper_4 * y - 16 * helper_4 * z - 512.0 / 3.0 * pow(x, 3) - 512 * x * y * z + 384 * x * y + 384 * x * z - 416.0 / 3.0 * x - 128.0 / 3.0 * pow(y, 3) + 192 * y * z - 208.0 / 3.0 * y - 128.0 / 3.0 * pow(z, 3) - 208.0 / 3.0 * z + 16;
+		val.col(12) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 48 * x;
+		result_0 = -16.0 / 3.0 * x * (helper_0 * y + helper_0 * z + 24 * pow(x, 2) - 36 * x + 24 * pow(y, 2) + 48 * y * z - 36 * y + 24 * pow(z, 2) - 36 * z + 13);
+		val.col(13) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 48 * x;
+		result_0 = -16.0 / 3.0 * x * (helper_0 * y + helper_0 * z + 24 * pow(x, 2) - 36 * x + 24 * pow(y, 2) + 48 * y * z - 36 * y + 24 * pow(z, 2) - 36 * z + 13);
+		val.col(14) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 72 * x;
+		const auto helper_1 = y * z;
+		const auto helper_2 = 96 * pow(x, 2);
+		const auto helper_3 = pow(y, 2);
+		const auto helper_4 = pow(z, 2);
+		const auto helper_5 = 32 * x;
+		result_0 = -4 * helper_0 * y - 4 * helper_0 * z + 256 * helper_1 * x - 32 * helper_1 + 4 * helper_2 * y + 4 * helper_2 * z - 4 * helper_2 + 4 * helper_3 * helper_5 - 16 * helper_3 + 4 * helper_4 * helper_5 - 16 * helper_4 + 256 * pow(x, 3) + 152 * x + 28 * y + 28 * z - 12;
+		val.col(15) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 32 * x;
+		result_0 = 4 * x * (helper_0 * y + helper_0 * z + 32 * pow(x, 2) - 36 * x - 8 * y - 8 * z + 7);
+		val.col(16) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 32 * x;
+		result_0 = 4 * x * (helper_0 * y + helper_0 * z + 32 * pow(x, 2) - 36 * x - 8 * y - 8 * z + 7);
+		val.col(17) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = 8 * helper_0;
+		result_0 = 224 * helper_0 - 16 * helper_1 * y - 16 * helper_1 * z - 512.0 / 3.0 * pow(x, 3) + 64 * x * y + 64 * x * z - 224.0 / 3.0 * x - 16.0 / 3.0 * y - 16.0 / 3.0 * z + 16.0 / 3.0;
+		val.col(18) = result_0.matrix();
+		}
+		{
+		result_0 = -16.0 / 3.0 * x * (8 * pow(x, 2) - 6 * x + 1);
+		val.col(19) = result_0.matrix();
+		}
+		{
+		result_0 = -16.0 / 3.0 * x * (8 * pow(x, 2) - 6 * x + 1);
+		val.col(20) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (16.0 / 3.0) * y * (24 * pow(x, 2) - 12 * x + 1);
+		val.col(21) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * x * (8 * pow(x, 2) - 6 * x + 1);
+		val.col(22) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(23) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 4 * y;
+		result_0 = helper_0 * (-helper_0 + 32 * x * y - 8 * x + 1);
+		val.col(24) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 4 * x;
+		result_0 = helper_0 * (-helper_0 + 32 * x * y - 8 * y + 1);
+		val.col(25) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(26) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (16.0 / 3.0) * y * (8 * pow(y, 2) - 6 * y + 1);
+		val.col(27) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * x * (24 * pow(y, 2) - 12 * y + 1);
+		val.col(28) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(29) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -16.0 / 3.0 * y * (8 * pow(y, 2) - 6 * y + 1);
+		val.col(30) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = pow(y, 2);
+		const auto helper_1 = 8 * helper_0;
+		result_0 = 224 * helper_0 - 16 * helper_1 * x - 16 * helper_1 * z + 64 * x * y - 16.0 / 3.0 * x - 512.0 / 3.0 * pow(y, 3) + 64 * y * z - 224.0 / 3.0 * y - 16.0 / 3.0 * z + 16.0 / 3.0;
+		val.col(31) = result_0.matrix();
+		}
+		{
+		result_0 = -16.0 / 3.0 * y * (8 * pow(y, 2) - 6 * y + 1);
+		val.col(32) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 32 * y;
+		result_0 = 4 * y * (helper_0 * x + helper_0 * z - 8 * x + 32 * pow(y, 2) - 36 * y - 8 * z + 7);
+		val.col(33) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 72 * y;
+		const auto helper_1 = x * z;
+		const auto helper_2 = pow(x, 2);
+		const auto helper_3 = 96 * pow(y, 2);
+		const auto helper_4 = pow(z, 2);
+		const auto helper_5 = 32 * y;
+		result_0 = -4 * helper_0 * x - 4 * helper_0 * z + 256 * helper_1 * y - 32 * helper_1 + 4 * helper_2 * helper_5 - 16 * helper_2 + 4 * helper_3 * x + 4 * helper_3 * z - 4 * helper_3 + 4 * helper_4 * helper_5 - 16 * helper_4 + 28 * x + 256 * pow(y, 3) + 152 * y + 28 * z - 12;
+		val.col(34) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 32 * y;
+		result_0 = 4 * y * (helper_0 * x + helper_0 * z - 8 * x + 32 * pow(y, 2) - 36 * y - 8 * z + 7);
+		val.col(35) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 48 * x;
+		result_0 = -16.0 / 3.0 * y * (helper_0 * y + helper_0 * z + 24 * pow(x, 2) - 36 * x + 24 * pow(y, 2) + 48 * y * z - 36 * y + 24 * pow(z, 2) - 36 * z + 13);
+		val.col(36) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		const auto helper_2 = pow(z, 2);
+		const auto helper_3 = 24 * helper_1;
+		const auto helper_4 = 16 * y;
+		result_0 = -16 * helper_0 * helper_4 - 128 * helper_0 * z + 96 * helper_0 + 288 * helper_1 - 16 * helper_2 * helper_4 - 128 * helper_2 * x + 96 * helper_2 - 16 * helper_3 * x - 16 * helper_3 * z - 128.0 / 3.0 * pow(x, 3) - 512 * x * y * z + 384 * x * y + 192 * x * z - 208.0 / 3.0 * x - 512.0 / 3.0 * pow(y, 3) + 384 * y * z - 416.0 / 3.0 * y - 128.0 / 3.0 * pow(z, 3) - 208.0 / 3.0 * z + 16;
+		val.col(37) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 48 * x;
+		result_0 = -16.0 / 3.0 * y * (helper_0 * y + helper_0 * z + 24 * pow(x, 2) - 36 * x + 24 * pow(y, 2) + 48 * y * z - 36 * y + 24 * pow(z, 2) - 36 * z + 13);
+		val.col(38) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 48 * x;
+		result_0 = -16.0 / 3.0 * z * (helper_0 * y + helper_0 * z + 24 * pow(x, 2) - 36 * x + 24 * pow(y, 2) + 48 * y * z - 36 * y + 24 * pow(z, 2) - 36 * z + 13);
+		val.col(39) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 48 * x;
+		result_0 = -16.0 / 3.0 * z * (helper_0 * y + helper_0 * z + 24 * pow(x, 2) - 36 * x + 24 * pow(y, 2) + 48 * y * z - 36 * y + 24 * pow(z, 2) - 36 * z + 13);
+		val.col(40) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = pow(x, 2);
+		const auto helper_1 = pow(y, 2);
+		const auto helper_2 = pow(z, 2);
+		const auto helper_3 = 24 * helper_2;
+		const auto helper_4 = 16 * z;
+		result_0 = -16 * helper_0 * helper_4 - 128 * helper_0 * y + 96 * helper_0 - 16 * helper_1 * helper_4 - 128 * helper_1 * x + 96 * helper_1 + 288 * helper_2 - 16 * helper_3 * x - 16 * helper_3 * y - 128.0 / 3.0 * pow(x, 3) - 512 * x * y * z + 192 * x * y + 384 * x * z - 208.0 / 3.0 * x - 128.0 / 3.0 * pow(y, 3) + 384 * y * z - 208.0 / 3.0 * y - 512.0 / 3.0 * pow(z, 3) - 416.0 / 3.0 * z + 16;
+		val.col(41) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 32 * z;
+		result_0 = 4 * z * (helper_0 * x + helper_0 * y - 8 * x - 8 * y + 32 * pow(z, 2) - 36 * z + 7);
+		val.col(42) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 32 * z;
+		result_0 = 4 * z * (helper_0 * x + helper_0 * y - 8 * x - 8 * y + 32 * pow(z, 2) - 36 * z + 7);
+		val.col(43) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = x * y;
+		const auto helper_1 = 72 * z;
+		const auto helper_2 = pow(x, 2);
+		const auto helper_3 = pow(y, 2);
+		const auto helper_4 = 96 * pow(z, 2);
+		const auto helper_5 = 32 * z;
+		result_0 = 256 * helper_0 * z - 32 * helper_0 - 4 * helper_1 * x - 4 * helper_1 * y + 4 * helper_2 * helper_5 - 16 * helper_2 + 4 * helper_3 * helper_5 - 16 * helper_3 + 4 * helper_4 * x + 4 * helper_4 * y - 4 * helper_4 + 28 * x + 28 * y + 256 * pow(z, 3) + 152 * z - 12;
+		val.col(44) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -16.0 / 3.0 * z * (8 * pow(z, 2) - 6 * z + 1);
+		val.col(45) = result_0.matrix();
+		}
+		{
+		result_0 = -16.0 / 3.0 * z * (8 * pow(z, 2) - 6 * z + 1);
+		val.col(46) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = pow(z, 2);
+		const auto helper_1 = 8 * helper_0;
+		result_0 = 224 * helper_0 - 16 * helper_1 * x - 16 * helper_1 * y + 64 * x * z - 16.0 / 3.0 * x + 64 * y * z - 16.0 / 3.0 * y - 512.0 / 3.0 * pow(z, 3) - 224.0 / 3.0 * z + 16.0 / 3.0;
+		val.col(47) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (16.0 / 3.0) * z * (24 * pow(x, 2) - 12 * x + 1);
+		val.col(48) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(49) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * x * (8 * pow(x, 2) - 6 * x + 1);
+		val.col(50) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 4 * z;
+		result_0 = helper_0 * (-helper_0 + 32 * x * z - 8 * x + 1);
+		val.col(51) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(52) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 4 * x;
+		result_0 = helper_0 * (-helper_0 + 32 * x * z - 8 * z + 1);
+		val.col(53) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = (16.0 / 3.0) * z * (8 * pow(z, 2) - 6 * z + 1);
+		val.col(54) = result_0.matrix();
+		}
+		{
+		result_0.setZero();
+		val.col(55) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * x * (24 * pow(z, 2) - 12 * z + 1);
+		val.col(56) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(57) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * z * (24 * pow(y, 2) - 12 * y + 1);
+		val.col(58) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * y * (8 * pow(y, 2) - 6 * y + 1);
+		val.col(59) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(60) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 4 * z;
+		result_0 = helper_0 * (-helper_0 + 32 * y * z - 8 * y + 1);
+		val.col(61) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 4 * y;
+		result_0 = helper_0 * (-helper_0 + 32 * y * z - 8 * z + 1);
+		val.col(62) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0.setZero();
+		val.col(63) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * z * (8 * pow(z, 2) - 6 * z + 1);
+		val.col(64) = result_0.matrix();
+		}
+		{
+		result_0 = (16.0 / 3.0) * y * (24 * pow(z, 2) - 12 * z + 1);
+		val.col(65) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 16 * x;
+		result_0 = 32 * y * (helper_0 * y + helper_0 * z + 12 * pow(x, 2) - 14 * x + 4 * pow(y, 2) + 8 * y * z - 7 * y + 4 * pow(z, 2) - 7 * z + 3);
+		val.col(66) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 16 * y;
+		result_0 = 32 * x * (helper_0 * x + helper_0 * z + 4 * pow(x, 2) + 8 * x * z - 7 * x + 12 * pow(y, 2) - 14 * y + 4 * pow(z, 2) - 7 * z + 3);
+		val.col(67) = result_0.matrix();
+		}
+		{
+		result_0 = 32 * x * y * (8 * x + 8 * y + 8 * z - 7);
+		val.col(68) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -32 * y * (8 * x * y - 2 * x + 4 * pow(y, 2) + 4 * y * z - 5 * y - z + 1);
+		val.col(69) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 8 * y;
+		result_0 = -32 * x * (helper_0 * x + helper_0 * z - x + 12 * pow(y, 2) - 10 * y - z + 1);
+		val.col(70) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * x * y * (4 * y - 1);
+		val.col(71) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 8 * x;
+		result_0 = -32 * y * (helper_0 * y + helper_0 * z + 12 * pow(x, 2) - 10 * x - y - z + 1);
+		val.col(72) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * x * (4 * pow(x, 2) + 8 * x * y + 4 * x * z - 5 * x - 2 * y - z + 1);
+		val.col(73) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * x * y * (4 * x - 1);
+		val.col(74) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 16 * x;
+		result_0 = 32 * z * (helper_0 * y + helper_0 * z + 12 * pow(x, 2) - 14 * x + 4 * pow(y, 2) + 8 * y * z - 7 * y + 4 * pow(z, 2) - 7 * z + 3);
+		val.col(75) = result_0.matrix();
+		}
+		{
+		result_0 = 32 * x * z * (8 * x + 8 * y + 8 * z - 7);
+		val.col(76) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 16 * z;
+		result_0 = 32 * x * (helper_0 * x + helper_0 * y + 4 * pow(x, 2) + 8 * x * y - 7 * x + 4 * pow(y, 2) - 7 * y + 12 * pow(z, 2) - 14 * z + 3);
+		val.col(77) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -32 * z * (8 * x * z - 2 * x + 4 * y * z - y + 4 * pow(z, 2) - 5 * z + 1);
+		val.col(78) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * x * z * (4 * z - 1);
+		val.col(79) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 8 * z;
+		result_0 = -32 * x * (helper_0 * x + helper_0 * y - x - y + 12 * pow(z, 2) - 10 * z + 1);
+		val.col(80) = result_0.matrix();
+		}
+	}
+	{
+		{
+		const auto helper_0 = 8 * x;
+		result_0 = -32 * z * (helper_0 * y + helper_0 * z + 12 * pow(x, 2) - 10 * x - y - z + 1);
+		val.col(81) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * x * z * (4 * x - 1);
+		val.col(82) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * x * (4 * pow(x, 2) + 4 * x * y + 8 * x * z - 5 * x - y - 2 * z + 1);
+		val.col(83) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 32 * y * z * (8 * x - 1);
+		val.col(84) = result_0.matrix();
+		}
+		{
+		result_0 = 32 * x * z * (4 * x - 1);
+		val.col(85) = result_0.matrix();
+		}
+		{
+		result_0 = 32 * x * y * (4 * x - 1);
+		val.col(86) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 32 * y * z * (4 * z - 1);
+		val.col(87) = result_0.matrix();
+		}
+		{
+		result_0 = 32 * x * z * (4 * z - 1);
+		val.col(88) = result_0.matrix();
+		}
+		{
+		result_0 = 32 * x * y * (8 * z - 1);
+		val.col(89) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 32 * y * z * (4 * y - 1);
+		val.col(90) = result_0.matrix();
+		}
+		{
+		result_0 = 32 * x * z * (8 * y - 1);
+		val.col(91) = result_0.matrix();
+		}
+		{
+		result_0 = 32 * x * y * (4 * y - 1);
+		val.col(92) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -32 * y * z * (4 * y - 1);
+		val.col(93) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 8 * y;
+		result_0 = -32 * z * (helper_0 * x + helper_0 * z - x + 12 * pow(y, 2) - 10 * y - z + 1);
+		val.col(94) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * y * (4 * x * y - x + 4 * pow(y, 2) + 8 * y * z - 5 * y - 2 * z + 1);
+		val.col(95) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -32 * y * z * (4 * z - 1);
+		val.col(96) = result_0.matrix();
+		}
+		{
+		result_0 = -32 * z * (4 * x * z - x + 8 * y * z - 2 * y + 4 * pow(z, 2) - 5 * z + 1);
+		val.col(97) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 8 * z;
+		result_0 = -32 * y * (helper_0 * x + helper_0 * y - x - y + 12 * pow(z, 2) - 10 * z + 1);
+		val.col(98) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = 32 * y * z * (8 * x + 8 * y + 8 * z - 7);
+		val.col(99) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 16 * y;
+		result_0 = 32 * z * (helper_0 * x + helper_0 * z + 4 * pow(x, 2) + 8 * x * z - 7 * x + 12 * pow(y, 2) - 14 * y + 4 * pow(z, 2) - 7 * z + 3);
+		val.col(100) = result_0.matrix();
+		}
+		{
+		const auto helper_0 = 16 * z;
+		result_0 = 32 * y * (helper_0 * x + helper_0 * y + 4 * pow(x, 2) + 8 * x * y - 7 * x + 4 * pow(y, 2) - 7 * y + 12 * pow(z, 2) - 14 * z + 3);
+		val.col(101) = result_0.matrix();
+		}
+	}
+	{
+		{
+		result_0 = -256 * y * z * (2 * x + y + z - 1);
+		val.col(102) = result_0.matrix();
+		}
+		{
+		result_0 = -256 * x * z * (x + 2 * y + z - 1);
+		val.col(103) = result_0.matrix();
+		}
+		{
+		result_0 = -256 * x * y * (x + y + 2 * z - 1);
+		val.col(104) = result_0.matrix();
+		}
+	}
+}
+
+void q_0_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 1);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0.setOnes();
+		val.col(0) = result_0.matrix();
+	}
+}
+
+void q_1_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 4);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = 1.0*(x - 1)*(y - 1);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*x*(y - 1);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*y;
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*y*(x - 1);
+		val.col(3) = result_0.matrix();
+	}
+}
+
+void q_2_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 9);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = 1.0*(x - 1)*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*y*(2.0*x - 1.0)*(2.0*y - 1.0);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*y*(x - 1)*(2.0*x - 1.0)*(2.0*y - 1.0);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*(x - 1)*(y - 1)*(2.0*y - 1.0);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*y*(2.0*x - 1.0)*(y - 1);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*y*(x - 1)*(2.0*y - 1.0);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*y*(x - 1)*(2.0*x - 1.0)*(y - 1);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		result_0 = 16.0*x*y*(x - 1)*(y - 1);
+		val.col(8) = result_0.matrix();
+	}
+}
+
+void q_3_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 16);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = 1.0*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*(x - 1)*(3.0*x - 2.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*(x - 1)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 2.0);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 1.0);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*y*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996);
+		val.col(8) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*y*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996);
+		val.col(9) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0);
+		val.col(10) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0);
+		val.col(11) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 2.0);
+		val.col(12) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 1.0);
+		val.col(13) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0);
+		val.col(14) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0);
+		val.col(15) = result_0.matrix();
+	}
+}
+
+void q_m2_fused_basis_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 8);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = -1.0*(x - 1)*(y - 1)*(2*x + 2*y - 1);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*(y - 1)*(-2*x + 2*y + 1);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = x*y*(2.0*x + 2.0*y - 3.0);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*y*(x - 1)*(2*x - 2*y + 1);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = 4*x*(x - 1)*(y - 1);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = -4*x*y*(y - 1);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = -4*x*y*(x - 1);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = 4*y*(x - 1)*(y - 1);
+		val.col(7) = result_0.matrix();
+	}
+}
+
+void q_0_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 2);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{result_0.setZero();val.col(0) = result_0.matrix(); }{result_0.setZero();val.col(1) = result_0.matrix(); }
+	}
+}
+
+void q_1_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 8);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{result_0 = 1.0*(y - 1);val.col(0) = result_0.matrix(); }{result_0 = 1.0*(x - 1);val.col(1) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 1.0*(1 - y);val.col(2) = result_0.matrix(); }{result_0 = -1.0*x;val.col(3) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 1.0*y;val.col(4) = result_0.matrix(); }{result_0 = 1.0*x;val.col(5) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -1.0*y;val.col(6) = result_0.matrix(); }{result_0 = 1.0*(1 - x);val.col(7) = result_0.matrix(); }
+	}
+}
+
+void q_2_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 18);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{result_0 = (4.0*x - 3.0)*(y - 1)*(2.0*y - 1.0);val.col(0) = result_0.matrix(); }{result_0 = (x - 1)*(2.0*x - 1.0)*(4.0*y - 3.0);val.col(1) = result_0.matrix(); }
+	}
+	{
+		{result_0 = (4.0*x - 1.0)*(y - 1)*(2.0*y - 1.0);val.col(2) = result_0.matrix(); }{result_0 = x*(2.0*x - 1.0)*(4.0*y - 3.0);val.col(3) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*(4.0*x - 1.0)*(2.0*y - 1.0);val.col(4) = result_0.matrix(); }{result_0 = x*(2.0*x - 1.0)*(4.0*y - 1.0);val.col(5) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*(4.0*x - 3.0)*(2.0*y - 1.0);val.col(6) = result_0.matrix(); }{result_0 = (x - 1)*(2.0*x - 1.0)*(4.0*y - 1.0);val.col(7) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4.0*(2*x - 1)*(y - 1)*(2.0*y - 1.0);val.col(8) = result_0.matrix(); }{result_0 = -x*(x - 1)*(16.0*y - 12.0);val.col(9) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*(16.0*x - 4.0)*(y - 1);val.col(10) = result_0.matrix(); }{result_0 = -4.0*x*(2.0*x - 1.0)*(2*y - 1);val.col(11) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4.0*y*(2*x - 1)*(2.0*y - 1.0);val.col(12) = result_0.matrix(); }{result_0 = -x*(x - 1)*(16.0*y - 4.0);val.col(13) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*(16.0*x - 12.0)*(y - 1);val.col(14) = result_0.matrix(); }{result_0 = -4.0*(x - 1)*(2.0*x - 1.0)*(2*y - 1);val.col(15) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 16.0*y*(2*x - 1)*(y - 1);val.col(16) = result_0.matrix(); }{result_0 = 16.0*x*(x - 1)*(2*y - 1);val.col(17) = result_0.matrix(); }
+	}
+}
+
+void q_3_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 32);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = (y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(0) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = (x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(1) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*x;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = -(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(2) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(3) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*x;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = y*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(4) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*y;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(5) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -y*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(6) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*y;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = -(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(7) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 8.9999999999999982;
+		result_0 = -(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(8) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -x*(x - 1)*(3.0*x - 2.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(9) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 4.4999999999999991;
+		result_0 = (y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(10) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = x*(x - 1)*(3.0*x - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(11) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = y*(y - 1)*(3.0*y - 2.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(12) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 8.9999999999999982;
+		result_0 = x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(13) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = -y*(y - 1)*(3.0*y - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(14) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 4.4999999999999991;
+		result_0 = -x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(15) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 4.4999999999999991;
+		result_0 = -y*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(16) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = -x*(x - 1)*(3.0*x - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(17) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 8.9999999999999982;
+		result_0 = y*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(18) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = x*(x - 1)*(3.0*x - 2.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(19) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = y*(y - 1)*(3.0*y - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(20) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 4.4999999999999991;
+		result_0 = (x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(21) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -y*(y - 1)*(3.0*y - 2.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(22) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 8.9999999999999982;
+		result_0 = -(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(23) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = y*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(24) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = x*(x - 1)*(3.0*x - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(25) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = -y*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(26) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = -x*(x - 1)*(3.0*x - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(27) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = -y*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(28) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = -x*(x - 1)*(3.0*x - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(29) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = y*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(30) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = x*(x - 1)*(3.0*x - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(31) = result_0.matrix(); }
+	}
+}
+
+void q_m2_fused_basis_grad_value_2d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 2);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+
+	val.resize(uv.rows(), 16);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{result_0 = -(y - 1)*(4.0*x + 2.0*y - 3.0);val.col(0) = result_0.matrix(); }{result_0 = -(x - 1)*(2.0*x + 4.0*y - 3.0);val.col(1) = result_0.matrix(); }
+	}
+	{
+		{result_0 = (y - 1)*(-4.0*x + 2*y + 1);val.col(2) = result_0.matrix(); }{result_0 = -x*(2.0*x - 4.0*y + 1.0);val.col(3) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*(4.0*x + 2.0*y - 3.0);val.col(4) = result_0.matrix(); }{result_0 = x*(2.0*x + 4.0*y - 3.0);val.col(5) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*(-4.0*x + 2.0*y + 1.0);val.col(6) = result_0.matrix(); }{result_0 = (x - 1)*(2.0*x - 4.0*y + 1.0);val.col(7) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 4*(2*x - 1)*(y - 1);val.col(8) = result_0.matrix(); }{result_0 = 4*x*(x - 1);val.col(9) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4*y*(y - 1);val.col(10) = result_0.matrix(); }{result_0 = -4*x*(2*y - 1);val.col(11) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4*y*(2*x - 1);val.col(12) = result_0.matrix(); }{result_0 = -4*x*(x - 1);val.col(13) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 4*y*(y - 1);val.col(14) = result_0.matrix(); }{result_0 = 4*(x - 1)*(2*y - 1);val.col(15) = result_0.matrix(); }
+	}
+}
+
+void q_0_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 1);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0.setOnes();
+		val.col(0) = result_0.matrix();
+	}
+}
+
+void q_1_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 8);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = -1.0*(x - 1)*(y - 1)*(z - 1);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*(y - 1)*(z - 1);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*x*y*(z - 1);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*y*(x - 1)*(z - 1);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*z*(x - 1)*(y - 1);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*x*z*(y - 1);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*y*z;
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*y*z*(x - 1);
+		val.col(7) = result_0.matrix();
+	}
+}
+
+void q_2_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 27);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = 1.0*(x - 1)*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*y*(2.0*x - 1.0)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*y*(x - 1)*(2.0*x - 1.0)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*z*(x - 1)*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(2.0*z - 1.0);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*z*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(2.0*z - 1.0);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*y*z*(2.0*x - 1.0)*(2.0*y - 1.0)*(2.0*z - 1.0);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*y*z*(x - 1)*(2.0*x - 1.0)*(2.0*y - 1.0)*(2.0*z - 1.0);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*(x - 1)*(y - 1)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);
+		val.col(8) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*y*(2.0*x - 1.0)*(y - 1)*(z - 1)*(2.0*z - 1.0);
+		val.col(9) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*y*(x - 1)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);
+		val.col(10) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*y*(x - 1)*(2.0*x - 1.0)*(y - 1)*(z - 1)*(2.0*z - 1.0);
+		val.col(11) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*z*(x - 1)*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(z - 1);
+		val.col(12) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*z*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(z - 1);
+		val.col(13) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*y*z*(2.0*x - 1.0)*(2.0*y - 1.0)*(z - 1);
+		val.col(14) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*y*z*(x - 1)*(2.0*x - 1.0)*(2.0*y - 1.0)*(z - 1);
+		val.col(15) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*z*(x - 1)*(y - 1)*(2.0*y - 1.0)*(2.0*z - 1.0);
+		val.col(16) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*y*z*(2.0*x - 1.0)*(y - 1)*(2.0*z - 1.0);
+		val.col(17) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*x*y*z*(x - 1)*(2.0*y - 1.0)*(2.0*z - 1.0);
+		val.col(18) = result_0.matrix();
+	}
+	{
+		result_0 = -4.0*y*z*(x - 1)*(2.0*x - 1.0)*(y - 1)*(2.0*z - 1.0);
+		val.col(19) = result_0.matrix();
+	}
+	{
+		result_0 = 16.0*y*z*(x - 1)*(2.0*x - 1.0)*(y - 1)*(z - 1);
+		val.col(20) = result_0.matrix();
+	}
+	{
+		result_0 = 16.0*x*y*z*(2.0*x - 1.0)*(y - 1)*(z - 1);
+		val.col(21) = result_0.matrix();
+	}
+	{
+		result_0 = 16.0*x*z*(x - 1)*(y - 1)*(2.0*y - 1.0)*(z - 1);
+		val.col(22) = result_0.matrix();
+	}
+	{
+		result_0 = 16.0*x*y*z*(x - 1)*(2.0*y - 1.0)*(z - 1);
+		val.col(23) = result_0.matrix();
+	}
+	{
+		result_0 = 16.0*x*y*(x - 1)*(y - 1)*(z - 1)*(2.0*z - 1.0);
+		val.col(24) = result_0.matrix();
+	}
+	{
+		result_0 = 16.0*x*y*z*(x - 1)*(y - 1)*(2.0*z - 1.0);
+		val.col(25) = result_0.matrix();
+	}
+	{
+		result_0 = -64.0*x*y*z*(x - 1)*(y - 1)*(z - 1);
+		val.col(26) = result_0.matrix();
+	}
+}
+
+void q_3_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 64);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = -1.0*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*x*y*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*y*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*(x - 1)*(3.0*x - 2.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(8) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*(x - 1)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(9) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(10) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(11) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*y*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(12) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*y*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(13) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(14) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(15) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(16) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(17) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(18) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(19) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*y*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0);
+		val.col(20) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*y*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0);
+		val.col(21) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*y*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0);
+		val.col(22) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*y*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0);
+		val.col(23) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*z*(x - 1)*(3.0*x - 2.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(24) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*z*(x - 1)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(25) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*y*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(26) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*y*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(27) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*x*y*z*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(28) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*x*y*z*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(29) = result_0.matrix();
+	}
+	{
+		result_0 = 4.4999999999999991*y*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(30) = result_0.matrix();
+	}
+	{
+		result_0 = -4.4999999999999991*y*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(31) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*y*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(32) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*y*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(33) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*y*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(34) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*y*z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(35) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(36) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(37) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(38) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(39) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*z*(x - 1)*(3.0*x - 2.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(40) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*z*(x - 1)*(3.0*x - 2.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(41) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*z*(x - 1)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(42) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*z*(x - 1)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(43) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*z*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0);
+		val.col(44) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*z*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0);
+		val.col(45) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*z*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0);
+		val.col(46) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*z*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0);
+		val.col(47) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(48) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(49) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(50) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0);
+		val.col(51) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*z*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(52) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*z*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(53) = result_0.matrix();
+	}
+	{
+		result_0 = -20.249999999999993*x*y*z*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(54) = result_0.matrix();
+	}
+	{
+		result_0 = 20.249999999999993*x*y*z*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996);
+		val.col(55) = result_0.matrix();
+	}
+	{
+		result_0 = 91.124999999999957*x*y*z*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(56) = result_0.matrix();
+	}
+	{
+		result_0 = -91.124999999999957*x*y*z*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(57) = result_0.matrix();
+	}
+	{
+		result_0 = -91.124999999999957*x*y*z*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(58) = result_0.matrix();
+	}
+	{
+		result_0 = 91.124999999999957*x*y*z*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(59) = result_0.matrix();
+	}
+	{
+		result_0 = -91.124999999999957*x*y*z*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(60) = result_0.matrix();
+	}
+	{
+		result_0 = 91.124999999999957*x*y*z*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(61) = result_0.matrix();
+	}
+	{
+		result_0 = 91.124999999999957*x*y*z*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0);
+		val.col(62) = result_0.matrix();
+	}
+	{
+		result_0 = -91.124999999999957*x*y*z*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0);
+		val.col(63) = result_0.matrix();
+	}
+}
+
+void q_m2_fused_basis_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 20);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		result_0 = 1.0*(x - 1)*(y - 1)*(z - 1)*(2*x + 2*y + 2*z - 1);
+		val.col(0) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*x*(y - 1)*(z - 1)*(-2*x + 2*y + 2*z + 1);
+		val.col(1) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*x*y*(z - 1)*(2*x + 2*y - 2*z - 3);
+		val.col(2) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*y*(x - 1)*(z - 1)*(2*x - 2*y + 2*z + 1);
+		val.col(3) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*z*(x - 1)*(y - 1)*(2*x + 2*y - 2*z + 1);
+		val.col(4) = result_0.matrix();
+	}
+	{
+		result_0 = -1.0*x*z*(y - 1)*(2*x - 2*y + 2*z - 3);
+		val.col(5) = result_0.matrix();
+	}
+	{
+		result_0 = x*y*z*(2.0*x + 2.0*y + 2.0*z - 5.0);
+		val.col(6) = result_0.matrix();
+	}
+	{
+		result_0 = 1.0*y*z*(x - 1)*(2*x - 2*y - 2*z + 3);
+		val.col(7) = result_0.matrix();
+	}
+	{
+		result_0 = -4*x*(x - 1)*(y - 1)*(z - 1);
+		val.col(8) = result_0.matrix();
+	}
+	{
+		result_0 = 4*x*y*(y - 1)*(z - 1);
+		val.col(9) = result_0.matrix();
+	}
+	{
+		result_0 = 4*x*y*(x - 1)*(z - 1);
+		val.col(10) = result_0.matrix();
+	}
+	{
+		result_0 = -4*y*(x - 1)*(y - 1)*(z - 1);
+		val.col(11) = result_0.matrix();
+	}
+	{
+		result_0 = -4*z*(x - 1)*(y - 1)*(z - 1);
+		val.col(12) = result_0.matrix();
+	}
+	{
+		result_0 = 4*x*z*(y - 1)*(z - 1);
+		val.col(13) = result_0.matrix();
+	}
+	{
+		result_0 = -4*x*y*z*(z - 1);
+		val.col(14) = result_0.matrix();
+	}
+	{
+		result_0 = 4*y*z*(x - 1)*(z - 1);
+		val.col(15) = result_0.matrix();
+	}
+	{
+		result_0 = 4*x*z*(x - 1)*(y - 1);
+		val.col(16) = result_0.matrix();
+	}
+	{
+		result_0 = -4*x*y*z*(y - 1);
+		val.col(17) = result_0.matrix();
+	}
+	{
+		result_0 = -4*x*y*z*(x - 1);
+		val.col(18) = result_0.matrix();
+	}
+	{
+		result_0 = 4*y*z*(x - 1)*(y - 1);
+		val.col(19) = result_0.matrix();
+	}
+}
+
+void q_0_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 3);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{result_0.setZero();val.col(0) = result_0.matrix(); }{result_0.setZero();val.col(1) = result_0.matrix(); }{result_0.setZero();val.col(2) = result_0.matrix(); }
+	}
+}
+
+void q_1_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 24);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{result_0 = -1.0*(y - 1)*(z - 1);val.col(0) = result_0.matrix(); }{result_0 = -1.0*(x - 1)*(z - 1);val.col(1) = result_0.matrix(); }{result_0 = -1.0*(x - 1)*(y - 1);val.col(2) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 1.0*(y - 1)*(z - 1);val.col(3) = result_0.matrix(); }{result_0 = 1.0*x*(z - 1);val.col(4) = result_0.matrix(); }{result_0 = 1.0*x*(y - 1);val.col(5) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -1.0*y*(z - 1);val.col(6) = result_0.matrix(); }{result_0 = -1.0*x*(z - 1);val.col(7) = result_0.matrix(); }{result_0 = -1.0*x*y;val.col(8) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 1.0*y*(z - 1);val.col(9) = result_0.matrix(); }{result_0 = 1.0*(x - 1)*(z - 1);val.col(10) = result_0.matrix(); }{result_0 = 1.0*y*(x - 1);val.col(11) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 1.0*z*(y - 1);val.col(12) = result_0.matrix(); }{result_0 = 1.0*z*(x - 1);val.col(13) = result_0.matrix(); }{result_0 = 1.0*(x - 1)*(y - 1);val.col(14) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -1.0*z*(y - 1);val.col(15) = result_0.matrix(); }{result_0 = -1.0*x*z;val.col(16) = result_0.matrix(); }{result_0 = -1.0*x*(y - 1);val.col(17) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 1.0*y*z;val.col(18) = result_0.matrix(); }{result_0 = 1.0*x*z;val.col(19) = result_0.matrix(); }{result_0 = 1.0*x*y;val.col(20) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -1.0*y*z;val.col(21) = result_0.matrix(); }{result_0 = -1.0*z*(x - 1);val.col(22) = result_0.matrix(); }{result_0 = -1.0*y*(x - 1);val.col(23) = result_0.matrix(); }
+	}
+}
+
+void q_2_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 81);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{result_0 = (4.0*x - 3.0)*(y - 1)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);val.col(0) = result_0.matrix(); }{result_0 = (x - 1)*(2.0*x - 1.0)*(4.0*y - 3.0)*(z - 1)*(2.0*z - 1.0);val.col(1) = result_0.matrix(); }{result_0 = (x - 1)*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(4.0*z - 3.0);val.col(2) = result_0.matrix(); }
+	}
+	{
+		{result_0 = (4.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);val.col(3) = result_0.matrix(); }{result_0 = x*(2.0*x - 1.0)*(4.0*y - 3.0)*(z - 1)*(2.0*z - 1.0);val.col(4) = result_0.matrix(); }{result_0 = x*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(4.0*z - 3.0);val.col(5) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*(4.0*x - 1.0)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);val.col(6) = result_0.matrix(); }{result_0 = x*(2.0*x - 1.0)*(4.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);val.col(7) = result_0.matrix(); }{result_0 = x*y*(2.0*x - 1.0)*(2.0*y - 1.0)*(4.0*z - 3.0);val.col(8) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*(4.0*x - 3.0)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);val.col(9) = result_0.matrix(); }{result_0 = (x - 1)*(2.0*x - 1.0)*(4.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);val.col(10) = result_0.matrix(); }{result_0 = y*(x - 1)*(2.0*x - 1.0)*(2.0*y - 1.0)*(4.0*z - 3.0);val.col(11) = result_0.matrix(); }
+	}
+	{
+		{result_0 = z*(4.0*x - 3.0)*(y - 1)*(2.0*y - 1.0)*(2.0*z - 1.0);val.col(12) = result_0.matrix(); }{result_0 = z*(x - 1)*(2.0*x - 1.0)*(4.0*y - 3.0)*(2.0*z - 1.0);val.col(13) = result_0.matrix(); }{result_0 = (x - 1)*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(4.0*z - 1.0);val.col(14) = result_0.matrix(); }
+	}
+	{
+		{result_0 = z*(4.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(2.0*z - 1.0);val.col(15) = result_0.matrix(); }{result_0 = x*z*(2.0*x - 1.0)*(4.0*y - 3.0)*(2.0*z - 1.0);val.col(16) = result_0.matrix(); }{result_0 = x*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(4.0*z - 1.0);val.col(17) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*z*(4.0*x - 1.0)*(2.0*y - 1.0)*(2.0*z - 1.0);val.col(18) = result_0.matrix(); }{result_0 = x*z*(2.0*x - 1.0)*(4.0*y - 1.0)*(2.0*z - 1.0);val.col(19) = result_0.matrix(); }{result_0 = x*y*(2.0*x - 1.0)*(2.0*y - 1.0)*(4.0*z - 1.0);val.col(20) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*z*(4.0*x - 3.0)*(2.0*y - 1.0)*(2.0*z - 1.0);val.col(21) = result_0.matrix(); }{result_0 = z*(x - 1)*(2.0*x - 1.0)*(4.0*y - 1.0)*(2.0*z - 1.0);val.col(22) = result_0.matrix(); }{result_0 = y*(x - 1)*(2.0*x - 1.0)*(2.0*y - 1.0)*(4.0*z - 1.0);val.col(23) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4.0*(2*x - 1)*(y - 1)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);val.col(24) = result_0.matrix(); }{result_0 = -x*(x - 1)*(16.0*y - 12.0)*(z - 1)*(2.0*z - 1.0);val.col(25) = result_0.matrix(); }{result_0 = -x*(x - 1)*(y - 1)*(2.0*y - 1.0)*(16.0*z - 12.0);val.col(26) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*(16.0*x - 4.0)*(y - 1)*(z - 1)*(2.0*z - 1.0);val.col(27) = result_0.matrix(); }{result_0 = -4.0*x*(2.0*x - 1.0)*(2*y - 1)*(z - 1)*(2.0*z - 1.0);val.col(28) = result_0.matrix(); }{result_0 = -x*y*(2.0*x - 1.0)*(y - 1)*(16.0*z - 12.0);val.col(29) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4.0*y*(2*x - 1)*(2.0*y - 1.0)*(z - 1)*(2.0*z - 1.0);val.col(30) = result_0.matrix(); }{result_0 = -x*(x - 1)*(16.0*y - 4.0)*(z - 1)*(2.0*z - 1.0);val.col(31) = result_0.matrix(); }{result_0 = -x*y*(x - 1)*(2.0*y - 1.0)*(16.0*z - 12.0);val.col(32) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*(16.0*x - 12.0)*(y - 1)*(z - 1)*(2.0*z - 1.0);val.col(33) = result_0.matrix(); }{result_0 = -4.0*(x - 1)*(2.0*x - 1.0)*(2*y - 1)*(z - 1)*(2.0*z - 1.0);val.col(34) = result_0.matrix(); }{result_0 = -y*(x - 1)*(2.0*x - 1.0)*(y - 1)*(16.0*z - 12.0);val.col(35) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -z*(16.0*x - 12.0)*(y - 1)*(2.0*y - 1.0)*(z - 1);val.col(36) = result_0.matrix(); }{result_0 = -z*(x - 1)*(2.0*x - 1.0)*(16.0*y - 12.0)*(z - 1);val.col(37) = result_0.matrix(); }{result_0 = -4.0*(x - 1)*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(2*z - 1);val.col(38) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -z*(16.0*x - 4.0)*(y - 1)*(2.0*y - 1.0)*(z - 1);val.col(39) = result_0.matrix(); }{result_0 = -x*z*(2.0*x - 1.0)*(16.0*y - 12.0)*(z - 1);val.col(40) = result_0.matrix(); }{result_0 = -4.0*x*(2.0*x - 1.0)*(y - 1)*(2.0*y - 1.0)*(2*z - 1);val.col(41) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*z*(16.0*x - 4.0)*(2.0*y - 1.0)*(z - 1);val.col(42) = result_0.matrix(); }{result_0 = -x*z*(2.0*x - 1.0)*(16.0*y - 4.0)*(z - 1);val.col(43) = result_0.matrix(); }{result_0 = -4.0*x*y*(2.0*x - 1.0)*(2.0*y - 1.0)*(2*z - 1);val.col(44) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*z*(16.0*x - 12.0)*(2.0*y - 1.0)*(z - 1);val.col(45) = result_0.matrix(); }{result_0 = -z*(x - 1)*(2.0*x - 1.0)*(16.0*y - 4.0)*(z - 1);val.col(46) = result_0.matrix(); }{result_0 = -4.0*y*(x - 1)*(2.0*x - 1.0)*(2.0*y - 1.0)*(2*z - 1);val.col(47) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4.0*z*(2*x - 1)*(y - 1)*(2.0*y - 1.0)*(2.0*z - 1.0);val.col(48) = result_0.matrix(); }{result_0 = -x*z*(x - 1)*(16.0*y - 12.0)*(2.0*z - 1.0);val.col(49) = result_0.matrix(); }{result_0 = -x*(x - 1)*(y - 1)*(2.0*y - 1.0)*(16.0*z - 4.0);val.col(50) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*z*(16.0*x - 4.0)*(y - 1)*(2.0*z - 1.0);val.col(51) = result_0.matrix(); }{result_0 = -4.0*x*z*(2.0*x - 1.0)*(2*y - 1)*(2.0*z - 1.0);val.col(52) = result_0.matrix(); }{result_0 = -x*y*(2.0*x - 1.0)*(y - 1)*(16.0*z - 4.0);val.col(53) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4.0*y*z*(2*x - 1)*(2.0*y - 1.0)*(2.0*z - 1.0);val.col(54) = result_0.matrix(); }{result_0 = -x*z*(x - 1)*(16.0*y - 4.0)*(2.0*z - 1.0);val.col(55) = result_0.matrix(); }{result_0 = -x*y*(x - 1)*(2.0*y - 1.0)*(16.0*z - 4.0);val.col(56) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*z*(16.0*x - 12.0)*(y - 1)*(2.0*z - 1.0);val.col(57) = result_0.matrix(); }{result_0 = -4.0*z*(x - 1)*(2.0*x - 1.0)*(2*y - 1)*(2.0*z - 1.0);val.col(58) = result_0.matrix(); }{result_0 = -y*(x - 1)*(2.0*x - 1.0)*(y - 1)*(16.0*z - 4.0);val.col(59) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*z*(64.0*x - 48.0)*(y - 1)*(z - 1);val.col(60) = result_0.matrix(); }{result_0 = 16.0*z*(x - 1)*(2.0*x - 1.0)*(2*y - 1)*(z - 1);val.col(61) = result_0.matrix(); }{result_0 = 16.0*y*(x - 1)*(2.0*x - 1.0)*(y - 1)*(2*z - 1);val.col(62) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*z*(64.0*x - 16.0)*(y - 1)*(z - 1);val.col(63) = result_0.matrix(); }{result_0 = 16.0*x*z*(2.0*x - 1.0)*(2*y - 1)*(z - 1);val.col(64) = result_0.matrix(); }{result_0 = 16.0*x*y*(2.0*x - 1.0)*(y - 1)*(2*z - 1);val.col(65) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 16.0*z*(2*x - 1)*(y - 1)*(2.0*y - 1.0)*(z - 1);val.col(66) = result_0.matrix(); }{result_0 = x*z*(x - 1)*(64.0*y - 48.0)*(z - 1);val.col(67) = result_0.matrix(); }{result_0 = 16.0*x*(x - 1)*(y - 1)*(2.0*y - 1.0)*(2*z - 1);val.col(68) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 16.0*y*z*(2*x - 1)*(2.0*y - 1.0)*(z - 1);val.col(69) = result_0.matrix(); }{result_0 = x*z*(x - 1)*(64.0*y - 16.0)*(z - 1);val.col(70) = result_0.matrix(); }{result_0 = 16.0*x*y*(x - 1)*(2.0*y - 1.0)*(2*z - 1);val.col(71) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 16.0*y*(2*x - 1)*(y - 1)*(z - 1)*(2.0*z - 1.0);val.col(72) = result_0.matrix(); }{result_0 = 16.0*x*(x - 1)*(2*y - 1)*(z - 1)*(2.0*z - 1.0);val.col(73) = result_0.matrix(); }{result_0 = x*y*(x - 1)*(y - 1)*(64.0*z - 48.0);val.col(74) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 16.0*y*z*(2*x - 1)*(y - 1)*(2.0*z - 1.0);val.col(75) = result_0.matrix(); }{result_0 = 16.0*x*z*(x - 1)*(2*y - 1)*(2.0*z - 1.0);val.col(76) = result_0.matrix(); }{result_0 = x*y*(x - 1)*(y - 1)*(64.0*z - 16.0);val.col(77) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -64.0*y*z*(2*x - 1)*(y - 1)*(z - 1);val.col(78) = result_0.matrix(); }{result_0 = -64.0*x*z*(x - 1)*(2*y - 1)*(z - 1);val.col(79) = result_0.matrix(); }{result_0 = -64.0*x*y*(x - 1)*(y - 1)*(2*z - 1);val.col(80) = result_0.matrix(); }
+	}
+}
+
+void q_3_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 192);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(0) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(1) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = -(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(2) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*x;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = (y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(3) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(4) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(5) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*x;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = -y*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(6) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*y;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = -x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(7) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = -x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(8) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = y*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(9) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*y;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = (x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(10) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(11) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(12) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(13) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*z;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = (x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(14) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*x;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = -z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(15) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(16) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*z;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = -x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(17) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*x;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(18) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*y;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(19) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*z;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(20) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(3.0*helper_0*helper_1 + 1.5*helper_0*helper_2 + 1.0*helper_1*helper_2);val.col(21) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*y;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = -z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(22) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z;
+		const auto helper_1 = helper_0 - 0.49999999999999989;
+		const auto helper_2 = 2.9999999999999996*z;
+		const auto helper_3 = helper_2 - 1.9999999999999996;
+		result_0 = -y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_3 + helper_1*helper_2 + 1.0*helper_1*helper_3);val.col(23) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 8.9999999999999982;
+		result_0 = (y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(24) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = x*(x - 1)*(3.0*x - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(25) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = x*(x - 1)*(3.0*x - 2.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(26) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 4.4999999999999991;
+		result_0 = -(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(27) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -x*(x - 1)*(3.0*x - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(28) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = -x*(x - 1)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(29) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = -y*(y - 1)*(3.0*y - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(30) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 8.9999999999999982;
+		result_0 = -x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(31) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = -x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 2.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(32) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = y*(y - 1)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(33) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 4.4999999999999991;
+		result_0 = x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(34) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(35) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 4.4999999999999991;
+		result_0 = y*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(36) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = x*(x - 1)*(3.0*x - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(37) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = x*y*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(38) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 8.9999999999999982;
+		result_0 = -y*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(39) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = -x*(x - 1)*(3.0*x - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(40) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = -x*y*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(41) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -y*(y - 1)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(42) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 4.4999999999999991;
+		result_0 = -(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(43) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = -y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(44) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = y*(y - 1)*(3.0*y - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(45) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 8.9999999999999982;
+		result_0 = (x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(46) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(47) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(48) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 2.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(49) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 13.499999999999996*z - 8.9999999999999982;
+		result_0 = (x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*z + helper_1*z);val.col(50) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(51) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(52) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 13.499999999999996*z - 4.4999999999999991;
+		result_0 = -(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*z + helper_1*z);val.col(53) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(54) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(55) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 13.499999999999996*z - 4.4999999999999991;
+		result_0 = x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*z + helper_1*z);val.col(56) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = -z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(57) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(58) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 13.499999999999996*z - 8.9999999999999982;
+		result_0 = -x*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 13.499999999999998*helper_0*z + helper_1*z);val.col(59) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = -y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(60) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = -x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(61) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 13.499999999999996*z - 4.4999999999999991;
+		result_0 = -x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*z + helper_1*z);val.col(62) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(63) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(64) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 13.499999999999996*z - 8.9999999999999982;
+		result_0 = x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*z + helper_1*z);val.col(65) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(66) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(67) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 13.499999999999996*z - 4.4999999999999991;
+		result_0 = y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*z + helper_1*z);val.col(68) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(69) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = -z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 2.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(70) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 13.499999999999996*z - 8.9999999999999982;
+		result_0 = -y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*z + helper_1*z);val.col(71) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 8.9999999999999982;
+		result_0 = -z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(72) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -x*z*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(73) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = -x*(x - 1)*(3.0*x - 2.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*z + 6.7499999999999973*helper_1*z);val.col(74) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 4.4999999999999991;
+		result_0 = z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(75) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = x*z*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(76) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = x*(x - 1)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*z + 6.7499999999999973*helper_1*z);val.col(77) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = y*z*(y - 1)*(3.0*y - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(78) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 8.9999999999999982;
+		result_0 = x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(79) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 2.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*z + 6.7499999999999973*helper_1*z);val.col(80) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = -y*z*(y - 1)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*x + 6.7499999999999973*helper_1*x);val.col(81) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 4.4999999999999991;
+		result_0 = -x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(82) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = -x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*z + 6.7499999999999973*helper_1*z);val.col(83) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 4.4999999999999991;
+		result_0 = -y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(84) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = -x*z*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(85) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = -x*y*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*z + 6.7499999999999973*helper_1*z);val.col(86) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 13.499999999999996*x - 8.9999999999999982;
+		result_0 = y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*x + helper_1*x);val.col(87) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = x*z*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*y + 6.7499999999999973*helper_1*y);val.col(88) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = x*y*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*z + 6.7499999999999973*helper_1*z);val.col(89) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = y*z*(y - 1)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(90) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 4.4999999999999991;
+		result_0 = z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(91) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*z + 6.7499999999999973*helper_1*z);val.col(92) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -y*z*(y - 1)*(3.0*y - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(13.499999999999998*helper_0*helper_1 + 6.7499999999999991*helper_0*helper_2 + 4.4999999999999991*helper_1*helper_2);val.col(93) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 13.499999999999996*y - 8.9999999999999982;
+		result_0 = -z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 13.499999999999998*helper_0*y + helper_1*y);val.col(94) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = -y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(4.4999999999999991*helper_0*helper_1 + 13.499999999999995*helper_0*z + 6.7499999999999973*helper_1*z);val.col(95) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -y*z*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(96) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = -z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(97) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 20.249999999999993;
+		result_0 = -y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(98) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = y*z*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(99) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(100) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 40.499999999999986;
+		result_0 = y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(101) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = y*z*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 1.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(102) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(103) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 20.249999999999993;
+		result_0 = y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(104) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 1.5*x - 1.0;
+		const auto helper_2 = 3.0*x - 1.0;
+		result_0 = -y*z*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 2.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(105) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = -z*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(106) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 40.499999999999986;
+		result_0 = -y*(x - 1)*(1.5*x - 1.0)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(107) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = y*z*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 2.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*x + 30.374999999999986*helper_1*x);val.col(108) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(109) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 40.499999999999986;
+		result_0 = x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(110) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = -y*z*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 1.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*x + 30.374999999999986*helper_1*x);val.col(111) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = -x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(112) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 20.249999999999993;
+		result_0 = -x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(113) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = -y*z*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*x + 30.374999999999986*helper_1*x);val.col(114) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = -x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(115) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 40.499999999999986;
+		result_0 = -x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(116) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = 1.4999999999999998*x - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*x - 1.9999999999999996;
+		result_0 = y*z*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*x + 30.374999999999986*helper_1*x);val.col(117) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = x*z*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(118) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 20.249999999999993;
+		result_0 = x*y*(1.4999999999999998*x - 0.49999999999999989)*(2.9999999999999996*x - 1.9999999999999996)*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(119) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = -z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(120) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -x*z*(x - 1)*(3.0*x - 2.0)*(z - 1)*(3.0*z - 2.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(121) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 40.499999999999986;
+		result_0 = -x*(x - 1)*(3.0*x - 2.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(122) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(123) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = x*z*(x - 1)*(3.0*x - 2.0)*(z - 1)*(3.0*z - 1.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(124) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 20.249999999999993;
+		result_0 = x*(x - 1)*(3.0*x - 2.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(125) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(126) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = x*z*(x - 1)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 2.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(127) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 40.499999999999986;
+		result_0 = x*(x - 1)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(128) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = -z*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(129) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 1.5*y - 1.0;
+		const auto helper_2 = 3.0*y - 1.0;
+		result_0 = -x*z*(x - 1)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 1.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(130) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 20.249999999999993;
+		result_0 = -x*(x - 1)*(3.0*x - 1.0)*(y - 1)*(1.5*y - 1.0)*(3.0*y - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(131) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(132) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = x*z*(x - 1)*(3.0*x - 2.0)*(z - 1)*(3.0*z - 2.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*y + 30.374999999999986*helper_1*y);val.col(133) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 40.499999999999986;
+		result_0 = x*y*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(134) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = -y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(135) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = -x*z*(x - 1)*(3.0*x - 2.0)*(z - 1)*(3.0*z - 1.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*y + 30.374999999999986*helper_1*y);val.col(136) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 20.249999999999993;
+		result_0 = -x*y*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(137) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = -y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(138) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = -x*z*(x - 1)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 2.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*y + 30.374999999999986*helper_1*y);val.col(139) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 40.499999999999986;
+		result_0 = -x*y*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(140) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = y*z*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(141) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*y - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*y - 1.9999999999999996;
+		result_0 = x*z*(x - 1)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 1.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*y + 30.374999999999986*helper_1*y);val.col(142) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 60.749999999999979*z - 20.249999999999993;
+		result_0 = x*y*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*y - 0.49999999999999989)*(2.9999999999999996*y - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*z + helper_1*z);val.col(143) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = -y*(y - 1)*(3.0*y - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(144) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = -x*(x - 1)*(3.0*x - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(145) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = -x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 2.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(146) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = y*(y - 1)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(147) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = x*(x - 1)*(3.0*x - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(148) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 1.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(149) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = y*(y - 1)*(3.0*y - 2.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(150) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = x*(x - 1)*(3.0*x - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(151) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(152) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = -y*(y - 1)*(3.0*y - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(153) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = -x*(x - 1)*(3.0*x - 1.0)*(z - 1)*(1.5*z - 1.0)*(3.0*z - 1.0)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(154) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 1.5*z - 1.0;
+		const auto helper_2 = 3.0*z - 1.0;
+		result_0 = -x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(60.749999999999979*helper_0*helper_1 + 30.374999999999989*helper_0*helper_2 + 20.249999999999993*helper_1*helper_2);val.col(155) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = y*z*(y - 1)*(3.0*y - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(156) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = x*z*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(157) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 2.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*z + 30.374999999999986*helper_1*z);val.col(158) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 40.499999999999986;
+		result_0 = -y*z*(y - 1)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(159) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = -x*z*(x - 1)*(3.0*x - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(160) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = -x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 1.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*z + 30.374999999999986*helper_1*z);val.col(161) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = -y*z*(y - 1)*(3.0*y - 2.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(162) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 40.499999999999986;
+		result_0 = -x*z*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(163) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = -x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*z + 30.374999999999986*helper_1*z);val.col(164) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 60.749999999999979*x - 20.249999999999993;
+		result_0 = y*z*(y - 1)*(3.0*y - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*x + helper_1*x);val.col(165) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 60.749999999999979*y - 20.249999999999993;
+		result_0 = x*z*(x - 1)*(3.0*x - 1.0)*(1.4999999999999998*z - 0.49999999999999989)*(2.9999999999999996*z - 1.9999999999999996)*(helper_0*helper_1 + 60.749999999999979*helper_0*y + helper_1*y);val.col(166) = result_0.matrix(); }{const auto helper_0 = 1.4999999999999998*z - 0.49999999999999989;
+		const auto helper_1 = 2.9999999999999996*z - 1.9999999999999996;
+		result_0 = x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(20.249999999999993*helper_0*helper_1 + 60.749999999999972*helper_0*z + 30.374999999999986*helper_1*z);val.col(167) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 273.37499999999989*x - 182.24999999999991;
+		result_0 = y*z*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*x + helper_1*x);val.col(168) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 273.37499999999989*y - 182.24999999999991;
+		result_0 = x*z*(x - 1)*(3.0*x - 2.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*y + helper_1*y);val.col(169) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 273.37499999999989*z - 182.24999999999991;
+		result_0 = x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*z + helper_1*z);val.col(170) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 273.37499999999989*x - 182.24999999999991;
+		result_0 = -y*z*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*x + helper_1*x);val.col(171) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 273.37499999999989*y - 182.24999999999991;
+		result_0 = -x*z*(x - 1)*(3.0*x - 2.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*y + helper_1*y);val.col(172) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 273.37499999999989*z - 91.124999999999957;
+		result_0 = -x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*z + helper_1*z);val.col(173) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 273.37499999999989*x - 182.24999999999991;
+		result_0 = -y*z*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*x + helper_1*x);val.col(174) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 273.37499999999989*y - 91.124999999999957;
+		result_0 = -x*z*(x - 1)*(3.0*x - 2.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*y + helper_1*y);val.col(175) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 273.37499999999989*z - 182.24999999999991;
+		result_0 = -x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*z + helper_1*z);val.col(176) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 273.37499999999989*x - 182.24999999999991;
+		result_0 = y*z*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*x + helper_1*x);val.col(177) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 273.37499999999989*y - 91.124999999999957;
+		result_0 = x*z*(x - 1)*(3.0*x - 2.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*y + helper_1*y);val.col(178) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 273.37499999999989*z - 91.124999999999957;
+		result_0 = x*y*(x - 1)*(3.0*x - 2.0)*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*z + helper_1*z);val.col(179) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 273.37499999999989*x - 91.124999999999957;
+		result_0 = -y*z*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*x + helper_1*x);val.col(180) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 273.37499999999989*y - 182.24999999999991;
+		result_0 = -x*z*(x - 1)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*y + helper_1*y);val.col(181) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 273.37499999999989*z - 182.24999999999991;
+		result_0 = -x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*z + helper_1*z);val.col(182) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 273.37499999999989*x - 91.124999999999957;
+		result_0 = y*z*(y - 1)*(3.0*y - 2.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*x + helper_1*x);val.col(183) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 273.37499999999989*y - 182.24999999999991;
+		result_0 = x*z*(x - 1)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*y + helper_1*y);val.col(184) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 273.37499999999989*z - 91.124999999999957;
+		result_0 = x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*z + helper_1*z);val.col(185) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 273.37499999999989*x - 91.124999999999957;
+		result_0 = y*z*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*x + helper_1*x);val.col(186) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 273.37499999999989*y - 91.124999999999957;
+		result_0 = x*z*(x - 1)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 2.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*y + helper_1*y);val.col(187) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 273.37499999999989*z - 182.24999999999991;
+		result_0 = x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*z + helper_1*z);val.col(188) = result_0.matrix(); }
+	}
+	{
+		{const auto helper_0 = x - 1;
+		const auto helper_1 = 273.37499999999989*x - 91.124999999999957;
+		result_0 = -y*z*(y - 1)*(3.0*y - 1.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*x + helper_1*x);val.col(189) = result_0.matrix(); }{const auto helper_0 = y - 1;
+		const auto helper_1 = 273.37499999999989*y - 91.124999999999957;
+		result_0 = -x*z*(x - 1)*(3.0*x - 1.0)*(z - 1)*(3.0*z - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*y + helper_1*y);val.col(190) = result_0.matrix(); }{const auto helper_0 = z - 1;
+		const auto helper_1 = 273.37499999999989*z - 91.124999999999957;
+		result_0 = -x*y*(x - 1)*(3.0*x - 1.0)*(y - 1)*(3.0*y - 1.0)*(helper_0*helper_1 + 273.37499999999989*helper_0*z + helper_1*z);val.col(191) = result_0.matrix(); }
+	}
+}
+
+void q_m2_fused_basis_grad_value_3d(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)
+{
+	assert(uv.cols() == 3);
+	auto x = uv.col(0).array();
+	auto y = uv.col(1).array();
+	auto z = uv.col(2).array();
+
+	val.resize(uv.rows(), 60);
+	Eigen::ArrayXd result_0(uv.rows());
+	{
+		{result_0 = (y - 1)*(z - 1)*(4.0*x + 2*y + 2*z - 3.0);val.col(0) = result_0.matrix(); }{result_0 = (x - 1)*(z - 1)*(2.0*x + 4.0*y + 2.0*z - 3.0);val.col(1) = result_0.matrix(); }{result_0 = (x - 1)*(y - 1)*(2.0*x + 2.0*y + 4.0*z - 3.0);val.col(2) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -(y - 1)*(z - 1)*(-4.0*x + 2.0*y + 2.0*z + 1.0);val.col(3) = result_0.matrix(); }{result_0 = x*(z - 1)*(2.0*x - 4.0*y - 2.0*z + 1.0);val.col(4) = result_0.matrix(); }{result_0 = x*(y - 1)*(2.0*x - 2.0*y - 4.0*z + 1.0);val.col(5) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*(z - 1)*(4.0*x + 2.0*y - 2.0*z - 3.0);val.col(6) = result_0.matrix(); }{result_0 = -x*(z - 1)*(2.0*x + 4.0*y - 2.0*z - 3.0);val.col(7) = result_0.matrix(); }{result_0 = -x*y*(2.0*x + 2.0*y - 4.0*z - 1.0);val.col(8) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -y*(z - 1)*(4.0*x - 2.0*y + 2.0*z - 1.0);val.col(9) = result_0.matrix(); }{result_0 = -(x - 1)*(z - 1)*(2.0*x - 4.0*y + 2.0*z + 1.0);val.col(10) = result_0.matrix(); }{result_0 = -y*(x - 1)*(2.0*x - 2.0*y + 4.0*z - 1.0);val.col(11) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -z*(y - 1)*(4.0*x + 2.0*y - 2.0*z - 1.0);val.col(12) = result_0.matrix(); }{result_0 = -z*(x - 1)*(2.0*x + 4.0*y - 2.0*z - 1.0);val.col(13) = result_0.matrix(); }{result_0 = -(x - 1)*(y - 1)*(2.0*x + 2.0*y - 4.0*z + 1.0);val.col(14) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -z*(y - 1)*(4.0*x - 2.0*y + 2.0*z - 3.0);val.col(15) = result_0.matrix(); }{result_0 = -x*z*(2.0*x - 4.0*y + 2.0*z - 1.0);val.col(16) = result_0.matrix(); }{result_0 = -x*(y - 1)*(2.0*x - 2.0*y + 4.0*z - 3.0);val.col(17) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*z*(4.0*x + 2.0*y + 2.0*z - 5.0);val.col(18) = result_0.matrix(); }{result_0 = x*z*(2.0*x + 4.0*y + 2.0*z - 5.0);val.col(19) = result_0.matrix(); }{result_0 = x*y*(2.0*x + 2.0*y + 4.0*z - 5.0);val.col(20) = result_0.matrix(); }
+	}
+	{
+		{result_0 = y*z*(4.0*x - 2.0*y - 2.0*z + 1.0);val.col(21) = result_0.matrix(); }{result_0 = z*(x - 1)*(2.0*x - 4.0*y - 2.0*z + 3.0);val.col(22) = result_0.matrix(); }{result_0 = y*(x - 1)*(2.0*x - 2.0*y - 4.0*z + 3.0);val.col(23) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4*(2*x - 1)*(y - 1)*(z - 1);val.col(24) = result_0.matrix(); }{result_0 = -4*x*(x - 1)*(z - 1);val.col(25) = result_0.matrix(); }{result_0 = -4*x*(x - 1)*(y - 1);val.col(26) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 4*y*(y - 1)*(z - 1);val.col(27) = result_0.matrix(); }{result_0 = 4*x*(2*y - 1)*(z - 1);val.col(28) = result_0.matrix(); }{result_0 = 4*x*y*(y - 1);val.col(29) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 4*y*(2*x - 1)*(z - 1);val.col(30) = result_0.matrix(); }{result_0 = 4*x*(x - 1)*(z - 1);val.col(31) = result_0.matrix(); }{result_0 = 4*x*y*(x - 1);val.col(32) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4*y*(y - 1)*(z - 1);val.col(33) = result_0.matrix(); }{result_0 = -4*(x - 1)*(2*y - 1)*(z - 1);val.col(34) = result_0.matrix(); }{result_0 = -4*y*(x - 1)*(y - 1);val.col(35) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4*z*(y - 1)*(z - 1);val.col(36) = result_0.matrix(); }{result_0 = -4*z*(x - 1)*(z - 1);val.col(37) = result_0.matrix(); }{result_0 = -4*(x - 1)*(y - 1)*(2*z - 1);val.col(38) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 4*z*(y - 1)*(z - 1);val.col(39) = result_0.matrix(); }{result_0 = 4*x*z*(z - 1);val.col(40) = result_0.matrix(); }{result_0 = 4*x*(y - 1)*(2*z - 1);val.col(41) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4*y*z*(z - 1);val.col(42) = result_0.matrix(); }{result_0 = -4*x*z*(z - 1);val.col(43) = result_0.matrix(); }{result_0 = -4*x*y*(2*z - 1);val.col(44) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 4*y*z*(z - 1);val.col(45) = result_0.matrix(); }{result_0 = 4*z*(x - 1)*(z - 1);val.col(46) = result_0.matrix(); }{result_0 = 4*y*(x - 1)*(2*z - 1);val.col(47) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 4*z*(2*x - 1)*(y - 1);val.col(48) = result_0.matrix(); }{result_0 = 4*x*z*(x - 1);val.col(49) = result_0.matrix(); }{result_0 = 4*x*(x - 1)*(y - 1);val.col(50) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4*y*z*(y - 1);val.col(51) = result_0.matrix(); }{result_0 = -4*x*z*(2*y - 1);val.col(52) = result_0.matrix(); }{result_0 = -4*x*y*(y - 1);val.col(53) = result_0.matrix(); }
+	}
+	{
+		{result_0 = -4*y*z*(2*x - 1);val.col(54) = result_0.matrix(); }{result_0 = -4*x*z*(x - 1);val.col(55) = result_0.matrix(); }{result_0 = -4*x*y*(x - 1);val.col(56) = result_0.matrix(); }
+	}
+	{
+		{result_0 = 4*y*z*(y - 1);val.col(57) = result_0.matrix(); }{result_0 = 4*z*(x - 1)*(2*y - 1);val.col(58) = result_0.matrix(); }{result_0 = 4*y*(x - 1)*(y - 1);val.col(59) = result_0.matrix(); }
+	}
+}
+
+} // namespace
+
+FusedBasesFunc p_fused_basis_value_2d(const int p)
+{
+	switch (p)
+	{
+	case 0:
+		return &p_0_fused_basis_value_2d;
+	case 1:
+		return &p_1_fused_basis_value_2d;
+	case 2:
+		return &p_2_fused_basis_value_2d;
+	case 3:
+		return &p_3_fused_basis_value_2d;
+	case 4:
+		return &p_4_fused_basis_value_2d;
+	default:
+		return nullptr;
+	}
+}
+
+FusedBasesFunc p_fused_grad_basis_value_2d(const int p)
+{
+	switch (p)
+	{
+	case 0:
+		return &p_0_fused_basis_grad_value_2d;
+	case 1:
+		return &p_1_fused_basis_grad_value_2d;
+	case 2:
+		return &p_2_fused_basis_grad_value_2d;
+	case 3:
+		return &p_3_fused_basis_grad_value_2d;
+	case 4:
+		return &p_4_fused_basis_grad_value_2d;
+	default:
+		return nullptr;
+	}
+}
+
+FusedBasesFunc p_fused_basis_value_3d(const int p)
+{
+	switch (p)
+	{
+	case 0:
+		return &p_0_fused_basis_value_3d;
+	case 1:
+		return &p_1_fused_basis_value_3d;
+	case 2:
+		return &p_2_fused_basis_value_3d;
+	case 3:
+		return &p_3_fused_basis_value_3d;
+	case 4:
+		return &p_4_fused_basis_value_3d;
+	default:
+		return nullptr;
+	}
+}
+
+FusedBasesFunc p_fused_grad_basis_value_3d(const int p)
+{
+	switch (p)
+	{
+	case 0:
+		return &p_0_fused_basis_grad_value_3d;
+	case 1:
+		return &p_1_fused_basis_grad_value_3d;
+	case 2:
+		return &p_2_fused_basis_grad_value_3d;
+	case 3:
+		return &p_3_fused_basis_grad_value_3d;
+	case 4:
+		return &p_4_fused_basis_grad_value_3d;
+	default:
+		return nullptr;
+	}
+}
+
+FusedBasesFunc q_fused_basis_value_2d(const int p)
+{
+	switch (p)
+	{
+	case 0:
+		return &q_0_fused_basis_value_2d;
+	case 1:
+		return &q_1_fused_basis_value_2d;
+	case 2:
+		return &q_2_fused_basis_value_2d;
+	case 3:
+		return &q_3_fused_basis_value_2d;
+	case -2:
+		return &q_m2_fused_basis_value_2d;
+	default:
+		return nullptr;
+	}
+}
+
+FusedBasesFunc q_fused_grad_basis_value_2d(const int p)
+{
+	switch (p)
+	{
+	case 0:
+		return &q_0_fused_basis_grad_value_2d;
+	case 1:
+		return &q_1_fused_basis_grad_value_2d;
+	case 2:
+		return &q_2_fused_basis_grad_value_2d;
+	case 3:
+		return &q_3_fused_basis_grad_value_2d;
+	case -2:
+		return &q_m2_fused_basis_grad_value_2d;
+	default:
+		return nullptr;
+	}
+}
+
+FusedBasesFunc q_fused_basis_value_3d(const int p)
+{
+	switch (p)
+	{
+	case 0:
+		return &q_0_fused_basis_value_3d;
+	case 1:
+		return &q_1_fused_basis_value_3d;
+	case 2:
+		return &q_2_fused_basis_value_3d;
+	case 3:
+		return &q_3_fused_basis_value_3d;
+	case -2:
+		return &q_m2_fused_basis_value_3d;
+	default:
+		return nullptr;
+	}
+}
+
+FusedBasesFunc q_fused_grad_basis_value_3d(const int p)
+{
+	switch (p)
+	{
+	case 0:
+		return &q_0_fused_basis_grad_value_3d;
+	case 1:
+		return &q_1_fused_basis_grad_value_3d;
+	case 2:
+		return &q_2_fused_basis_grad_value_3d;
+	case 3:
+		return &q_3_fused_basis_grad_value_3d;
+	case -2:
+		return &q_m2_fused_basis_grad_value_3d;
+	default:
+		return nullptr;
+	}
+}
+
+}}
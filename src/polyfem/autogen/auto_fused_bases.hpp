@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+namespace polyfem {
+namespace autogen {
+// Evaluates all the bases of one order at the points uv in a single call.
+// Values are stored in a #uv x n_bases matrix, gradients in a #uv x (n_bases * dim) matrix
+// where the gradient of basis j is in the columns j * dim to (j + 1) * dim - 1.
+typedef void (*FusedBasesFunc)(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val);
+
+// Kernels of order p (-2 for serendipity), nullptr if the order has no fused kernel
+FusedBasesFunc p_fused_basis_value_2d(const int p);
+FusedBasesFunc p_fused_grad_basis_value_2d(const int p);
+FusedBasesFunc p_fused_basis_value_3d(const int p);
+FusedBasesFunc p_fused_grad_basis_value_3d(const int p);
+FusedBasesFunc q_fused_basis_value_2d(const int p);
+FusedBasesFunc q_fused_grad_basis_value_2d(const int p);
+FusedBasesFunc q_fused_basis_value_3d(const int p);
+FusedBasesFunc q_fused_grad_basis_value_3d(const int p);
+
+}}
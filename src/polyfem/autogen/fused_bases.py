@@ -0,0 +1,150 @@
+# Generates auto_fused_bases.{hpp,cpp} from the generated per-basis kernels
+# (auto_p_bases.cpp, auto_q_bases_*d_val.cpp, auto_q_bases_*d_grad*.cpp).
+# Every fused kernel evaluates all the bases of one order in a single call:
+# the values in a #uv x n_bases matrix and the gradients in a #uv x (n_bases * dim)
+# matrix, the gradient of basis j is in the columns j * dim to (j + 1) * dim - 1.
+#
+# Run from this folder after regenerating the bases: python fused_bases.py
+
+import os
+import re
+
+P_ORDERS = [0, 1, 2, 3, 4]
+Q_ORDERS = [0, 1, 2, 3, -2]
+
+
+def order_name(order):
+    return "m2" if order < 0 else str(order)
+
+
+def read(*files):
+    text = ""
+    for f in files:
+        with open(f, "r") as file:
+            text += file.read() + "\n"
+    return text
+
+
+def matching_brace(text, start):
+    assert text[start] == "{"
+    depth = 0
+    for i in range(start, len(text)):
+        if text[i] == "{":
+            depth += 1
+        elif text[i] == "}":
+            depth -= 1
+            if depth == 0:
+                return i
+    raise RuntimeError("Unbalanced braces")
+
+
+def function_cases(text, name):
+    """list of the bodies of the switch cases of the generated function name"""
+    match = re.search(r"void\s+" + name + r"\s*\(", text)
+    if match is None:
+        raise RuntimeError("Missing function " + name)
+
+    body_start = text.index("{", match.end())
+    body = text[body_start:matching_brace(text, body_start) + 1]
+    switch_start = body.index("{", body.index("switch"))
+    switch = body[switch_start + 1:matching_brace(body, switch_start)]
+
+    cases = []
+    for case in re.finditer(r"case\s+(\d+)\s*:", switch):
+        assert int(case.group(1)) == len(cases)
+        case_start = switch.index("{", case.end())
+        case_body = switch[case_start + 1:matching_brace(switch, case_start)]
+        cases.append("\n".join(l.strip() for l in case_body.strip().splitlines() if l.strip()))
+    return cases
+
+
+def indent(code, n):
+    return "\n".join("\t" * n + l for l in code.splitlines())
+
+
+def coordinates(dim):
+    res = "\tauto x = uv.col(0).array();\n\tauto y = uv.col(1).array();\n"
+    if dim == 3:
+        res += "\tauto z = uv.col(2).array();\n"
+    return res
+
+
+def value_kernel(name, cases, dim):
+    code = "void " + name + "(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)\n{\n"
+    code += "\tassert(uv.cols() == {});\n".format(dim)
+    code += coordinates(dim)
+    code += "\n\tval.resize(uv.rows(), {});\n".format(len(cases))
+    code += "\tEigen::ArrayXd result_0(uv.rows());\n"
+    for j, case in enumerate(cases):
+        code += "\t{\n" + indent(case, 2) + "\n\t\tval.col({}) = result_0.matrix();\n\t}}\n".format(j)
+    code += "}\n"
+    return code
+
+
+def grad_kernel(name, cases, dim):
+    code = "void " + name + "(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val)\n{\n"
+    code += "\tassert(uv.cols() == {});\n".format(dim)
+    code += coordinates(dim)
+    code += "\n\tval.resize(uv.rows(), {});\n".format(len(cases) * dim)
+    code += "\tEigen::ArrayXd result_0(uv.rows());\n"
+    for j, case in enumerate(cases):
+        case = re.sub(r"val\.col\((\d)\)\s*=\s*result_0\s*;",
+                      lambda m: "val.col({}) = result_0.matrix();".format(j * dim + int(m.group(1))), case)
+        code += "\t{\n" + indent(case, 2) + "\n\t}\n"
+    code += "}\n"
+    return code
+
+
+def dispatch(name, kernels, orders):
+    code = "FusedBasesFunc " + name + "(const int p)\n{\n\tswitch (p)\n\t{\n"
+    for order, kernel in zip(orders, kernels):
+        code += "\tcase {}:\n\t\treturn &{};\n".format(order, kernel)
+    code += "\tdefault:\n\t\treturn nullptr;\n\t}\n}\n"
+    return code
+
+
+if __name__ == "__main__":
+    path = os.path.abspath(os.path.dirname(__file__))
+
+    p_text = read(os.path.join(path, "auto_p_bases.cpp"))
+    q_text = {
+        2: read(os.path.join(path, "auto_q_bases_2d_val.cpp"), os.path.join(path, "auto_q_bases_2d_grad.cpp")),
+        3: read(os.path.join(path, "auto_q_bases_3d_val.cpp"), *[os.path.join(path, "auto_q_bases_3d_grad_{}.cpp".format(q)) for q in Q_ORDERS])}
+
+    kernels = ""
+    dispatchers = ""
+    declarations = ""
+    for family, orders in [("p", P_ORDERS), ("q", Q_ORDERS)]:
+        for dim in [2, 3]:
+            text = p_text if family == "p" else q_text[dim]
+            for grad in [False, True]:
+                names = []
+                for order in orders:
+                    source = "{}_{}_basis_{}value_{}d".format(family, order_name(order), "grad_" if grad else "", dim)
+                    name = "{}_{}_fused_basis_{}value_{}d".format(family, order_name(order), "grad_" if grad else "", dim)
+                    cases = function_cases(text, source)
+                    kernels += (grad_kernel if grad else value_kernel)(name, cases, dim) + "\n"
+                    names.append(name)
+
+                dispatcher = "{}_fused_{}basis_value_{}d".format(family, "grad_" if grad else "", dim)
+                dispatchers += dispatch(dispatcher, names, orders) + "\n"
+                declarations += "FusedBasesFunc {}(const int p);\n".format(dispatcher)
+
+    with open(os.path.join(path, "auto_fused_bases.hpp"), "w") as file:
+        file.write("#pragma once\n\n#include <Eigen/Dense>\n\n")
+        file.write("namespace polyfem {\nnamespace autogen {\n")
+        file.write("// Evaluates all the bases of one order at the points uv in a single call.\n")
+        file.write("// Values are stored in a #uv x n_bases matrix, gradients in a #uv x (n_bases * dim) matrix\n")
+        file.write("// where the gradient of basis j is in the columns j * dim to (j + 1) * dim - 1.\n")
+        file.write("typedef void (*FusedBasesFunc)(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val);\n\n")
+        file.write("// Kernels of order p (-2 for serendipity), nullptr if the order has no fused kernel\n")
+        file.write(declarations)
+        file.write("\n}}\n")
+
+    with open(os.path.join(path, "auto_fused_bases.cpp"), "w") as file:
+        file.write("#include \"auto_fused_bases.hpp\"\n\n#include <cassert>\n\n")
+        file.write("namespace polyfem {\nnamespace autogen {\nnamespace {\n")
+        file.write(kernels)
+        file.write("} // namespace\n\n")
+        file.write(dispatchers)
+        file.write("}}\n")
@@ -79,6 +79,33 @@ namespace polyfem
 			}
 		}
 
+		void ElementBases::set_fused_funcs(EvalAllBasesFunc bases_fun, EvalAllBasesFunc grads_fun)
+		{
+			if (bases_fun == nullptr || grads_fun == nullptr)
+				return;
+
+			eval_bases_func_ = [bases_fun](const Eigen::MatrixXd &uv, std::vector<AssemblyValues> &basis_values) {
+				// reused across calls, the kernel does not allocate once the size is known
+				thread_local Eigen::MatrixXd val;
+				bases_fun(uv, val);
+
+				basis_values.resize(val.cols());
+				for (long i = 0; i < val.cols(); ++i)
+					basis_values[i].val = val.col(i);
+			};
+
+			eval_grads_func_ = [grads_fun](const Eigen::MatrixXd &uv, std::vector<AssemblyValues> &basis_values) {
+				thread_local Eigen::MatrixXd grad;
+				grads_fun(uv, grad);
+
+				const int dim = uv.cols();
+				assert(grad.cols() % dim == 0);
+				basis_values.resize(grad.cols() / dim);
+				for (size_t i = 0; i < basis_values.size(); ++i)
+					basis_values[i].grad = grad.middleCols(i * dim, dim);
+			};
+		}
+
 		void ElementBases::eval_geom_mapping_grads(const Eigen::MatrixXd &samples, std::vector<Eigen::MatrixXd> &grads) const
 		{
 			grads.resize(samples.rows());
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <polyfem/basis/Basis.hpp>
+#include <polyfem/basis/TensorProductBasis.hpp>
 #include <polyfem/quadrature/Quadrature.hpp>
 #include <polyfem/mesh/Mesh.hpp>
 
 #include <polyfem/assembler/AssemblyValues.hpp>
 
+#include <string>
 #include <vector>
 
 namespace polyfem
@@ -20,6 +22,10 @@ namespace polyfem
 			
 			// function type that evaluates bases at given points and saves them in basis_values
 			typedef std::function<void(const Eigen::MatrixXd &uv, std::vector<assembler::AssemblyValues> &basis_values)> EvalBasesFunc;
+
+			// function type that evaluates all the bases at given points in a single #uv x n_bases matrix
+			// (#uv x (n_bases * dim) for the gradients, the gradient of basis j in the columns j * dim to (j + 1) * dim - 1)
+			typedef void (*EvalAllBasesFunc)(const Eigen::MatrixXd &uv, Eigen::MatrixXd &val);
 			
 			// function type that computes quadrature points and saves them in quadrature
 			typedef std::function<void(quadrature::Quadrature &quadrature)> QuadratureFunction;
@@ -38,6 +44,14 @@ namespace polyfem
 			// or directly in the object domain (harmonic bases)
 			bool has_parameterization = true;
 
+			/// identifies the reference element (type, order, and quadratures) of the bases: elements with the same
+			/// key have the same basis values and gradients at the quadrature points. Empty if the bases are element specific
+			std::string reference_key;
+
+			/// tensor-product structure of the bases and of the (stiffness) quadrature, used by the sum-factorized
+			/// kernels of the assemblers. Null if the bases or the quadrature are not tensor products
+			std::shared_ptr<const TensorProductBasis> tensor_basis;
+
 			/// @brief Map the sample positions in the parametric domain to the object domain (if the element has no parameterization, e.g. harmonic bases, then the parametric domain = object domain,
 			/// and the mapping is identity)
 			///
@@ -96,6 +110,10 @@ namespace polyfem
 			void set_bases_func(EvalBasesFunc fun) { eval_bases_func_ = fun; }
 			void set_grads_func(EvalBasesFunc fun) { eval_grads_func_ = fun; }
 
+			/// evaluate all the bases with one call to bases_fun (resp. grads_fun) instead of one call per basis,
+			/// does nothing if one of the functions is null
+			void set_fused_funcs(EvalAllBasesFunc bases_fun, EvalAllBasesFunc grads_fun);
+
 			/// sets mapping from local nodes to global nodes
 			void set_local_node_from_primitive_func(LocalNodeFromPrimitiveFunc fun) { local_node_from_primitive_ = fun; }
 
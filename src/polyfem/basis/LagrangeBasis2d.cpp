@@ -5,6 +5,7 @@
 #include <polyfem/quadrature/QuadQuadrature.hpp>
 #include <polyfem/autogen/auto_p_bases.hpp>
 #include <polyfem/autogen/auto_q_bases.hpp>
+#include <polyfem/autogen/auto_fused_bases.hpp>
 
 #include <polyfem/assembler/AssemblerUtils.hpp>
 
@@ -180,7 +181,9 @@ namespace
 		return l2g;
 	}
 
-	void tri_local_to_global(const bool is_geom_bases, const int p, const Mesh2D &mesh, int f, const Eigen::VectorXi &discr_order, const Eigen::VectorXi &edge_orders, std::vector<int> &res, MeshNodes &nodes, std::vector<std::vector<int>> &edge_virtual_nodes)
+	/// Nodes is MeshNodes or MeshNodes::Recorder
+	template <typename Nodes>
+	void tri_local_to_global(const bool is_geom_bases, const int p, const Mesh2D &mesh, int f, const Eigen::VectorXi &discr_order, const Eigen::VectorXi &edge_orders, std::vector<int> &res, Nodes &nodes, std::vector<std::vector<int>> &edge_virtual_nodes)
 	{
 		int edge_offset = mesh.n_vertices();
 		int face_offset = edge_offset + mesh.n_edges();
@@ -309,7 +312,9 @@ namespace
 		// return res;
 	}
 
-	void quad_local_to_global(const bool serendipity, const int q, const Mesh2D &mesh, int f, const Eigen::VectorXi &discr_order, std::vector<int> &res, MeshNodes &nodes)
+	/// Nodes is MeshNodes or MeshNodes::Recorder
+	template <typename Nodes>
+	void quad_local_to_global(const bool serendipity, const int q, const Mesh2D &mesh, int f, const Eigen::VectorXi &discr_order, std::vector<int> &res, Nodes &nodes)
 	{
 		int edge_offset = mesh.n_vertices();
 		int face_offset = edge_offset + mesh.n_edges();
@@ -402,6 +407,38 @@ namespace
 	/// @param[out] local_boundary     Which facet of the element are on the boundary
 	/// @param[out] poly_edge_to_data  Data for edges at the interface with a polygon
 	///
+	/// boundary edges of element f as pairs (global edge, local edge)
+	void element_boundary_primitives(const Mesh2D &mesh, const int f, std::vector<std::pair<int, int>> &primitives)
+	{
+		Eigen::Matrix<int, Eigen::Dynamic, 2, 0, 4, 2> ev;
+		if (mesh.is_cube(f))
+		{
+			auto v = quad_vertices_local_to_global(mesh, f);
+			ev.resize(4, 2);
+			ev.row(0) << v[0], v[1];
+			ev.row(1) << v[1], v[2];
+			ev.row(2) << v[2], v[3];
+			ev.row(3) << v[3], v[0];
+		}
+		else if (mesh.is_simplex(f))
+		{
+			auto v = tri_vertices_local_to_global(mesh, f);
+			ev.resize(3, 2);
+			ev.row(0) << v[0], v[1];
+			ev.row(1) << v[1], v[2];
+			ev.row(2) << v[2], v[0];
+		}
+
+		for (int i = 0; i < int(ev.rows()); ++i)
+		{
+			const auto index = find_edge(mesh, f, ev(i, 0), ev(i, 1));
+			const int edge = index.edge;
+
+			if (mesh.is_boundary_edge(edge) || mesh.get_boundary_id(edge) > 0)
+				primitives.emplace_back(edge, i);
+		}
+	}
+
 	void compute_nodes(
 		const Mesh2D &mesh,
 		const Eigen::VectorXi &discr_orders,
@@ -426,63 +463,44 @@ namespace
 			edge_virtual_nodes.resize(ncmesh.n_edges());
 		}
 
-		for (int f = 0; f < mesh.n_faces(); ++f)
-		{
+		const auto local_to_global = [&](const int f, auto &element_nodes, std::vector<int> &res) {
 			const int discr_order = discr_orders(f);
 			if (mesh.is_cube(f))
-			{
-				quad_local_to_global(serendipity, discr_order, mesh, f, discr_orders, element_nodes_id[f], nodes);
-
-				LocalBoundary lb(f, BoundaryType::QUAD_LINE);
-
-				auto v = quad_vertices_local_to_global(mesh, f);
-				Eigen::Matrix<int, 4, 2> ev;
-				ev.row(0) << v[0], v[1];
-				ev.row(1) << v[1], v[2];
-				ev.row(2) << v[2], v[3];
-				ev.row(3) << v[3], v[0];
-
-				for (int i = 0; i < int(ev.rows()); ++i)
-				{
-					const auto index = find_edge(mesh, f, ev(i, 0), ev(i, 1));
-					const int edge = index.edge;
-
-					if (mesh.is_boundary_edge(edge) || mesh.get_boundary_id(edge) > 0)
-					{
-						lb.add_boundary_primitive(edge, i);
-					}
-				}
-
-				if (!lb.empty())
-					local_boundary.emplace_back(lb);
-			}
+				quad_local_to_global(serendipity, discr_order, mesh, f, discr_orders, res, element_nodes);
 			else if (mesh.is_simplex(f))
-			{
-				tri_local_to_global(is_geom_bases, discr_order, mesh, f, discr_orders, edge_orders, element_nodes_id[f], nodes, edge_virtual_nodes);
-
-				auto v = tri_vertices_local_to_global(mesh, f);
-
-				Eigen::Matrix<int, 3, 2> ev;
-				ev.row(0) << v[0], v[1];
-				ev.row(1) << v[1], v[2];
-				ev.row(2) << v[2], v[0];
+				tri_local_to_global(is_geom_bases, discr_order, mesh, f, discr_orders, edge_orders, res, element_nodes, edge_virtual_nodes);
+		};
 
-				LocalBoundary lb(f, BoundaryType::TRI_LINE);
+		if (mesh.is_conforming())
+		{
+			// the nodes are counted per element, numbered with a prefix sum, and filled in parallel,
+			// the numbering is the same as the serial visit and does not depend on the number of threads
+			nodes.number_elements(
+				mesh.n_faces(), [&](int f, MeshNodes::Recorder &recorder, std::vector<int> &res) { local_to_global(f, recorder, res); }, element_nodes_id);
+		}
+		else
+		{
+			// the virtual nodes of the leader edges are stored outside of the elements, they are assigned serially
+			for (int f = 0; f < mesh.n_faces(); ++f)
+				local_to_global(f, nodes, element_nodes_id[f]);
+		}
 
-				for (int i = 0; i < int(ev.rows()); ++i)
-				{
-					const auto index = find_edge(mesh, f, ev(i, 0), ev(i, 1));
-					const int edge = index.edge;
+		// the local boundaries only query the mesh, they are computed in parallel and gathered in element order
+		std::vector<std::vector<std::pair<int, int>>> boundary_primitives(mesh.n_faces());
+		utils::maybe_parallel_for(mesh.n_faces(), [&](int start, int end, int thread_id) {
+			for (int f = start; f < end; ++f)
+				element_boundary_primitives(mesh, f, boundary_primitives[f]);
+		});
 
-					if (mesh.is_boundary_edge(edge) || mesh.get_boundary_id(edge) > 0)
-					{
-						lb.add_boundary_primitive(edge, i);
-					}
-				}
+		for (int f = 0; f < mesh.n_faces(); ++f)
+		{
+			if (boundary_primitives[f].empty())
+				continue;
 
-				if (!lb.empty())
-					local_boundary.emplace_back(lb);
-			}
+			LocalBoundary lb(f, mesh.is_cube(f) ? BoundaryType::QUAD_LINE : BoundaryType::TRI_LINE);
+			for (const auto &[edge, i] : boundary_primitives[f])
+				lb.add_boundary_primitive(edge, i);
+			local_boundary.emplace_back(lb);
 		}
 
 		if (!has_polys)
@@ -731,193 +749,216 @@ int LagrangeBasis2d::build_bases(
 	std::vector<int> interface_elements;
 	interface_elements.reserve(mesh.n_faces());
 
-	for (int e = 0; e < mesh.n_faces(); ++e)
-	{
-		ElementBases &b = bases[e];
-		const int discr_order = discr_orders(e);
-		const int n_el_bases = element_nodes_id[e].size();
-		b.bases.resize(n_el_bases);
-
-		bool skip_interface_element = false;
-
-		for (int j = 0; j < n_el_bases; ++j)
+	// the element bases are independent, the global node ids are already assigned
+	std::vector<char> is_interface_element(mesh.n_faces(), false);
+	utils::maybe_parallel_for(mesh.n_faces(), [&](int start, int end, int thread_id) {
+		for (int e = start; e < end; ++e)
 		{
-			// mark interface between elements of different order
-			const int global_index = element_nodes_id[e][j];
-			if (global_index < 0)
-			{
-				skip_interface_element = true;
-				break;
-			}
-		}
-
-		if (skip_interface_element)
-		{
-			interface_elements.push_back(e);
-		}
+			ElementBases &b = bases[e];
+			const int discr_order = discr_orders(e);
+			const int n_el_bases = element_nodes_id[e].size();
+			b.bases.resize(n_el_bases);
 
-		if (mesh.is_cube(e))
-		{
-			const int real_order = quadrature_order > 0 ? quadrature_order : AssemblerUtils::quadrature_order(assembler, discr_order, AssemblerUtils::BasisType::CUBE_LAGRANGE, 2);
-			const int real_mass_order = mass_quadrature_order > 0 ? mass_quadrature_order : AssemblerUtils::quadrature_order("Mass", discr_order, AssemblerUtils::BasisType::CUBE_LAGRANGE, 2);
-			b.set_quadrature([real_order](Quadrature &quad) {
-				QuadQuadrature quad_quadrature;
-				quad_quadrature.get_quadrature(real_order, quad);
-			});
-			b.set_mass_quadrature([real_mass_order](Quadrature &quad) {
-				QuadQuadrature quad_quadrature;
-				quad_quadrature.get_quadrature(real_mass_order, quad);
-			});
-			// quad_quadrature.get_quadrature(real_order, b.quadrature);
-
-			b.set_local_node_from_primitive_func([discr_order, e](const int primitive_id, const Mesh &mesh) {
-				const auto &mesh2d = dynamic_cast<const Mesh2D &>(mesh);
-				auto index = mesh2d.get_index_from_face(e);
-
-				for (int le = 0; le < mesh2d.n_face_vertices(e); ++le)
-				{
-					if (index.edge == primitive_id)
-						break;
-					index = mesh2d.next_around_face(index);
-				}
-				assert(index.edge == primitive_id);
-				return quad_edge_local_nodes(discr_order, mesh2d, index);
-			});
+			bool skip_interface_element = false;
 
 			for (int j = 0; j < n_el_bases; ++j)
 			{
+				// mark interface between elements of different order
 				const int global_index = element_nodes_id[e][j];
-
-				// if(!skip_interface_element)
-				b.bases[j].init(discr_order, global_index, j, nodes.node_position(global_index));
-
-				const int dtmp = serendipity ? -2 : discr_order;
-
-				b.bases[j].set_basis([dtmp, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::q_basis_value_2d(dtmp, j, uv, val); });
-				b.bases[j].set_grad([dtmp, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::q_grad_basis_value_2d(dtmp, j, uv, val); });
-			}
-		}
-		else if (mesh.is_simplex(e))
-		{
-			const int real_order = quadrature_order > 0 ? quadrature_order : AssemblerUtils::quadrature_order(assembler, discr_order, AssemblerUtils::BasisType::SIMPLEX_LAGRANGE, 2);
-			const int real_mass_order = mass_quadrature_order > 0 ? mass_quadrature_order : AssemblerUtils::quadrature_order("Mass", discr_order, AssemblerUtils::BasisType::SIMPLEX_LAGRANGE, 2);
-			b.set_quadrature([real_order](Quadrature &quad) {
-				TriQuadrature tri_quadrature;
-				tri_quadrature.get_quadrature(real_order, quad);
-			});
-			b.set_mass_quadrature([real_mass_order](Quadrature &quad) {
-				TriQuadrature tri_quadrature;
-				tri_quadrature.get_quadrature(real_mass_order, quad);
-			});
-
-			b.set_local_node_from_primitive_func([discr_order, e](const int primitive_id, const Mesh &mesh) {
-				const auto &mesh2d = dynamic_cast<const Mesh2D &>(mesh);
-				auto index = mesh2d.get_index_from_face(e);
-
-				for (int le = 0; le < mesh2d.n_face_vertices(e); ++le)
+				if (global_index < 0)
 				{
-					if (index.edge == primitive_id)
-						break;
-					index = mesh2d.next_around_face(index);
+					skip_interface_element = true;
+					break;
 				}
-				assert(index.edge == primitive_id);
-				return tri_edge_local_nodes(discr_order, mesh2d, index);
-			});
+			}
 
-			const bool rational = is_geom_bases && mesh.is_rational() && !mesh.cell_weights(e).empty();
+			if (skip_interface_element)
+			{
+				is_interface_element[e] = true;
+			}
 
-			for (int j = 0; j < n_el_bases; ++j)
+			if (mesh.is_cube(e))
 			{
-				const int global_index = element_nodes_id[e][j];
+				const int real_order = quadrature_order > 0 ? quadrature_order : AssemblerUtils::quadrature_order(assembler, discr_order, AssemblerUtils::BasisType::CUBE_LAGRANGE, 2);
+				const int real_mass_order = mass_quadrature_order > 0 ? mass_quadrature_order : AssemblerUtils::quadrature_order("Mass", discr_order, AssemblerUtils::BasisType::CUBE_LAGRANGE, 2);
+				b.set_quadrature([real_order](Quadrature &quad) {
+					QuadQuadrature quad_quadrature;
+					quad_quadrature.get_quadrature(real_order, quad);
+				});
+				b.set_mass_quadrature([real_mass_order](Quadrature &quad) {
+					QuadQuadrature quad_quadrature;
+					quad_quadrature.get_quadrature(real_mass_order, quad);
+				});
+				b.reference_key = "Q2_" + std::to_string(serendipity ? -2 : discr_order) + "_" + std::to_string(real_order) + "_" + std::to_string(real_mass_order);
+				if (!serendipity && discr_order >= 1)
+					b.tensor_basis = TensorProductBasis::get(2, discr_order, real_order);
+				// quad_quadrature.get_quadrature(real_order, b.quadrature);
+
+				b.set_local_node_from_primitive_func([discr_order, e](const int primitive_id, const Mesh &mesh) {
+					const auto &mesh2d = dynamic_cast<const Mesh2D &>(mesh);
+					auto index = mesh2d.get_index_from_face(e);
+
+					for (int le = 0; le < mesh2d.n_face_vertices(e); ++le)
+					{
+						if (index.edge == primitive_id)
+							break;
+						index = mesh2d.next_around_face(index);
+					}
+					assert(index.edge == primitive_id);
+					return quad_edge_local_nodes(discr_order, mesh2d, index);
+				});
 
-				if (!skip_interface_element)
+				for (int j = 0; j < n_el_bases; ++j)
 				{
+					const int global_index = element_nodes_id[e][j];
+
+					// if(!skip_interface_element)
 					b.bases[j].init(discr_order, global_index, j, nodes.node_position(global_index));
+
+					const int dtmp = serendipity ? -2 : discr_order;
+
+					b.bases[j].set_basis([dtmp, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::q_basis_value_2d(dtmp, j, uv, val); });
+					b.bases[j].set_grad([dtmp, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::q_grad_basis_value_2d(dtmp, j, uv, val); });
 				}
 
-				if (rational)
+				// evaluates all the element bases at once
+				const int q = serendipity ? -2 : discr_order;
+				b.set_fused_funcs(autogen::q_fused_basis_value_2d(q), autogen::q_fused_grad_basis_value_2d(q));
+			}
+			else if (mesh.is_simplex(e))
+			{
+				const int real_order = quadrature_order > 0 ? quadrature_order : AssemblerUtils::quadrature_order(assembler, discr_order, AssemblerUtils::BasisType::SIMPLEX_LAGRANGE, 2);
+				const int real_mass_order = mass_quadrature_order > 0 ? mass_quadrature_order : AssemblerUtils::quadrature_order("Mass", discr_order, AssemblerUtils::BasisType::SIMPLEX_LAGRANGE, 2);
+				b.set_quadrature([real_order](Quadrature &quad) {
+					TriQuadrature tri_quadrature;
+					tri_quadrature.get_quadrature(real_order, quad);
+				});
+				b.set_mass_quadrature([real_mass_order](Quadrature &quad) {
+					TriQuadrature tri_quadrature;
+					tri_quadrature.get_quadrature(real_mass_order, quad);
+				});
+
+				b.set_local_node_from_primitive_func([discr_order, e](const int primitive_id, const Mesh &mesh) {
+					const auto &mesh2d = dynamic_cast<const Mesh2D &>(mesh);
+					auto index = mesh2d.get_index_from_face(e);
+
+					for (int le = 0; le < mesh2d.n_face_vertices(e); ++le)
+					{
+						if (index.edge == primitive_id)
+							break;
+						index = mesh2d.next_around_face(index);
+					}
+					assert(index.edge == primitive_id);
+					return tri_edge_local_nodes(discr_order, mesh2d, index);
+				});
+
+				const bool rational = is_geom_bases && mesh.is_rational() && !mesh.cell_weights(e).empty();
+				// rational bases depend on the element weights
+				if (!rational)
+					b.reference_key = "P2_" + std::to_string(discr_order) + "_" + std::to_string(real_order) + "_" + std::to_string(real_mass_order);
+
+				for (int j = 0; j < n_el_bases; ++j)
 				{
-					const auto &w = mesh.cell_weights(e);
-					assert(discr_order == 2);
-					assert(w.size() == 6);
+					const int global_index = element_nodes_id[e][j];
 
-					b.bases[j].set_basis([discr_order, j, w](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) {
-						autogen::p_basis_value_2d(discr_order, j, uv, val);
-						Eigen::MatrixXd denom = val;
-						denom.setZero();
-						Eigen::MatrixXd tmp;
+					if (!skip_interface_element)
+					{
+						b.bases[j].init(discr_order, global_index, j, nodes.node_position(global_index));
+					}
 
-						for (int k = 0; k < 6; ++k)
-						{
-							autogen::p_basis_value_2d(discr_order, k, uv, tmp);
-							denom += w[k] * tmp;
-						}
+					if (rational)
+					{
+						const auto &w = mesh.cell_weights(e);
+						assert(discr_order == 2);
+						assert(w.size() == 6);
 
-						val = (w[j] * val.array() / denom.array()).eval();
-					});
+						b.bases[j].set_basis([discr_order, j, w](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) {
+							autogen::p_basis_value_2d(discr_order, j, uv, val);
+							Eigen::MatrixXd denom = val;
+							denom.setZero();
+							Eigen::MatrixXd tmp;
 
-					b.bases[j].set_grad([discr_order, j, w](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) {
-						Eigen::MatrixXd b;
-						autogen::p_basis_value_2d(discr_order, j, uv, b);
-						autogen::p_grad_basis_value_2d(discr_order, j, uv, val);
-						Eigen::MatrixXd denom = b;
-						denom.setZero();
-						Eigen::MatrixXd denom_prime = val;
-						denom_prime.setZero();
-						Eigen::MatrixXd tmp;
+							for (int k = 0; k < 6; ++k)
+							{
+								autogen::p_basis_value_2d(discr_order, k, uv, tmp);
+								denom += w[k] * tmp;
+							}
 
-						for (int k = 0; k < 6; ++k)
-						{
-							autogen::p_basis_value_2d(discr_order, k, uv, tmp);
-							denom += w[k] * tmp;
+							val = (w[j] * val.array() / denom.array()).eval();
+						});
 
-							autogen::p_grad_basis_value_2d(discr_order, k, uv, tmp);
-							denom_prime += w[k] * tmp;
-						}
+						b.bases[j].set_grad([discr_order, j, w](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) {
+							Eigen::MatrixXd b;
+							autogen::p_basis_value_2d(discr_order, j, uv, b);
+							autogen::p_grad_basis_value_2d(discr_order, j, uv, val);
+							Eigen::MatrixXd denom = b;
+							denom.setZero();
+							Eigen::MatrixXd denom_prime = val;
+							denom_prime.setZero();
+							Eigen::MatrixXd tmp;
 
-						val.col(0) = ((w[j] * val.col(0).array() * denom.array() - w[j] * b.array() * denom_prime.col(0).array()) / (denom.array() * denom.array())).eval();
-						val.col(1) = ((w[j] * val.col(1).array() * denom.array() - w[j] * b.array() * denom_prime.col(1).array()) / (denom.array() * denom.array())).eval();
-					});
-				}
-				else
-				{
-					// pick out basis functions using autogenerated code
-					b.bases[j].set_basis([discr_order, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::p_basis_value_2d(discr_order, j, uv, val); });
-					b.bases[j].set_grad([discr_order, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::p_grad_basis_value_2d(discr_order, j, uv, val); });
+							for (int k = 0; k < 6; ++k)
+							{
+								autogen::p_basis_value_2d(discr_order, k, uv, tmp);
+								denom += w[k] * tmp;
+
+								autogen::p_grad_basis_value_2d(discr_order, k, uv, tmp);
+								denom_prime += w[k] * tmp;
+							}
+
+							val.col(0) = ((w[j] * val.col(0).array() * denom.array() - w[j] * b.array() * denom_prime.col(0).array()) / (denom.array() * denom.array())).eval();
+							val.col(1) = ((w[j] * val.col(1).array() * denom.array() - w[j] * b.array() * denom_prime.col(1).array()) / (denom.array() * denom.array())).eval();
+						});
+					}
+					else
+					{
+						// pick out basis functions using autogenerated code
+						b.bases[j].set_basis([discr_order, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::p_basis_value_2d(discr_order, j, uv, val); });
+						b.bases[j].set_grad([discr_order, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::p_grad_basis_value_2d(discr_order, j, uv, val); });
+					}
 				}
+
+				if (!rational)
+					b.set_fused_funcs(autogen::p_fused_basis_value_2d(discr_order), autogen::p_fused_grad_basis_value_2d(discr_order));
+			}
+			else
+			{
+				// Polygon bases are built later on
 			}
-		}
-		else
-		{
-			// Polygon bases are built later on
-		}
 		
 #ifndef NDEBUG
-		if (mesh.is_conforming())
-		{
-			Eigen::MatrixXd uv(4, 2);
-			uv << 0.1, 0.1, 0.3, 0.3, 0.9, 0.01, 0.01, 0.9;
-			Eigen::MatrixXd dx(4, 1);
-			dx.setConstant(1e-6);
-			Eigen::MatrixXd uvdx = uv;
-			uvdx.col(0) += dx;
-			Eigen::MatrixXd uvdy = uv;
-			uvdy.col(1) += dx;
-			Eigen::MatrixXd grad, val, vdx, vdy;
-
-			for (int j = 0; j < n_el_bases; ++j)
+			if (mesh.is_conforming())
 			{
-				b.bases[j].eval_grad(uv, grad);
+				Eigen::MatrixXd uv(4, 2);
+				uv << 0.1, 0.1, 0.3, 0.3, 0.9, 0.01, 0.01, 0.9;
+				Eigen::MatrixXd dx(4, 1);
+				dx.setConstant(1e-6);
+				Eigen::MatrixXd uvdx = uv;
+				uvdx.col(0) += dx;
+				Eigen::MatrixXd uvdy = uv;
+				uvdy.col(1) += dx;
+				Eigen::MatrixXd grad, val, vdx, vdy;
+
+				for (int j = 0; j < n_el_bases; ++j)
+				{
+					b.bases[j].eval_grad(uv, grad);
 
-				b.bases[j].eval_basis(uv, val);
-				b.bases[j].eval_basis(uvdx, vdx);
-				b.bases[j].eval_basis(uvdy, vdy);
+					b.bases[j].eval_basis(uv, val);
+					b.bases[j].eval_basis(uvdx, vdx);
+					b.bases[j].eval_basis(uvdy, vdy);
 
-				assert((grad.col(0) - (vdx - val) / 1e-6).norm() < 1e-4);
-				assert((grad.col(1) - (vdy - val) / 1e-6).norm() < 1e-4);
+					assert((grad.col(0) - (vdx - val) / 1e-6).norm() < 1e-4);
+					assert((grad.col(1) - (vdy - val) / 1e-6).norm() < 1e-4);
+				}
 			}
-		}
 #endif
+		}
+	});
+
+	for (int e = 0; e < mesh.n_faces(); ++e)
+	{
+		if (is_interface_element[e])
+			interface_elements.push_back(e);
 	}
 
 	if (!is_geom_bases)
@@ -10,6 +10,7 @@
 
 #include <polyfem/autogen/auto_p_bases.hpp>
 #include <polyfem/autogen/auto_q_bases.hpp>
+#include <polyfem/autogen/auto_fused_bases.hpp>
 
 #include <polyfem/utils/MaybeParallelFor.hpp>
 
@@ -200,7 +201,9 @@ namespace
 		return elem;
 	}
 
-	void tet_local_to_global(const bool is_geom_bases, const int p, const Mesh3D &mesh, int c, const Eigen::VectorXi &discr_order, const Eigen::VectorXi &edge_orders, const Eigen::VectorXi &face_orders, std::vector<int> &res, polyfem::mesh::MeshNodes &nodes, std::vector<std::vector<int>> &edge_virtual_nodes, std::vector<std::vector<int>> &face_virtual_nodes)
+	/// Nodes is MeshNodes or MeshNodes::Recorder
+	template <typename Nodes>
+	void tet_local_to_global(const bool is_geom_bases, const int p, const Mesh3D &mesh, int c, const Eigen::VectorXi &discr_order, const Eigen::VectorXi &edge_orders, const Eigen::VectorXi &face_orders, std::vector<int> &res, Nodes &nodes, std::vector<std::vector<int>> &edge_virtual_nodes, std::vector<std::vector<int>> &face_virtual_nodes)
 	{
 		const int n_edge_nodes = p > 1 ? ((p - 1) * 6) : 0;
 		const int nn = p > 2 ? (p - 2) : 0;
@@ -396,7 +399,9 @@ namespace
 		assert(res.size() == size_t(4 + n_edge_nodes + n_face_nodes + n_cell_nodes));
 	}
 
-	void hex_local_to_global(const bool serendipity, const int q, const Mesh3D &mesh, int c, const Eigen::VectorXi &discr_order, std::vector<int> &res, MeshNodes &nodes)
+	/// Nodes is MeshNodes or MeshNodes::Recorder
+	template <typename Nodes>
+	void hex_local_to_global(const bool serendipity, const int q, const Mesh3D &mesh, int c, const Eigen::VectorXi &discr_order, std::vector<int> &res, Nodes &nodes)
 	{
 		assert(mesh.is_cube(c));
 
@@ -535,6 +540,47 @@ namespace
 	/// @param[out] local_boundary     Which facet of the element are on the boundary
 	/// @param[out] poly_face_to_data  Data for faces at the interface with a polyhedra
 	///
+	/// boundary faces of element c as pairs (global face, local face)
+	void element_boundary_primitives(const Mesh3D &mesh, const int c, std::vector<std::pair<int, int>> &primitives)
+	{
+		if (mesh.is_cube(c))
+		{
+			auto v = hex_vertices_local_to_global(mesh, c);
+			Eigen::Matrix<int, 6, 4> fv;
+			fv.row(0) << v[0], v[3], v[4], v[7];
+			fv.row(1) << v[1], v[2], v[5], v[6];
+			fv.row(2) << v[0], v[1], v[5], v[4];
+			fv.row(3) << v[3], v[2], v[6], v[7];
+			fv.row(4) << v[0], v[1], v[2], v[3];
+			fv.row(5) << v[4], v[5], v[6], v[7];
+
+			for (int i = 0; i < fv.rows(); ++i)
+			{
+				const int f = find_quad_face(mesh, c, fv(i, 0), fv(i, 1), fv(i, 2), fv(i, 3)).face;
+
+				if (mesh.is_boundary_face(f) || mesh.get_boundary_id(f) > 0)
+					primitives.emplace_back(f, i);
+			}
+		}
+		else if (mesh.is_simplex(c))
+		{
+			auto v = tet_vertices_local_to_global(mesh, c);
+			Eigen::Matrix<int, 4, 3> fv;
+			fv.row(0) << v[0], v[1], v[2];
+			fv.row(1) << v[0], v[1], v[3];
+			fv.row(2) << v[1], v[2], v[3];
+			fv.row(3) << v[2], v[0], v[3];
+
+			for (long i = 0; i < fv.rows(); ++i)
+			{
+				const int f = mesh.get_index_from_element_face(c, fv(i, 0), fv(i, 1), fv(i, 2)).face;
+
+				if (mesh.is_boundary_face(f))
+					primitives.emplace_back(f, i);
+			}
+		}
+	}
+
 	void compute_nodes(
 		const Mesh3D &mesh,
 		const Eigen::VectorXi &discr_orders,
@@ -553,7 +599,7 @@ namespace
 		// Step 1: Assign global node ids for each quads
 		local_boundary.clear();
 		// local_boundary.resize(mesh.n_faces());
-		element_nodes_id.resize(mesh.n_faces());
+		element_nodes_id.resize(mesh.n_cells());
 
 		if (!mesh.is_conforming())
 		{
@@ -562,63 +608,45 @@ namespace
 			face_virtual_nodes.resize(ncmesh.n_faces());
 		}
 
-		for (int c = 0; c < mesh.n_cells(); ++c)
-		{
+		const auto local_to_global = [&](const int c, auto &element_nodes, std::vector<int> &res) {
 			const int discr_order = discr_orders(c);
 
 			if (mesh.is_cube(c))
-			{
-				hex_local_to_global(serendipity, discr_order, mesh, c, discr_orders, element_nodes_id[c], nodes);
-
-				auto v = hex_vertices_local_to_global(mesh, c);
-				Eigen::Matrix<int, 6, 4> fv;
-				fv.row(0) << v[0], v[3], v[4], v[7];
-				fv.row(1) << v[1], v[2], v[5], v[6];
-				fv.row(2) << v[0], v[1], v[5], v[4];
-				fv.row(3) << v[3], v[2], v[6], v[7];
-				fv.row(4) << v[0], v[1], v[2], v[3];
-				fv.row(5) << v[4], v[5], v[6], v[7];
-
-				LocalBoundary lb(c, BoundaryType::QUAD);
-				for (int i = 0; i < fv.rows(); ++i)
-				{
-					const int f = find_quad_face(mesh, c, fv(i, 0), fv(i, 1), fv(i, 2), fv(i, 3)).face;
+				hex_local_to_global(serendipity, discr_order, mesh, c, discr_orders, res, element_nodes);
+			else if (mesh.is_simplex(c))
+				tet_local_to_global(is_geom_bases, discr_order, mesh, c, discr_orders, edge_orders, face_orders, res, element_nodes, edge_virtual_nodes, face_virtual_nodes);
+		};
 
-					if (mesh.is_boundary_face(f) || mesh.get_boundary_id(f) > 0)
-					{
-						lb.add_boundary_primitive(f, i);
-					}
-				}
+		if (mesh.is_conforming())
+		{
+			// the nodes are counted per element, numbered with a prefix sum, and filled in parallel,
+			// the numbering is the same as the serial visit and does not depend on the number of threads
+			nodes.number_elements(
+				mesh.n_cells(), [&](int c, MeshNodes::Recorder &recorder, std::vector<int> &res) { local_to_global(c, recorder, res); }, element_nodes_id);
+		}
+		else
+		{
+			// the virtual nodes of the leader edges and faces are stored outside of the elements, they are assigned serially
+			for (int c = 0; c < mesh.n_cells(); ++c)
+				local_to_global(c, nodes, element_nodes_id[c]);
+		}
 
-				if (!lb.empty())
-					local_boundary.emplace_back(lb);
-			}
-			else if (mesh.is_simplex(c))
-			{
-				// element_nodes_id[c] = polyfem::LagrangeBasis3d::tet_local_to_global(discr_order, mesh, c, discr_orders, nodes);
-				tet_local_to_global(is_geom_bases, discr_order, mesh, c, discr_orders, edge_orders, face_orders, element_nodes_id[c], nodes, edge_virtual_nodes, face_virtual_nodes);
-
-				auto v = tet_vertices_local_to_global(mesh, c);
-				Eigen::Matrix<int, 4, 3> fv;
-				fv.row(0) << v[0], v[1], v[2];
-				fv.row(1) << v[0], v[1], v[3];
-				fv.row(2) << v[1], v[2], v[3];
-				fv.row(3) << v[2], v[0], v[3];
-
-				LocalBoundary lb(c, BoundaryType::TRI);
-				for (long i = 0; i < fv.rows(); ++i)
-				{
-					const int f = mesh.get_index_from_element_face(c, fv(i, 0), fv(i, 1), fv(i, 2)).face;
+		// the local boundaries only query the mesh, they are computed in parallel and gathered in element order
+		std::vector<std::vector<std::pair<int, int>>> boundary_primitives(mesh.n_cells());
+		utils::maybe_parallel_for(mesh.n_cells(), [&](int start, int end, int thread_id) {
+			for (int c = start; c < end; ++c)
+				element_boundary_primitives(mesh, c, boundary_primitives[c]);
+		});
 
-					if (mesh.is_boundary_face(f))
-					{
-						lb.add_boundary_primitive(f, i);
-					}
-				}
+		for (int c = 0; c < mesh.n_cells(); ++c)
+		{
+			if (boundary_primitives[c].empty())
+				continue;
 
-				if (!lb.empty())
-					local_boundary.emplace_back(lb);
-			}
+			LocalBoundary lb(c, mesh.is_cube(c) ? BoundaryType::QUAD : BoundaryType::TRI);
+			for (const auto &[f, i] : boundary_primitives[c])
+				lb.add_boundary_primitive(f, i);
+			local_boundary.emplace_back(lb);
 		}
 
 		if (!has_polys)
@@ -1442,117 +1470,137 @@ int LagrangeBasis3d::build_bases(
 	std::vector<int> interface_elements;
 	interface_elements.reserve(mesh.n_faces());
 
-	for (int e = 0; e < mesh.n_cells(); ++e)
-	{
-		ElementBases &b = bases[e];
-		const int discr_order = discr_orders(e);
-		const int n_el_bases = (int)element_nodes_id[e].size();
-		b.bases.resize(n_el_bases);
+	// the element bases are independent, the global node ids are already assigned
+	std::vector<char> is_interface_element(mesh.n_cells(), false);
+	utils::maybe_parallel_for(mesh.n_cells(), [&](int start, int end, int thread_id) {
+		for (int e = start; e < end; ++e)
+		{
+			ElementBases &b = bases[e];
+			const int discr_order = discr_orders(e);
+			const int n_el_bases = (int)element_nodes_id[e].size();
+			b.bases.resize(n_el_bases);
 
-		bool skip_interface_element = false;
+			bool skip_interface_element = false;
 
-		for (int j = 0; j < n_el_bases; ++j)
-		{
-			const int global_index = element_nodes_id[e][j];
-			if (global_index < 0)
+			for (int j = 0; j < n_el_bases; ++j)
 			{
-				skip_interface_element = true;
-				break;
+				const int global_index = element_nodes_id[e][j];
+				if (global_index < 0)
+				{
+					skip_interface_element = true;
+					break;
+				}
 			}
-		}
 
-		if (skip_interface_element)
-		{
-			interface_elements.push_back(e);
-		}
+			if (skip_interface_element)
+			{
+				is_interface_element[e] = true;
+			}
 
-		if (mesh.is_cube(e))
-		{
-			const int real_order = quadrature_order > 0 ? quadrature_order : AssemblerUtils::quadrature_order(assembler, discr_order, AssemblerUtils::BasisType::CUBE_LAGRANGE, 3);
-			const int real_mass_order = mass_quadrature_order > 0 ? mass_quadrature_order : AssemblerUtils::quadrature_order("Mass", discr_order, AssemblerUtils::BasisType::CUBE_LAGRANGE, 3);
-			b.set_quadrature([real_order](Quadrature &quad) {
-				HexQuadrature hex_quadrature;
-				hex_quadrature.get_quadrature(real_order, quad);
-			});
-			b.set_mass_quadrature([real_mass_order](Quadrature &quad) {
-				HexQuadrature hex_quadrature;
-				hex_quadrature.get_quadrature(real_mass_order, quad);
-			});
-
-			b.set_local_node_from_primitive_func([serendipity, discr_order, e](const int primitive_id, const Mesh &mesh) {
-				const auto &mesh3d = dynamic_cast<const Mesh3D &>(mesh);
-				Navigation3D::Index index;
-
-				for (int lf = 0; lf < 6; ++lf)
+			if (mesh.is_cube(e))
+			{
+				const int real_order = quadrature_order > 0 ? quadrature_order : AssemblerUtils::quadrature_order(assembler, discr_order, AssemblerUtils::BasisType::CUBE_LAGRANGE, 3);
+				const int real_mass_order = mass_quadrature_order > 0 ? mass_quadrature_order : AssemblerUtils::quadrature_order("Mass", discr_order, AssemblerUtils::BasisType::CUBE_LAGRANGE, 3);
+				b.set_quadrature([real_order](Quadrature &quad) {
+					HexQuadrature hex_quadrature;
+					hex_quadrature.get_quadrature(real_order, quad);
+				});
+				b.set_mass_quadrature([real_mass_order](Quadrature &quad) {
+					HexQuadrature hex_quadrature;
+					hex_quadrature.get_quadrature(real_mass_order, quad);
+				});
+				b.reference_key = "Q3_" + std::to_string(serendipity ? -2 : discr_order) + "_" + std::to_string(real_order) + "_" + std::to_string(real_mass_order);
+				if (!serendipity && discr_order >= 1)
+					b.tensor_basis = TensorProductBasis::get(3, discr_order, real_order);
+
+				b.set_local_node_from_primitive_func([serendipity, discr_order, e](const int primitive_id, const Mesh &mesh) {
+					const auto &mesh3d = dynamic_cast<const Mesh3D &>(mesh);
+					Navigation3D::Index index;
+
+					for (int lf = 0; lf < 6; ++lf)
+					{
+						index = mesh3d.get_index_from_element(e, lf, 0);
+						if (index.face == primitive_id)
+							break;
+					}
+					assert(index.face == primitive_id);
+					return hex_face_local_nodes(serendipity, discr_order, mesh3d, index);
+				});
+
+				for (int j = 0; j < n_el_bases; ++j)
 				{
-					index = mesh3d.get_index_from_element(e, lf, 0);
-					if (index.face == primitive_id)
-						break;
+					const int global_index = element_nodes_id[e][j];
+
+					b.bases[j].init(discr_order, global_index, j, nodes.node_position(global_index));
+
+					const int dtmp = serendipity ? -2 : discr_order;
+
+					b.bases[j].set_basis([dtmp, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::q_basis_value_3d(dtmp, j, uv, val); });
+					b.bases[j].set_grad([dtmp, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::q_grad_basis_value_3d(dtmp, j, uv, val); });
 				}
-				assert(index.face == primitive_id);
-				return hex_face_local_nodes(serendipity, discr_order, mesh3d, index);
-			});
 
-			for (int j = 0; j < n_el_bases; ++j)
+				// evaluates all the element bases at once
+				const int q = serendipity ? -2 : discr_order;
+				b.set_fused_funcs(autogen::q_fused_basis_value_3d(q), autogen::q_fused_grad_basis_value_3d(q));
+			}
+			else if (mesh.is_simplex(e))
 			{
-				const int global_index = element_nodes_id[e][j];
+				const int real_order = quadrature_order > 0 ? quadrature_order : AssemblerUtils::quadrature_order(assembler, discr_order, AssemblerUtils::BasisType::SIMPLEX_LAGRANGE, 3);
+				const int real_mass_order = mass_quadrature_order > 0 ? mass_quadrature_order : AssemblerUtils::quadrature_order("Mass", discr_order, AssemblerUtils::BasisType::SIMPLEX_LAGRANGE, 3);
 
-				b.bases[j].init(discr_order, global_index, j, nodes.node_position(global_index));
+				b.set_quadrature([real_order](Quadrature &quad) {
+					TetQuadrature tet_quadrature;
+					tet_quadrature.get_quadrature(real_order, quad);
+				});
+				b.set_mass_quadrature([real_mass_order](Quadrature &quad) {
+					TetQuadrature tet_quadrature;
+					tet_quadrature.get_quadrature(real_mass_order, quad);
+				});
+				b.reference_key = "P3_" + std::to_string(discr_order) + "_" + std::to_string(real_order) + "_" + std::to_string(real_mass_order);
 
-				const int dtmp = serendipity ? -2 : discr_order;
+				b.set_local_node_from_primitive_func([discr_order, e](const int primitive_id, const Mesh &mesh) {
+					const auto &mesh3d = dynamic_cast<const Mesh3D &>(mesh);
+					Navigation3D::Index index;
 
-				b.bases[j].set_basis([dtmp, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::q_basis_value_3d(dtmp, j, uv, val); });
-				b.bases[j].set_grad([dtmp, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::q_grad_basis_value_3d(dtmp, j, uv, val); });
-			}
-		}
-		else if (mesh.is_simplex(e))
-		{
-			const int real_order = quadrature_order > 0 ? quadrature_order : AssemblerUtils::quadrature_order(assembler, discr_order, AssemblerUtils::BasisType::SIMPLEX_LAGRANGE, 3);
-			const int real_mass_order = mass_quadrature_order > 0 ? mass_quadrature_order : AssemblerUtils::quadrature_order("Mass", discr_order, AssemblerUtils::BasisType::SIMPLEX_LAGRANGE, 3);
-
-			b.set_quadrature([real_order](Quadrature &quad) {
-				TetQuadrature tet_quadrature;
-				tet_quadrature.get_quadrature(real_order, quad);
-			});
-			b.set_mass_quadrature([real_mass_order](Quadrature &quad) {
-				TetQuadrature tet_quadrature;
-				tet_quadrature.get_quadrature(real_mass_order, quad);
-			});
-
-			b.set_local_node_from_primitive_func([discr_order, e](const int primitive_id, const Mesh &mesh) {
-				const auto &mesh3d = dynamic_cast<const Mesh3D &>(mesh);
-				Navigation3D::Index index;
-
-				for (int lf = 0; lf < mesh3d.n_cell_faces(e); ++lf)
-				{
-					index = mesh3d.get_index_from_element(e, lf, 0);
-					if (index.face == primitive_id)
-						break;
-				}
-				assert(index.face == primitive_id);
-				return tet_face_local_nodes(discr_order, mesh3d, index);
-			});
+					for (int lf = 0; lf < mesh3d.n_cell_faces(e); ++lf)
+					{
+						index = mesh3d.get_index_from_element(e, lf, 0);
+						if (index.face == primitive_id)
+							break;
+					}
+					assert(index.face == primitive_id);
+					return tet_face_local_nodes(discr_order, mesh3d, index);
+				});
 
-			const bool rational = is_geom_bases && mesh.is_rational() && !mesh.cell_weights(e).empty();
-			assert(!rational);
+				const bool rational = is_geom_bases && mesh.is_rational() && !mesh.cell_weights(e).empty();
+				assert(!rational);
 
-			for (int j = 0; j < n_el_bases; ++j)
-			{
-				const int global_index = element_nodes_id[e][j];
-				if (!skip_interface_element)
+				for (int j = 0; j < n_el_bases; ++j)
 				{
-					b.bases[j].init(discr_order, global_index, j, nodes.node_position(global_index));
+					const int global_index = element_nodes_id[e][j];
+					if (!skip_interface_element)
+					{
+						b.bases[j].init(discr_order, global_index, j, nodes.node_position(global_index));
+					}
+
+					b.bases[j].set_basis([discr_order, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::p_basis_value_3d(discr_order, j, uv, val); });
+					b.bases[j].set_grad([discr_order, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::p_grad_basis_value_3d(discr_order, j, uv, val); });
 				}
 
-				b.bases[j].set_basis([discr_order, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::p_basis_value_3d(discr_order, j, uv, val); });
-				b.bases[j].set_grad([discr_order, j](const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { autogen::p_grad_basis_value_3d(discr_order, j, uv, val); });
+				b.set_fused_funcs(autogen::p_fused_basis_value_3d(discr_order), autogen::p_fused_grad_basis_value_3d(discr_order));
+			}
+			else
+			{
+				// Polyhedra bases are built later on
+				// assert(false);
 			}
 		}
-		else
-		{
-			// Polyhedra bases are built later on
-			// assert(false);
-		}
+	});
+
+	for (int e = 0; e < mesh.n_cells(); ++e)
+	{
+		if (is_interface_element[e])
+			interface_elements.push_back(e);
 	}
 
 	if (!is_geom_bases)
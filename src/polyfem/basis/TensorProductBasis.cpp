@@ -0,0 +1,199 @@
+#include "TensorProductBasis.hpp"
+
+#include <polyfem/quadrature/LineQuadrature.hpp>
+#include <polyfem/quadrature/QuadQuadrature.hpp>
+#include <polyfem/quadrature/HexQuadrature.hpp>
+#include <polyfem/autogen/auto_q_bases.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <map>
+#include <mutex>
+#include <tuple>
+
+namespace polyfem
+{
+	namespace basis
+	{
+		namespace
+		{
+			/// values (resp. derivatives) of the 1D Lagrange polynomials on the order + 1 equispaced nodes of [0, 1] at the points x
+			void lagrange_1d(const int order, const Eigen::VectorXd &x, Eigen::MatrixXd &val, Eigen::MatrixXd &der)
+			{
+				const int n = order + 1;
+				const Eigen::VectorXd nodes = Eigen::VectorXd::LinSpaced(n, 0, 1);
+
+				val.setOnes(x.size(), n);
+				der.setZero(x.size(), n);
+
+				for (int m = 0; m < n; ++m)
+				{
+					for (int l = 0; l < n; ++l)
+					{
+						if (l == m)
+							continue;
+
+						const double denom = nodes(m) - nodes(l);
+						val.col(m).array() *= (x.array() - nodes(l)) / denom;
+
+						Eigen::ArrayXd tmp = Eigen::ArrayXd::Constant(x.size(), 1 / denom);
+						for (int r = 0; r < n; ++r)
+						{
+							if (r != m && r != l)
+								tmp *= (x.array() - nodes(r)) / (nodes(m) - nodes(r));
+						}
+						der.col(m).array() += tmp;
+					}
+				}
+			}
+		} // namespace
+
+		TensorProductBasis::TensorProductBasis(const int dim, const int order, const int quadrature_order)
+			: dim_(dim), order_(order), quadrature_order_(quadrature_order)
+		{
+			assert(dim == 2 || dim == 3);
+			assert(order >= 1);
+
+			quadrature::Quadrature line;
+			quadrature::LineQuadrature line_quadrature;
+			line_quadrature.get_quadrature(quadrature_order, line);
+
+			const Eigen::VectorXd x = line.points.col(0);
+			lagrange_1d(order, x, b_, d_);
+			n_quadrature_points_ = dim == 2 ? x.size() * x.size() : x.size() * x.size() * x.size();
+
+			if (dim == 2)
+				quadrature::QuadQuadrature().get_quadrature(quadrature_order, quadrature_);
+			else
+				quadrature::HexQuadrature().get_quadrature(quadrature_order, quadrature_);
+			assert(quadrature_.size() == n_quadrature_points_);
+
+			// the nodes of the Q_k bases are on the grid of step 1 / order
+			Eigen::MatrixXd nodes;
+			if (dim == 2)
+				autogen::q_nodes_2d(order, nodes);
+			else
+				autogen::q_nodes_3d(order, nodes);
+
+			const int n = order + 1;
+			lex_.resize(nodes.rows());
+			for (int j = 0; j < nodes.rows(); ++j)
+			{
+				int index = 0;
+				for (int c = dim - 1; c >= 0; --c)
+					index = index * n + int(std::round(nodes(j, c) * order));
+				lex_(j) = index;
+			}
+		}
+
+		std::shared_ptr<const TensorProductBasis> TensorProductBasis::get(const int dim, const int order, const int quadrature_order)
+		{
+			static std::mutex mutex;
+			static std::map<std::tuple<int, int, int>, std::shared_ptr<const TensorProductBasis>> instances;
+
+			std::lock_guard<std::mutex> lock(mutex);
+			auto &res = instances[std::make_tuple(dim, order, quadrature_order)];
+			if (!res)
+				res = std::make_shared<TensorProductBasis>(dim, order, quadrature_order);
+			return res;
+		}
+
+		bool TensorProductBasis::is_quadrature(const quadrature::Quadrature &quad) const
+		{
+			if (quad.points.rows() != quadrature_.points.rows() || quad.points.cols() != quadrature_.points.cols()
+				|| quad.weights.size() != quadrature_.weights.size())
+				return false;
+
+			return (quad.points - quadrature_.points).cwiseAbs().maxCoeff() <= 1e-14
+				   && (quad.weights - quadrature_.weights).cwiseAbs().maxCoeff() <= 1e-14;
+		}
+
+		void TensorProductBasis::interpolate_grad(const Eigen::MatrixXd &coeffs, Eigen::MatrixXd &grad) const
+		{
+			assert(coeffs.rows() == n_bases());
+
+			const int n = order_ + 1;
+			const int nq = b_.rows();
+			const int n_fields = coeffs.cols();
+			grad.resize(n_quadrature_points_, n_fields * dim_);
+
+			Eigen::VectorXd u(n_bases());
+			Eigen::MatrixXd tmp;
+			for (int f = 0; f < n_fields; ++f)
+			{
+				for (int j = 0; j < n_bases(); ++j)
+					u(lex_(j)) = coeffs(j, f);
+
+				if (dim_ == 2)
+				{
+					const Eigen::Map<const Eigen::MatrixXd> ux(u.data(), n, n);
+					Eigen::Map<Eigen::MatrixXd>(grad.col(f * 2 + 0).data(), nq, nq) = d_ * ux * b_.transpose();
+					Eigen::Map<Eigen::MatrixXd>(grad.col(f * 2 + 1).data(), nq, nq) = b_ * ux * d_.transpose();
+					continue;
+				}
+
+				// contract z, then y, then x
+				const Eigen::Map<const Eigen::MatrixXd> uxy(u.data(), n * n, n);
+				const Eigen::MatrixXd bz = uxy * b_.transpose();
+				const Eigen::MatrixXd dz = uxy * d_.transpose();
+
+				for (int qz = 0; qz < nq; ++qz)
+				{
+					const Eigen::Map<const Eigen::MatrixXd> bz_q(bz.col(qz).data(), n, n);
+					const Eigen::Map<const Eigen::MatrixXd> dz_q(dz.col(qz).data(), n, n);
+					const long offset = long(qz) * nq * nq;
+
+					tmp.noalias() = bz_q * b_.transpose();
+					Eigen::Map<Eigen::MatrixXd>(grad.col(f * 3 + 0).data() + offset, nq, nq).noalias() = d_ * tmp;
+					tmp.noalias() = bz_q * d_.transpose();
+					Eigen::Map<Eigen::MatrixXd>(grad.col(f * 3 + 1).data() + offset, nq, nq).noalias() = b_ * tmp;
+					tmp.noalias() = dz_q * b_.transpose();
+					Eigen::Map<Eigen::MatrixXd>(grad.col(f * 3 + 2).data() + offset, nq, nq).noalias() = b_ * tmp;
+				}
+			}
+		}
+
+		void TensorProductBasis::integrate_grad(const Eigen::MatrixXd &flux, Eigen::MatrixXd &res) const
+		{
+			assert(flux.rows() == n_quadrature_points_);
+			assert(flux.cols() % dim_ == 0);
+
+			const int n = order_ + 1;
+			const int nq = b_.rows();
+			const int n_fields = flux.cols() / dim_;
+			res.resize(n_bases(), n_fields);
+
+			Eigen::MatrixXd u(n * n, dim_ == 2 ? 1 : n);
+			Eigen::MatrixXd bz(n * n, nq), dz(n * n, nq);
+			for (int f = 0; f < n_fields; ++f)
+			{
+				if (dim_ == 2)
+				{
+					const Eigen::Map<const Eigen::MatrixXd> fx(flux.col(f * 2 + 0).data(), nq, nq);
+					const Eigen::Map<const Eigen::MatrixXd> fy(flux.col(f * 2 + 1).data(), nq, nq);
+					Eigen::Map<Eigen::MatrixXd>(u.data(), n, n) = d_.transpose() * fx * b_ + b_.transpose() * fy * d_;
+				}
+				else
+				{
+					// transpose of interpolate_grad: contract x, then y, then z
+					for (int qz = 0; qz < nq; ++qz)
+					{
+						const long offset = long(qz) * nq * nq;
+						const Eigen::Map<const Eigen::MatrixXd> fx(flux.col(f * 3 + 0).data() + offset, nq, nq);
+						const Eigen::Map<const Eigen::MatrixXd> fy(flux.col(f * 3 + 1).data() + offset, nq, nq);
+						const Eigen::Map<const Eigen::MatrixXd> fz(flux.col(f * 3 + 2).data() + offset, nq, nq);
+
+						Eigen::Map<Eigen::MatrixXd>(bz.col(qz).data(), n, n) = d_.transpose() * fx * b_ + b_.transpose() * fy * d_;
+						Eigen::Map<Eigen::MatrixXd>(dz.col(qz).data(), n, n) = b_.transpose() * fz * b_;
+					}
+
+					u.noalias() = bz * b_;
+					u.noalias() += dz * d_;
+				}
+
+				for (int j = 0; j < n_bases(); ++j)
+					res(j, f) = u.data()[lex_(j)];
+			}
+		}
+	} // namespace basis
+} // namespace polyfem
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <polyfem/quadrature/Quadrature.hpp>
+
+#include <Eigen/Dense>
+
+#include <memory>
+
+namespace polyfem
+{
+	namespace basis
+	{
+		/// @brief Q_k Lagrange bases of a quad/hex written as products of 1D Lagrange polynomials, evaluated at the
+		/// points of the tensor-product quadrature (QuadQuadrature/HexQuadrature) built from the same LineQuadrature.
+		///
+		/// The gradients of a field at all the quadrature points (and the transpose operation, integrating a flux
+		/// against the basis gradients) are computed one direction at a time (sum factorization). This costs
+		/// O(k^{dim+1}) per field instead of O(k^{2 dim}) for the dense #quadrature points x #bases products.
+		class TensorProductBasis
+		{
+		public:
+			/// @param[in] dim dimension of the element (2 for quads, 3 for hexes)
+			/// @param[in] order order k of the Q_k Lagrange bases (k >= 1)
+			/// @param[in] quadrature_order order of the quad/hex quadrature
+			TensorProductBasis(const int dim, const int order, const int quadrature_order);
+
+			/// shared instance for the given parameters, the instances are never released
+			static std::shared_ptr<const TensorProductBasis> get(const int dim, const int order, const int quadrature_order);
+
+			inline int dim() const { return dim_; }
+			inline int order() const { return order_; }
+			inline int quadrature_order() const { return quadrature_order_; }
+			/// number of bases, (order + 1)^dim
+			inline int n_bases() const { return lex_.size(); }
+			/// number of quadrature points, same order as the points of QuadQuadrature/HexQuadrature
+			inline int n_quadrature_points() const { return n_quadrature_points_; }
+			/// the QuadQuadrature/HexQuadrature of quadrature_order the kernels integrate with
+			inline const quadrature::Quadrature &quadrature() const { return quadrature_; }
+
+			/// true if quad has the points and weights of quadrature(), the kernels ignore the points and weights of the element
+			bool is_quadrature(const quadrature::Quadrature &quad) const;
+
+			/// @brief Gradients in the reference element of the fields with local coefficients coeffs at the quadrature points
+			///
+			/// @param[in] coeffs #bases x #fields coefficients, in the order of the local bases of the element
+			/// @param[out] grad #quadrature points x (#fields * dim), the gradient of field f is in the columns f * dim to (f + 1) * dim - 1
+			void interpolate_grad(const Eigen::MatrixXd &coeffs, Eigen::MatrixXd &grad) const;
+
+			/// @brief Transpose of interpolate_grad: res(j, f) = sum_q sum_c d phi_j / d x_c (q) flux(q, f * dim + c)
+			///
+			/// @param[in] flux #quadrature points x (#fields * dim)
+			/// @param[out] res #bases x #fields, in the order of the local bases of the element
+			void integrate_grad(const Eigen::MatrixXd &flux, Eigen::MatrixXd &res) const;
+
+		private:
+			int dim_;
+			int order_;
+			int quadrature_order_;
+			int n_quadrature_points_;
+			quadrature::Quadrature quadrature_;
+
+			Eigen::MatrixXd b_;  ///< 1D bases at the 1D quadrature points, #1D quadrature points x (order + 1)
+			Eigen::MatrixXd d_;  ///< 1D bases derivatives at the 1D quadrature points
+			Eigen::VectorXi lex_; ///< local basis index to lexicographic index (x fastest)
+		};
+	} // namespace basis
+} // namespace polyfem
@@ -0,0 +1,106 @@
+#include "AsyncFileWriter.hpp"
+
+#include <polyfem/utils/Logger.hpp>
+
+#include <algorithm>
+
+namespace polyfem::io
+{
+	AsyncFileWriter::AsyncFileWriter(const int max_pending)
+		: max_pending_(std::max(max_pending, 1))
+	{
+		thread_ = std::thread([this]() { run(); });
+	}
+
+	AsyncFileWriter::~AsyncFileWriter()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stop_ = true;
+		}
+		task_cv_.notify_one();
+		thread_.join();
+
+		if (exception_)
+		{
+			try
+			{
+				std::rethrow_exception(exception_);
+			}
+			catch (const std::exception &e)
+			{
+				logger().error("Asynchronous write failed: {}", e.what());
+			}
+			catch (...)
+			{
+				logger().error("Asynchronous write failed");
+			}
+		}
+	}
+
+	void AsyncFileWriter::push(std::function<void()> task)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mutex_);
+			space_cv_.wait(lock, [this]() { return int(tasks_.size()) + int(busy_) < max_pending_ || exception_; });
+			rethrow();
+			tasks_.push_back(std::move(task));
+		}
+		task_cv_.notify_one();
+	}
+
+	void AsyncFileWriter::flush()
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		space_cv_.wait(lock, [this]() { return (tasks_.empty() && !busy_) || exception_; });
+		rethrow();
+	}
+
+	void AsyncFileWriter::rethrow()
+	{
+		if (!exception_)
+			return;
+
+		std::exception_ptr e = exception_;
+		exception_ = nullptr;
+		// the writes queued after the failure are dropped
+		tasks_.clear();
+		std::rethrow_exception(e);
+	}
+
+	void AsyncFileWriter::run()
+	{
+		while (true)
+		{
+			std::function<void()> task;
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				task_cv_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+				// the pending writes are executed before stopping
+				if (tasks_.empty())
+					return;
+				task = std::move(tasks_.front());
+				tasks_.pop_front();
+				busy_ = true;
+			}
+
+			std::exception_ptr error;
+			try
+			{
+				task();
+			}
+			catch (...)
+			{
+				error = std::current_exception();
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				busy_ = false;
+				if (error && !exception_)
+					exception_ = error;
+			}
+			space_cv_.notify_all();
+		}
+	}
+} // namespace polyfem::io
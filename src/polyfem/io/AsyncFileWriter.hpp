@@ -0,0 +1,53 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace polyfem::io
+{
+	/// Executes file writes on a background thread in submission order.
+	/// At most max_pending writes are queued, push blocks when the queue is full to bound the memory.
+	class AsyncFileWriter
+	{
+	public:
+		/// @param[in] max_pending maximum number of queued writes
+		explicit AsyncFileWriter(const int max_pending);
+		/// waits for the pending writes
+		~AsyncFileWriter();
+
+		AsyncFileWriter(const AsyncFileWriter &) = delete;
+		AsyncFileWriter &operator=(const AsyncFileWriter &) = delete;
+
+		/// @brief queues a write, blocks while the queue is full
+		/// rethrows the first error of the previous writes
+		/// @param[in] task write to execute, owns all the data it writes
+		void push(std::function<void()> task);
+
+		/// @brief waits until all the queued writes are done
+		/// rethrows the first error of the previous writes
+		void flush();
+
+		/// @return maximum number of queued writes
+		inline int max_pending() const { return max_pending_; }
+
+	private:
+		void run();
+		void rethrow();
+
+		const int max_pending_;
+
+		std::mutex mutex_;
+		std::condition_variable task_cv_;  ///< signals new tasks or stop
+		std::condition_variable space_cv_; ///< signals a free slot or an empty queue
+		std::deque<std::function<void()>> tasks_;
+		bool busy_ = false; ///< a task is being executed
+		bool stop_ = false;
+		std::exception_ptr exception_;
+
+		std::thread thread_;
+	};
+} // namespace polyfem::io
@@ -14,6 +14,7 @@
 #include <polyfem/autogen/auto_q_bases.hpp>
 
 #include <polyfem/utils/Logger.hpp>
+#include <polyfem/utils/MaybeParallelFor.hpp>
 
 #include <igl/AABB.h>
 #include <igl/per_face_normals.h>
@@ -51,8 +52,213 @@ namespace polyfem::io
 				logger().error("Invalid tensor dimensions.");
 			}
 		}
+
+		/// local points where the element e is sampled for the visualization
+		/// @return the points (either from the sampler or stored in buffer), nullptr if the element is not exported
+		const Eigen::MatrixXd *vis_local_points(
+			const Mesh &mesh,
+			const Eigen::VectorXi &disc_orders,
+			const std::map<int, Eigen::MatrixXd> &polys,
+			const std::map<int, std::pair<Eigen::MatrixXd, Eigen::MatrixXi>> &polys_3d,
+			const utils::RefElementSampler &sampler,
+			const bool use_sampler,
+			const bool boundary_only,
+			const int e,
+			Eigen::MatrixXd &buffer)
+		{
+			if (boundary_only && mesh.is_volume() && !mesh.is_boundary_element(e))
+				return nullptr;
+
+			if (use_sampler)
+			{
+				if (mesh.is_simplex(e))
+					return &sampler.simplex_points();
+				if (mesh.is_cube(e))
+					return &sampler.cube_points();
+
+				Eigen::MatrixXi vis_faces_poly, vis_edges_poly;
+				if (mesh.is_volume())
+					sampler.sample_polyhedron(polys_3d.at(e).first, polys_3d.at(e).second, buffer, vis_faces_poly, vis_edges_poly);
+				else
+					sampler.sample_polygon(polys.at(e), buffer, vis_faces_poly, vis_edges_poly);
+				return &buffer;
+			}
+
+			if (mesh.is_simplex(e))
+			{
+				if (mesh.is_volume())
+					autogen::p_nodes_3d(disc_orders(e), buffer);
+				else
+					autogen::p_nodes_2d(disc_orders(e), buffer);
+			}
+			else if (mesh.is_cube(e))
+			{
+				if (mesh.is_volume())
+					autogen::q_nodes_3d(disc_orders(e), buffer);
+				else
+					autogen::q_nodes_2d(disc_orders(e), buffer);
+			}
+			else
+				return nullptr;
+
+			return &buffer;
+		}
+
+		/// first sample row of every element, n_elements + 1 entries, the polygons are sampled
+		std::vector<int> vis_offsets(
+			const Mesh &mesh,
+			const int n_elements,
+			const Eigen::VectorXi &disc_orders,
+			const std::map<int, Eigen::MatrixXd> &polys,
+			const std::map<int, std::pair<Eigen::MatrixXd, Eigen::MatrixXi>> &polys_3d,
+			const utils::RefElementSampler &sampler,
+			const bool use_sampler,
+			const bool boundary_only)
+		{
+			std::vector<int> offsets(n_elements + 1, 0);
+			Eigen::MatrixXd buffer;
+			for (int e = 0; e < n_elements; ++e)
+			{
+				const Eigen::MatrixXd *local_pts = vis_local_points(mesh, disc_orders, polys, polys_3d, sampler, use_sampler, boundary_only, e, buffer);
+				offsets[e + 1] = offsets[e] + (local_pts ? local_pts->rows() : 0);
+			}
+			return offsets;
+		}
+
+		/// evaluates the named values of the assembler (scalar or tensor) at the sample points of every element
+		/// and stores them in result with the row offsets of the elements
+		template <typename Evaluate>
+		void evaluate_sampled_values(
+			const Mesh &mesh,
+			const std::vector<ElementBases> &bases,
+			const std::vector<ElementBases> &gbases,
+			const Eigen::VectorXi &disc_orders,
+			const std::map<int, Eigen::MatrixXd> &polys,
+			const std::map<int, std::pair<Eigen::MatrixXd, Eigen::MatrixXi>> &polys_3d,
+			const utils::RefElementSampler &sampler,
+			const int n_points,
+			const Eigen::MatrixXd &fun,
+			const double t,
+			const bool use_sampler,
+			const bool boundary_only,
+			const SampledValuesCache *cache,
+			const Evaluate &evaluate,
+			std::vector<Assembler::NamedMatrix> &result)
+		{
+			result.clear();
+
+			const int n_els = bases.size();
+			if (cache && !cache->matches(use_sampler, boundary_only))
+				cache = nullptr;
+
+			std::vector<int> offsets;
+			if (!cache)
+				offsets = vis_offsets(mesh, n_els, disc_orders, polys, polys_3d, sampler, use_sampler, boundary_only);
+			const auto offset = [&](const int e) { return cache ? cache->offset(e) : offsets[e]; };
+			assert(offset(n_els) <= n_points);
+
+			// the names and sizes of the values are given by the first sampled element
+			int first = 0;
+			while (first < n_els && offset(first + 1) == offset(first))
+				++first;
+			if (first == n_els)
+				return;
+
+			{
+				Eigen::MatrixXd buffer;
+				std::vector<Assembler::NamedMatrix> tmp;
+				const Eigen::MatrixXd *local_pts = vis_local_points(mesh, disc_orders, polys, polys_3d, sampler, use_sampler, boundary_only, first, buffer);
+				evaluate(OutputData(t, first, bases[first], gbases[first], *local_pts, fun, cache ? cache->values(first) : nullptr), tmp);
+
+				result.resize(tmp.size());
+				for (int k = 0; k < tmp.size(); ++k)
+				{
+					result[k].first = tmp[k].first;
+					result[k].second.resize(n_points, tmp[k].second.cols());
+				}
+			}
+
+			utils::maybe_parallel_for(n_els, [&](int start, int end, int thread_id) {
+				Eigen::MatrixXd buffer;
+				std::vector<Assembler::NamedMatrix> tmp;
+
+				for (int i = start; i < end; ++i)
+				{
+					if (offset(i + 1) == offset(i))
+						continue;
+
+					const Eigen::MatrixXd *local_pts = vis_local_points(mesh, disc_orders, polys, polys_3d, sampler, use_sampler, boundary_only, i, buffer);
+					evaluate(OutputData(t, i, bases[i], gbases[i], *local_pts, fun, cache ? cache->values(i) : nullptr), tmp);
+
+					assert(tmp.size() == result.size());
+					for (int k = 0; k < tmp.size(); ++k)
+					{
+						assert(local_pts->rows() == tmp[k].second.rows());
+						result[k].second.block(offset(i), 0, tmp[k].second.rows(), tmp[k].second.cols()) = tmp[k].second;
+					}
+				}
+			});
+		}
 	} // namespace
 
+	void SampledValuesCache::init(
+		const Mesh &mesh,
+		const std::vector<ElementBases> &bases,
+		const std::vector<ElementBases> &gbases,
+		const Eigen::VectorXi &disc_orders,
+		const std::map<int, Eigen::MatrixXd> &polys,
+		const std::map<int, std::pair<Eigen::MatrixXd, Eigen::MatrixXi>> &polys_3d,
+		const utils::RefElementSampler &sampler,
+		const bool use_sampler,
+		const bool boundary_only)
+	{
+		const int n_els = bases.size();
+
+		use_sampler_ = use_sampler;
+		boundary_only_ = boundary_only;
+		offsets_ = vis_offsets(mesh, n_els, disc_orders, polys, polys_3d, sampler, use_sampler, boundary_only);
+		values_.clear();
+		values_.resize(n_els);
+		element_sizes_.assign(n_els, 0);
+
+		utils::maybe_parallel_for(n_els, [&](int start, int end, int thread_id) {
+			Eigen::MatrixXd buffer;
+			ElementAssemblyValues vals;
+
+			for (int e = start; e < end; ++e)
+			{
+				const Eigen::MatrixXd *local_pts = vis_local_points(mesh, disc_orders, polys, polys_3d, sampler, use_sampler, boundary_only, e, buffer);
+				if (!local_pts)
+					continue;
+
+				values_[e].compute(e, mesh.is_volume(), *local_pts, bases[e], gbases[e]);
+
+				vals.compute(e, mesh.is_volume(), bases[e], gbases[e]);
+				element_sizes_[e] = (vals.det.array() * vals.quadrature.weights.array()).sum();
+			}
+		});
+
+		initialized_ = true;
+
+		logger().debug("Cached the values at {} sample points ({} MB)", offsets_.back(), memory() / 1024. / 1024.);
+	}
+
+	void SampledValuesCache::clear()
+	{
+		initialized_ = false;
+		values_.clear();
+		offsets_.clear();
+		element_sizes_.clear();
+	}
+
+	size_t SampledValuesCache::memory() const
+	{
+		size_t res = sizeof(int) * offsets_.capacity() + sizeof(double) * element_sizes_.capacity();
+		for (const auto &vals : values_)
+			res += vals.memory();
+		return res;
+	}
+
 	void Evaluator::get_sidesets(
 		const mesh::Mesh &mesh,
 		Eigen::MatrixXd &pts,
@@ -573,7 +779,8 @@ namespace polyfem::io
 		std::vector<assembler::Assembler::NamedMatrix> &result_scalar,
 		std::vector<assembler::Assembler::NamedMatrix> &result_tensor,
 		const bool use_sampler,
-		const bool boundary_only)
+		const bool boundary_only,
+		const SampledValuesCache *cache)
 	{
 		result_scalar.clear();
 		result_tensor.clear();
@@ -590,75 +797,63 @@ namespace polyfem::io
 		}
 
 		assert(!is_problem_scalar);
-		const int actual_dim = mesh.dimension();
+		const int n_els = bases.size();
 
-		std::vector<Eigen::MatrixXd> avg_scalar;
+		// the values are averaged from the nodes of the elements, polygons are not supported
+		if (cache && !cache->matches(/*use_sampler=*/false, /*boundary_only=*/false))
+			cache = nullptr;
 
-		Eigen::MatrixXd areas(n_bases, 1);
-		areas.setZero();
+		const auto element_nodes = [&](const int e, Eigen::MatrixXd &buffer) {
+			return vis_local_points(mesh, disc_orders, polys, polys_3d, sampler, /*use_sampler=*/false, /*boundary_only=*/false, e, buffer);
+		};
 
+		// the names of the scalar values are given by the first supported element
 		std::vector<std::pair<std::string, Eigen::MatrixXd>> tmp_s;
-		Eigen::MatrixXd local_val;
-
-		ElementAssemblyValues vals;
-		for (int i = 0; i < int(bases.size()); ++i)
 		{
-			const ElementBases &bs = bases[i];
-			const ElementBases &gbs = gbases[i];
-			Eigen::MatrixXd local_pts;
-
-			if (mesh.is_simplex(i))
+			Eigen::MatrixXd buffer;
+			for (int e = 0; e < n_els && tmp_s.empty(); ++e)
 			{
-				if (mesh.dimension() == 3)
-					autogen::p_nodes_3d(disc_orders(i), local_pts);
-				else
-					autogen::p_nodes_2d(disc_orders(i), local_pts);
-			}
-			else if (mesh.is_cube(i))
-			{
-				if (mesh.dimension() == 3)
-					autogen::q_nodes_3d(disc_orders(i), local_pts);
-				else
-					autogen::q_nodes_2d(disc_orders(i), local_pts);
-			}
-			else
-			{
-				// not supported for polys
-				continue;
+				const Eigen::MatrixXd *local_pts = element_nodes(e, buffer);
+				if (local_pts)
+					assembler.compute_scalar_value(OutputData(t, e, bases[e], gbases[e], *local_pts, fun, cache ? cache->values(e) : nullptr), tmp_s);
 			}
+		}
 
-			vals.compute(i, actual_dim == 3, bases[i], gbases[i]);
-			const quadrature::Quadrature &quadrature = vals.quadrature;
-			const double area = (vals.det.array() * quadrature.weights.array()).sum();
+		struct LocalStorage
+		{
+			std::vector<Eigen::VectorXd> avg_scalar;
+			Eigen::VectorXd areas;
+		};
+		auto storage = utils::create_thread_storage(LocalStorage{
+			std::vector<Eigen::VectorXd>(tmp_s.size(), Eigen::VectorXd::Zero(n_bases)),
+			Eigen::VectorXd::Zero(n_bases)});
 
-			assembler.compute_scalar_value(OutputData(t, i, bs, gbs, local_pts, fun), tmp_s);
+		utils::maybe_parallel_for(n_els, [&](int start, int end, int thread_id) {
+			LocalStorage &local_storage = utils::get_local_thread_storage(storage, thread_id);
 
-			// assembler.compute_tensor_value(i, bs, gbs, local_pts, fun, local_val);
-			// MatrixXd avg_tensor(n_points * actual_dim*actual_dim, 1);
+			Eigen::MatrixXd buffer;
+			ElementAssemblyValues vals;
+			std::vector<std::pair<std::string, Eigen::MatrixXd>> local_s;
 
-			for (size_t j = 0; j < bs.bases.size(); ++j)
+			for (int i = start; i < end; ++i)
 			{
-				const Basis &b = bs.bases[j];
-				if (b.global().size() > 1)
+				const Eigen::MatrixXd *local_pts = element_nodes(i, buffer);
+				if (!local_pts)
 					continue;
 
-				auto &global = b.global().front();
-				areas(global.index) += area;
-			}
+				const ElementBases &bs = bases[i];
 
-			if (avg_scalar.empty())
-			{
-				avg_scalar.resize(tmp_s.size());
-				for (auto &m : avg_scalar)
+				double area;
+				if (cache)
+					area = cache->element_size(i);
+				else
 				{
-					m.resize(n_bases, 1);
-					m.setZero();
+					vals.compute(i, mesh.is_volume(), bases[i], gbases[i]);
+					area = (vals.det.array() * vals.quadrature.weights.array()).sum();
 				}
-			}
 
-			for (int k = 0; k < tmp_s.size(); ++k)
-			{
-				local_val = tmp_s[k].second;
+				assembler.compute_scalar_value(OutputData(t, i, bs, gbases[i], *local_pts, fun, cache ? cache->values(i) : nullptr), local_s);
+				assert(local_s.size() == tmp_s.size());
 
 				for (size_t j = 0; j < bs.bases.size(); ++j)
 				{
@@ -666,10 +861,21 @@ namespace polyfem::io
 					if (b.global().size() > 1)
 						continue;
 
-					auto &global = b.global().front();
-					avg_scalar[k](global.index) += local_val(j) * area;
+					const int global = b.global().front().index;
+					local_storage.areas(global) += area;
+					for (int k = 0; k < local_s.size(); ++k)
+						local_storage.avg_scalar[k](global) += local_s[k].second(j) * area;
 				}
 			}
+		});
+
+		std::vector<Eigen::MatrixXd> avg_scalar(tmp_s.size(), Eigen::VectorXd::Zero(n_bases));
+		Eigen::VectorXd areas = Eigen::VectorXd::Zero(n_bases);
+		for (const LocalStorage &local_storage : storage)
+		{
+			areas += local_storage.areas;
+			for (int k = 0; k < avg_scalar.size(); ++k)
+				avg_scalar[k] += local_storage.avg_scalar[k];
 		}
 
 		for (auto &m : avg_scalar)
@@ -910,74 +1116,41 @@ namespace polyfem::io
 			return;
 		}
 
-		std::vector<AssemblyValues> tmp;
-
-		result.resize(n_points, actual_dim);
-
-		int index = 0;
+		const int n_els = basis.size();
 
-		Eigen::MatrixXi vis_faces_poly, vis_edges_poly;
+		const std::vector<int> offsets = vis_offsets(mesh, n_els, disc_orders, polys, polys_3d, sampler, use_sampler, boundary_only);
+		assert(offsets.back() <= n_points);
 
-		for (int i = 0; i < int(basis.size()); ++i)
-		{
-			const ElementBases &bs = basis[i];
-			Eigen::MatrixXd local_pts;
+		result.resize(n_points, actual_dim);
 
-			if (boundary_only && mesh.is_volume() && !mesh.is_boundary_element(i))
-				continue;
+		utils::maybe_parallel_for(n_els, [&](int start, int end, int thread_id) {
+			std::vector<AssemblyValues> tmp;
+			Eigen::MatrixXd buffer, local_res;
 
-			if (use_sampler)
+			for (int i = start; i < end; ++i)
 			{
-				if (mesh.is_simplex(i))
-					local_pts = sampler.simplex_points();
-				else if (mesh.is_cube(i))
-					local_pts = sampler.cube_points();
-				else
-				{
-					if (mesh.is_volume())
-						sampler.sample_polyhedron(polys_3d.at(i).first, polys_3d.at(i).second, local_pts, vis_faces_poly, vis_edges_poly);
-					else
-						sampler.sample_polygon(polys.at(i), local_pts, vis_faces_poly, vis_edges_poly);
-				}
-			}
-			else
-			{
-				if (mesh.is_volume())
-				{
-					if (mesh.is_simplex(i))
-						autogen::p_nodes_3d(disc_orders(i), local_pts);
-					else if (mesh.is_cube(i))
-						autogen::q_nodes_3d(disc_orders(i), local_pts);
-					else
-						continue;
-				}
-				else
-				{
-					if (mesh.is_simplex(i))
-						autogen::p_nodes_2d(disc_orders(i), local_pts);
-					else if (mesh.is_cube(i))
-						autogen::q_nodes_2d(disc_orders(i), local_pts);
-					else
-						continue;
-				}
-			}
-
-			Eigen::MatrixXd local_res = Eigen::MatrixXd::Zero(local_pts.rows(), actual_dim);
-			bs.evaluate_bases(local_pts, tmp);
-			for (size_t j = 0; j < bs.bases.size(); ++j)
-			{
-				const Basis &b = bs.bases[j];
+				const Eigen::MatrixXd *local_pts = vis_local_points(mesh, disc_orders, polys, polys_3d, sampler, use_sampler, boundary_only, i, buffer);
+				if (!local_pts)
+					continue;
 
-				for (int d = 0; d < actual_dim; ++d)
+				const ElementBases &bs = basis[i];
+				local_res.setZero(local_pts->rows(), actual_dim);
+				bs.evaluate_bases(*local_pts, tmp);
+				for (size_t j = 0; j < bs.bases.size(); ++j)
 				{
-					for (size_t ii = 0; ii < b.global().size(); ++ii)
-						local_res.col(d) += b.global()[ii].val * tmp[j].val * fun(b.global()[ii].index * actual_dim + d);
+					const Basis &b = bs.bases[j];
+
+					for (int d = 0; d < actual_dim; ++d)
+					{
+						for (size_t ii = 0; ii < b.global().size(); ++ii)
+							local_res.col(d) += b.global()[ii].val * tmp[j].val * fun(b.global()[ii].index * actual_dim + d);
+					}
 				}
-			}
 
-			result.block(index, 0, local_res.rows(), actual_dim) = local_res;
-			index += local_res.rows();
-		}
+				assert(local_res.rows() == offsets[i + 1] - offsets[i]);
+				result.block(offsets[i], 0, local_res.rows(), actual_dim) = local_res;
+			}
+		});
 	}
 
 	void Evaluator::interpolate_at_local_vals(
@@ -1177,7 +1350,8 @@ namespace polyfem::io
 		const double t,
 		std::vector<assembler::Assembler::NamedMatrix> &result,
 		const bool use_sampler,
-		const bool boundary_only)
+		const bool boundary_only,
+		const SampledValuesCache *cache)
 	{
 		if (fun.size() <= 0)
 		{
@@ -1185,79 +1359,12 @@ namespace polyfem::io
 			return;
 		}
 
-		result.clear();
-
 		assert(!is_problem_scalar);
 
-		int index = 0;
-
-		Eigen::MatrixXi vis_faces_poly, vis_edges_poly;
-		std::vector<std::pair<std::string, Eigen::MatrixXd>> tmp_s;
-
-		for (int i = 0; i < int(bases.size()); ++i)
-		{
-			if (boundary_only && mesh.is_volume() && !mesh.is_boundary_element(i))
-				continue;
-
-			const ElementBases &bs = bases[i];
-			const ElementBases &gbs = gbases[i];
-			Eigen::MatrixXd local_pts;
-
-			if (use_sampler)
-			{
-				if (mesh.is_simplex(i))
-					local_pts = sampler.simplex_points();
-				else if (mesh.is_cube(i))
-					local_pts = sampler.cube_points();
-				else
-				{
-					if (mesh.is_volume())
-						sampler.sample_polyhedron(polys_3d.at(i).first, polys_3d.at(i).second, local_pts, vis_faces_poly, vis_edges_poly);
-					else
-						sampler.sample_polygon(polys.at(i), local_pts, vis_faces_poly, vis_edges_poly);
-				}
-			}
-			else
-			{
-				if (mesh.is_volume())
-				{
-					if (mesh.is_simplex(i))
-						autogen::p_nodes_3d(disc_orders(i), local_pts);
-					else if (mesh.is_cube(i))
-						autogen::q_nodes_3d(disc_orders(i), local_pts);
-					else
-						continue;
-				}
-				else
-				{
-					if (mesh.is_simplex(i))
-						autogen::p_nodes_2d(disc_orders(i), local_pts);
-					else if (mesh.is_cube(i))
-						autogen::q_nodes_2d(disc_orders(i), local_pts);
-					else
-						continue;
-				}
-			}
-
-			assembler.compute_scalar_value(OutputData(t, i, bs, gbs, local_pts, fun), tmp_s);
-
-			if (result.empty())
-			{
-				result.resize(tmp_s.size());
-				for (int k = 0; k < tmp_s.size(); ++k)
-				{
-					result[k].first = tmp_s[k].first;
-					result[k].second.resize(n_points, 1);
-				}
-			}
-
-			for (int k = 0; k < tmp_s.size(); ++k)
-			{
-				assert(local_pts.rows() == tmp_s[k].second.rows());
-				result[k].second.block(index, 0, tmp_s[k].second.rows(), 1) = tmp_s[k].second;
-			}
-			index += local_pts.rows();
-		}
+		evaluate_sampled_values(
+			mesh, bases, gbases, disc_orders, polys, polys_3d, sampler, n_points, fun, t, use_sampler, boundary_only, cache,
+			[&](const OutputData &data, std::vector<Assembler::NamedMatrix> &tmp) { assembler.compute_scalar_value(data, tmp); },
+			result);
 	}
 
 	void Evaluator::compute_tensor_value(
@@ -1275,7 +1382,8 @@ namespace polyfem::io
 		const double t,
 		std::vector<assembler::Assembler::NamedMatrix> &result,
 		const bool use_sampler,
-		const bool boundary_only)
+		const bool boundary_only,
+		const SampledValuesCache *cache)
 	{
 		if (fun.size() <= 0)
 		{
@@ -1283,80 +1391,12 @@ namespace polyfem::io
 			return;
 		}
 
-		result.clear();
-
-		const int actual_dim = mesh.dimension();
 		assert(!is_problem_scalar);
 
-		int index = 0;
-
-		Eigen::MatrixXi vis_faces_poly, vis_edges_poly;
-		std::vector<std::pair<std::string, Eigen::MatrixXd>> tmp_t;
-
-		for (int i = 0; i < int(bases.size()); ++i)
-		{
-			if (boundary_only && mesh.is_volume() && !mesh.is_boundary_element(i))
-				continue;
-
-			const ElementBases &bs = bases[i];
-			const ElementBases &gbs = gbases[i];
-			Eigen::MatrixXd local_pts;
-
-			if (use_sampler)
-			{
-				if (mesh.is_simplex(i))
-					local_pts = sampler.simplex_points();
-				else if (mesh.is_cube(i))
-					local_pts = sampler.cube_points();
-				else
-				{
-					if (mesh.is_volume())
-						sampler.sample_polyhedron(polys_3d.at(i).first, polys_3d.at(i).second, local_pts, vis_faces_poly, vis_edges_poly);
-					else
-						sampler.sample_polygon(polys.at(i), local_pts, vis_faces_poly, vis_edges_poly);
-				}
-			}
-			else
-			{
-				if (mesh.is_volume())
-				{
-					if (mesh.is_simplex(i))
-						autogen::p_nodes_3d(disc_orders(i), local_pts);
-					else if (mesh.is_cube(i))
-						autogen::q_nodes_3d(disc_orders(i), local_pts);
-					else
-						continue;
-				}
-				else
-				{
-					if (mesh.is_simplex(i))
-						autogen::p_nodes_2d(disc_orders(i), local_pts);
-					else if (mesh.is_cube(i))
-						autogen::q_nodes_2d(disc_orders(i), local_pts);
-					else
-						continue;
-				}
-			}
-
-			assembler.compute_tensor_value(OutputData(t, i, bs, gbs, local_pts, fun), tmp_t);
-
-			if (result.empty())
-			{
-				result.resize(tmp_t.size());
-				for (int k = 0; k < tmp_t.size(); ++k)
-				{
-					result[k].first = tmp_t[k].first;
-					result[k].second.resize(n_points, actual_dim * actual_dim);
-				}
-			}
-
-			for (int k = 0; k < tmp_t.size(); ++k)
-			{
-				assert(local_pts.rows() == tmp_t[k].second.rows());
-				result[k].second.block(index, 0, tmp_t[k].second.rows(), tmp_t[k].second.cols()) = tmp_t[k].second;
-			}
-			index += local_pts.rows();
-		}
+		evaluate_sampled_values(
+			mesh, bases, gbases, disc_orders, polys, polys_3d, sampler, n_points, fun, t, use_sampler, boundary_only, cache,
+			[&](const OutputData &data, std::vector<Assembler::NamedMatrix> &tmp) { assembler.compute_tensor_value(data, tmp); },
+			result);
 	}
 
 	Eigen::MatrixXd Evaluator::get_bases_position(
@@ -4,6 +4,7 @@
 
 #include <polyfem/basis/ElementBases.hpp>
 #include <polyfem/assembler/Assembler.hpp>
+#include <polyfem/assembler/ElementAssemblyValues.hpp>
 #include <polyfem/mesh/Mesh.hpp>
 #include <polyfem/mesh/MeshNodes.hpp>
 
@@ -11,6 +12,66 @@
 
 namespace polyfem::io
 {
+	/// Caches the basis values and geometric mapping at the output sample points of every element.
+	/// The values depend only on the geometry and are reused for all the time steps,
+	/// the cache must be cleared when the mesh or the bases change (e.g., remeshing).
+	class SampledValuesCache
+	{
+	public:
+		/// computes the values at the points used by the Evaluator for the given sampling options
+		/// @param[in] mesh mesh
+		/// @param[in] bases bases
+		/// @param[in] gbases geom bases
+		/// @param[in] disc_orders discretization orders
+		/// @param[in] polys polygons
+		/// @param[in] polys_3d polyhedra
+		/// @param[in] sampler sampler for the local element
+		/// @param[in] use_sampler uses the sampler or the nodes of the elements
+		/// @param[in] boundary_only samples only the boundary elements
+		void init(
+			const mesh::Mesh &mesh,
+			const std::vector<basis::ElementBases> &bases,
+			const std::vector<basis::ElementBases> &gbases,
+			const Eigen::VectorXi &disc_orders,
+			const std::map<int, Eigen::MatrixXd> &polys,
+			const std::map<int, std::pair<Eigen::MatrixXd, Eigen::MatrixXi>> &polys_3d,
+			const utils::RefElementSampler &sampler,
+			const bool use_sampler,
+			const bool boundary_only);
+
+		void clear();
+
+		/// @return if the cache was initialized with these sampling options
+		inline bool matches(const bool use_sampler, const bool boundary_only) const
+		{
+			return initialized_ && use_sampler_ == use_sampler && boundary_only_ == boundary_only;
+		}
+
+		/// @return values of element e at its sample points, nullptr if the element is not sampled
+		inline const assembler::ElementAssemblyValues *values(const int e) const
+		{
+			return offsets_[e + 1] > offsets_[e] ? &values_[e] : nullptr;
+		}
+
+		/// @return first sample row of element e
+		inline int offset(const int e) const { return offsets_[e]; }
+
+		/// @return size (volume or area) of element e
+		inline double element_size(const int e) const { return element_sizes_[e]; }
+
+		/// heap memory used by the cached values (in bytes)
+		size_t memory() const;
+
+	private:
+		bool initialized_ = false;
+		bool use_sampler_;
+		bool boundary_only_;
+
+		std::vector<assembler::ElementAssemblyValues> values_; ///< values at the sample points, one per element
+		std::vector<int> offsets_;                             ///< first sample row of every element, n_elements + 1 entries
+		std::vector<double> element_sizes_;                    ///< integral of the jacobian determinant of every element
+	};
+
 	class Evaluator
 	{
 	private:
@@ -204,6 +265,7 @@ namespace polyfem::io
 		/// @param[out] result scalar value
 		/// @param[in] use_sampler uses the sampler or not
 		/// @param[in] boundary_only interpolates only at boundary elements
+		/// @param[in] cache optional cached values at the sample points, used if it matches the sampling options
 		static void compute_scalar_value(
 			const mesh::Mesh &mesh,
 			const bool is_problem_scalar,
@@ -219,7 +281,8 @@ namespace polyfem::io
 			const double t,
 			std::vector<assembler::Assembler::NamedMatrix> &result,
 			const bool use_sampler,
-			const bool boundary_only);
+			const bool boundary_only,
+			const SampledValuesCache *cache = nullptr);
 
 		/// computes scalar quantity of funtion (ie von mises for elasticity and norm of velocity for fluid)
 		/// the scalar value is averaged around every node to make it continuos
@@ -239,6 +302,7 @@ namespace polyfem::io
 		/// @param[out] result_tensor tensor value
 		/// @param[in] use_sampler uses the sampler or not
 		/// @param[in] boundary_only interpolates only at boundary elements
+		/// @param[in] cache optional cached values at the element nodes (no sampler, all elements)
 		static void average_grad_based_function(
 			const mesh::Mesh &mesh,
 			const bool is_problem_scalar,
@@ -256,7 +320,8 @@ namespace polyfem::io
 			std::vector<assembler::Assembler::NamedMatrix> &result_scalar,
 			std::vector<assembler::Assembler::NamedMatrix> &result_tensor,
 			const bool use_sampler,
-			const bool boundary_only);
+			const bool boundary_only,
+			const SampledValuesCache *cache = nullptr);
 
 		/// compute tensor quantity (ie stress tensor or velocy)
 		/// @param[in] mesh mesh
@@ -273,6 +338,7 @@ namespace polyfem::io
 		/// @param[out] result resulting tensor
 		/// @param[in] use_sampler uses the sampler or not
 		/// @param[in] boundary_only interpolates only at boundary elements
+		/// @param[in] cache optional cached values at the sample points, used if it matches the sampling options
 		static void compute_tensor_value(
 			const mesh::Mesh &mesh,
 			const bool is_problem_scalar,
@@ -288,7 +354,8 @@ namespace polyfem::io
 			const double t,
 			std::vector<assembler::Assembler::NamedMatrix> &result,
 			const bool use_sampler,
-			const bool boundary_only);
+			const bool boundary_only,
+			const SampledValuesCache *cache = nullptr);
 
 		/// computes integrated solution (fun) per surface face. pts and faces are the boundary are the boundary on the rest configuration
 		/// @param[in] mesh mesh
@@ -1108,6 +1108,8 @@ namespace polyfem::io
 
 		use_hdf5 = args["output"]["paraview"]["options"]["use_hdf5"];
 
+		cache_values = args["output"]["advanced"]["cache_vis_values"];
+
 		this->solve_export_to_file = solve_export_to_file;
 	}
 
@@ -1217,19 +1219,13 @@ namespace polyfem::io
 		const mesh::Obstacle &obstacle = state.obstacle;
 		const assembler::Problem &problem = *state.problem;
 
-		Eigen::MatrixXd points;
-		Eigen::MatrixXi tets;
-		Eigen::MatrixXi el_id;
-		Eigen::MatrixXd discr;
-		std::vector<std::vector<int>> elements;
-
-		if (opts.use_sampler)
-			build_vis_mesh(mesh, disc_orders, gbases,
-						   state.polys, state.polys_3d, opts.boundary_only,
-						   points, tets, el_id, discr);
-		else
-			build_high_order_vis_mesh(mesh, disc_orders, bases,
-									  points, elements, el_id, discr);
+		const VisMesh &vis_mesh = volume_vis_mesh(state, opts);
+		// copies, the obstacle is appended to the mesh
+		Eigen::MatrixXd points = vis_mesh.points;
+		Eigen::MatrixXi tets = vis_mesh.tets;
+		const Eigen::MatrixXi &el_id = vis_mesh.el_id;
+		Eigen::MatrixXd discr = vis_mesh.discr;
+		std::vector<std::vector<int>> elements = vis_mesh.elements;
 
 		Eigen::MatrixXd fun, exact_fun, err, node_fun;
 
@@ -1437,11 +1433,12 @@ namespace polyfem::io
 		if (fun.cols() != 1)
 		{
 			std::vector<assembler::Assembler::NamedMatrix> vals, tvals;
+			const SampledValuesCache *cache = sampled_values(state, opts, opts.use_sampler, opts.boundary_only);
 			Evaluator::compute_scalar_value(
 				mesh, problem.is_scalar(), bases, gbases,
 				state.disc_orders, state.polys, state.polys_3d,
 				*state.assembler,
-				ref_element_sampler, points.rows(), sol, t, vals, opts.use_sampler, opts.boundary_only);
+				ref_element_sampler, points.rows(), sol, t, vals, opts.use_sampler, opts.boundary_only, cache);
 
 			for (auto &[_, v] : vals)
 				utils::append_rows_of_zeros(v, obstacle.n_vertices());
@@ -1462,7 +1459,7 @@ namespace polyfem::io
 				Evaluator::compute_tensor_value(
 					mesh, problem.is_scalar(), bases, gbases, state.disc_orders,
 					state.polys, state.polys_3d, *state.assembler, ref_element_sampler,
-					points.rows(), sol, t, tvals, opts.use_sampler, opts.boundary_only);
+					points.rows(), sol, t, tvals, opts.use_sampler, opts.boundary_only, cache);
 
 				for (auto &[_, v] : tvals)
 					utils::append_rows_of_zeros(v, obstacle.n_vertices());
@@ -1489,7 +1486,8 @@ namespace polyfem::io
 					mesh, problem.is_scalar(), state.n_bases, bases, gbases,
 					state.disc_orders, state.polys, state.polys_3d, *state.assembler,
 					ref_element_sampler, t, points.rows(), sol, vals, tvals,
-					opts.use_sampler, opts.boundary_only);
+					opts.use_sampler, opts.boundary_only,
+					sampled_values(state, opts, /*use_sampler=*/false, /*boundary_only=*/false));
 
 				if (obstacle.n_vertices() > 0)
 				{
@@ -1725,10 +1723,13 @@ namespace polyfem::io
 				}
 			}
 
-			if (elements.empty())
-				writer.write_mesh(path, points, tets);
-			else
-				writer.write_mesh(path, points, elements, true, disc_orders.maxCoeff() == 1);
+			const bool is_linear = disc_orders.maxCoeff() == 1;
+			write([tmpw, path, points = std::move(points), tets = std::move(tets), elements = std::move(elements), is_linear]() {
+				if (elements.empty())
+					tmpw->write_mesh(path, points, tets);
+				else
+					tmpw->write_mesh(path, points, elements, true, is_linear);
+			});
 		}
 		else
 		{
@@ -1738,6 +1739,52 @@ namespace polyfem::io
 		}
 	}
 
+	const OutGeometryData::VisMesh &OutGeometryData::volume_vis_mesh(const State &state, const ExportOptions &opts) const
+	{
+		if (vis_mesh_cache.valid
+			&& vis_mesh_cache.use_sampler == opts.use_sampler
+			&& vis_mesh_cache.boundary_only == opts.boundary_only)
+			return vis_mesh_cache;
+
+		POLYFEM_SCOPED_TIMER("Building the visualization mesh");
+
+		VisMesh &vis_mesh = vis_mesh_cache;
+		vis_mesh = VisMesh();
+		if (opts.use_sampler)
+			build_vis_mesh(*state.mesh, state.disc_orders, state.geom_bases(),
+						   state.polys, state.polys_3d, opts.boundary_only,
+						   vis_mesh.points, vis_mesh.tets, vis_mesh.el_id, vis_mesh.discr);
+		else
+			build_high_order_vis_mesh(*state.mesh, state.disc_orders, state.bases,
+									  vis_mesh.points, vis_mesh.elements, vis_mesh.el_id, vis_mesh.discr);
+
+		vis_mesh.use_sampler = opts.use_sampler;
+		vis_mesh.boundary_only = opts.boundary_only;
+		vis_mesh.valid = true;
+
+		return vis_mesh;
+	}
+
+	const SampledValuesCache *OutGeometryData::sampled_values(const State &state, const ExportOptions &opts, const bool use_sampler, const bool boundary_only) const
+	{
+		if (!opts.cache_values)
+			return nullptr;
+
+		if (vis_values_cache.matches(use_sampler, boundary_only))
+			return &vis_values_cache;
+		if (node_values_cache.matches(use_sampler, boundary_only))
+			return &node_values_cache;
+
+		// the element nodes are used to average the scalar values, the other options sample the visualization mesh
+		SampledValuesCache &cache = (!use_sampler && !boundary_only) ? node_values_cache : vis_values_cache;
+
+		POLYFEM_SCOPED_TIMER("Caching the values at the visualization points");
+		cache.init(*state.mesh, state.bases, state.geom_bases(), state.disc_orders,
+				   state.polys, state.polys_3d, ref_element_sampler, use_sampler, boundary_only);
+
+		return &cache;
+	}
+
 	void OutGeometryData::save_volume_vector_field(
 		const State &state,
 		const Eigen::MatrixXd &points,
@@ -1804,8 +1851,6 @@ namespace polyfem::io
 
 		Eigen::MatrixXd fun, interp_p, discr, vect, b_sidesets;
 
-		Eigen::MatrixXd lsol, lp, lgrad, lpgrad;
-
 		int actual_dim = 1;
 		if (!problem.is_scalar())
 			actual_dim = mesh.dimension();
@@ -1818,70 +1863,74 @@ namespace polyfem::io
 		b_sidesets.resize(boundary_vis_vertices.rows(), 1);
 		b_sidesets.setZero();
 
-		for (int i = 0; i < boundary_vis_vertices.rows(); ++i)
-		{
-			const auto s_id = mesh.get_boundary_id(boundary_vis_primitive_ids(i));
-			if (s_id > 0)
-			{
-				b_sidesets(i) = s_id;
-			}
-
-			const int el_index = boundary_vis_elements_ids(i);
-			Evaluator::interpolate_at_local_vals(
-				mesh, problem.is_scalar(), bases, gbases,
-				el_index, boundary_vis_local_vertices.row(i), sol, lsol, lgrad);
-			assert(lsol.size() == actual_dim);
-			if (state.mixed_assembler != nullptr)
-			{
-				Evaluator::interpolate_at_local_vals(
-					mesh, 1, pressure_bases, gbases,
-					el_index, boundary_vis_local_vertices.row(i), pressure, lp, lpgrad);
-				assert(lp.size() == 1);
-				interp_p(i) = lp(0);
-			}
+		utils::maybe_parallel_for(boundary_vis_vertices.rows(), [&](int start, int end, int thread_id) {
+			Eigen::MatrixXd lsol, lp, lgrad, lpgrad;
 
-			discr(i) = disc_orders(el_index);
-			for (int j = 0; j < actual_dim; ++j)
+			for (int i = start; i < end; ++i)
 			{
-				fun(i, j) = lsol(j);
-			}
+				const auto s_id = mesh.get_boundary_id(boundary_vis_primitive_ids(i));
+				if (s_id > 0)
+				{
+					b_sidesets(i) = s_id;
+				}
 
-			if (actual_dim == 1)
-			{
-				assert(lgrad.size() == mesh.dimension());
-				for (int j = 0; j < mesh.dimension(); ++j)
+				const int el_index = boundary_vis_elements_ids(i);
+				Evaluator::interpolate_at_local_vals(
+					mesh, problem.is_scalar(), bases, gbases,
+					el_index, boundary_vis_local_vertices.row(i), sol, lsol, lgrad);
+				assert(lsol.size() == actual_dim);
+				if (state.mixed_assembler != nullptr)
 				{
-					vect(i, j) = lgrad(j);
+					Evaluator::interpolate_at_local_vals(
+						mesh, 1, pressure_bases, gbases,
+						el_index, boundary_vis_local_vertices.row(i), pressure, lp, lpgrad);
+					assert(lp.size() == 1);
+					interp_p(i) = lp(0);
 				}
-			}
-			else
-			{
-				assert(lgrad.size() == actual_dim * actual_dim);
-				std::vector<assembler::Assembler::NamedMatrix> tensor_flat;
-				const basis::ElementBases &gbs = gbases[el_index];
-				const basis::ElementBases &bs = bases[el_index];
-				assembler.compute_tensor_value(assembler::OutputData(t, el_index, bs, gbs, boundary_vis_local_vertices.row(i), sol), tensor_flat);
-				// TF computed only from cauchy stress
-				assert(tensor_flat[0].first == "cauchy_stess");
-				assert(tensor_flat[0].second.size() == actual_dim * actual_dim);
 
-				Eigen::Map<Eigen::MatrixXd> tensor(tensor_flat[0].second.data(), actual_dim, actual_dim);
-				vect.row(i) = displaced_boundary_vis_normals.row(i) * tensor;
+				discr(i) = disc_orders(el_index);
+				for (int j = 0; j < actual_dim; ++j)
+				{
+					fun(i, j) = lsol(j);
+				}
 
-				double area = 0;
-				if (mesh.is_volume())
+				if (actual_dim == 1)
 				{
-					if (mesh.is_simplex(el_index))
-						area = mesh.tri_area(boundary_vis_primitive_ids(i));
-					else if (mesh.is_cube(el_index))
-						area = mesh.quad_area(boundary_vis_primitive_ids(i));
+					assert(lgrad.size() == mesh.dimension());
+					for (int j = 0; j < mesh.dimension(); ++j)
+					{
+						vect(i, j) = lgrad(j);
+					}
 				}
 				else
-					area = mesh.edge_length(boundary_vis_primitive_ids(i));
+				{
+					assert(lgrad.size() == actual_dim * actual_dim);
+					std::vector<assembler::Assembler::NamedMatrix> tensor_flat;
+					const basis::ElementBases &gbs = gbases[el_index];
+					const basis::ElementBases &bs = bases[el_index];
+					assembler.compute_tensor_value(assembler::OutputData(t, el_index, bs, gbs, boundary_vis_local_vertices.row(i), sol), tensor_flat);
+					// TF computed only from cauchy stress
+					assert(tensor_flat[0].first == "cauchy_stess");
+					assert(tensor_flat[0].second.size() == actual_dim * actual_dim);
+
+					Eigen::Map<Eigen::MatrixXd> tensor(tensor_flat[0].second.data(), actual_dim, actual_dim);
+					vect.row(i) = displaced_boundary_vis_normals.row(i) * tensor;
+
+					double area = 0;
+					if (mesh.is_volume())
+					{
+						if (mesh.is_simplex(el_index))
+							area = mesh.tri_area(boundary_vis_primitive_ids(i));
+						else if (mesh.is_cube(el_index))
+							area = mesh.quad_area(boundary_vis_primitive_ids(i));
+					}
+					else
+						area = mesh.edge_length(boundary_vis_primitive_ids(i));
 
-				vect.row(i) *= area;
+					vect.row(i) *= area;
+				}
 			}
-		}
+		});
 
 		std::shared_ptr<paraviewo::ParaviewWriter> tmpw;
 		if (opts.use_hdf5)
@@ -1957,7 +2006,9 @@ namespace polyfem::io
 			solution_frames.back().solution = fun;
 
 		if (opts.solve_export_to_file)
-			writer.write_mesh(export_surface, boundary_vis_vertices, boundary_vis_elements);
+			write([tmpw, export_surface, boundary_vis_vertices = std::move(boundary_vis_vertices), boundary_vis_elements = std::move(boundary_vis_elements)]() {
+				tmpw->write_mesh(export_surface, boundary_vis_vertices, boundary_vis_elements);
+			});
 		else
 		{
 			solution_frames.back().name = export_surface;
@@ -2053,10 +2104,12 @@ namespace polyfem::io
 			// Write the solution last so it is the default for warp-by-vector
 			writer.add_field("solution", surface_displacements);
 
-			writer.write_mesh(
-				export_surface.substr(0, export_surface.length() - 4) + "_contact.vtu",
-				collision_mesh.rest_positions(),
-				problem_dim == 3 ? collision_mesh.faces() : collision_mesh.edges());
+			write([tmpw,
+				   path = export_surface.substr(0, export_surface.length() - 4) + "_contact.vtu",
+				   rest_positions = Eigen::MatrixXd(collision_mesh.rest_positions()),
+				   cells = Eigen::MatrixXi(problem_dim == 3 ? collision_mesh.faces() : collision_mesh.edges())]() {
+				tmpw->write_mesh(path, rest_positions, cells);
+			});
 		}
 	}
 
@@ -2238,14 +2291,17 @@ namespace polyfem::io
 				mesh, problem.is_scalar(), state.bases, gbases,
 				state.disc_orders, state.polys, state.polys_3d,
 				*state.assembler,
-				ref_element_sampler, pts_index, sol, t, scalar_val, /*use_sampler*/ true, false);
+				ref_element_sampler, pts_index, sol, t, scalar_val, /*use_sampler*/ true, false,
+				opts.cache_values && vis_values_cache.matches(true, false) ? &vis_values_cache : nullptr);
 			for (const auto &v : scalar_val)
 				writer.add_field(v.first, v.second);
 		}
 		// Write the solution last so it is the default for warp-by-vector
 		writer.add_field("solution", fun);
 
-		writer.write_mesh(name, points, edges);
+		write([tmpw, name, points = std::move(points), edges = std::move(edges)]() {
+			tmpw->write_mesh(name, points, edges);
+		});
 	}
 
 	void OutGeometryData::save_points(
@@ -2300,7 +2356,9 @@ namespace polyfem::io
 			writer.add_field("sidesets", b_sidesets);
 			// Write the solution last so it is the default for warp-by-vector
 			writer.add_field("solution", fun);
-			writer.write_mesh(path, points, cells, false, false);
+			write([tmpw, path, points = std::move(points), cells = std::move(cells)]() {
+				tmpw->write_mesh(path, points, cells, false, false);
+			});
 		}
 	}
 
@@ -2315,6 +2373,39 @@ namespace polyfem::io
 	void OutGeometryData::init_sampler(const polyfem::mesh::Mesh &mesh, const double vismesh_rel_area)
 	{
 		ref_element_sampler.init(mesh.is_volume(), mesh.n_elements(), vismesh_rel_area);
+		clear_vis_mesh_cache();
+	}
+
+	void OutGeometryData::set_async_writes(int max_pending, const bool use_hdf5)
+	{
+		// HDF5 is not built thread safe and the main thread writes HDF5 files too (eg the time integrator state)
+		if (max_pending > 0 && use_hdf5)
+		{
+			logger().warn("Asynchronous paraview writes are disabled with use_hdf5");
+			max_pending = 0;
+		}
+
+		if (async_writer && async_writer->max_pending() == max_pending)
+			return;
+
+		// the destructor waits for the pending writes
+		async_writer.reset();
+		if (max_pending > 0)
+			async_writer = std::make_shared<AsyncFileWriter>(max_pending);
+	}
+
+	void OutGeometryData::flush_writes() const
+	{
+		if (async_writer)
+			async_writer->flush();
+	}
+
+	void OutGeometryData::write(std::function<void()> task) const
+	{
+		if (async_writer)
+			async_writer->push(std::move(task));
+		else
+			task();
 	}
 
 	void OutGeometryData::build_grid(const polyfem::mesh::Mesh &mesh, const double spacing)
@@ -2842,6 +2933,9 @@ namespace polyfem::io
 		j["time_building_basis"] = runtime.building_basis_time;
 		j["time_loading_mesh"] = runtime.loading_mesh_time;
 		j["time_computing_poly_basis"] = runtime.computing_poly_basis_time;
+		j["time_building_node_mapping"] = runtime.building_node_mapping_time;
+		j["time_setting_up_bc"] = runtime.setting_up_bc_time;
+		j["time_building_cache"] = runtime.building_cache_time;
 		j["time_assembling_stiffness_mat"] = runtime.assembling_stiffness_mat_time;
 		j["time_assembling_mass_mat"] = runtime.assembling_mass_mat_time;
 		j["time_assigning_rhs"] = runtime.assigning_rhs_time;
@@ -14,10 +14,15 @@
 #include <paraviewo/VTUWriter.hpp>
 #include <paraviewo/HDF5VTUWriter.hpp>
 
+#include <polyfem/io/AsyncFileWriter.hpp>
+#include <polyfem/io/Evaluator.hpp>
+
 #include <polyfem/utils/RefElementSampler.hpp>
 
 #include <Eigen/Dense>
 
+#include <memory>
+
 namespace polyfem
 {
 	class State;
@@ -74,6 +79,8 @@ namespace polyfem::io
 
 			bool use_hdf5;
 
+			bool cache_values;
+
 			/// @brief initialize the flags based on the input args
 			/// @param[in] args input arguments used to set most of the flags
 			/// @param[in] is_mesh_linear if the mesh is linear
@@ -118,6 +125,22 @@ namespace polyfem::io
 		/// @param[in] spacing grid spacing, <=0 mean no grid
 		void build_grid(const polyfem::mesh::Mesh &mesh, const double spacing);
 
+		/// @brief enables the asynchronous writes of the paraview files on a background thread
+		/// @param[in] max_pending maximum number of files queued for writing, 0 writes synchronously
+		/// @param[in] use_hdf5 the files are written with HDF5, which is not thread safe, the writes are then synchronous
+		void set_async_writes(int max_pending, const bool use_hdf5);
+
+		/// @brief waits until all the queued paraview files are written
+		void flush_writes() const;
+
+		/// @brief clears the cached visualization mesh and sampled values, must be called when the mesh or the bases change
+		void clear_vis_mesh_cache()
+		{
+			vis_mesh_cache = VisMesh();
+			vis_values_cache.clear();
+			node_values_cache.clear();
+		}
+
 		/// @brief exports everytihng, txt, vtu, etc
 		/// @param[in] state state to get the data
 		/// @param[in] sol solution
@@ -276,6 +299,47 @@ namespace polyfem::io
 		/// grid mesh boundaries
 		Eigen::MatrixXd grid_points_bc;
 
+		/// volume visualization mesh, it depends only on the geometry and is reused for every time step
+		struct VisMesh
+		{
+			bool valid = false;
+			bool use_sampler;
+			bool boundary_only;
+			Eigen::MatrixXd points;
+			Eigen::MatrixXi tets;
+			std::vector<std::vector<int>> elements;
+			Eigen::MatrixXi el_id;
+			Eigen::MatrixXd discr;
+		};
+		/// cached volume visualization mesh, built on the first save_volume
+		mutable VisMesh vis_mesh_cache;
+
+		/// basis values at the sample points of the visualization mesh
+		mutable SampledValuesCache vis_values_cache;
+		/// basis values at the element nodes, used to average the scalar values
+		mutable SampledValuesCache node_values_cache;
+
+		/// @brief returns the cached values for the sampling options, (re)builds the cache if needed
+		/// @param[in] state state to get the data
+		/// @param[in] opts export options
+		/// @param[in] use_sampler uses the sampler or the nodes of the elements
+		/// @param[in] boundary_only samples only the boundary elements
+		/// @return the cache, nullptr if the values are not cached
+		const SampledValuesCache *sampled_values(const State &state, const ExportOptions &opts, const bool use_sampler, const bool boundary_only) const;
+
+		/// writes the paraview files in the background, null if the writes are synchronous
+		std::shared_ptr<AsyncFileWriter> async_writer;
+
+		/// @brief returns the volume visualization mesh, builds it if the cache is empty or was built with other options
+		/// @param[in] state state to get the data
+		/// @param[in] opts export options
+		/// @return cached visualization mesh
+		const VisMesh &volume_vis_mesh(const State &state, const ExportOptions &opts) const;
+
+		/// @brief executes the write task, in the background if the asynchronous writes are enabled
+		/// @param[in] task write task, it must own all the data it writes
+		void write(std::function<void()> task) const;
+
 		/// @brief builds the boundary mesh for visualization
 		/// @param[in] mesh mesh
 		/// @param[in] bases bases
@@ -364,19 +428,25 @@ namespace polyfem::io
 	{
 	public:
 		/// time to construct the basis
-		double building_basis_time;
+		double building_basis_time = 0;
 		/// time to load the mesh
-		double loading_mesh_time;
+		double loading_mesh_time = 0;
 		/// time to build the polygonal/polyhedral bases
-		double computing_poly_basis_time;
+		double computing_poly_basis_time = 0;
+		/// time to build the node mapping
+		double building_node_mapping_time = 0;
+		/// time to setup the boundary conditions
+		double setting_up_bc_time = 0;
+		/// time to build the assembly values cache
+		double building_cache_time = 0;
 		/// time to assembly
-		double assembling_stiffness_mat_time;
+		double assembling_stiffness_mat_time = 0;
 		/// time to assembly mass
-		double assembling_mass_mat_time;
+		double assembling_mass_mat_time = 0;
 		/// time to computing the rhs
-		double assigning_rhs_time;
+		double assigning_rhs_time = 0;
 		/// time to solve
-		double solving_time;
+		double solving_time = 0;
 
 		/// @brief computes total time
 		/// @return total time
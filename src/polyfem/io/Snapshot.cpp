@@ -0,0 +1,242 @@
+#include "Snapshot.hpp"
+
+#include <polyfem/utils/Logger.hpp>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define POLYFEM_SNAPSHOT_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace polyfem::io
+{
+	using namespace snapshot;
+
+	namespace
+	{
+		struct FileHeader
+		{
+			char magic[8];
+			uint32_t version;
+			uint32_t endianness;
+			uint64_t n_arrays;
+			uint64_t file_size;
+			char reserved[32];
+		};
+		static_assert(sizeof(FileHeader) == 64, "Snapshot header must be 64 bytes");
+
+		struct ArrayHeader
+		{
+			char name[MAX_NAME_SIZE];
+			uint32_t type;
+			uint32_t reserved;
+			int64_t rows;
+			int64_t cols;
+			uint64_t offset;
+		};
+		static_assert(sizeof(ArrayHeader) == 128, "Snapshot array header must be 128 bytes");
+
+		inline size_t aligned(const size_t offset)
+		{
+			return (offset + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+		}
+
+		inline size_t type_size(const Type type)
+		{
+			return type == Type::DOUBLE ? sizeof(double) : sizeof(int32_t);
+		}
+	} // namespace
+
+	void SnapshotWriter::add(const std::string &name, const Eigen::MatrixXd &mat)
+	{
+		add(name, Type::DOUBLE, mat.rows(), mat.cols(), mat.data(), mat.size() * sizeof(double));
+	}
+
+	void SnapshotWriter::add(const std::string &name, const Eigen::MatrixXi &mat)
+	{
+		static_assert(sizeof(int) == sizeof(int32_t), "Snapshots store 32 bits integers");
+		add(name, Type::INT32, mat.rows(), mat.cols(), mat.data(), mat.size() * sizeof(int));
+	}
+
+	void SnapshotWriter::add(const std::string &name, const std::vector<int> &vec)
+	{
+		add(name, Type::INT32, vec.size(), 1, vec.data(), vec.size() * sizeof(int));
+	}
+
+	void SnapshotWriter::add(const std::string &name, const Type type, const int64_t rows, const int64_t cols, const void *data, const size_t bytes)
+	{
+		if (name.empty() || name.size() >= MAX_NAME_SIZE)
+			log_and_throw_error("Invalid snapshot array name \"{}\"", name);
+		for (const Array &a : arrays_)
+			if (a.name == name)
+				log_and_throw_error("Snapshot array {} added twice", name);
+
+		arrays_.push_back({name, type, rows, cols, std::vector<char>(bytes)});
+		if (bytes > 0)
+			std::memcpy(arrays_.back().data.data(), data, bytes);
+	}
+
+	void SnapshotWriter::write(const std::string &path) const
+	{
+		std::vector<ArrayHeader> table(arrays_.size());
+		size_t offset = aligned(sizeof(FileHeader) + table.size() * sizeof(ArrayHeader));
+		for (size_t i = 0; i < arrays_.size(); ++i)
+		{
+			ArrayHeader &h = table[i];
+			std::memset(&h, 0, sizeof(ArrayHeader));
+			std::strncpy(h.name, arrays_[i].name.c_str(), MAX_NAME_SIZE - 1);
+			h.type = uint32_t(arrays_[i].type);
+			h.rows = arrays_[i].rows;
+			h.cols = arrays_[i].cols;
+			h.offset = offset;
+			offset = aligned(offset + arrays_[i].data.size());
+		}
+
+		FileHeader header;
+		std::memset(&header, 0, sizeof(FileHeader));
+		std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+		header.version = VERSION;
+		header.endianness = ENDIANNESS;
+		header.n_arrays = table.size();
+		header.file_size = offset;
+
+		// written next to the file and renamed, so an interrupted write never leaves a truncated snapshot
+		const std::string tmp_path = path + ".tmp";
+		std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+		if (!out.is_open())
+			log_and_throw_error("Unable to open snapshot file {}", tmp_path);
+
+		const std::vector<char> padding(ALIGNMENT, 0);
+		out.write(reinterpret_cast<const char *>(&header), sizeof(FileHeader));
+		out.write(reinterpret_cast<const char *>(table.data()), table.size() * sizeof(ArrayHeader));
+		size_t position = sizeof(FileHeader) + table.size() * sizeof(ArrayHeader);
+		for (size_t i = 0; i < arrays_.size(); ++i)
+		{
+			out.write(padding.data(), table[i].offset - position);
+			out.write(arrays_[i].data.data(), arrays_[i].data.size());
+			position = table[i].offset + arrays_[i].data.size();
+		}
+		out.write(padding.data(), header.file_size - position);
+		out.close();
+
+		if (!out)
+			log_and_throw_error("Unable to write snapshot file {}", tmp_path);
+
+		std::error_code ec;
+		std::filesystem::rename(tmp_path, path, ec);
+		if (ec)
+			log_and_throw_error("Unable to move snapshot {} to {}: {}", tmp_path, path, ec.message());
+	}
+
+	SnapshotReader::SnapshotReader(const std::string &path)
+		: path_(path)
+	{
+#ifdef POLYFEM_SNAPSHOT_MMAP
+		const int fd = ::open(path.c_str(), O_RDONLY);
+		if (fd < 0)
+			log_and_throw_error("Unable to open snapshot file {}", path);
+
+		struct stat st;
+		if (::fstat(fd, &st) == 0 && st.st_size > 0)
+		{
+			void *ptr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (ptr != MAP_FAILED)
+			{
+				data_ = static_cast<const char *>(ptr);
+				size_ = st.st_size;
+				mapped_ = true;
+			}
+		}
+		::close(fd);
+#endif
+
+		if (!mapped_)
+		{
+			std::ifstream in(path, std::ios::binary | std::ios::ate);
+			if (!in.is_open())
+				log_and_throw_error("Unable to open snapshot file {}", path);
+			buffer_.resize(in.tellg());
+			in.seekg(0);
+			in.read(buffer_.data(), buffer_.size());
+			data_ = buffer_.data();
+			size_ = buffer_.size();
+		}
+
+		if (size_ < sizeof(FileHeader))
+			log_and_throw_error("{} is not a snapshot file", path);
+
+		FileHeader header;
+		std::memcpy(&header, data_, sizeof(FileHeader));
+		if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+			log_and_throw_error("{} is not a snapshot file", path);
+		if (header.endianness != ENDIANNESS)
+			log_and_throw_error("Snapshot {} was written on a machine with a different endianness", path);
+		if (header.version != VERSION)
+			log_and_throw_error("Snapshot {} has version {}, expected version {}", path, header.version, VERSION);
+		if (header.file_size != size_ || header.n_arrays > (size_ - sizeof(FileHeader)) / sizeof(ArrayHeader))
+			log_and_throw_error("Snapshot {} is truncated", path);
+
+		for (uint64_t i = 0; i < header.n_arrays; ++i)
+		{
+			ArrayHeader h;
+			std::memcpy(&h, data_ + sizeof(FileHeader) + i * sizeof(ArrayHeader), sizeof(ArrayHeader));
+			h.name[MAX_NAME_SIZE - 1] = '\0';
+
+			if ((h.type != uint32_t(Type::DOUBLE) && h.type != uint32_t(Type::INT32))
+				|| h.rows < 0 || h.cols < 0 || h.offset % ALIGNMENT != 0 || h.offset > size_)
+				log_and_throw_error("Snapshot {} has an invalid array {}", path, h.name);
+
+			// checked by division, rows * cols can overflow on a corrupt header
+			const uint64_t max_entries = (size_ - h.offset) / type_size(Type(h.type));
+			if (h.cols > 0 && uint64_t(h.rows) > max_entries / uint64_t(h.cols))
+				log_and_throw_error("Snapshot {} has an invalid array {}", path, h.name);
+
+			arrays_[h.name] = {Type(h.type), h.rows, h.cols, data_ + h.offset};
+		}
+
+		logger().debug("Opened snapshot {} ({} arrays, {:.2f} MB{})", path, arrays_.size(), size_ / 1024. / 1024., mapped_ ? ", memory mapped" : "");
+	}
+
+	SnapshotReader::~SnapshotReader()
+	{
+#ifdef POLYFEM_SNAPSHOT_MMAP
+		if (mapped_)
+			::munmap(const_cast<char *>(data_), size_);
+#endif
+	}
+
+	const SnapshotReader::Array &SnapshotReader::array(const std::string &name, const Type type) const
+	{
+		const auto it = arrays_.find(name);
+		if (it == arrays_.end())
+			log_and_throw_error("Snapshot {} has no array {}", path_, name);
+		if (it->second.type != type)
+			log_and_throw_error("Snapshot array {} in {} has the wrong type", name, path_);
+		return it->second;
+	}
+
+	Eigen::Map<const Eigen::MatrixXd> SnapshotReader::matrix(const std::string &name) const
+	{
+		const Array &a = array(name, Type::DOUBLE);
+		return Eigen::Map<const Eigen::MatrixXd>(reinterpret_cast<const double *>(a.data), a.rows, a.cols);
+	}
+
+	Eigen::Map<const Eigen::MatrixXi> SnapshotReader::imatrix(const std::string &name) const
+	{
+		const Array &a = array(name, Type::INT32);
+		return Eigen::Map<const Eigen::MatrixXi>(reinterpret_cast<const int *>(a.data), a.rows, a.cols);
+	}
+
+	std::vector<int> SnapshotReader::ivector(const std::string &name) const
+	{
+		const Array &a = array(name, Type::INT32);
+		const int *data = reinterpret_cast<const int *>(a.data);
+		return std::vector<int>(data, data + a.rows * a.cols);
+	}
+} // namespace polyfem::io
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <Eigen/Dense>
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace polyfem::io
+{
+	/// Binary snapshot of a simulation, a versioned header followed by a table of named arrays.
+	/// Every array is stored column major at a 64 bytes aligned offset, so the file can be
+	/// memory mapped and the arrays used in place (see SnapshotReader).
+	namespace snapshot
+	{
+		constexpr char MAGIC[8] = {'P', 'F', 'E', 'M', 'S', 'N', 'A', 'P'};
+		/// incremented every time the layout or the content of the snapshots changes
+		constexpr uint32_t VERSION = 1;
+		constexpr uint32_t ENDIANNESS = 0x01020304;
+		constexpr size_t ALIGNMENT = 64;
+		constexpr size_t MAX_NAME_SIZE = 96;
+
+		enum class Type : uint32_t
+		{
+			DOUBLE = 0,
+			INT32 = 1
+		};
+	} // namespace snapshot
+
+	/// Collects named arrays and writes them in the snapshot format
+	class SnapshotWriter
+	{
+	public:
+		/// adds (a copy of) the matrix, names must be unique
+		void add(const std::string &name, const Eigen::MatrixXd &mat);
+		void add(const std::string &name, const Eigen::MatrixXi &mat);
+		void add(const std::string &name, const std::vector<int> &vec);
+
+		/// writes the file (replaced atomically if it exists), throws if the file cannot be written
+		void write(const std::string &path) const;
+
+	private:
+		struct Array
+		{
+			std::string name;
+			snapshot::Type type;
+			int64_t rows;
+			int64_t cols;
+			std::vector<char> data;
+		};
+
+		void add(const std::string &name, const snapshot::Type type, const int64_t rows, const int64_t cols, const void *data, const size_t bytes);
+
+		std::vector<Array> arrays_;
+	};
+
+	/// Memory maps a snapshot and gives access to its arrays without copies
+	class SnapshotReader
+	{
+	public:
+		/// opens and validates the file, throws if it is not a snapshot or has a different version
+		SnapshotReader(const std::string &path);
+		~SnapshotReader();
+
+		SnapshotReader(const SnapshotReader &) = delete;
+		SnapshotReader &operator=(const SnapshotReader &) = delete;
+
+		const std::string &path() const { return path_; }
+
+		bool has(const std::string &name) const { return arrays_.find(name) != arrays_.end(); }
+
+		/// views of the arrays, valid as long as the reader, throw if the array is missing or has another type
+		Eigen::Map<const Eigen::MatrixXd> matrix(const std::string &name) const;
+		Eigen::Map<const Eigen::MatrixXi> imatrix(const std::string &name) const;
+
+		/// copy of an integer array as vector
+		std::vector<int> ivector(const std::string &name) const;
+
+	private:
+		struct Array
+		{
+			snapshot::Type type;
+			int64_t rows;
+			int64_t cols;
+			const char *data;
+		};
+
+		const Array &array(const std::string &name, const snapshot::Type type) const;
+
+		std::string path_;
+		const char *data_ = nullptr;
+		size_t size_ = 0;
+		bool mapped_ = false;
+		std::vector<char> buffer_; ///< file content when memory mapping is not available
+		std::unordered_map<std::string, Array> arrays_;
+	};
+} // namespace polyfem::io
@@ -1,3 +1,4 @@
+#include <cmath>
 #include <filesystem>
 
 #include <CLI/CLI.hpp>
@@ -10,6 +11,7 @@
 #include <polyfem/utils/JSONUtils.hpp>
 #include <polyfem/utils/Logger.hpp>
 #include <polyfem/io/YamlToJson.hpp>
+#include <polyfem/io/Snapshot.hpp>
 
 using namespace polyfem;
 using namespace solver;
@@ -56,7 +58,9 @@ bool load_yaml(const std::string &yaml_file, json &out)
 int forward_simulation(const CLI::App &command_line,
 					   const std::string &hdf5_file,
 					   const std::string output_dir,
+					   const std::string &snapshot_file,
 					   const unsigned max_threads,
+					   const std::string &thread_affinity,
 					   const bool is_strict,
 					   const bool fallback_solver,
 					   const spdlog::level::level_enum &log_level,
@@ -64,6 +68,7 @@ int forward_simulation(const CLI::App &command_line,
 
 int optimization_simulation(const CLI::App &command_line,
 							const unsigned max_threads,
+							const std::string &thread_affinity,
 							const bool is_strict,
 							const spdlog::level::level_enum &log_level,
 							json &opt_args);
@@ -81,6 +86,10 @@ int main(int argc, char **argv)
 	unsigned max_threads = std::numeric_limits<unsigned>::max();
 	command_line.add_option("--max_threads", max_threads, "Maximum number of threads");
 
+	std::string thread_affinity = "none";
+	command_line.add_option("--thread_affinity", thread_affinity, "Placement of the threads on the cores (none, compact, or spread over the NUMA nodes)")
+		->check(CLI::IsMember({"none", "compact", "spread"}));
+
 	auto input = command_line.add_option_group("input");
 
 	std::string json_file = "";
@@ -97,6 +106,9 @@ int main(int argc, char **argv)
 	std::string output_dir = "";
 	command_line.add_option("-o,--output_dir", output_dir, "Directory for output files")->check(CLI::ExistingDirectory | CLI::NonexistentPath);
 
+	std::string snapshot_file = "";
+	command_line.add_option("--snapshot", snapshot_file, "Restart a time dependent simulation from a binary snapshot (see /output/data/snapshot)")->check(CLI::ExistingFile);
+
 	bool is_strict = true;
 	command_line.add_flag("-s,--strict_validation,!--ns,!--no_strict_validation", is_strict, "Disables strict validation of input JSON");
 
@@ -128,20 +140,22 @@ int main(int argc, char **argv)
 			log_and_throw_error(fmt::format("unable to open {} file", json_file));
 
 		if (in_args.contains("states"))
-			return optimization_simulation(command_line, max_threads, is_strict, log_level, in_args);
+			return optimization_simulation(command_line, max_threads, thread_affinity, is_strict, log_level, in_args);
 		else
-			return forward_simulation(command_line, "", output_dir, max_threads,
+			return forward_simulation(command_line, "", output_dir, snapshot_file, max_threads, thread_affinity,
 									  is_strict, fallback_solver, log_level, in_args);
 	}
 	else
-		return forward_simulation(command_line, hdf5_file, output_dir, max_threads,
+		return forward_simulation(command_line, hdf5_file, output_dir, snapshot_file, max_threads, thread_affinity,
 								  is_strict, fallback_solver, log_level, in_args);
 }
 
 int forward_simulation(const CLI::App &command_line,
 					   const std::string &hdf5_file,
 					   const std::string output_dir,
+					   const std::string &snapshot_file,
 					   const unsigned max_threads,
+					   const std::string &thread_affinity,
 					   const bool is_strict,
 					   const bool fallback_solver,
 					   const spdlog::level::level_enum &log_level,
@@ -184,10 +198,30 @@ int forward_simulation(const CLI::App &command_line,
 		tmp["/output/log/level"_json_pointer] = int(log_level);
 	if (has_arg(command_line, "max_threads"))
 		tmp["/solver/max_threads"_json_pointer] = max_threads;
+	if (has_arg(command_line, "thread_affinity"))
+		tmp["/solver/thread_affinity"_json_pointer] = thread_affinity;
 	if (has_arg(command_line, "output_dir"))
 		tmp["/output/directory"_json_pointer] = std::filesystem::absolute(output_dir);
 	if (has_arg(command_line, "enable_overwrite_solver"))
 		tmp["/solver/linear/enable_overwrite_solver"_json_pointer] = fallback_solver;
+	if (!snapshot_file.empty())
+	{
+		// resume at the time of the snapshot and run the remaining time steps
+		const io::SnapshotReader snapshot(snapshot_file);
+		const auto time = snapshot.matrix("time");
+		const int remaining_steps = std::lround(time(2));
+		if (remaining_steps <= 0)
+		{
+			logger().info("Snapshot {} is at the end of the simulation", snapshot_file);
+			return EXIT_SUCCESS;
+		}
+
+		tmp["/input/data/snapshot"_json_pointer] = std::filesystem::absolute(snapshot_file).string();
+		tmp["/time/t0"_json_pointer] = time(0);
+		tmp["/time/dt"_json_pointer] = time(1);
+		tmp["/time/time_steps"_json_pointer] = remaining_steps;
+		tmp["/time/tend"_json_pointer] = nullptr; // removed by the merge
+	}
 	assert(tmp.is_object());
 	in_args.merge_patch(tmp);
 
@@ -226,6 +260,7 @@ int forward_simulation(const CLI::App &command_line,
 
 int optimization_simulation(const CLI::App &command_line,
 							const unsigned max_threads,
+							const std::string &thread_affinity,
 							const bool is_strict,
 							const spdlog::level::level_enum &log_level,
 							json &opt_args)
@@ -235,6 +270,8 @@ int optimization_simulation(const CLI::App &command_line,
 		tmp["/output/log/level"_json_pointer] = int(log_level);
 	if (has_arg(command_line, "max_threads"))
 		tmp["/solver/max_threads"_json_pointer] = max_threads;
+	if (has_arg(command_line, "thread_affinity"))
+		tmp["/solver/thread_affinity"_json_pointer] = thread_affinity;
 	opt_args.merge_patch(tmp);
 
 	OptState opt_state;
@@ -4,6 +4,11 @@
 #include <polyfem/mesh/mesh2D/NCMesh2D.hpp>
 #include <polyfem/mesh/mesh3D/CMesh3D.hpp>
 #include <polyfem/mesh/mesh3D/NCMesh3D.hpp>
+
+#include <polyfem/utils/MaybeParallelFor.hpp>
+
+#include <atomic>
+#include <numeric>
 ////////////////////////////////////////////////////////////////////////////////
 
 namespace polyfem::mesh
@@ -154,6 +159,18 @@ namespace polyfem::mesh
 
 	////////////////////////////////////////////////////////////////////////////////
 
+	RowVectorNd MeshNodes::primitive_position(const int primitive_id) const
+	{
+		if (primitive_id < edge_offset_)
+			return mesh_.point(primitive_id);
+		else if (primitive_id < face_offset_)
+			return mesh_.edge_barycenter(primitive_id - edge_offset_);
+		else if (primitive_id < cell_offset_)
+			return mesh_.face_barycenter(primitive_id - face_offset_);
+		else
+			return mesh_.cell_barycenter(primitive_id - cell_offset_);
+	}
+
 	int MeshNodes::node_id_from_primitive(int primitive_id)
 	{
 		if (primitive_to_node_[primitive_id] < 0 || !connect_nodes_)
@@ -162,376 +179,371 @@ namespace polyfem::mesh
 			node_to_primitive_.push_back(primitive_id);
 			node_to_primitive_gid_.push_back(primitive_id);
 
-			if (primitive_id < edge_offset_)
-				nodes_.row(primitive_id) = mesh_.point(primitive_id);
-			else if (primitive_id < face_offset_)
-				nodes_.row(primitive_id) = mesh_.edge_barycenter(primitive_id - edge_offset_);
-			else if (primitive_id < cell_offset_)
-				nodes_.row(primitive_id) = mesh_.face_barycenter(primitive_id - face_offset_);
-			else
-				nodes_.row(primitive_id) = mesh_.cell_barycenter(primitive_id - cell_offset_);
+			nodes_.row(primitive_id) = primitive_position(primitive_id);
 		}
 		return primitive_to_node_[primitive_id];
 	}
 
-	std::vector<int> MeshNodes::node_ids_from_edge(const Navigation::Index &index, const int n_new_nodes)
+	MeshNodes::NodeRequest MeshNodes::request_from_primitive(int primitive_id) const
 	{
-		std::vector<int> res;
+		NodeRequest request;
+		request.type = NodeRequest::Type::Primitive;
+		request.start = primitive_id;
+		request.size = 1;
+		request.n_new_nodes = 1;
+		request.gid = primitive_id;
+		request.always_new = !connect_nodes_;
+		return request;
+	}
+
+	MeshNodes::NodeRequest MeshNodes::request_from_edge(const Navigation::Index &index, const int n_new_nodes) const
+	{
+		NodeRequest request;
+		request.type = NodeRequest::Type::Edge2D;
+		request.n_new_nodes = n_new_nodes;
+		request.gid = index.edge;
+		request.always_new = !connect_nodes_;
+		request.index2d = index;
 		if (n_new_nodes <= 0)
-			return res;
+			return request;
 
-		const Mesh2D *mesh2d = dynamic_cast<const Mesh2D *>(&mesh_);
-		int start;
+		request.size = n_new_nodes;
 
+		const Mesh2D *mesh2d = dynamic_cast<const Mesh2D *>(&mesh_);
 		if (connect_nodes_)
-			start = edge_offset_ + index.edge * max_nodes_per_edge_;
+			request.start = edge_offset_ + index.edge * max_nodes_per_edge_;
 		else
 		{
 			if (mesh2d->is_boundary_edge(index.edge) || mesh2d->switch_face(index).face > index.face)
-				start = edge_offset_ + index.edge * max_nodes_per_edge_;
+				request.start = edge_offset_ + index.edge * max_nodes_per_edge_;
 			else
-				start = edge_offset_ + index.edge * max_nodes_per_edge_ + max_nodes_per_edge_ / 2;
+				request.start = edge_offset_ + index.edge * max_nodes_per_edge_ + max_nodes_per_edge_ / 2;
 		}
 
-		// const auto v1 = mesh2d->point(index.vertex);
-		// const auto v2 = mesh2d->point(mesh2d->switch_vertex(index).vertex);
-		assert(start < primitive_to_node_.size());
-		const int start_node_id = primitive_to_node_[start];
-#ifndef NDEBUG
-		if (!connect_nodes_)
-		{
-			assert(start_node_id < 0);
-		}
-#endif
-		if (start_node_id < 0 || !connect_nodes_)
-		{
-			for (int i = 1; i <= n_new_nodes; ++i)
-			{
-				// const double t = i/(n_new_nodes + 1.0);
+		assert(request.start + request.size <= primitive_to_node_.size());
+		return request;
+	}
 
-				const int primitive_id = start + i - 1;
-				assert(primitive_id < primitive_to_node_.size());
-				primitive_to_node_[primitive_id] = n_nodes();
+	MeshNodes::NodeRequest MeshNodes::request_from_face(const Navigation::Index &index, const int n_new_nodes) const
+	{
+		NodeRequest request;
+		request.type = NodeRequest::Type::Face2D;
+		request.n_new_nodes = n_new_nodes;
+		request.gid = index.face;
+		request.always_new = !connect_nodes_;
+		request.index2d = index;
+		if (n_new_nodes <= 0)
+			return request;
 
-				node_to_primitive_.push_back(primitive_id);
-				node_to_primitive_gid_.push_back(index.edge);
+		request.start = face_offset_ + index.face * max_nodes_per_face_;
+		request.size = mesh_.is_simplex(index.face) ? (n_new_nodes * (n_new_nodes + 1) / 2) : (n_new_nodes * n_new_nodes);
+		return request;
+	}
 
-				// nodes_.row(primitive_id) = (1 - t) * v1 + t * v2;
-				nodes_.row(primitive_id) = mesh2d->edge_node(index, n_new_nodes, i);
+	MeshNodes::NodeRequest MeshNodes::request_from_edge(const Navigation3D::Index &index, const int n_new_nodes) const
+	{
+		NodeRequest request;
+		request.type = NodeRequest::Type::Edge3D;
+		request.n_new_nodes = n_new_nodes;
+		request.gid = index.edge;
+		request.always_new = false;
+		request.index3d = index;
+		if (n_new_nodes <= 0)
+			return request;
 
-				res.push_back(primitive_to_node_[primitive_id]);
-			}
-		}
+		request.start = edge_offset_ + index.edge * max_nodes_per_edge_;
+		request.size = n_new_nodes;
+		return request;
+	}
+
+	MeshNodes::NodeRequest MeshNodes::request_from_face(const Navigation3D::Index &index, const int n_new_nodes) const
+	{
+		NodeRequest request;
+		request.type = NodeRequest::Type::Face3D;
+		request.n_new_nodes = n_new_nodes;
+		request.gid = index.face;
+		request.always_new = !connect_nodes_;
+		request.index3d = index;
+		if (n_new_nodes <= 0)
+			return request;
+
+		const Mesh3D *mesh3d = dynamic_cast<const Mesh3D *>(&mesh_);
+		if (connect_nodes_)
+			request.start = face_offset_ + index.face * max_nodes_per_face_;
 		else
 		{
-			// const double t = 1/(n_new_nodes + 1.0);
-			// const RowVectorNd v = (1 - t) * v1 + t * v2;
-			const RowVectorNd v = mesh2d->edge_node(index, n_new_nodes, 1);
-			if ((node_position(start_node_id) - v).norm() < 1e-10)
-			{
-				for (int i = 0; i < n_new_nodes; ++i)
-				{
-					const int primitive_id = start + i;
-					res.push_back(primitive_to_node_[primitive_id]);
-				}
-			}
+			if (mesh3d->is_boundary_face(index.face) || mesh3d->switch_element(index).element > index.element)
+				request.start = face_offset_ + index.face * max_nodes_per_face_;
 			else
-			{
-				for (int i = n_new_nodes - 1; i >= 0; --i)
-				{
-					const int primitive_id = start + i;
-					res.push_back(primitive_to_node_[primitive_id]);
-				}
-			}
+				request.start = face_offset_ + index.face * max_nodes_per_face_ + max_nodes_per_face_ / 2;
 		}
 
-		assert(res.size() == size_t(n_new_nodes));
-		return res;
+		request.size = mesh3d->is_simplex(index.element) ? (n_new_nodes * (n_new_nodes + 1) / 2) : (n_new_nodes * n_new_nodes);
+		return request;
 	}
 
-	std::vector<int> MeshNodes::node_ids_from_edge(const Navigation3D::Index &index, const int n_new_nodes)
+	MeshNodes::NodeRequest MeshNodes::request_from_cell(const Navigation3D::Index &index, const int n_new_nodes) const
 	{
-		std::vector<int> res;
+		NodeRequest request;
+		request.type = NodeRequest::Type::Cell;
+		request.n_new_nodes = n_new_nodes;
+		request.gid = index.element;
+		request.always_new = true;
+		request.index3d = index;
 		if (n_new_nodes <= 0)
-			return res;
-
-		const int start = edge_offset_ + index.edge * max_nodes_per_edge_;
-
-		const Mesh3D *mesh3d = dynamic_cast<const Mesh3D *>(&mesh_);
+			return request;
 
-		// const auto v1 = mesh3d->point(index.vertex);
-		// const auto v2 = mesh3d->point(mesh3d->switch_vertex(index).vertex);
-
-		const int start_node_id = primitive_to_node_[start];
-		if (start_node_id < 0)
+		request.start = cell_offset_ + index.element * max_nodes_per_cell_;
+		if (mesh_.is_simplex(index.element))
 		{
-			for (int i = 1; i <= n_new_nodes; ++i)
-			{
-				// const double t = i/(n_new_nodes + 1.0);
+			for (int pp = 0; pp <= n_new_nodes; ++pp)
+				request.size += (pp * (pp + 1) / 2);
+		}
+		else
+			request.size = n_new_nodes * n_new_nodes * n_new_nodes;
+		return request;
+	}
 
-				const int primitive_id = start + i - 1;
-				primitive_to_node_[primitive_id] = n_nodes();
-				node_to_primitive_.push_back(primitive_id);
-				node_to_primitive_gid_.push_back(index.edge);
+	std::vector<int> MeshNodes::node_ids(const NodeRequest &request)
+	{
+		if (request.size <= 0)
+			return std::vector<int>();
 
-				// nodes_.row(primitive_id) = (1 - t) * v1 + t * v2;
-				nodes_.row(primitive_id) = mesh3d->edge_node(index, n_new_nodes, i);
+		if (!request.always_new && primitive_to_node_[request.start] >= 0)
+			return existing_node_ids(request);
 
-				res.push_back(primitive_to_node_[primitive_id]);
-			}
-		}
-		else
-		{
-			// const double t = 1/(n_new_nodes + 1.0);
-			// const RowVectorNd v = (1 - t) * v1 + t * v2;
-			const RowVectorNd v = mesh3d->edge_node(index, n_new_nodes, 1);
-			if ((node_position(start_node_id) - v).norm() < 1e-10)
-			{
-				for (int i = 0; i < n_new_nodes; ++i)
-				{
-					const int primitive_id = start + i;
-					res.push_back(primitive_to_node_[primitive_id]);
-				}
-			}
-			else
-			{
-				for (int i = n_new_nodes - 1; i >= 0; --i)
-				{
-					const int primitive_id = start + i;
-					res.push_back(primitive_to_node_[primitive_id]);
-				}
-			}
-		}
+		const int first_id = n_nodes();
+		node_to_primitive_.resize(first_id + request.size);
+		node_to_primitive_gid_.resize(first_id + request.size);
+		set_nodes(request, first_id, true);
 
-		assert(res.size() == size_t(n_new_nodes));
+		std::vector<int> res(request.size);
+		std::iota(res.begin(), res.end(), first_id);
 		return res;
 	}
 
-	std::vector<int> MeshNodes::node_ids_from_face(const Navigation::Index &index, const int n_new_nodes)
+	void MeshNodes::set_nodes(const NodeRequest &request, const int first_id, const bool set_primitive)
 	{
-		std::vector<int> res;
-		if (n_new_nodes <= 0)
-			return res;
+		int loc_index = 0;
+		const auto add_node = [&](const auto &position) {
+			const int primitive_id = request.start + loc_index;
+			const int node_id = first_id + loc_index;
+			assert(primitive_id < primitive_to_node_.size());
+
+			node_to_primitive_[node_id] = primitive_id;
+			node_to_primitive_gid_[node_id] = request.gid;
+			if (set_primitive)
+			{
+				primitive_to_node_[primitive_id] = node_id;
+				nodes_.row(primitive_id) = position();
+			}
 
-		// assert(mesh_.is_simplex(index.face));
-		const int start = face_offset_ + index.face * max_nodes_per_face_;
-		const int start_node_id = primitive_to_node_[start];
+			++loc_index;
+		};
 
-		const Mesh2D *mesh2d = dynamic_cast<const Mesh2D *>(&mesh_);
+		const int n_new_nodes = request.n_new_nodes;
+		switch (request.type)
+		{
+		case NodeRequest::Type::Primitive:
+			add_node([&]() { return primitive_position(request.start); });
+			break;
 
-		// const auto v1 = mesh2d->point(index.vertex);
-		// const auto v2 = mesh2d->point(mesh2d->switch_vertex(index).vertex);
-		// const auto v3 = mesh2d->point(mesh2d->switch_vertex(mesh2d->switch_edge(index)).vertex);
+		case NodeRequest::Type::Edge2D:
+		{
+			const Mesh2D *mesh2d = dynamic_cast<const Mesh2D *>(&mesh_);
+			for (int i = 1; i <= n_new_nodes; ++i)
+				add_node([&]() { return mesh2d->edge_node(request.index2d, n_new_nodes, i); });
+			break;
+		}
 
-		if (start_node_id < 0 || !connect_nodes_)
+		case NodeRequest::Type::Face2D:
 		{
-			int loc_index = 0;
+			const Mesh2D *mesh2d = dynamic_cast<const Mesh2D *>(&mesh_);
 			for (int i = 1; i <= n_new_nodes; ++i)
 			{
-				// const double b2 = i/(n_new_nodes + 2.0);
-				const int end = mesh2d->is_simplex(index.face) ? (n_new_nodes - i + 1) : n_new_nodes;
+				const int end = mesh2d->is_simplex(request.index2d.face) ? (n_new_nodes - i + 1) : n_new_nodes;
 				for (int j = 1; j <= end; ++j)
-				{
-					// const double b3 = j/(n_new_nodes + 2.0);
-					// const double b1 = 1 - b3 - b2;
-					// assert(b3 < 1);
-					// assert(b3 > 0);
-
-					const int primitive_id = start + loc_index;
-					primitive_to_node_[primitive_id] = n_nodes();
-					node_to_primitive_.push_back(primitive_id);
-					node_to_primitive_gid_.push_back(index.face);
+					add_node([&]() { return mesh2d->face_node(request.index2d, n_new_nodes, i, j); });
+			}
+			break;
+		}
 
-					// nodes_.row(primitive_id) = b1 * v1 + b2 * v2 + b3 * v3;
-					nodes_.row(primitive_id) = mesh2d->face_node(index, n_new_nodes, i, j);
+		case NodeRequest::Type::Edge3D:
+		{
+			const Mesh3D *mesh3d = dynamic_cast<const Mesh3D *>(&mesh_);
+			for (int i = 1; i <= n_new_nodes; ++i)
+				add_node([&]() { return mesh3d->edge_node(request.index3d, n_new_nodes, i); });
+			break;
+		}
 
-					res.push_back(primitive_to_node_[primitive_id]);
+		case NodeRequest::Type::Face3D:
+		{
+			const Mesh3D *mesh3d = dynamic_cast<const Mesh3D *>(&mesh_);
+			for (int i = 1; i <= n_new_nodes; ++i)
+			{
+				const int end = mesh3d->is_simplex(request.index3d.element) ? (n_new_nodes - i + 1) : n_new_nodes;
+				for (int j = 1; j <= end; ++j)
+					add_node([&]() { return mesh3d->face_node(request.index3d, n_new_nodes, i, j); });
+			}
+			break;
+		}
 
-					++loc_index;
+		case NodeRequest::Type::Cell:
+		{
+			const Mesh3D *mesh3d = dynamic_cast<const Mesh3D *>(&mesh_);
+			const bool is_simplex = mesh3d->is_simplex(request.index3d.element);
+			for (int i = 1; i <= n_new_nodes; ++i)
+			{
+				const int endj = is_simplex ? (n_new_nodes - i + 1) : n_new_nodes;
+				for (int j = 1; j <= endj; ++j)
+				{
+					const int endk = is_simplex ? (n_new_nodes - i - j + 2) : n_new_nodes;
+					for (int k = 1; k <= endk; ++k)
+						add_node([&]() { return mesh3d->cell_node(request.index3d, n_new_nodes, i, j, k); });
 				}
 			}
+			break;
 		}
-		else
-		{
-			assert(false);
 		}
 
-#ifndef NDEBUG
-		if (mesh2d->is_simplex(index.face))
-			assert(res.size() == size_t(n_new_nodes * (n_new_nodes + 1) / 2));
-		else
-			assert(res.size() == size_t(n_new_nodes * n_new_nodes));
-#endif
-		return res;
+		assert(loc_index == request.size);
 	}
 
-	std::vector<int> MeshNodes::node_ids_from_face(const Navigation3D::Index &index, const int n_new_nodes)
+	std::vector<int> MeshNodes::existing_node_ids(const NodeRequest &request) const
 	{
 		std::vector<int> res;
-		if (n_new_nodes <= 0)
-			return res;
-
-		// assert(mesh_.is_simplex(index.element));
-		const Mesh3D *mesh3d = dynamic_cast<const Mesh3D *>(&mesh_);
-		int start;
-
-		if (connect_nodes_)
-			start = face_offset_ + index.face * max_nodes_per_face_;
-		else
-		{
-			if (mesh3d->is_boundary_face(index.face) || mesh3d->switch_element(index).element > index.element)
-				start = face_offset_ + index.face * max_nodes_per_face_;
-			else
-				start = face_offset_ + index.face * max_nodes_per_face_ + max_nodes_per_face_ / 2;
-		}
-
+		const int n_new_nodes = request.n_new_nodes;
+		const int start = request.start;
 		const int start_node_id = primitive_to_node_[start];
+		assert(start_node_id >= 0);
 
-#ifndef NDEBUG
-		if (!connect_nodes_)
+		switch (request.type)
 		{
-			assert(start_node_id < 0);
-		}
-#endif
+		case NodeRequest::Type::Primitive:
+			res.push_back(start_node_id);
+			break;
 
-		if (start_node_id < 0 || !connect_nodes_)
+		case NodeRequest::Type::Edge2D:
+		case NodeRequest::Type::Edge3D:
 		{
-			int loc_index = 0;
-			for (int i = 1; i <= n_new_nodes; ++i)
+			// the nodes are reversed if the edge was created from the other side
+			const RowVectorNd v = request.type == NodeRequest::Type::Edge2D
+									  ? dynamic_cast<const Mesh2D *>(&mesh_)->edge_node(request.index2d, n_new_nodes, 1)
+									  : dynamic_cast<const Mesh3D *>(&mesh_)->edge_node(request.index3d, n_new_nodes, 1);
+			if ((node_position(start_node_id) - v).norm() < 1e-10)
 			{
-				// const double b2 = i/(n_new_nodes + 2.0);
-				const int end = mesh3d->is_simplex(index.element) ? (n_new_nodes - i + 1) : n_new_nodes;
-				for (int j = 1; j <= end; ++j)
-				{
-					const int primitive_id = start + loc_index;
-					primitive_to_node_[primitive_id] = n_nodes();
-					node_to_primitive_.push_back(primitive_id);
-					node_to_primitive_gid_.push_back(index.face);
-
-					nodes_.row(primitive_id) = mesh3d->face_node(index, n_new_nodes, i, j);
-
-					res.push_back(primitive_to_node_[primitive_id]);
-
-					++loc_index;
-				}
+				for (int i = 0; i < n_new_nodes; ++i)
+					res.push_back(primitive_to_node_[start + i]);
 			}
+			else
+			{
+				for (int i = n_new_nodes - 1; i >= 0; --i)
+					res.push_back(primitive_to_node_[start + i]);
+			}
+			break;
 		}
-		else
+
+		case NodeRequest::Type::Face3D:
 		{
 			if (n_new_nodes == 1)
 			{
 				res.push_back(start_node_id);
+				break;
 			}
-			else
+
+			const Mesh3D *mesh3d = dynamic_cast<const Mesh3D *>(&mesh_);
+			const int total_nodes = request.size;
+			for (int i = 1; i <= n_new_nodes; ++i)
 			{
-				const int total_nodes = mesh3d->is_simplex(index.element) ? (n_new_nodes * (n_new_nodes + 1) / 2) : (n_new_nodes * n_new_nodes);
-				for (int i = 1; i <= n_new_nodes; ++i)
+				const int end = mesh3d->is_simplex(request.index3d.element) ? (n_new_nodes - i + 1) : n_new_nodes;
+				for (int j = 1; j <= end; ++j)
 				{
-					const int end = mesh3d->is_simplex(index.element) ? (n_new_nodes - i + 1) : n_new_nodes;
-					for (int j = 1; j <= end; ++j)
-					{
-						const RowVectorNd p = mesh3d->face_node(index, n_new_nodes, i, j);
+					const RowVectorNd p = mesh3d->face_node(request.index3d, n_new_nodes, i, j);
 
-						bool found = false;
-						for (int k = start; k < start + total_nodes; ++k)
+					bool found = false;
+					for (int k = start; k < start + total_nodes; ++k)
+					{
+						const double dist = (nodes_.row(k) - p).norm();
+						if (dist < 1e-10)
 						{
-							const double dist = (nodes_.row(k) - p).norm();
-							if (dist < 1e-10)
-							{
-								res.push_back(primitive_to_node_[k]);
-								found = true;
-								break;
-							}
+							res.push_back(primitive_to_node_[k]);
+							found = true;
+							break;
 						}
-
-						assert(found);
 					}
+
+					assert(found);
 				}
 			}
+			break;
 		}
 
-#ifndef NDEBUG
-		if (mesh3d->is_simplex(index.element))
-			assert(res.size() == size_t(n_new_nodes * (n_new_nodes + 1) / 2));
-		else
-			assert(res.size() == size_t(n_new_nodes * n_new_nodes));
-#endif
+		case NodeRequest::Type::Face2D:
+		case NodeRequest::Type::Cell:
+			// the face nodes in 2D and the cell nodes belong to one element
+			assert(false);
+			break;
+		}
+
+		assert(request.type == NodeRequest::Type::Face2D || request.type == NodeRequest::Type::Cell || res.size() == size_t(request.size));
 		return res;
 	}
 
-	std::vector<int> MeshNodes::node_ids_from_cell(const Navigation3D::Index &index, const int n_new_nodes)
+	std::vector<int> MeshNodes::node_ids_from_edge(const Navigation::Index &index, const int n_new_nodes)
 	{
-		std::vector<int> res;
-		const int start = cell_offset_ + index.element * max_nodes_per_cell_;
-		const Mesh3D *mesh3d = dynamic_cast<const Mesh3D *>(&mesh_);
-
-		if (mesh3d->is_simplex(index.element))
+		const NodeRequest request = request_from_edge(index, n_new_nodes);
+#ifndef NDEBUG
+		if (!connect_nodes_ && request.size > 0)
 		{
-			int loc_index = 0;
-			for (int i = 1; i <= n_new_nodes; ++i)
-			{
-				const int endj = (n_new_nodes - i + 1);
-				for (int j = 1; j <= endj; ++j)
-				{
-					const int endk = (n_new_nodes - i - j + 2);
-					for (int k = 1; k <= endk; ++k)
-					{
-						const int primitive_id = start + loc_index;
-
-						primitive_to_node_[primitive_id] = n_nodes();
-						node_to_primitive_.push_back(primitive_id);
-						node_to_primitive_gid_.push_back(index.element);
-
-						nodes_.row(primitive_id) = mesh3d->cell_node(index, n_new_nodes, i, j, k);
-						res.push_back(primitive_to_node_[primitive_id]);
-
-						++loc_index;
-					}
-				}
-			}
+			assert(primitive_to_node_[request.start] < 0);
 		}
-		else
-		{
-			int loc_index = 0;
-			for (int i = 1; i <= n_new_nodes; ++i)
-			{
-				for (int j = 1; j <= n_new_nodes; ++j)
-				{
-					for (int k = 1; k <= n_new_nodes; ++k)
-					{
-						const int primitive_id = start + loc_index;
-
-						primitive_to_node_[primitive_id] = n_nodes();
-						node_to_primitive_.push_back(primitive_id);
-						node_to_primitive_gid_.push_back(index.element);
+#endif
+		std::vector<int> res = node_ids(request);
+		assert(res.size() == size_t(std::max(n_new_nodes, 0)));
+		return res;
+	}
 
-						nodes_.row(primitive_id) = mesh3d->cell_node(index, n_new_nodes, i, j, k);
-						res.push_back(primitive_to_node_[primitive_id]);
+	std::vector<int> MeshNodes::node_ids_from_edge(const Navigation3D::Index &index, const int n_new_nodes)
+	{
+		std::vector<int> res = node_ids(request_from_edge(index, n_new_nodes));
+		assert(res.size() == size_t(std::max(n_new_nodes, 0)));
+		return res;
+	}
 
-						++loc_index;
-					}
-				}
-			}
-		}
+	std::vector<int> MeshNodes::node_ids_from_face(const Navigation::Index &index, const int n_new_nodes)
+	{
+		const NodeRequest request = request_from_face(index, n_new_nodes);
+		std::vector<int> res = node_ids(request);
+		assert(res.size() == size_t(request.size));
+		return res;
+	}
 
+	std::vector<int> MeshNodes::node_ids_from_face(const Navigation3D::Index &index, const int n_new_nodes)
+	{
+		const NodeRequest request = request_from_face(index, n_new_nodes);
 #ifndef NDEBUG
-		if (res.size() == 1 && connect_nodes_)
+		if (!connect_nodes_ && request.size > 0)
 		{
-			const int idx = node_id_from_cell(index.element);
-			assert(idx == res.front());
+			assert(primitive_to_node_[request.start] < 0);
 		}
 #endif
+		std::vector<int> res = node_ids(request);
+		assert(res.size() == size_t(request.size));
+		return res;
+	}
+
+	std::vector<int> MeshNodes::node_ids_from_cell(const Navigation3D::Index &index, const int n_new_nodes)
+	{
+		const NodeRequest request = request_from_cell(index, n_new_nodes);
+		std::vector<int> res = node_ids(request);
+		assert(res.size() == size_t(request.size));
 
 #ifndef NDEBUG
-		if (mesh3d->is_simplex(index.element))
+		if (res.size() == 1 && connect_nodes_)
 		{
-			int n_cell_nodes = 0;
-			for (int pp = 0; pp <= n_new_nodes; ++pp)
-				n_cell_nodes += (pp * (pp + 1) / 2);
-			assert(res.size() == size_t(n_cell_nodes));
+			const int idx = node_id_from_cell(index.element);
+			assert(idx == res.front());
 		}
-		else
-			assert(res.size() == size_t(n_new_nodes * n_new_nodes * n_new_nodes));
 #endif
 
 		return res;
@@ -612,4 +624,147 @@ namespace polyfem::mesh
 		return count;
 	}
 
-} // namespace polyfem::mesh
\ No newline at end of file
+	////////////////////////////////////////////////////////////////////////////////
+
+	std::vector<int> MeshNodes::Recorder::record(const NodeRequest &request)
+	{
+		std::vector<int> tickets(std::max(request.size, 0));
+		if (request.size <= 0)
+			return tickets;
+
+		std::iota(tickets.begin(), tickets.end(), n_requested_);
+		n_requested_ += request.size;
+		requests_.push_back(request);
+		return tickets;
+	}
+
+	void MeshNodes::number_elements(
+		const int n_elements,
+		const std::function<void(int, Recorder &, std::vector<int> &)> &local_to_global,
+		std::vector<std::vector<int>> &element_nodes_id)
+	{
+		element_nodes_id.resize(n_elements);
+
+		// Phase 1: record the blocks requested by every element, the local ids are tickets in the requested nodes
+		std::vector<std::vector<NodeRequest>> requests(n_elements);
+		utils::maybe_parallel_for(n_elements, [&](int start, int end, int thread_id) {
+			for (int e = start; e < end; ++e)
+			{
+				Recorder recorder(*this, requests[e]);
+				element_nodes_id[e].clear();
+				local_to_global(e, recorder, element_nodes_id[e]);
+			}
+		});
+
+		// in the serial visit, the first element requesting a block creates its nodes and the last
+		// element requesting a block with always new nodes is the one left in primitive_to_node_
+		const int n_primitives = primitive_to_node_.size();
+		std::vector<std::atomic<int>> first_element(n_primitives), last_element(n_primitives);
+		utils::maybe_parallel_for(n_primitives, [&](int start, int end, int thread_id) {
+			for (int i = start; i < end; ++i)
+			{
+				first_element[i].store(n_elements, std::memory_order_relaxed);
+				last_element[i].store(-1, std::memory_order_relaxed);
+			}
+		});
+
+		utils::maybe_parallel_for(n_elements, [&](int start, int end, int thread_id) {
+			for (int e = start; e < end; ++e)
+			{
+				for (const NodeRequest &request : requests[e])
+				{
+					std::atomic<int> &first = first_element[request.start];
+					int current = first.load(std::memory_order_relaxed);
+					while (current > e && !first.compare_exchange_weak(current, e, std::memory_order_relaxed))
+						;
+
+					if (request.always_new)
+					{
+						std::atomic<int> &last = last_element[request.start];
+						current = last.load(std::memory_order_relaxed);
+						while (current < e && !last.compare_exchange_weak(current, e, std::memory_order_relaxed))
+							;
+					}
+				}
+			}
+		});
+
+		// Phase 2: count the new nodes of every element, the prefix sum gives the first new id of every element
+		std::vector<int> offsets(n_elements + 1, 0);
+		utils::maybe_parallel_for(n_elements, [&](int start, int end, int thread_id) {
+			for (int e = start; e < end; ++e)
+			{
+				auto &element_requests = requests[e];
+				for (int r = 0; r < element_requests.size(); ++r)
+				{
+					NodeRequest &request = element_requests[r];
+					if (request.always_new)
+						request.creates = true;
+					else
+					{
+						request.creates = primitive_to_node_[request.start] < 0 && first_element[request.start].load(std::memory_order_relaxed) == e;
+						// an element requesting a block twice creates it the first time
+						for (int prev = 0; prev < r && request.creates; ++prev)
+							request.creates = element_requests[prev].start != request.start;
+					}
+
+					if (request.creates)
+						offsets[e + 1] += request.size;
+				}
+			}
+		});
+
+		offsets[0] = n_nodes();
+		std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+		node_to_primitive_.resize(offsets.back());
+		node_to_primitive_gid_.resize(offsets.back());
+
+		// Phase 3: fill the new nodes, every element owns its range of ids and the primitives of the blocks it creates
+		utils::maybe_parallel_for(n_elements, [&](int start, int end, int thread_id) {
+			for (int e = start; e < end; ++e)
+			{
+				int node_id = offsets[e];
+				for (NodeRequest &request : requests[e])
+				{
+					if (!request.creates)
+						continue;
+
+					const int last = last_element[request.start].load(std::memory_order_relaxed);
+					request.first_id = node_id;
+					set_nodes(request, node_id, last < 0 || (request.always_new && last == e));
+					node_id += request.size;
+				}
+				assert(node_id == offsets[e + 1]);
+			}
+		});
+
+		// Phase 4: replace the tickets by the node ids, the shared blocks are oriented with the positions of their nodes
+		utils::maybe_parallel_for(n_elements, [&](int start, int end, int thread_id) {
+			std::vector<int> ids;
+			for (int e = start; e < end; ++e)
+			{
+				ids.clear();
+				for (const NodeRequest &request : requests[e])
+				{
+					if (request.creates)
+					{
+						for (int i = 0; i < request.size; ++i)
+							ids.push_back(request.first_id + i);
+					}
+					else
+					{
+						const std::vector<int> existing = existing_node_ids(request);
+						ids.insert(ids.end(), existing.begin(), existing.end());
+					}
+				}
+
+				for (int &id : element_nodes_id[e])
+				{
+					if (id >= 0)
+						id = ids[id];
+				}
+			}
+		});
+	}
+
+} // namespace polyfem::mesh
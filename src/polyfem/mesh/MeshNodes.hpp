@@ -8,6 +8,9 @@
 
 #include <Eigen/Dense>
 
+#include <functional>
+#include <vector>
+
 namespace polyfem
 {
 	namespace mesh
@@ -17,6 +20,8 @@ namespace polyfem
 		class MeshNodes
 		{
 		public:
+			class Recorder;
+
 			MeshNodes(const Mesh &mesh, const bool has_poly, const bool connect_nodes, const int max_nodes_per_edge, const int max_nodes_per_face, const int max_nodes_per_cell = 0);
 
 			// Number of currently assigned nodes
@@ -79,7 +84,60 @@ namespace polyfem
 			// Retrieve a list of nodes which are marked as boundary
 			std::vector<int> boundary_nodes() const;
 
+			/// @brief assigns the node ids of all the elements in two phases, local_to_global(e, recorder, ids) fills the
+			/// local node ids of element e by requesting them from the recorder, as it would from this object
+			/// the elements are recorded in parallel, the new nodes are counted per element, offset with a prefix sum, and
+			/// filled in parallel, the numbering is the same as calling local_to_global serially in element order
+			/// @param[in] n_elements number of elements
+			/// @param[in] local_to_global fills the local node ids of an element, negative ids are kept as they are
+			/// @param[out] element_nodes_id global node ids of every element
+			void number_elements(
+				const int n_elements,
+				const std::function<void(int, Recorder &, std::vector<int> &)> &local_to_global,
+				std::vector<std::vector<int>> &element_nodes_id);
+
 		private:
+			/// block of contiguous primitives requested by one call of the node id functions
+			struct NodeRequest
+			{
+				enum class Type
+				{
+					Primitive,
+					Edge2D,
+					Face2D,
+					Edge3D,
+					Face3D,
+					Cell
+				};
+
+				Type type;
+				int start = 0;           ///< first primitive of the block
+				int size = 0;            ///< number of nodes in the block
+				int n_new_nodes = 0;     ///< requested number of new nodes (per edge for faces and cells)
+				int gid = -1;            ///< primitive gid of the nodes
+				bool always_new = false; ///< new nodes are created even if the block already has nodes
+				bool creates = false;    ///< the request creates the nodes of the block (set by number_elements)
+				int first_id = -1;       ///< first created node id (set by number_elements)
+				Navigation::Index index2d{};
+				Navigation3D::Index index3d{};
+			};
+
+			NodeRequest request_from_primitive(int primitive_id) const;
+			NodeRequest request_from_edge(const Navigation::Index &index, const int n_new_nodes) const;
+			NodeRequest request_from_face(const Navigation::Index &index, const int n_new_nodes) const;
+			NodeRequest request_from_edge(const Navigation3D::Index &index, const int n_new_nodes) const;
+			NodeRequest request_from_face(const Navigation3D::Index &index, const int n_new_nodes) const;
+			NodeRequest request_from_cell(const Navigation3D::Index &index, const int n_new_nodes) const;
+
+			/// ids of the request, created now if needed
+			std::vector<int> node_ids(const NodeRequest &request);
+			/// sets the maps and the positions of the block of nodes starting at first_id,
+			/// primitive_to_node_ and nodes_ are only written if set_primitive is true
+			void set_nodes(const NodeRequest &request, const int first_id, const bool set_primitive);
+			/// ids of a block that already has nodes, in the orientation of the request
+			std::vector<int> existing_node_ids(const NodeRequest &request) const;
+			RowVectorNd primitive_position(const int primitive_id) const;
+
 			int count_nonnegative_nodes(int start_i, int end_i) const;
 
 			const Mesh &mesh_;
@@ -103,5 +161,33 @@ namespace polyfem
 			std::vector<bool> is_boundary_;
 			std::vector<bool> is_interface_;
 		};
+
+		/// has the node id functions of MeshNodes used by the local to global maps, records the requested
+		/// blocks of nodes and returns tickets (indices in the requested nodes of the element) instead of node ids
+		class MeshNodes::Recorder
+		{
+		public:
+			Recorder(const MeshNodes &nodes, std::vector<NodeRequest> &requests) : nodes_(nodes), requests_(requests) {}
+
+			int node_id_from_vertex(int v) { return record(nodes_.request_from_primitive(nodes_.primitive_from_vertex(v))).front(); }
+			int node_id_from_edge(int e) { return record(nodes_.request_from_primitive(nodes_.edge_offset_ + e * nodes_.max_nodes_per_edge_)).front(); }
+			int node_id_from_face(int f) { return record(nodes_.request_from_primitive(nodes_.face_offset_ + f * nodes_.max_nodes_per_face_)).front(); }
+			int node_id_from_cell(int c) { return record(nodes_.request_from_primitive(nodes_.cell_offset_ + c * nodes_.max_nodes_per_cell_)).front(); }
+			int node_id_from_primitive(int primitive_id) { return record(nodes_.request_from_primitive(primitive_id)).front(); }
+
+			std::vector<int> node_ids_from_edge(const Navigation::Index &index, const int n_new_nodes) { return record(nodes_.request_from_edge(index, n_new_nodes)); }
+			std::vector<int> node_ids_from_face(const Navigation::Index &index, const int n_new_nodes) { return record(nodes_.request_from_face(index, n_new_nodes)); }
+
+			std::vector<int> node_ids_from_edge(const Navigation3D::Index &index, const int n_new_nodes) { return record(nodes_.request_from_edge(index, n_new_nodes)); }
+			std::vector<int> node_ids_from_face(const Navigation3D::Index &index, const int n_new_nodes) { return record(nodes_.request_from_face(index, n_new_nodes)); }
+			std::vector<int> node_ids_from_cell(const Navigation3D::Index &index, const int n_new_nodes) { return record(nodes_.request_from_cell(index, n_new_nodes)); }
+
+		private:
+			std::vector<int> record(const NodeRequest &request);
+
+			const MeshNodes &nodes_;
+			std::vector<NodeRequest> &requests_;
+			int n_requested_ = 0;
+		};
 	} // namespace mesh
 } // namespace polyfem
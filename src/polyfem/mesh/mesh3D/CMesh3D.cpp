@@ -4,6 +4,7 @@
 #include <polyfem/utils/StringUtils.hpp>
 
 #include <polyfem/utils/Logger.hpp>
+#include <polyfem/utils/MaybeParallelFor.hpp>
 
 #include <igl/barycentric_coordinates.h>
 
@@ -143,8 +144,8 @@ namespace polyfem
 
 				for (auto fid : h.fs)
 					h.vs.insert(h.vs.end(), mesh_.faces[fid].vs.begin(), mesh_.faces[fid].vs.end());
-				sort(h.vs.begin(), h.vs.end());
-				h.vs.erase(unique(h.vs.begin(), h.vs.end()), h.vs.end());
+				std::sort(h.vs.begin(), h.vs.end());
+				h.vs.erase(std::unique(h.vs.begin(), h.vs.end()), h.vs.end());
 
 				int tmp;
 				auto __ = fscanf(f, "%d", &tmp);
@@ -196,6 +197,7 @@ namespace polyfem
 			// if(is_simplicial())
 			// MeshProcessing3D::orient_volume_mesh(mesh_);
 			compute_elements_tag();
+			logger().debug("Mesh connectivity memory: {:.2f} MB", mesh_.memory() / 1024. / 1024.);
 			return true;
 		}
 
@@ -266,8 +268,8 @@ namespace polyfem
 					{
 						cell.vs.insert(cell.vs.end(), mesh_.faces[fid].vs.begin(), mesh_.faces[fid].vs.end());
 					}
-					sort(cell.vs.begin(), cell.vs.end());
-					cell.vs.erase(unique(cell.vs.begin(), cell.vs.end()), cell.vs.end());
+					std::sort(cell.vs.begin(), cell.vs.end());
+					cell.vs.erase(std::unique(cell.vs.begin(), cell.vs.end()), cell.vs.end());
 
 					for (int j = 0; j < nf; ++j)
 					{
@@ -388,8 +390,8 @@ namespace polyfem
 					{
 						cell.vs.insert(cell.vs.end(), mesh_.faces[fid].vs.begin(), mesh_.faces[fid].vs.end());
 					}
-					sort(cell.vs.begin(), cell.vs.end());
-					cell.vs.erase(unique(cell.vs.begin(), cell.vs.end()), cell.vs.end());
+					std::sort(cell.vs.begin(), cell.vs.end());
+					cell.vs.erase(std::unique(cell.vs.begin(), cell.vs.end()), cell.vs.end());
 
 					// Compute a point in the kernel (assumes the barycenter is ok)
 					Eigen::RowVector3d p(0, 0, 0);
@@ -410,6 +412,7 @@ namespace polyfem
 			// 	MeshProcessing3D::orient_volume_mesh(mesh_);
 			// }
 			compute_elements_tag();
+			logger().debug("Mesh connectivity memory: {:.2f} MB", mesh_.memory() / 1024. / 1024.);
 			return true;
 		}
 
@@ -1349,7 +1352,7 @@ namespace polyfem
 
 			// boundary flags
 			std::vector<bool> bv_flag(mesh_.vertices.size(), false), be_flag(mesh_.edges.size(), false), bf_flag(mesh_.faces.size(), false);
-			for (auto f : mesh_.faces)
+			for (const auto &f : mesh_.faces)
 				if (f.boundary)
 					bf_flag[f.id] = true;
 				else
@@ -1367,170 +1370,174 @@ namespace polyfem
 						bv_flag[mesh_.faces[i].vs[j]] = true;
 					}
 
-			for (auto &ele : mesh_.elements)
-			{
-				if (ele.hex)
+			// each element only writes its own tag
+			utils::maybe_parallel_for(n_cells(), [&](int start, int end, int thread_id) {
+				for (int e = start; e < end; ++e)
 				{
-					bool attaching_non_hex = false, on_boundary = false;
-					;
-					for (auto vid : ele.vs)
+					const Element &ele = mesh_.elements[e];
+					if (ele.hex)
 					{
-						for (auto eleid : mesh_.vertices[vid].neighbor_hs)
-							if (!mesh_.elements[eleid].hex)
+						bool attaching_non_hex = false, on_boundary = false;
+						;
+						for (auto vid : ele.vs)
+						{
+							for (auto eleid : mesh_.vertices[vid].neighbor_hs)
+								if (!mesh_.elements[eleid].hex)
+								{
+									attaching_non_hex = true;
+									break;
+								}
+							if (mesh_.vertices[vid].boundary)
 							{
-								attaching_non_hex = true;
+								on_boundary = true;
 								break;
 							}
-						if (mesh_.vertices[vid].boundary)
+							if (on_boundary || attaching_non_hex)
+								break;
+						}
+						if (attaching_non_hex)
 						{
-							on_boundary = true;
-							break;
+							ele_tag[ele.id] = ElementType::INTERFACE_CUBE;
+							continue;
 						}
-						if (on_boundary || attaching_non_hex)
-							break;
-					}
-					if (attaching_non_hex)
-					{
-						ele_tag[ele.id] = ElementType::INTERFACE_CUBE;
-						continue;
-					}
 
-					if (on_boundary)
-					{
-						ele_tag[ele.id] = ElementType::MULTI_SINGULAR_BOUNDARY_CUBE;
-						// has no boundary edge--> singular
-						bool boundary_edge = false, boundary_edge_singular = false, interior_edge_singular = false;
-						int n_interior_edge_singular = 0;
-						for (auto eid : ele.es)
+						if (on_boundary)
 						{
-							int en = 0;
-							if (be_flag[eid])
+							ele_tag[ele.id] = ElementType::MULTI_SINGULAR_BOUNDARY_CUBE;
+							// has no boundary edge--> singular
+							bool boundary_edge = false, boundary_edge_singular = false, interior_edge_singular = false;
+							int n_interior_edge_singular = 0;
+							for (auto eid : ele.es)
 							{
-								boundary_edge = true;
-								for (auto nhid : mesh_.edges[eid].neighbor_hs)
-									if (mesh_.elements[nhid].hex)
-										en++;
-								if (en > 2)
-									boundary_edge_singular = true;
-							}
-							else
-							{
-								for (auto nhid : mesh_.edges[eid].neighbor_hs)
-									if (mesh_.elements[nhid].hex)
-										en++;
-								if (en != 4)
+								int en = 0;
+								if (be_flag[eid])
 								{
-									interior_edge_singular = true;
-									n_interior_edge_singular++;
+									boundary_edge = true;
+									for (auto nhid : mesh_.edges[eid].neighbor_hs)
+										if (mesh_.elements[nhid].hex)
+											en++;
+									if (en > 2)
+										boundary_edge_singular = true;
+								}
+								else
+								{
+									for (auto nhid : mesh_.edges[eid].neighbor_hs)
+										if (mesh_.elements[nhid].hex)
+											en++;
+									if (en != 4)
+									{
+										interior_edge_singular = true;
+										n_interior_edge_singular++;
+									}
 								}
 							}
-						}
-						if (!boundary_edge || boundary_edge_singular || n_interior_edge_singular > 1)
-							continue;
+							if (!boundary_edge || boundary_edge_singular || n_interior_edge_singular > 1)
+								continue;
 
-						bool has_singular_v = false, has_iregular_v = false;
-						int n_in_irregular_v = 0;
-						for (auto vid : ele.vs)
-						{
-							int vn = 0;
-							if (bv_flag[vid])
-							{
-								int nh = 0;
-								for (auto nhid : mesh_.vertices[vid].neighbor_hs)
-									if (mesh_.elements[nhid].hex)
-										nh++;
-								if (nh > 4)
-									has_iregular_v = true;
-								continue; // not sure the conditions
-							}
-							else
+							bool has_singular_v = false, has_iregular_v = false;
+							int n_in_irregular_v = 0;
+							for (auto vid : ele.vs)
 							{
-								if (mesh_.vertices[vid].neighbor_hs.size() != 8)
-									n_in_irregular_v++;
-								int n_irregular_e = 0;
-								for (auto eid : mesh_.vertices[vid].neighbor_es)
+								int vn = 0;
+								if (bv_flag[vid])
 								{
-									if (mesh_.edges[eid].neighbor_hs.size() != 4)
-										n_irregular_e++;
+									int nh = 0;
+									for (auto nhid : mesh_.vertices[vid].neighbor_hs)
+										if (mesh_.elements[nhid].hex)
+											nh++;
+									if (nh > 4)
+										has_iregular_v = true;
+									continue; // not sure the conditions
 								}
-								if (n_irregular_e != 0 && n_irregular_e != 2)
+								else
 								{
-									has_singular_v = true;
-									break;
+									if (mesh_.vertices[vid].neighbor_hs.size() != 8)
+										n_in_irregular_v++;
+									int n_irregular_e = 0;
+									for (auto eid : mesh_.vertices[vid].neighbor_es)
+									{
+										if (mesh_.edges[eid].neighbor_hs.size() != 4)
+											n_irregular_e++;
+									}
+									if (n_irregular_e != 0 && n_irregular_e != 2)
+									{
+										has_singular_v = true;
+										break;
+									}
 								}
 							}
-						}
-						int n_irregular_e = 0;
-						for (auto eid : ele.es)
-							if (!be_flag[eid] && mesh_.edges[eid].neighbor_hs.size() != 4)
-								n_irregular_e++;
-						if (has_singular_v)
-							continue;
-						if (!has_singular_v)
-						{
-							if (n_irregular_e == 1)
+							int n_irregular_e = 0;
+							for (auto eid : ele.es)
+								if (!be_flag[eid] && mesh_.edges[eid].neighbor_hs.size() != 4)
+									n_irregular_e++;
+							if (has_singular_v)
+								continue;
+							if (!has_singular_v)
 							{
-								ele_tag[ele.id] = ElementType::SIMPLE_SINGULAR_BOUNDARY_CUBE;
+								if (n_irregular_e == 1)
+								{
+									ele_tag[ele.id] = ElementType::SIMPLE_SINGULAR_BOUNDARY_CUBE;
+								}
+								else if (n_irregular_e == 0 && n_in_irregular_v == 0 && !has_iregular_v)
+									ele_tag[ele.id] = ElementType::REGULAR_BOUNDARY_CUBE;
+								else
+									continue;
 							}
-							else if (n_irregular_e == 0 && n_in_irregular_v == 0 && !has_iregular_v)
-								ele_tag[ele.id] = ElementType::REGULAR_BOUNDARY_CUBE;
-							else
-								continue;
+							continue;
 						}
-						continue;
-					}
 
-					// type 1
-					bool has_irregular_v = false;
-					for (auto vid : ele.vs)
-						if (mesh_.vertices[vid].neighbor_hs.size() != 8)
+						// type 1
+						bool has_irregular_v = false;
+						for (auto vid : ele.vs)
+							if (mesh_.vertices[vid].neighbor_hs.size() != 8)
+							{
+								has_irregular_v = true;
+								break;
+							}
+						if (!has_irregular_v)
 						{
-							has_irregular_v = true;
-							break;
+							ele_tag[ele.id] = ElementType::REGULAR_INTERIOR_CUBE;
+							continue;
 						}
-					if (!has_irregular_v)
-					{
-						ele_tag[ele.id] = ElementType::REGULAR_INTERIOR_CUBE;
-						continue;
-					}
-					// type 2
-					bool has_singular_v = false;
-					int n_irregular_v = 0;
-					for (auto vid : ele.vs)
-					{
-						if (mesh_.vertices[vid].neighbor_hs.size() != 8)
-							n_irregular_v++;
-						int n_irregular_e = 0;
-						for (auto eid : mesh_.vertices[vid].neighbor_es)
+						// type 2
+						bool has_singular_v = false;
+						int n_irregular_v = 0;
+						for (auto vid : ele.vs)
 						{
-							if (mesh_.edges[eid].neighbor_hs.size() != 4)
-								n_irregular_e++;
+							if (mesh_.vertices[vid].neighbor_hs.size() != 8)
+								n_irregular_v++;
+							int n_irregular_e = 0;
+							for (auto eid : mesh_.vertices[vid].neighbor_es)
+							{
+								if (mesh_.edges[eid].neighbor_hs.size() != 4)
+									n_irregular_e++;
+							}
+							if (n_irregular_e != 0 && n_irregular_e != 2)
+							{
+								has_singular_v = true;
+								break;
+							}
 						}
-						if (n_irregular_e != 0 && n_irregular_e != 2)
+						if (!has_singular_v && n_irregular_v == 2)
 						{
-							has_singular_v = true;
-							break;
+							ele_tag[ele.id] = ElementType::SIMPLE_SINGULAR_INTERIOR_CUBE;
+							continue;
 						}
+
+						ele_tag[ele.id] = ElementType::MULTI_SINGULAR_INTERIOR_CUBE;
 					}
-					if (!has_singular_v && n_irregular_v == 2)
+					else
 					{
-						ele_tag[ele.id] = ElementType::SIMPLE_SINGULAR_INTERIOR_CUBE;
-						continue;
+						ele_tag[ele.id] = ElementType::INTERIOR_POLYTOPE;
+						for (auto fid : ele.fs)
+							if (mesh_.faces[fid].boundary)
+							{
+								ele_tag[ele.id] = ElementType::BOUNDARY_POLYTOPE;
+								break;
+							}
 					}
-
-					ele_tag[ele.id] = ElementType::MULTI_SINGULAR_INTERIOR_CUBE;
-				}
-				else
-				{
-					ele_tag[ele.id] = ElementType::INTERIOR_POLYTOPE;
-					for (auto fid : ele.fs)
-						if (mesh_.faces[fid].boundary)
-						{
-							ele_tag[ele.id] = ElementType::BOUNDARY_POLYTOPE;
-							break;
-						}
 				}
-			}
+			});
 
 			// TODO correct?
 			for (auto &ele : mesh_.elements)
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <polyfem/utils/SmallVector.hpp>
+
 #include <vector>
 #include <Eigen/Dense>
 #include <cassert>
@@ -8,47 +10,72 @@ namespace polyfem
 {
 	namespace mesh
 	{
+		/// connectivity lists are stored inline in the entities, the inline capacities
+		/// cover hex and tet meshes so only polyhedra and high valence vertices allocate
+		using ElementVertexList = utils::SmallVector<uint32_t, 8>;
+		using ElementEdgeList = utils::SmallVector<uint32_t, 12>;
+		using ElementFaceList = utils::SmallVector<uint32_t, 6>;
+		using FaceList = utils::SmallVector<uint32_t, 4>;
+		using Point3 = utils::SmallVector<double, 3>;
+
+		/// the link of a tet mesh vertex with k neighbors has 2k - 4 tets and 3k - 6 faces,
+		/// the capacities cover k <= 16 (the mean is about 14 to 15); a hex vertex has 6, 6, 12, and 8
+		using VertexVertexList = utils::SmallVector<uint32_t, 16>;
+		using VertexEdgeList = utils::SmallVector<uint32_t, 16>;
+		using VertexFaceList = utils::SmallVector<uint32_t, 42>;
+		using VertexElementList = utils::SmallVector<uint32_t, 28>;
+		/// faces and elements around an edge, about 5 for tet meshes and 4 for hex meshes
+		using EdgeNeighborList = utils::SmallVector<uint32_t, 8>;
+
 		struct Vertex
 		{
 			int id;
-			std::vector<double> v;
-			std::vector<uint32_t> neighbor_vs;
-			std::vector<uint32_t> neighbor_es;
-			std::vector<uint32_t> neighbor_fs;
-			std::vector<uint32_t> neighbor_hs;
+			Point3 v;
+			VertexVertexList neighbor_vs;
+			VertexEdgeList neighbor_es;
+			VertexFaceList neighbor_fs;
+			VertexElementList neighbor_hs;
 
 			bool boundary;
 			bool boundary_hex;
+
+			size_t heap_memory() const { return v.heap_memory() + neighbor_vs.heap_memory() + neighbor_es.heap_memory() + neighbor_fs.heap_memory() + neighbor_hs.heap_memory(); }
 		};
 		struct Edge
 		{
 			int id;
-			std::vector<uint32_t> vs;
-			std::vector<uint32_t> neighbor_fs;
-			std::vector<uint32_t> neighbor_hs;
+			utils::SmallVector<uint32_t, 2> vs;
+			EdgeNeighborList neighbor_fs;
+			EdgeNeighborList neighbor_hs;
 
 			bool boundary;
 			bool boundary_hex;
+
+			size_t heap_memory() const { return vs.heap_memory() + neighbor_fs.heap_memory() + neighbor_hs.heap_memory(); }
 		};
 		struct Face
 		{
 			int id;
-			std::vector<uint32_t> vs;
-			std::vector<uint32_t> es;
-			std::vector<uint32_t> neighbor_hs;
+			FaceList vs;
+			FaceList es;
+			utils::SmallVector<uint32_t, 2> neighbor_hs;
 			bool boundary;
 			bool boundary_hex;
+
+			size_t heap_memory() const { return vs.heap_memory() + es.heap_memory() + neighbor_hs.heap_memory(); }
 		};
 
 		struct Element
 		{
 			int id;
-			std::vector<uint32_t> vs;
-			std::vector<uint32_t> es;
-			std::vector<uint32_t> fs;
-			std::vector<bool> fs_flag;
+			ElementVertexList vs;
+			ElementEdgeList es;
+			ElementFaceList fs;
+			utils::SmallVector<bool, 6> fs_flag;
 			bool hex = false;
-			std::vector<double> v_in_Kernel;
+			Point3 v_in_Kernel;
+
+			size_t heap_memory() const { return vs.heap_memory() + es.heap_memory() + fs.heap_memory() + fs_flag.heap_memory() + v_in_Kernel.heap_memory(); }
 		};
 
 		enum class MeshType
@@ -75,6 +102,24 @@ namespace polyfem
 			Eigen::MatrixXi FV, FE, FH, FHi; // FV (3, nf), FE(3, nf), FH (2, nf), FHi(2, nf)
 			Eigen::MatrixXi HV, HF;          // HV(4, nh), HE(6, nh), HF(4, nh)
 
+			/// memory used by the connectivity (in bytes)
+			size_t memory() const
+			{
+				size_t res = vertices.capacity() * sizeof(Vertex) + edges.capacity() * sizeof(Edge) + faces.capacity() * sizeof(Face) + elements.capacity() * sizeof(Element);
+				for (const auto &v : vertices)
+					res += v.heap_memory();
+				for (const auto &e : edges)
+					res += e.heap_memory();
+				for (const auto &f : faces)
+					res += f.heap_memory();
+				for (const auto &c : elements)
+					res += c.heap_memory();
+
+				res += sizeof(double) * points.size();
+				res += sizeof(int) * (EV.size() + FV.size() + FE.size() + FH.size() + FHi.size() + HV.size() + HF.size());
+				return res;
+			}
+
 			void append(const Mesh3DStorage &other)
 			{
 				if (other.type != type)
@@ -60,8 +60,26 @@ namespace polyfem
 			void orient_volume_mesh(Mesh3DStorage &hmi);
 			void ele_subdivison_levels(const Mesh3DStorage &hmi, std::vector<int> &Ls);
 
-			// template<typename T>
-			void set_intersection_own(const std::vector<uint32_t> &A, const std::vector<uint32_t> &B, std::array<uint32_t, 2> &C, int &num);
+			/// first num common entries of A and B, works on any list of indices (vector or inline connectivity list)
+			template <typename ListA, typename ListB>
+			void set_intersection_own(const ListA &A, const ListB &B, std::array<uint32_t, 2> &C, int &num)
+			{
+				int n = 0;
+				for (const auto a : A)
+				{
+					for (const auto b : B)
+					{
+						if (a == b)
+						{
+							C[n++] = a;
+							if (n == num)
+								break;
+						}
+					}
+					if (n == num)
+						break;
+				}
+			}
 		} // namespace MeshProcessing3D
 	}     // namespace mesh
 } // namespace polyfem
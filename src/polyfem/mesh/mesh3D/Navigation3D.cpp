@@ -72,7 +72,8 @@ polyfem::mesh::Navigation3D::Index polyfem::mesh::Navigation3D::get_index_from_e
 		idx.face_corner = find(M.faces[idx.face].vs.begin(), M.faces[idx.face].vs.end(), idx.vertex) - M.faces[idx.face].vs.begin();
 
 		int v0 = idx.vertex, v1 = M.elements[hi].vs[1];
-		const vector<uint32_t> &ves0 = M.vertices[v0].neighbor_es, &ves1 = M.vertices[v1].neighbor_es;
+		const auto &ves0 = M.vertices[v0].neighbor_es;
+		const auto &ves1 = M.vertices[v1].neighbor_es;
 		std::array<uint32_t, 2> sharedes;
 		int num = 1;
 		MeshProcessing3D::set_intersection_own(ves0, ves1, sharedes, num);
@@ -393,7 +394,8 @@ polyfem::mesh::Navigation3D::Index polyfem::mesh::Navigation3D::switch_face(cons
 	}
 	else
 	{
-		const vector<uint32_t> &efs = M.edges[idx.edge].neighbor_fs, &hfs = M.elements[idx.element].fs;
+		const auto &efs = M.edges[idx.edge].neighbor_fs;
+		const auto &hfs = M.elements[idx.element].fs;
 		std::array<uint32_t, 2> sharedfs;
 		int num = 2;
 		MeshProcessing3D::set_intersection_own(efs, hfs, sharedfs, num);
@@ -408,7 +410,7 @@ polyfem::mesh::Navigation3D::Index polyfem::mesh::Navigation3D::switch_face(cons
 				break;
 			}
 
-		const vector<uint32_t> &fvs = M.faces[idx.face].vs;
+		const auto &fvs = M.faces[idx.face].vs;
 		for (int i = 0; i < fvs.size(); i++)
 			if (idx.vertex == fvs[i])
 			{
@@ -458,7 +460,7 @@ polyfem::mesh::Navigation3D::Index polyfem::mesh::Navigation3D::switch_element(c
 			else
 				idx.element = M.faces[idx.face].neighbor_hs[0];
 
-			const vector<uint32_t> &fs = M.elements[idx.element].fs;
+			const auto &fs = M.elements[idx.element].fs;
 			for (int i = 0; i < fs.size(); i++)
 				if (idx.face == fs[i])
 				{
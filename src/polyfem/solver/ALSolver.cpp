@@ -81,7 +81,11 @@ namespace polyfem::solver
 			if (eta < eta_tol && al_weight < max_al_weight)
 				al_weight *= scaling;
 			else
+			{
 				lagr_form->update_lagrangian(sol, al_weight);
+				// the value of the Lagrangian form changed at the same solution
+				nl_problem.invalidate_evaluation_cache();
+			}
 
 			post_subsolve(al_weight);
 			++al_steps;
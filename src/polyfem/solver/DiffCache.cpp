@@ -0,0 +1,133 @@
+#include "DiffCache.hpp"
+
+#include <polyfem/utils/Logger.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <random>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace polyfem::solver
+{
+	namespace
+	{
+		template <typename T>
+		void write_array(std::fstream &out, const T *data, const std::size_t size)
+		{
+			out.write(reinterpret_cast<const char *>(data), size * sizeof(T));
+		}
+
+		template <typename T>
+		void read_array(std::fstream &in, T *data, const std::size_t size)
+		{
+			in.read(reinterpret_cast<char *>(data), size * sizeof(T));
+		}
+
+		int process_id()
+		{
+#ifdef _WIN32
+			return _getpid();
+#else
+			return getpid();
+#endif
+		}
+	} // namespace
+
+	void DiffCache::open_scratch()
+	{
+		namespace fs = std::filesystem;
+
+		const fs::path directory = scratch_directory_.empty() ? fs::temp_directory_path() : fs::path(scratch_directory_);
+		fs::create_directories(directory);
+
+		// the file is created exclusively with the pid and a random suffix, so that
+		// concurrent caches (in this or other processes) never share a scratch file
+		std::random_device rd;
+		scratch_path_.clear();
+		for (int attempt = 0; attempt < 16 && scratch_path_.empty(); ++attempt)
+		{
+			const uint64_t suffix = (uint64_t(rd()) << 32) | rd();
+			const fs::path path = directory / fmt::format("polyfem_adjoint_{}_{:016x}.bin", process_id(), suffix);
+			if (FILE *file = std::fopen(path.string().c_str(), "wbx"))
+			{
+				std::fclose(file);
+				scratch_path_ = path.string();
+			}
+		}
+		if (scratch_path_.empty())
+			log_and_throw_error("Unable to create an adjoint scratch file in {}", directory.string());
+
+		scratch_.open(scratch_path_, std::ios::in | std::ios::out | std::ios::binary);
+		if (!scratch_.is_open())
+			log_and_throw_error("Unable to open adjoint scratch file {}", scratch_path_);
+
+		logger().debug("Spilling the adjoint Jacobians to {}", scratch_path_);
+	}
+
+	void DiffCache::close_scratch()
+	{
+		loaded_gradu_h_ = StiffnessMatrix();
+		loaded_step_ = -1;
+
+		if (!scratch_.is_open())
+			return;
+
+		scratch_.close();
+		std::error_code ec;
+		std::filesystem::remove(scratch_path_, ec);
+		scratch_path_.clear();
+	}
+
+	void DiffCache::spill_gradu_h(const int step)
+	{
+		if (step < 0 || gradu_h_offsets_.empty() || gradu_h_offsets_[step] >= 0)
+			return;
+
+		StiffnessMatrix &mat = gradu_h_[step];
+		mat.makeCompressed();
+
+		scratch_.seekp(0, std::ios::end);
+		gradu_h_offsets_[step] = scratch_.tellp();
+
+		const int64_t header[3] = {mat.rows(), mat.cols(), mat.nonZeros()};
+		write_array(scratch_, header, 3);
+		write_array(scratch_, mat.outerIndexPtr(), mat.outerSize() + 1);
+		write_array(scratch_, mat.innerIndexPtr(), mat.nonZeros());
+		write_array(scratch_, mat.valuePtr(), mat.nonZeros());
+
+		if (!scratch_)
+			log_and_throw_error("Unable to write the Jacobian of step {} to {}", step, scratch_path_);
+
+		// frees the memory
+		mat = StiffnessMatrix();
+	}
+
+	const StiffnessMatrix &DiffCache::load_gradu_h(const int step) const
+	{
+		if (loaded_step_ == step)
+			return loaded_gradu_h_;
+
+		scratch_.seekg(gradu_h_offsets_[step]);
+
+		int64_t header[3];
+		read_array(scratch_, header, 3);
+
+		loaded_gradu_h_.resize(header[0], header[1]);
+		loaded_gradu_h_.resizeNonZeros(header[2]);
+		read_array(scratch_, loaded_gradu_h_.outerIndexPtr(), loaded_gradu_h_.outerSize() + 1);
+		read_array(scratch_, loaded_gradu_h_.innerIndexPtr(), header[2]);
+		read_array(scratch_, loaded_gradu_h_.valuePtr(), header[2]);
+
+		if (!scratch_)
+			log_and_throw_error("Unable to read the Jacobian of step {} from {}", step, scratch_path_);
+
+		loaded_step_ = step;
+		return loaded_gradu_h_;
+	}
+} // namespace polyfem::solver
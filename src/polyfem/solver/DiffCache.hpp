@@ -6,6 +6,10 @@
 #include <ipc/collisions/collisions.hpp>
 #include <ipc/friction/friction_collisions.hpp>
 
+#include <algorithm>
+#include <fstream>
+#include <string>
+
 namespace polyfem::solver
 {
 	enum class CacheLevel
@@ -18,11 +22,41 @@ namespace polyfem::solver
 	class DiffCache
 	{
 	public:
+		/// where the per time step force Jacobians are kept
+		enum class Storage
+		{
+			Memory, ///< all Jacobians in RAM
+			Disk    ///< only the most recent Jacobians in RAM, the older ones are spilled to a scratch file
+		};
+
+		DiffCache() = default;
+		~DiffCache() { close_scratch(); }
+
+		/// @brief Set the storage of the per time step force Jacobians, takes effect at the next init
+		/// @param storage Memory or Disk
+		/// @param memory_steps Number of most recent Jacobians kept in RAM with the Disk storage
+		/// @param directory Directory of the scratch file, the system temporary directory if empty
+		void set_storage(const Storage storage, const int memory_steps = 1, const std::string &directory = "")
+		{
+			storage_ = storage;
+			memory_steps_ = std::max(memory_steps, 0);
+			scratch_directory_ = directory;
+		}
+		inline Storage storage() const { return storage_; }
+
 		void init(const int dimension, const int ndof, const int n_time_steps = 0)
 		{
 			cur_size_ = 0;
 			n_time_steps_ = n_time_steps;
 
+			close_scratch();
+			gradu_h_offsets_.clear();
+			if (storage_ == Storage::Disk && n_time_steps > 0)
+			{
+				gradu_h_offsets_.assign(n_time_steps + 1, -1);
+				open_scratch();
+			}
+
 			u_.setZero(ndof, n_time_steps + 1);
 			disp_grad_.assign(n_time_steps + 1, Eigen::MatrixXd::Zero(dimension,dimension));
 			if (n_time_steps_ > 0)
@@ -73,6 +107,7 @@ namespace polyfem::solver
 
 			gradu_h_[cur_step] = gradu_h;
 			// gradu_h_prev_[cur_step] = gradu_h_prev;
+			spill_gradu_h(cur_step - memory_steps_);
 
 			collision_set_[cur_step] = collision_set;
 			friction_collision_set_[cur_step] = friction_collision_set;
@@ -89,6 +124,7 @@ namespace polyfem::solver
         {
             u_.col(cur_step) = u;
             gradu_h_[cur_step] = gradu_h;
+            spill_gradu_h(cur_step - memory_steps_);
             collision_set_[cur_step] = contact_set;
             disp_grad_[cur_step] = disp_grad;
 
@@ -131,12 +167,15 @@ namespace polyfem::solver
 			return acc_.col(step);
 		}
 
+		/// the reference of a spilled Jacobian is only valid until the next call
 		const StiffnessMatrix &gradu_h(int step) const
 		{
 			assert(step < size());
 			if (step < 0)
 				step += gradu_h_.size();
-			return gradu_h_[step];
+			if (gradu_h_offsets_.empty() || gradu_h_offsets_[step] < 0)
+				return gradu_h_[step];
+			return load_gradu_h(step);
 		}
 		// const StiffnessMatrix &gradu_h_prev(const int step) const { assert(step < size()); return gradu_h_prev_[step]; }
 
@@ -156,6 +195,12 @@ namespace polyfem::solver
 		}
 
 	private:
+		void open_scratch();
+		void close_scratch();
+		/// writes the Jacobian of the given step to the scratch file and frees it, does nothing with the Memory storage
+		void spill_gradu_h(const int step);
+		const StiffnessMatrix &load_gradu_h(const int step) const;
+
 		int n_time_steps_ = 0;
 		int cur_size_ = 0;
 
@@ -173,5 +218,15 @@ namespace polyfem::solver
 		std::vector<ipc::FrictionCollisions> friction_collision_set_;
 
 		Eigen::MatrixXd adjoint_mat_;
+
+		Storage storage_ = Storage::Memory;
+		int memory_steps_ = 1;
+		std::string scratch_directory_;
+		std::string scratch_path_;
+		mutable std::fstream scratch_;
+		std::vector<std::streamoff> gradu_h_offsets_; ///< position of the Jacobians in the scratch file, -1 if in memory
+
+		mutable StiffnessMatrix loaded_gradu_h_; ///< last Jacobian read from the scratch file
+		mutable int loaded_step_ = -1;
 	};
 } // namespace polyfem::solver
\ No newline at end of file
@@ -1,7 +1,31 @@
 #include "FullNLProblem.hpp"
 
+#ifdef POLYFEM_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
+
+#include <functional>
+
 namespace polyfem::solver
 {
+	namespace
+	{
+		/// calls func(i) for every i in [0, n), concurrently with TBB that nests with the parallel loops of the forms.
+		/// The C++ threads pool does not nest (a form would run its loops serially), so the forms are evaluated in turn.
+		void for_each_form(const int n, const std::function<void(int)> &func)
+		{
+#ifdef POLYFEM_WITH_TBB
+			if (n > 1)
+			{
+				tbb::parallel_for(0, n, func);
+				return;
+			}
+#endif
+			for (int i = 0; i < n; ++i)
+				func(i);
+		}
+	} // namespace
+
 	FullNLProblem::FullNLProblem(const std::vector<std::shared_ptr<Form>> &forms)
 		: forms_(forms)
 	{
@@ -9,6 +33,7 @@ namespace polyfem::solver
 
 	void FullNLProblem::init(const TVector &x)
 	{
+		invalidate_evaluation_cache();
 		for (auto &f : forms_)
 			f->init(x);
 	}
@@ -21,12 +46,14 @@ namespace polyfem::solver
 
 	void FullNLProblem::init_lagging(const TVector &x)
 	{
+		invalidate_evaluation_cache();
 		for (auto &f : forms_)
 			f->init_lagging(x);
 	}
 
 	void FullNLProblem::update_lagging(const TVector &x, const int iter_num)
 	{
+		invalidate_evaluation_cache();
 		for (auto &f : forms_)
 			f->update_lagging(x, iter_num);
 	}
@@ -84,43 +111,121 @@ namespace polyfem::solver
 		return true;
 	}
 
+	std::vector<std::shared_ptr<Form>> FullNLProblem::enabled_forms() const
+	{
+		std::vector<std::shared_ptr<Form>> forms;
+		for (const auto &f : forms_)
+			if (f->enabled())
+				forms.push_back(f);
+		return forms;
+	}
+
+	void FullNLProblem::invalidate_evaluation_cache()
+	{
+		cached_x_.resize(0);
+		cached_evaluations_.clear();
+		solution_x_.resize(0);
+	}
+
+	void FullNLProblem::evaluate_forms(const TVector &x)
+	{
+		if (cached_evaluations_.size() != forms_.size() || cached_x_.size() != x.size() || cached_x_ != x)
+		{
+			cached_x_ = x;
+			cached_evaluations_.assign(forms_.size(), FormEvaluation());
+		}
+
+		std::vector<int> to_evaluate;
+		for (size_t i = 0; i < forms_.size(); ++i)
+		{
+			const FormEvaluation &eval = cached_evaluations_[i];
+			if (forms_[i]->enabled() && (!eval.valid || eval.weight != forms_[i]->weight()))
+				to_evaluate.push_back(i);
+		}
+
+		for_each_form(to_evaluate.size(), [&](int k) {
+			const int i = to_evaluate[k];
+			FormEvaluation &eval = cached_evaluations_[i];
+			eval.weight = forms_[i]->weight();
+			forms_[i]->value_and_first_derivative(x, eval.value, eval.grad);
+			eval.valid = true;
+		});
+	}
+
 	double FullNLProblem::value(const TVector &x)
 	{
+		// the line search evaluates the value at the trial point and the gradient right after if it is accepted
+		evaluate_forms(x);
+
+		// summed in the order of the forms, the result does not depend on the scheduling
 		double val = 0;
-		for (auto &f : forms_)
-			if (f->enabled())
-				val += f->value(x);
+		for (size_t i = 0; i < forms_.size(); ++i)
+			if (forms_[i]->enabled())
+				val += cached_evaluations_[i].value;
 		return val;
 	}
 
 	void FullNLProblem::gradient(const TVector &x, TVector &grad)
 	{
+		evaluate_forms(x);
+
 		grad = TVector::Zero(x.size());
-		for (auto &f : forms_)
-		{
-			if (!f->enabled())
-				continue;
-			TVector tmp;
-			f->first_derivative(x, tmp);
-			grad += tmp;
-		}
+		for (size_t i = 0; i < forms_.size(); ++i)
+			if (forms_[i]->enabled())
+				grad += cached_evaluations_[i].grad;
+	}
+
+	void FullNLProblem::value_and_gradient(const TVector &x, double &val, TVector &grad)
+	{
+		val = value(x);
+		gradient(x, grad);
 	}
 
 	void FullNLProblem::hessian(const TVector &x, THessian &hessian)
 	{
-		hessian.resize(x.size(), x.size());
-		for (auto &f : forms_)
+		const std::vector<std::shared_ptr<Form>> forms = enabled_forms();
+		if (forms.empty())
 		{
-			if (!f->enabled())
-				continue;
-			THessian tmp;
-			f->second_derivative(x, tmp);
-			hessian += tmp;
+			hessian.resize(x.size(), x.size());
+			hessian.setZero();
+			return;
 		}
+
+		std::vector<THessian> hessians(forms.size());
+		for_each_form(forms.size(), [&](int i) { forms[i]->second_derivative(x, hessians[i]); });
+
+		hessian_sum_.sum(hessians, hessian);
+	}
+
+	void FullNLProblem::hessian_apply(const TVector &x, const TVector &v, TVector &out)
+	{
+		const std::vector<std::shared_ptr<Form>> forms = enabled_forms();
+		std::vector<TVector> products(forms.size());
+		for_each_form(forms.size(), [&](int i) { forms[i]->second_derivative_apply(x, v, products[i]); });
+
+		out = TVector::Zero(x.size());
+		for (const TVector &tmp : products)
+			out += tmp;
+	}
+
+	void FullNLProblem::hessian_diagonal(const TVector &x, TVector &diag)
+	{
+		const std::vector<std::shared_ptr<Form>> forms = enabled_forms();
+		std::vector<TVector> diags(forms.size());
+		for_each_form(forms.size(), [&](int i) { forms[i]->second_derivative_diagonal(x, diags[i]); });
+
+		diag = TVector::Zero(x.size());
+		for (const TVector &tmp : diags)
+			diag += tmp;
 	}
 
 	void FullNLProblem::solution_changed(const TVector &x)
 	{
+		// the forms (eg the collision set) are updated from x, the evaluations stay valid only if they
+		// were already computed with the forms of this x
+		if (solution_x_.size() != x.size() || solution_x_ != x)
+			invalidate_evaluation_cache();
+		solution_x_ = x;
 		for (auto &f : forms_)
 			f->solution_changed(x);
 	}
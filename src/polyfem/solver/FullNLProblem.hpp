@@ -1,6 +1,7 @@
 #pragma once
 
 #include <polyfem/solver/forms/Form.hpp>
+#include <polyfem/utils/MatrixUtils.hpp>
 #include <polysolve/nonlinear/Problem.hpp>
 
 #include <memory>
@@ -15,10 +16,19 @@ namespace polyfem::solver
 		virtual ~FullNLProblem() = default;
 		virtual void init(const TVector &x0) override;
 
+		/// @brief Value of the sum of the forms, the gradient is computed at the same time and reused by gradient(x)
 		virtual double value(const TVector &x) override;
+		/// @brief Gradient of the sum of the forms, reused if value(x) was called at the same x
 		virtual void gradient(const TVector &x, TVector &gradv) override;
+		/// @brief Value and gradient at once, the forms share the intermediates (eg element values, collision stencils)
+		virtual void value_and_gradient(const TVector &x, double &val, TVector &gradv);
 		virtual void hessian(const TVector &x, THessian &hessian) override;
 
+		/// @brief Product of the Hessian with v, computed form by form without assembling the Hessian
+		virtual void hessian_apply(const TVector &x, const TVector &v, TVector &out);
+		/// @brief Diagonal of the Hessian (eg for Jacobi preconditioning of matrix-free Krylov solvers)
+		virtual void hessian_diagonal(const TVector &x, TVector &diag);
+
 		virtual bool is_step_valid(const TVector &x0, const TVector &x1) override;
 		virtual bool is_step_collision_free(const TVector &x0, const TVector &x1);
 		virtual double max_step_size(const TVector &x0, const TVector &x1) override;
@@ -38,9 +48,40 @@ namespace polyfem::solver
 
 		std::vector<std::shared_ptr<Form>> &forms() { return forms_; }
 
+		/// @brief Forget the values and gradients of the forms computed at the last x,
+		/// must be called when the forms change without a change of x (eg new time step)
+		void invalidate_evaluation_cache();
+
 		virtual bool stop(const TVector &x) override { return false; }
 
 	protected:
 		std::vector<std::shared_ptr<Form>> forms_;
+
+	private:
+		/// the forms to evaluate, value, gradient, and hessian evaluate them concurrently
+		std::vector<std::shared_ptr<Form>> enabled_forms() const;
+
+		/// value and gradient of a form at cached_x_, multiplied with weight
+		struct FormEvaluation
+		{
+			bool valid = false;
+			double weight;
+			double value;
+			TVector grad;
+		};
+
+		/// computes (concurrently) the value and gradient of the enabled forms not already evaluated at x
+		void evaluate_forms(const TVector &x);
+
+		/// solution at which the forms were last evaluated
+		TVector cached_x_;
+		/// evaluation of each entry of forms_ at cached_x_, a form whose weight changed (eg the adaptive
+		/// barrier stiffness in post_step) is evaluated again
+		std::vector<FormEvaluation> cached_evaluations_;
+		/// solution of the last solution_changed, the forms (eg the collision set) were updated for it
+		TVector solution_x_;
+
+		/// sum of the Hessians of the forms, cached for the union of their sparsity patterns
+		utils::SparseMatrixSum hessian_sum_;
 	};
 } // namespace polyfem::solver
@@ -171,6 +171,21 @@ namespace polyfem::solver
             }
     }
 
+    void NLHomoProblem::hessian_apply(const TVector &x, const TVector &v, TVector &out)
+    {
+        // the macro strain dofs couple all the dofs, use the assembled hessian
+        THessian hessian;
+        this->hessian(x, hessian);
+        out = hessian * v;
+    }
+
+    void NLHomoProblem::hessian_diagonal(const TVector &x, TVector &diag)
+    {
+        THessian hessian;
+        this->hessian(x, hessian);
+        diag = hessian.diagonal();
+    }
+
     void NLHomoProblem::set_fixed_entry(const Eigen::VectorXi &fixed_entry)
     {
         const int dim = state_.mesh->dimension();
@@ -33,6 +33,8 @@ namespace polyfem::solver
 		double value(const TVector &x) override;
 		void gradient(const TVector &x, TVector &gradv) override;
 		void hessian(const TVector &x, THessian &hessian) override;
+		void hessian_apply(const TVector &x, const TVector &v, TVector &out) override;
+		void hessian_diagonal(const TVector &x, TVector &diag) override;
 
 		void full_hessian_to_reduced_hessian(const THessian &full, THessian &reduced) const override;
 
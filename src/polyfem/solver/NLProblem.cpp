@@ -1,6 +1,9 @@
 #include "NLProblem.hpp"
 
 #include <polyfem/io/OBJWriter.hpp>
+#include <polyfem/utils/Logger.hpp>
+
+#include <cmath>
 
 /*
 m \frac{\partial^2 u}{\partial t^2} = \psi = \text{div}(\sigma[u])\newline
@@ -61,16 +64,36 @@ namespace polyfem::solver
 
 	void NLProblem::init_lagging(const TVector &x)
 	{
+		invalidate_hessian();
 		FullNLProblem::init_lagging(reduced_to_full(x));
 	}
 
 	void NLProblem::update_lagging(const TVector &x, const int iter_num)
 	{
+		// the lagged quantities (e.g., friction) change the Hessian
+		invalidate_hessian();
 		FullNLProblem::update_lagging(reduced_to_full(x), iter_num);
 	}
 
 	void NLProblem::update_quantities(const double t, const TVector &x)
 	{
+		if (hessian_max_reuses_ > 0)
+		{
+			logger().debug("Hessian assembled {} times, reused {} times", n_assembled_hessians_, n_reused_hessians_);
+			n_assembled_hessians_ = n_reused_hessians_ = 0;
+
+			if (hessian_reuse_across_time_steps_)
+			{
+				// the convergence rate is measured again from the first iteration of the new time step
+				hessian_grad_norm_ = std::numeric_limits<double>::infinity();
+				last_grad_norm_ = std::numeric_limits<double>::infinity();
+			}
+			else
+				invalidate_hessian();
+		}
+
+		invalidate_evaluation_cache();
+
 		t_ = t;
 		const TVector full = reduced_to_full(x);
 		for (auto &f : forms_)
@@ -108,14 +131,92 @@ namespace polyfem::solver
 		TVector full_grad;
 		FullNLProblem::gradient(reduced_to_full(x), full_grad);
 		grad = full_to_reduced_grad(full_grad);
+
+		if (hessian_max_reuses_ > 0)
+			last_grad_norm_ = grad.norm();
 	}
 
 	void NLProblem::hessian(const TVector &x, THessian &hessian)
 	{
+		if (reuse_hessian())
+		{
+			hessian = frozen_hessian_;
+			++frozen_hessian_reuses_;
+			++n_reused_hessians_;
+			hessian_grad_norm_ = last_grad_norm_;
+			return;
+		}
+
 		THessian full_hessian;
 		FullNLProblem::hessian(reduced_to_full(x), full_hessian);
 
 		full_hessian_to_reduced_hessian(full_hessian, hessian);
+
+		if (hessian_max_reuses_ > 0)
+		{
+			frozen_hessian_ = hessian;
+			frozen_hessian_reuses_ = 0;
+			++n_assembled_hessians_;
+			hessian_grad_norm_ = last_grad_norm_;
+		}
+	}
+
+	bool NLProblem::reuse_hessian() const
+	{
+		if (hessian_max_reuses_ <= 0 || frozen_hessian_.rows() != current_size() || frozen_hessian_reuses_ >= hessian_max_reuses_)
+			return false;
+
+		// the frozen Hessian is good enough as long as the gradient decreases quickly,
+		// without a gradient since the last reset (eg first iteration of a time step) the Hessian is reassembled
+		return std::isfinite(last_grad_norm_) && last_grad_norm_ <= hessian_max_convergence_rate_ * hessian_grad_norm_;
+	}
+
+	void NLProblem::set_hessian_reuse(const int max_reuses, const double max_convergence_rate, const bool across_time_steps)
+	{
+		assert(max_reuses >= 0);
+		assert(max_convergence_rate > 0 && max_convergence_rate <= 1);
+		hessian_max_reuses_ = max_reuses;
+		hessian_max_convergence_rate_ = max_convergence_rate;
+		hessian_reuse_across_time_steps_ = across_time_steps;
+		invalidate_hessian();
+	}
+
+	void NLProblem::invalidate_hessian()
+	{
+		frozen_hessian_.resize(0, 0);
+		frozen_hessian_.data().squeeze();
+		frozen_hessian_reuses_ = 0;
+		hessian_grad_norm_ = std::numeric_limits<double>::infinity();
+		last_grad_norm_ = std::numeric_limits<double>::infinity();
+	}
+
+	void NLProblem::hessian_apply(const TVector &x, const TVector &v, TVector &out)
+	{
+		// v is a direction, it vanishes on the Dirichlet nodes
+		TVector full_v;
+		reduced_to_full_aux(boundary_nodes_, full_size(), current_size(), v, Eigen::MatrixXd::Zero(full_size(), 1), full_v);
+
+		TVector full_out;
+		FullNLProblem::hessian_apply(reduced_to_full(x), full_v, full_out);
+
+		out = full_to_reduced_grad(full_out);
+	}
+
+	void NLProblem::hessian_diagonal(const TVector &x, TVector &diag)
+	{
+		if (periodic_bc_)
+		{
+			// the periodic dofs are merged, their diagonal entries include the coupling between the merged dofs
+			THessian hessian;
+			this->hessian(x, hessian);
+			diag = hessian.diagonal();
+			return;
+		}
+
+		TVector full_diag;
+		FullNLProblem::hessian_diagonal(reduced_to_full(x), full_diag);
+
+		diag = full_to_reduced_grad(full_diag);
 	}
 
 	void NLProblem::solution_changed(const TVector &newX)
@@ -140,6 +241,9 @@ namespace polyfem::solver
 
 	void NLProblem::set_apply_DBC(const TVector &x, const bool val)
 	{
+		// the augmented Lagrangian changes the Dirichlet terms of the Hessian
+		invalidate_hessian();
+		invalidate_evaluation_cache();
 		TVector full = reduced_to_full(x);
 		for (auto &form : forms_)
 			form->set_apply_DBC(full, val);
@@ -288,13 +392,21 @@ namespace polyfem::solver
 	void NLProblem::full_hessian_to_reduced_hessian(const THessian &full, THessian &reduced) const
 	{
 		// POLYFEM_SCOPED_TIMER("\tfull hessian to reduced hessian");
+		if (!periodic_bc_)
+		{
+			// no copy of the full Hessian without periodic boundary conditions
+			if (current_size() < full_size())
+				hessian_reduction_map_.reduce(boundary_nodes_, full, reduced);
+			else
+				reduced = full;
+			return;
+		}
+
 		THessian mid = full;
-		
-		if (periodic_bc_)
-			periodic_bc_->full_to_periodic(mid);
+		periodic_bc_->full_to_periodic(mid);
 
 		if (current_size() < full_size())
-			utils::full_to_reduced_matrix(mid.rows(), mid.rows() - boundary_nodes_.size(), boundary_nodes_, mid, reduced);
+			hessian_reduction_map_.reduce(boundary_nodes_, mid, reduced);
 		else
 			reduced = mid;
 	}
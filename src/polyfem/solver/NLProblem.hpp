@@ -4,6 +4,9 @@
 #include <polyfem/assembler/RhsAssembler.hpp>
 #include <polyfem/mesh/LocalBoundary.hpp>
 #include <polyfem/assembler/PeriodicBoundary.hpp>
+#include <polyfem/utils/MatrixUtils.hpp>
+
+#include <limits>
 
 namespace polyfem::solver
 {
@@ -34,6 +37,8 @@ namespace polyfem::solver
 		virtual double value(const TVector &x) override;
 		virtual void gradient(const TVector &x, TVector &gradv) override;
 		virtual void hessian(const TVector &x, THessian &hessian) override;
+		virtual void hessian_apply(const TVector &x, const TVector &v, TVector &out) override;
+		virtual void hessian_diagonal(const TVector &x, TVector &diag) override;
 
 		virtual bool is_step_valid(const TVector &x0, const TVector &x1) override;
 		virtual bool is_step_collision_free(const TVector &x0, const TVector &x1) override;
@@ -64,6 +69,16 @@ namespace polyfem::solver
 
 		void set_apply_DBC(const TVector &x, const bool val);
 
+		/// @brief Reuses the assembled Hessian over several Newton iterations (chord Newton).
+		/// The Hessian is reassembled when the gradient norm did not decrease fast enough
+		/// since the previous Hessian evaluation or after max_reuses consecutive reuses.
+		/// @param max_reuses maximum number of consecutive iterations using the same Hessian, 0 disables the reuse
+		/// @param max_convergence_rate reassemble if ||g_k|| > max_convergence_rate * ||g_prev||
+		/// @param across_time_steps keep the Hessian when the time step changes
+		void set_hessian_reuse(const int max_reuses, const double max_convergence_rate, const bool across_time_steps);
+		/// @brief Forces the next call to hessian to assemble the Hessian
+		void invalidate_hessian();
+
 	protected:
 		virtual Eigen::MatrixXd boundary_values() const;
 
@@ -93,6 +108,23 @@ namespace polyfem::solver
 		const std::vector<mesh::LocalBoundary> *local_boundary_;
 		const int n_boundary_samples_;
 
+		/// reduction of the Hessian, cached for the sparsity pattern of the last Hessian
+		mutable utils::FullToReducedMatrixMap hessian_reduction_map_;
+
+		/// true if the frozen Hessian can be used for the current iteration
+		bool reuse_hessian() const;
+
+		int hessian_max_reuses_ = 0; ///< 0 assembles the Hessian at every iteration
+		double hessian_max_convergence_rate_ = 0.5;
+		bool hessian_reuse_across_time_steps_ = false;
+
+		THessian frozen_hessian_;       ///< last assembled (reduced) Hessian, empty if the reuse is disabled
+		int frozen_hessian_reuses_ = 0; ///< number of consecutive iterations that used frozen_hessian_
+		double hessian_grad_norm_ = std::numeric_limits<double>::infinity(); ///< gradient norm at the previous Hessian evaluation
+		double last_grad_norm_ = std::numeric_limits<double>::infinity();    ///< norm of the last computed gradient
+		int n_assembled_hessians_ = 0;
+		int n_reused_hessians_ = 0;
+
 		template <class FullMat, class ReducedMat>
 		void full_to_reduced_aux(const std::vector<int> &boundary_nodes, const int full_size, const int reduced_size, const FullMat &full, ReducedMat &reduced) const;
 
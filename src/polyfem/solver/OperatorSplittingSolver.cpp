@@ -1,8 +1,12 @@
 #include "OperatorSplittingSolver.hpp"
 #include <unsupported/Eigen/SparseExtra>
 
+#include <polyfem/utils/MaybeParallelFor.hpp>
+
 #include <polysolve/linear/FEMSolver.hpp>
 
+#include <functional>
+
 #ifdef POLYFEM_WITH_OPENVDB
 #include <openvdb/openvdb.h>
 #endif
@@ -79,7 +83,9 @@ namespace polyfem::solver
 			logger().debug("hash grid in {} dimension: {}", d, hash_table_cell_num(d));
 			total_cell_num *= hash_table_cell_num(d);
 		}
-		hash_table.resize(total_cell_num);
+
+		// range of grid cells overlapped by the bounding box of every element
+		Eigen::Matrix<long, Eigen::Dynamic, Eigen::Dynamic> min_int(T.rows(), dim), max_int(T.rows(), dim);
 		for (int e = 0; e < T.rows(); e++)
 		{
 			Eigen::VectorXd min_ = V.row(T(e, 0));
@@ -92,48 +98,60 @@ namespace polyfem::solver
 				max_ = max_.cwiseMax(p);
 			}
 
-			Eigen::Matrix<long, Eigen::Dynamic, 1, Eigen::ColMajor, 3, 1> min_int(dim), max_int(dim);
-
 			for (int d = 0; d < dim; d++)
 			{
 				double temp = hash_table_cell_num(d) / (max_domain(d) - min_domain(d));
-				min_int(d) = floor((min_(d) * (1 - 1e-14) - min_domain(d)) * temp);
-				max_int(d) = ceil((max_(d) * (1 + 1e-14) - min_domain(d)) * temp);
-
-				min_int = min_int.cwiseMax(0);
-				max_int = max_int.cwiseMin(hash_table_cell_num);
+				min_int(e, d) = std::max(0l, (long)floor((min_(d) * (1 - 1e-14) - min_domain(d)) * temp));
+				max_int(e, d) = std::min(hash_table_cell_num(d), (long)ceil((max_(d) * (1 + 1e-14) - min_domain(d)) * temp));
 			}
+		}
 
-			for (long x = min_int(0); x < max_int(0); x++)
+		auto for_each_cell = [&](const int e, const std::function<void(long)> &func) {
+			for (long x = min_int(e, 0); x < max_int(e, 0); x++)
 			{
-				for (long y = min_int(1); y < max_int(1); y++)
+				for (long y = min_int(e, 1); y < max_int(e, 1); y++)
 				{
 					if (dim == 2)
-					{
-						long idx = x + y * hash_table_cell_num(0);
-						hash_table[idx].push_back(e);
-					}
+						func(x + y * hash_table_cell_num(0));
 					else
 					{
-						for (long z = min_int(2); z < max_int(2); z++)
-						{
-							long idx = x + (y + z * hash_table_cell_num(1)) * hash_table_cell_num(0);
-							hash_table[idx].push_back(e);
-						}
+						for (long z = min_int(e, 2); z < max_int(e, 2); z++)
+							func(x + (y + z * hash_table_cell_num(1)) * hash_table_cell_num(0));
 					}
 				}
 			}
-		}
+		};
+
+		// CSR layout: count, prefix sum, fill
+		hash_table_offsets.assign(total_cell_num + 1, 0);
+		for (int e = 0; e < T.rows(); e++)
+			for_each_cell(e, [&](long idx) { ++hash_table_offsets[idx + 1]; });
+		for (long i = 0; i < total_cell_num; i++)
+			hash_table_offsets[i + 1] += hash_table_offsets[i];
+
+		hash_table_elements.resize(hash_table_offsets.back());
+		std::vector<long> fill(hash_table_offsets.begin(), hash_table_offsets.end() - 1);
+		for (int e = 0; e < T.rows(); e++)
+			for_each_cell(e, [&](long idx) { hash_table_elements[fill[idx]++] = e; });
+
+		// elements around every vertex, the neighbors visited first by search_cell
+		vertex_elements_offsets.assign(V.rows() + 1, 0);
+		for (int e = 0; e < T.rows(); e++)
+			for (int i = 0; i < T.cols(); i++)
+				++vertex_elements_offsets[T(e, i) + 1];
+		for (int v = 0; v < V.rows(); v++)
+			vertex_elements_offsets[v + 1] += vertex_elements_offsets[v];
+
+		vertex_elements.resize(vertex_elements_offsets.back());
+		std::vector<int> vertex_fill(vertex_elements_offsets.begin(), vertex_elements_offsets.end() - 1);
+		for (int e = 0; e < T.rows(); e++)
+			for (int i = 0; i < T.cols(); i++)
+				vertex_elements[vertex_fill[T(e, i)]++] = e;
 
-		float average_intersection_num = 0;
 		int max_intersection_num = 0;
-		for (int i = 0; i < hash_table.size(); i++)
-		{
-			average_intersection_num += hash_table[i].size();
-			(hash_table[i].size() > max_intersection_num) ? (max_intersection_num = hash_table[i].size()) : 1;
-		}
-		average_intersection_num /= hash_table.size();
-		logger().debug("average intersection number for hash grid: {}", average_intersection_num);
+		for (long i = 0; i < total_cell_num; i++)
+			max_intersection_num = std::max<int>(max_intersection_num, hash_table_offsets[i + 1] - hash_table_offsets[i]);
+		logger().debug("average intersection number for hash grid: {}", float(hash_table_elements.size()) / total_cell_num);
 		logger().debug("max intersection number for hash grid: {}", max_intersection_num);
 	}
 
@@ -234,34 +252,28 @@ namespace polyfem::solver
 	{
 		double dist = 1e10;
 		int idx = -1, local_idx = -1;
+		// serial, this is called per point from the parallel advection loops
 		const int size = boundary_elem_id.size();
-#ifdef POLYFEM_WITH_TBB
-		tbb::parallel_for(0, size, 1, [&](int e)
-#else
 		for (int e = 0; e < size; e++)
-#endif
-						  {
-							  int elem_idx = boundary_elem_id[e];
+		{
+			int elem_idx = boundary_elem_id[e];
 
-							  for (int i = 0; i < shape; i++)
-							  {
-								  double dist_ = 0;
-								  for (int d = 0; d < dim; d++)
-								  {
-									  dist_ += pow(pos(d) - V(T(elem_idx, i), d), 2);
-								  }
-								  dist_ = sqrt(dist_);
-								  if (dist_ < dist)
-								  {
-									  dist = dist_;
-									  idx = elem_idx;
-									  local_idx = i;
-								  }
-							  }
-						  }
-#ifdef POLYFEM_WITH_TBB
-		);
-#endif
+			for (int i = 0; i < shape; i++)
+			{
+				double dist_ = 0;
+				for (int d = 0; d < dim; d++)
+				{
+					dist_ += pow(pos(d) - V(T(elem_idx, i), d), 2);
+				}
+				dist_ = sqrt(dist_);
+				if (dist_ < dist)
+				{
+					dist = dist_;
+					idx = elem_idx;
+					local_idx = i;
+				}
+			}
+		}
 		for (int d = 0; d < dim; d++)
 			pos(d) = V(T(idx, local_idx), d);
 		return idx;
@@ -300,21 +312,31 @@ namespace polyfem::solver
 			calculate_local_pts(gbases[new_elem], new_elem, pos_, local_pos);
 		}
 
-		// interpolation
+		interpolate_velocity(gbases, bases, new_elem, local_pos, sol, vel);
+
+		if (insideDomain)
+			return new_elem;
+		else
+			return -1;
+	}
+
+	void OperatorSplittingSolver::interpolate_velocity(const std::vector<basis::ElementBases> &gbases,
+													   const std::vector<basis::ElementBases> &bases,
+													   const int elem,
+													   const Eigen::MatrixXd &local_pos,
+													   const Eigen::MatrixXd &sol,
+													   RowVectorNd &vel)
+	{
 		vel = RowVectorNd::Zero(dim);
 		assembler::ElementAssemblyValues vals;
-		vals.compute(new_elem, dim == 3, local_pos, bases[new_elem], gbases[new_elem]);
+		vals.compute(elem, dim == 3, local_pos, bases[elem], gbases[elem]);
 		for (int d = 0; d < dim; d++)
 		{
 			for (int i = 0; i < vals.basis_values.size(); i++)
 			{
-				vel(d) += vals.basis_values[i].val(0) * sol(bases[new_elem].bases[i].global()[0].index * dim + d);
+				vel(d) += vals.basis_values[i].val(0) * sol(bases[elem].bases[i].global()[0].index * dim + d);
 			}
 		}
-		if (insideDomain)
-			return new_elem;
-		else
-			return -1;
 	}
 
 	void OperatorSplittingSolver::interpolator(const RowVectorNd &pos, double &val)
@@ -364,44 +386,69 @@ namespace polyfem::solver
 		Eigen::MatrixXd new_sol = Eigen::MatrixXd::Zero(sol.size(), 1);
 		// number of FEM nodes
 		const int n_vert = sol.size() / dim;
-		Eigen::VectorXi traversed = Eigen::VectorXi::Zero(n_vert);
 
-#ifdef POLYFEM_WITH_TBB
-		tbb::parallel_for(0, n_el, 1, [&](int e)
-#else
+		// every FEM node is advected once, from the first element containing it
+		std::vector<int> node_element(n_vert, -1), node_local(n_vert, -1);
 		for (int e = 0; e < n_el; ++e)
-#endif
-						  {
-							  // to compute global position with barycentric coordinate
-							  Eigen::MatrixXd mapped;
-							  gbases[e].eval_geom_mapping(local_pts, mapped);
+		{
+			for (int i = 0; i < local_pts.rows(); i++)
+			{
+				const int global = bases[e].bases[i].global()[0].index;
+				if (node_element[global] >= 0)
+					continue;
+				node_element[global] = e;
+				node_local[global] = i;
+			}
+		}
 
-							  for (int i = 0; i < local_pts.rows(); i++)
-							  {
-								  // global index of this FEM node
-								  int global = bases[e].bases[i].global()[0].index;
+		// departure points, the element of the node is the starting guess of the point location
+		Eigen::MatrixXd departure = Eigen::MatrixXd::Zero(n_vert, dim);
+		utils::maybe_parallel_for(n_el, [&](int start, int end, int thread_id) {
+			Eigen::MatrixXd mapped;
+			for (int e = start; e < end; ++e)
+			{
+				// to compute global position with barycentric coordinate
+				gbases[e].eval_geom_mapping(local_pts, mapped);
 
-								  if (traversed(global))
-									  continue;
-								  traversed(global) = 1;
+				for (int i = 0; i < local_pts.rows(); i++)
+				{
+					const int global = bases[e].bases[i].global()[0].index;
+					if (node_element[global] != e || node_local[global] != i)
+						continue;
 
-								  // velocity of this FEM node
-								  RowVectorNd vel_ = sol.block(global * dim, 0, dim, 1).transpose();
+					for (int d = 0; d < dim; d++)
+						departure(global, d) = mapped(i, d) - sol(global * dim + d) * dt;
+				}
+			}
+		});
 
-								  // global position of this FEM node
-								  RowVectorNd pos_ = RowVectorNd::Zero(1, dim);
-								  for (int d = 0; d < dim; d++)
-									  pos_(d) = mapped(i, d) - vel_(d) * dt;
+		std::vector<int> cells;
+		Eigen::MatrixXd local_pos;
+		locate(gbases, departure, node_element, cells, local_pos);
 
-								  Eigen::MatrixXd local_pos;
-								  interpolator(gbases, bases, pos_, vel_, local_pos, sol);
+		utils::maybe_parallel_for(n_vert, [&](int start, int end, int thread_id) {
+			RowVectorNd vel, pos;
+			Eigen::MatrixXd local;
+			for (int v = start; v < end; ++v)
+			{
+				if (node_element[v] < 0)
+					continue;
+
+				int cell = cells[v];
+				local = local_pos.row(v);
+				if (cell < 0)
+				{
+					// outside of the domain, use the closest boundary vertex
+					pos = departure.row(v);
+					cell = handle_boundary_advection(pos);
+					calculate_local_pts(gbases[cell], cell, pos, local);
+				}
+
+				interpolate_velocity(gbases, bases, cell, local, sol, vel);
+				new_sol.block(v * dim, 0, dim, 1) = vel.transpose();
+			}
+		});
 
-								  new_sol.block(global * dim, 0, dim, 1) = vel_.transpose();
-							  }
-						  }
-#ifdef POLYFEM_WITH_TBB
-		);
-#endif
 		sol.swap(new_sol);
 	}
 
@@ -562,6 +609,7 @@ namespace polyfem::solver
 			position_particle.resize(n_el * ppe);
 			velocity_particle.resize(n_el * ppe);
 			cellI_particle.resize(n_el * ppe);
+			local_pos_particle.resize(n_el * ppe, dim);
 #ifdef POLYFEM_WITH_TBB
 			tbb::parallel_for(0, n_el, 1, [&](int e)
 #else
@@ -584,8 +632,11 @@ namespace polyfem::solver
 									  }
 								  }
 
-								  for (int i = 0; i < shape; ++i)
+								  for (int i = 0; i < ppe; ++i)
+								  {
 									  cellI_particle[e * ppe + i] = e;
+									  local_pos_particle.row(e * ppe + i) = local_pts_particle.row(i);
+								  }
 
 								  // compute global position and velocity of particles
 								  // construct interpolant (linear for position)
@@ -694,6 +745,10 @@ namespace polyfem::solver
 						// TODO: dim == 3
 					}
 
+					// the local coordinates are the warm start of the next point location, they must match the new cell
+					if (local_pos_particle.rows() == cellI_particle.size())
+						local_pos_particle.row(pI) = local_pts_particle.row(0);
+
 					// compute global position and velocity of particles
 					// construct interpolant (linear for position)
 					Eigen::MatrixXd mapped;
@@ -715,41 +770,31 @@ namespace polyfem::solver
 			}
 		}
 
-		// advect
-		std::vector<assembler::ElementAssemblyValues> velocity_interpolator(ppe * n_el);
-#ifdef POLYFEM_WITH_TBB
-		tbb::parallel_for(0, (int)(ppe * n_el), 1, [&](int pI)
-#else
-		for (int pI = 0; pI < ppe * n_el; ++pI)
-#endif
-						  {
-							  // update particle position via advection
-							  RowVectorNd newvel;
-							  Eigen::MatrixXd local_pos;
-							  cellI_particle[pI] = trace_back(gbases, bases, position_particle[pI], velocity_particle[pI],
-															  position_particle[pI], newvel, local_pos, sol, -dt);
-
-							  // RK3:
-							  // RowVectorNd bypass, vel2, vel3;
-							  // trace_back( gbases, bases, position_particle[pI], velocity_particle[pI],
-							  //     bypass, vel2, sol, -0.5 * dt);
-							  // trace_back( gbases, bases, position_particle[pI], vel2,
-							  //     bypass, vel3, sol, -0.75 * dt);
-							  // trace_back( gbases, bases, position_particle[pI],
-							  //     2 * velocity_particle[pI] + 3 * vel2 + 4 * vel3,
-							  //     position_particle[pI], bypass, sol, -dt / 9);
-
-							  // prepare P2G
-							  if (cellI_particle[pI] >= 0)
-							  {
-								  // construct interpolator (always linear for P2G, can use gaussian or bspline later)
-								  velocity_interpolator[pI].compute(cellI_particle[pI], dim == 3, local_pos,
-																	gbases[cellI_particle[pI]], gbases[cellI_particle[pI]]);
-							  }
-						  }
-#ifdef POLYFEM_WITH_TBB
-		);
-#endif
+		// advect, the particles are located all at once starting from their previous element
+		const int n_particles = ppe * n_el;
+		Eigen::MatrixXd new_position(n_particles, dim);
+		for (int pI = 0; pI < n_particles; ++pI)
+			new_position.row(pI) = position_particle[pI] + velocity_particle[pI] * dt;
+
+		std::vector<int> new_cells;
+		locate(gbases, new_position, cellI_particle, new_cells, local_pos_particle);
+
+		std::vector<assembler::ElementAssemblyValues> velocity_interpolator(n_particles);
+		utils::maybe_parallel_for(n_particles, [&](int start, int end, int thread_id) {
+			for (int pI = start; pI < end; ++pI)
+			{
+				position_particle[pI] = new_position.row(pI);
+				cellI_particle[pI] = new_cells[pI];
+
+				// prepare P2G
+				if (cellI_particle[pI] >= 0)
+				{
+					// construct interpolator (always linear for P2G, can use gaussian or bspline later)
+					velocity_interpolator[pI].compute(cellI_particle[pI], dim == 3, local_pos_particle.row(pI),
+													  gbases[cellI_particle[pI]], gbases[cellI_particle[pI]]);
+				}
+			}
+		});
 
 		// P2G
 		new_sol = Eigen::MatrixXd::Zero(sol.size(), 1);
@@ -798,6 +843,8 @@ namespace polyfem::solver
 		position_particle.resize(ppe * n_el);
 		velocity_particle.resize(ppe * n_el);
 		cellI_particle.resize(ppe * n_el);
+		Eigen::MatrixXd new_position(ppe * n_el, dim), local_pos(ppe * n_el, dim);
+		std::vector<int> hints(ppe * n_el);
 #ifdef POLYFEM_WITH_TBB
 		tbb::parallel_for(0, n_el, 1, [&](int e)
 #else
@@ -843,37 +890,36 @@ namespace polyfem::solver
 								  }
 							  }
 
-							  // update particle position via advection
+							  // advected position, the sampled local coordinates are the starting guess of the point location
 							  for (int j = 0; j < ppe; ++j)
 							  {
-								  RowVectorNd newvel;
-								  Eigen::MatrixXd local_pos;
-								  cellI_particle[ppe * e + j] = trace_back(gbases, bases, position_particle[ppe * e + j], velocity_particle[e * ppe + j],
-																		   position_particle[ppe * e + j], newvel, local_pos, sol, -dt);
-
-								  // RK3:
-								  // RowVectorNd bypass, vel2, vel3;
-								  // trace_back( gbases, bases, position_particle[ppe * e + i], velocity_particle[e * ppe + i],
-								  //     bypass, vel2, sol, -0.5 * dt);
-								  // trace_back( gbases, bases, position_particle[ppe * e + i], vel2,
-								  //     bypass, vel3, sol, -0.75 * dt);
-								  // trace_back( gbases, bases, position_particle[ppe * e + i],
-								  //     2 * velocity_particle[e * ppe + i] + 3 * vel2 + 4 * vel3,
-								  //     position_particle[ppe * e + i], bypass, sol, -dt / 9);
-
-								  // prepare P2G
-								  if (cellI_particle[ppe * e + j] >= 0)
-								  {
-									  // construct interpolator (always linear for P2G, can use gaussian or bspline later)
-									  velocity_interpolator[ppe * e + j].compute(cellI_particle[ppe * e + j], dim == 3, local_pos,
-																				 gbases[cellI_particle[ppe * e + j]], gbases[cellI_particle[ppe * e + j]]);
-								  }
+								  new_position.row(ppe * e + j) = position_particle[ppe * e + j] + velocity_particle[e * ppe + j] * dt;
+								  local_pos.row(ppe * e + j) = local_pts_particle.row(j);
+								  hints[ppe * e + j] = e;
 							  }
 						  }
 #ifdef POLYFEM_WITH_TBB
 		);
 #endif
 
+		// update particle position via advection
+		locate(gbases, new_position, hints, cellI_particle, local_pos);
+
+		utils::maybe_parallel_for(ppe * n_el, [&](int start, int end, int thread_id) {
+			for (int pI = start; pI < end; ++pI)
+			{
+				position_particle[pI] = new_position.row(pI);
+
+				// prepare P2G
+				if (cellI_particle[pI] >= 0)
+				{
+					// construct interpolator (always linear for P2G, can use gaussian or bspline later)
+					velocity_interpolator[pI].compute(cellI_particle[pI], dim == 3, local_pos.row(pI),
+													  gbases[cellI_particle[pI]], gbases[cellI_particle[pI]]);
+				}
+			}
+		});
+
 		// P2G
 		for (int e = 0; e < n_el; ++e)
 		{
@@ -1116,8 +1162,38 @@ namespace polyfem::solver
 		}
 	}
 
-	long OperatorSplittingSolver::search_cell(const std::vector<basis::ElementBases> &gbases, const RowVectorNd &pos, Eigen::MatrixXd &local_pts)
+	bool OperatorSplittingSolver::inside_element(const Eigen::MatrixXd &local_pts) const
 	{
+		if (shape == dim + 1)
+			return local_pts.minCoeff() > -1e-13 && local_pts.sum() < 1 + 1e-13;
+		else
+			return local_pts.minCoeff() > -1e-13 && local_pts.maxCoeff() < 1 + 1e-13;
+	}
+
+	long OperatorSplittingSolver::search_cell(const std::vector<basis::ElementBases> &gbases, const RowVectorNd &pos, Eigen::MatrixXd &local_pts, const long hint, const bool warm_start)
+	{
+		if (hint >= 0)
+		{
+			// the hint and the elements around its vertices first
+			calculate_local_pts(gbases[hint], hint, pos, local_pts, warm_start);
+			if (inside_element(local_pts))
+				return hint;
+
+			for (int i = 0; i < T.cols(); i++)
+			{
+				const int v = T(hint, i);
+				for (int k = vertex_elements_offsets[v]; k < vertex_elements_offsets[v + 1]; k++)
+				{
+					const int e = vertex_elements[k];
+					if (e == hint)
+						continue;
+					calculate_local_pts(gbases[e], e, pos, local_pts);
+					if (inside_element(local_pts))
+						return e;
+				}
+			}
+		}
+
 		Eigen::Matrix<long, Eigen::Dynamic, 1> pos_int(dim);
 		for (int d = 0; d < dim; d++)
 		{
@@ -1135,25 +1211,44 @@ namespace polyfem::solver
 			dim_num *= hash_table_cell_num(d);
 		}
 
-		const std::vector<long> &list = hash_table[idx];
-		for (auto it = list.begin(); it != list.end(); it++)
+		for (long k = hash_table_offsets[idx]; k < hash_table_offsets[idx + 1]; k++)
 		{
-			calculate_local_pts(gbases[*it], *it, pos, local_pts);
+			const int e = hash_table_elements[k];
+			calculate_local_pts(gbases[e], e, pos, local_pts);
 
-			if (shape == dim + 1)
-			{
-				if (local_pts.minCoeff() > -1e-13 && local_pts.sum() < 1 + 1e-13)
-					return *it;
-			}
-			else
-			{
-				if (local_pts.minCoeff() > -1e-13 && local_pts.maxCoeff() < 1 + 1e-13)
-					return *it;
-			}
+			if (inside_element(local_pts))
+				return e;
 		}
 		return -1; // not inside any elem
 	}
 
+	void OperatorSplittingSolver::locate(const std::vector<basis::ElementBases> &gbases,
+										 const Eigen::MatrixXd &pts,
+										 const std::vector<int> &hints,
+										 std::vector<int> &cells,
+										 Eigen::MatrixXd &local_pts)
+	{
+		const int n_pts = pts.rows();
+		assert(hints.empty() || hints.size() == n_pts);
+
+		const bool warm_start = local_pts.rows() == n_pts && local_pts.cols() == dim;
+		if (!warm_start)
+			local_pts.setZero(n_pts, dim);
+		cells.resize(n_pts);
+
+		utils::maybe_parallel_for(n_pts, [&](int start, int end, int thread_id) {
+			RowVectorNd pos;
+			Eigen::MatrixXd local;
+			for (int i = start; i < end; ++i)
+			{
+				pos = pts.row(i);
+				local = local_pts.row(i);
+				cells[i] = search_cell(gbases, pos, local, hints.empty() ? -1 : hints[i], warm_start);
+				local_pts.row(i) = local;
+			}
+		});
+	}
+
 	bool OperatorSplittingSolver::outside_quad(const std::vector<RowVectorNd> &vert, const RowVectorNd &pos)
 	{
 		double a = (vert[1](0) - vert[0](0)) * (pos(1) - vert[0](1)) - (vert[1](1) - vert[0](1)) * (pos(0) - vert[0](0));
@@ -1273,9 +1368,13 @@ namespace polyfem::solver
 	void OperatorSplittingSolver::calculate_local_pts(const basis::ElementBases &gbase,
 													  const int elem_idx,
 													  const RowVectorNd &pos,
-													  Eigen::MatrixXd &local_pos)
+													  Eigen::MatrixXd &local_pos,
+													  const bool warm_start)
 	{
-		local_pos = Eigen::MatrixXd::Zero(1, dim);
+		if (!warm_start || local_pos.size() != dim)
+			local_pos = Eigen::MatrixXd::Zero(1, dim);
+		else
+			local_pos.resize(1, dim);
 
 		// if(shape == 4 && dim == 2 && outside_quad(vert, pos))
 		// {
@@ -79,6 +79,14 @@ namespace polyfem
 
 			void interpolator(const RowVectorNd &pos, double &val);
 
+			/// velocity at local_pos of element elem
+			void interpolate_velocity(const std::vector<basis::ElementBases> &gbases,
+									  const std::vector<basis::ElementBases> &bases,
+									  const int elem,
+									  const Eigen::MatrixXd &local_pos,
+									  const Eigen::MatrixXd &sol,
+									  RowVectorNd &vel);
+
 		public:
 			void advection(const mesh::Mesh &mesh,
 						   const std::vector<basis::ElementBases> &gbases,
@@ -132,7 +140,21 @@ namespace polyfem
 
 			void initialize_density(const std::shared_ptr<assembler::Problem> &problem);
 
-			long search_cell(const std::vector<basis::ElementBases> &gbases, const RowVectorNd &pos, Eigen::MatrixXd &local_pts);
+			/// element containing pos (-1 if outside) and the local coordinates of pos in it
+			/// if hint >= 0, the hint element and the elements sharing a vertex with it are tested before the hash grid;
+			/// with warm_start, local_pts is the initial guess of the local coordinates in the hint element
+			long search_cell(const std::vector<basis::ElementBases> &gbases, const RowVectorNd &pos, Eigen::MatrixXd &local_pts, const long hint = -1, const bool warm_start = false);
+
+			/// locates all the rows of pts in parallel, cells is -1 for the points outside of the domain
+			/// hints (empty or one per point) are passed to search_cell, if local_pts has one row per point
+			/// it is used as warm start for the hints
+			void locate(const std::vector<basis::ElementBases> &gbases,
+						const Eigen::MatrixXd &pts,
+						const std::vector<int> &hints,
+						std::vector<int> &cells,
+						Eigen::MatrixXd &local_pts);
+
+			bool inside_element(const Eigen::MatrixXd &local_pts) const;
 
 			bool outside_quad(const std::vector<RowVectorNd> &vert, const RowVectorNd &pos);
 
@@ -143,7 +165,8 @@ namespace polyfem
 			void calculate_local_pts(const basis::ElementBases &gbase,
 									 const int elem_idx,
 									 const RowVectorNd &pos,
-									 Eigen::MatrixXd &local_pos);
+									 Eigen::MatrixXd &local_pos,
+									 const bool warm_start = false);
 
 			void save_density();
 
@@ -157,12 +180,20 @@ namespace polyfem
 			Eigen::MatrixXd V;
 			Eigen::MatrixXi T;
 
-			std::vector<std::vector<long>> hash_table;
+			/// uniform grid in CSR layout, the elements overlapping cell c are
+			/// hash_table_elements[hash_table_offsets[c]] ... hash_table_elements[hash_table_offsets[c + 1] - 1]
+			std::vector<long> hash_table_offsets;
+			std::vector<int> hash_table_elements;
 			Eigen::Matrix<long, Eigen::Dynamic, 1, Eigen::ColMajor, 3, 1> hash_table_cell_num;
 
+			/// elements around every vertex, same CSR layout
+			std::vector<int> vertex_elements_offsets;
+			std::vector<int> vertex_elements;
+
 			std::vector<Eigen::Matrix<double, 1, Eigen::Dynamic, Eigen::RowMajor, 1, 3>> position_particle;
 			std::vector<Eigen::Matrix<double, 1, Eigen::Dynamic, Eigen::RowMajor, 1, 3>> velocity_particle;
 			std::vector<int> cellI_particle;
+			Eigen::MatrixXd local_pos_particle; ///< local coordinates of the particles in cellI_particle
 			Eigen::MatrixXd new_sol;
 			Eigen::MatrixXd new_sol_w;
 
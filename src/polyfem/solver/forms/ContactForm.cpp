@@ -15,8 +15,56 @@
 
 #include <igl/writePLY.h>
 
+#include <algorithm>
+#include <typeinfo>
+
 namespace polyfem::solver
 {
+	template <typename Potential, typename Collisions>
+	double potential_value_and_gradient(
+		const Potential &potential,
+		const Collisions &collisions,
+		const ipc::CollisionMesh &collision_mesh,
+		const Eigen::MatrixXd &V,
+		Eigen::VectorXd &grad)
+	{
+		const int dim = V.cols();
+		const Eigen::MatrixXi &E = collision_mesh.edges();
+		const Eigen::MatrixXi &F = collision_mesh.faces();
+
+		auto storage = utils::create_thread_storage(std::make_pair(0.0, Eigen::VectorXd::Zero(V.size()).eval()));
+
+		utils::maybe_parallel_for(collisions.size(), [&](int start, int end, int thread_id) {
+			auto &[local_val, local_grad] = utils::get_local_thread_storage(storage, thread_id);
+
+			for (size_t i = start; i < end; i++)
+			{
+				const auto &collision = collisions[i];
+				const ipc::VectorMax12d dof = collision.dof(V, E, F);
+				local_val += potential(collision, dof);
+
+				const ipc::VectorMax12d collision_grad = potential.gradient(collision, dof);
+				const std::array<long, 4> vis = collision.vertex_ids(E, F);
+				for (int j = 0; j < collision.num_vertices(); j++)
+					local_grad.segment(vis[j] * dim, dim) += collision_grad.segment(j * dim, dim);
+			}
+		});
+
+		double val = 0;
+		grad.setZero(V.size());
+		for (const auto &[local_val, local_grad] : storage)
+		{
+			val += local_val;
+			grad += local_grad;
+		}
+		return val;
+	}
+
+	template double potential_value_and_gradient(
+		const ipc::BarrierPotential &, const ipc::Collisions &, const ipc::CollisionMesh &, const Eigen::MatrixXd &, Eigen::VectorXd &);
+	template double potential_value_and_gradient(
+		const ipc::FrictionPotential &, const ipc::FrictionCollisions &, const ipc::CollisionMesh &, const Eigen::MatrixXd &, Eigen::VectorXd &);
+
 	ContactForm::ContactForm(const ipc::CollisionMesh &collision_mesh,
 							 const double dhat,
 							 const double avg_mass,
@@ -134,11 +182,29 @@ namespace polyfem::solver
 			return;
 
 		if (use_cached_candidates_)
+		{
+			POLYFEM_SCOPED_TIMER(collision_timings_.narrow_phase);
 			collision_set_.build(
 				candidates_, collision_mesh_, displaced_surface, dhat_);
+		}
+		else if (update_persistent_candidates(displaced_surface, displaced_surface))
+		{
+			POLYFEM_SCOPED_TIMER(collision_timings_.narrow_phase);
+			collision_set_.build(
+				persistent_candidates_, collision_mesh_, displaced_surface, dhat_);
+		}
 		else
+		{
+			ipc::Candidates candidates;
+			{
+				POLYFEM_SCOPED_TIMER(collision_timings_.broad_phase);
+				candidates.build(
+					collision_mesh_, displaced_surface, /*inflation_radius=*/(dhat_ + dmin_) / 2, broad_phase_method_);
+			}
+			POLYFEM_SCOPED_TIMER(collision_timings_.narrow_phase);
 			collision_set_.build(
-				collision_mesh_, displaced_surface, dhat_, dmin_, broad_phase_method_);
+				candidates, collision_mesh_, displaced_surface, dhat_);
+		}
 		cached_displaced_surface = displaced_surface;
 	}
 
@@ -203,13 +269,131 @@ namespace polyfem::solver
 		gradv = collision_mesh_.to_full_dof(gradv);
 	}
 
+	void ContactForm::value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const
+	{
+		val = potential_value_and_gradient(barrier_potential_, collision_set_, collision_mesh_, compute_displaced_surface(x), gradv);
+		gradv = collision_mesh_.to_full_dof(gradv);
+	}
+
 	void ContactForm::second_derivative_unweighted(const Eigen::VectorXd &x, StiffnessMatrix &hessian) const
 	{
 		POLYFEM_SCOPED_TIMER("barrier hessian");
-		hessian = barrier_potential_.hessian(collision_set_, collision_mesh_, compute_displaced_surface(x), project_to_psd_);
+		if (incremental_hessian_tol_ >= 0)
+			hessian = incremental_hessian(compute_displaced_surface(x));
+		else
+			hessian = barrier_potential_.hessian(collision_set_, collision_mesh_, compute_displaced_surface(x), project_to_psd_);
 		hessian = collision_mesh_.to_full_dof(hessian);
 	}
 
+	size_t ContactForm::CollisionKeyHash::operator()(const CollisionKey &key) const
+	{
+		size_t h = key.type;
+		for (const long v : key.vertex_ids)
+			h ^= std::hash<long>()(v) + 0x9e3779b9 + (h << 6) + (h >> 2);
+		return h;
+	}
+
+	StiffnessMatrix ContactForm::incremental_hessian(const Eigen::MatrixXd &V) const
+	{
+		const int dim = collision_mesh_.dim();
+		const int ndof = collision_mesh_.num_vertices() * dim;
+		const Eigen::MatrixXi &E = collision_mesh_.edges();
+		const Eigen::MatrixXi &F = collision_mesh_.faces();
+
+		// the cached blocks are invalid if the projection changed
+		if (hessian_blocks_psd_ != project_to_psd_)
+		{
+			hessian_blocks_.clear();
+			hessian_blocks_psd_ = project_to_psd_;
+		}
+
+		std::vector<CollisionKey> keys(collision_set_.size());
+		std::vector<HessianBlock> blocks(collision_set_.size());
+		std::vector<int> reused(collision_set_.size(), 0);
+
+		auto storage = utils::create_thread_storage(std::vector<Eigen::Triplet<double>>());
+
+		utils::maybe_parallel_for(collision_set_.size(), [&](int start, int end, int thread_id) {
+			std::vector<Eigen::Triplet<double>> &triplets = utils::get_local_thread_storage(storage, thread_id);
+
+			for (size_t i = start; i < end; i++)
+			{
+				const ipc::Collision &collision = collision_set_[i];
+				const int n_v = collision.num_vertices();
+				const std::array<long, 4> vis = collision.vertex_ids(E, F);
+
+				keys[i] = {typeid(collision).hash_code(), vis};
+				HessianBlock &block = blocks[i];
+				block.dof = collision.dof(V, E, F);
+				block.weight = collision.weight;
+
+				// read only access to the blocks of the previous evaluation
+				const auto it = hessian_blocks_.find(keys[i]);
+				if (it != hessian_blocks_.end()
+					&& it->second.weight == block.weight
+					&& it->second.dof.size() == block.dof.size()
+					&& (it->second.dof - block.dof).lpNorm<Eigen::Infinity>() <= incremental_hessian_tol_)
+				{
+					block.dof = it->second.dof;
+					block.hessian = it->second.hessian;
+					reused[i] = 1;
+				}
+				else
+					block.hessian = barrier_potential_.hessian(collision, block.dof, project_to_psd_);
+
+				for (int j = 0; j < n_v; ++j)
+					for (int k = 0; k < n_v; ++k)
+						for (int dj = 0; dj < dim; ++dj)
+							for (int dk = 0; dk < dim; ++dk)
+								triplets.emplace_back(vis[j] * dim + dj, vis[k] * dim + dk, block.hessian(j * dim + dj, k * dim + dk));
+			}
+		});
+
+		// only the active collisions are kept
+		hessian_blocks_.clear();
+		hessian_blocks_.reserve(keys.size());
+		for (size_t i = 0; i < keys.size(); ++i)
+			hessian_blocks_[keys[i]] = std::move(blocks[i]);
+
+		logger().trace("Reused {}/{} contact hessian blocks", std::count(reused.begin(), reused.end(), 1), reused.size());
+
+		std::vector<Eigen::Triplet<double>> triplets;
+		for (const auto &local_triplets : storage)
+			triplets.insert(triplets.end(), local_triplets.begin(), local_triplets.end());
+
+		StiffnessMatrix hessian(ndof, ndof);
+		hessian.setFromTriplets(triplets.begin(), triplets.end());
+		return hessian;
+	}
+
+	bool ContactForm::update_persistent_candidates(const Eigen::MatrixXd &V0, const Eigen::MatrixXd &V1) const
+	{
+		if (broad_phase_skin_ <= 0 || V0.rows() == 0)
+			return false;
+
+		const auto max_displacement = [](const Eigen::MatrixXd &A, const Eigen::MatrixXd &B) {
+			return (A - B).rowwise().norm().maxCoeff();
+		};
+
+		if (persistent_vertices_.rows() == V0.rows()
+			&& max_displacement(V0, persistent_vertices_) <= broad_phase_skin_
+			&& max_displacement(V1, persistent_vertices_) <= broad_phase_skin_)
+			return true;
+
+		// the candidates are centered on the trajectory to cover both ends
+		Eigen::MatrixXd center = (V0 + V1) / 2;
+		if (max_displacement(V0, center) > broad_phase_skin_)
+			return false;
+
+		POLYFEM_SCOPED_TIMER(collision_timings_.broad_phase);
+		persistent_candidates_.build(
+			collision_mesh_, center, /*inflation_radius=*/(dhat_ + dmin_) / 2 + broad_phase_skin_, broad_phase_method_);
+		persistent_vertices_ = std::move(center);
+		logger().trace("Rebuilt broad phase with {} candidates", persistent_candidates_.size());
+
+		return true;
+	}
+
 	void ContactForm::solution_changed(const Eigen::VectorXd &new_x)
 	{
 		update_collision_set(compute_displaced_surface(new_x));
@@ -229,13 +413,22 @@ namespace polyfem::solver
 			igl::writePLY(resolve_output_path("debug_ccd_1.ply"), V1, F, E);
 		}
 
+		const bool use_stq = broad_phase_method_ == ipc::BroadPhaseMethod::SWEEP_AND_TINIEST_QUEUE;
+		const bool use_persistent_candidates = !use_stq && !use_cached_candidates_ && update_persistent_candidates(V0, V1);
+
 		double max_step;
-		if (use_cached_candidates_ && broad_phase_method_ != ipc::BroadPhaseMethod::SWEEP_AND_TINIEST_QUEUE)
-			max_step = candidates_.compute_collision_free_stepsize(
-				collision_mesh_, V0, V1, dmin_, ccd_tolerance_, ccd_max_iterations_);
-		else
-			max_step = ipc::compute_collision_free_stepsize(
-				collision_mesh_, V0, V1, broad_phase_method_, ccd_tolerance_, ccd_max_iterations_);
+		{
+			POLYFEM_SCOPED_TIMER(collision_timings_.ccd);
+			if (use_cached_candidates_ && !use_stq)
+				max_step = candidates_.compute_collision_free_stepsize(
+					collision_mesh_, V0, V1, dmin_, ccd_tolerance_, ccd_max_iterations_);
+			else if (use_persistent_candidates)
+				max_step = persistent_candidates_.compute_collision_free_stepsize(
+					collision_mesh_, V0, V1, dmin_, ccd_tolerance_, ccd_max_iterations_);
+			else
+				max_step = ipc::compute_collision_free_stepsize(
+					collision_mesh_, V0, V1, broad_phase_method_, ccd_tolerance_, ccd_max_iterations_);
+		}
 
 		if (save_ccd_debug_meshes && ipc::has_intersections(collision_mesh_, (V1 - V0) * max_step + V0, broad_phase_method_))
 		{
@@ -264,6 +457,11 @@ namespace polyfem::solver
 
 	void ContactForm::line_search_begin(const Eigen::VectorXd &x0, const Eigen::VectorXd &x1)
 	{
+		// the persistent candidates are used instead if they cover the step
+		if (update_persistent_candidates(compute_displaced_surface(x0), compute_displaced_surface(x1)))
+			return;
+
+		POLYFEM_SCOPED_TIMER(collision_timings_.broad_phase);
 		candidates_.build(
 			collision_mesh_,
 			compute_displaced_surface(x0),
@@ -328,11 +526,18 @@ namespace polyfem::solver
 			return true;
 		}
 
+		const bool use_persistent_candidates = !use_cached_candidates_ && update_persistent_candidates(displaced0, displaced1);
+
+		POLYFEM_SCOPED_TIMER(collision_timings_.ccd);
 		bool is_valid;
 		if (use_cached_candidates_)
 			is_valid = candidates_.is_step_collision_free(
 				collision_mesh_, displaced0, displaced1, dmin_,
 				ccd_tolerance_, ccd_max_iterations_);
+		else if (use_persistent_candidates)
+			is_valid = persistent_candidates_.is_step_collision_free(
+				collision_mesh_, displaced0, displaced1, dmin_,
+				ccd_tolerance_, ccd_max_iterations_);
 		else
 			is_valid = ipc::is_step_collision_free(
 				collision_mesh_, displaced0, displaced1, broad_phase_method_,
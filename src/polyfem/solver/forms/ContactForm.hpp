@@ -4,12 +4,15 @@
 
 #include <polyfem/Common.hpp>
 #include <polyfem/utils/Types.hpp>
+#include <polyfem/utils/Timer.hpp>
 
 #include <ipc/collisions/collisions.hpp>
 #include <ipc/collision_mesh.hpp>
 #include <ipc/broad_phase/broad_phase.hpp>
 #include <ipc/potentials/barrier_potential.hpp>
 
+#include <unordered_map>
+
 // map BroadPhaseMethod values to JSON as strings
 namespace ipc
 {
@@ -31,6 +34,22 @@ namespace ipc
 
 namespace polyfem::solver
 {
+	/// @brief Value and gradient wrt the vertices of a potential (barrier or friction) summed over the collisions,
+	/// in a single pass: the stencil of each collision is gathered once for both.
+	/// @param[in] potential Potential to evaluate
+	/// @param[in] collisions Collisions to sum over
+	/// @param[in] collision_mesh Collision mesh
+	/// @param[in] V Positions (or velocities for friction) of the collision mesh vertices
+	/// @param[out] grad Gradient wrt V, flattened row-wise
+	/// @return Value of the potential
+	template <typename Potential, typename Collisions>
+	double potential_value_and_gradient(
+		const Potential &potential,
+		const Collisions &collisions,
+		const ipc::CollisionMesh &collision_mesh,
+		const Eigen::MatrixXd &V,
+		Eigen::VectorXd &grad);
+
 	/// @brief Form representing the contact potential and forces
 	class ContactForm : public Form
 	{
@@ -80,6 +99,12 @@ namespace polyfem::solver
 		/// @param[out] gradv Output gradient of the value wrt x
 		virtual void first_derivative_unweighted(const Eigen::VectorXd &x, Eigen::VectorXd &gradv) const override;
 
+		/// @brief Compute the value and the first derivative wrt x at once
+		/// @param[in] x Current solution
+		/// @param[out] val Value of the contact barrier potential
+		/// @param[out] gradv Output gradient of the value wrt x
+		void value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const override;
+
 		/// @brief Compute the second derivative of the value wrt x
 		/// @param x Current solution
 		/// @param hessian Output Hessian of the value wrt x
@@ -141,6 +166,36 @@ namespace polyfem::solver
 		/// @brief If true, output debug files
 		bool save_ccd_debug_meshes = false;
 
+		/// @brief Reuse the local Hessian of the collisions whose vertices moved less than tol since it was computed
+		/// @param tol Maximum displacement (infinity norm) of the collision vertices, negative to disable the reuse
+		void set_incremental_hessian_tolerance(const double tol)
+		{
+			incremental_hessian_tol_ = tol;
+			hessian_blocks_.clear();
+		}
+		double incremental_hessian_tolerance() const { return incremental_hessian_tol_; }
+
+		/// @brief Keep the broad phase candidates between Newton iterations and time steps
+		/// The candidates are built with an extra inflation of skin and reused until a vertex moves more than skin
+		/// @param skin Extra inflation radius of the broad phase, non-positive to rebuild the candidates at every query
+		void set_broad_phase_skin(const double skin)
+		{
+			broad_phase_skin_ = skin;
+			persistent_candidates_.clear();
+			persistent_vertices_.resize(0, 0);
+		}
+		double broad_phase_skin() const { return broad_phase_skin_; }
+
+		/// @brief Accumulated time spent in the collision detection
+		struct CollisionTimings
+		{
+			utils::Timing broad_phase;  ///< candidates construction
+			utils::Timing narrow_phase; ///< collision set construction from the candidates
+			utils::Timing ccd;          ///< continuous collision detection (includes its broad phase if the candidates are not cached)
+		};
+		const CollisionTimings &collision_timings() const { return collision_timings_; }
+		void reset_collision_timings() { collision_timings_ = CollisionTimings(); }
+
 		double dhat() const { return dhat_; }
 		const ipc::Collisions &collision_set() const { return collision_set_; }
 		const ipc::BarrierPotential &barrier_potential() const { return barrier_potential_; }
@@ -193,5 +248,53 @@ namespace polyfem::solver
 		ipc::Candidates candidates_;
 
 		const ipc::BarrierPotential barrier_potential_;
+
+	private:
+		/// @brief Make sure the persistent candidates contain all the pairs of the trajectory V0 -> V1, rebuilding them if needed
+		/// @return False if the trajectory is too long to be covered by the skin
+		bool update_persistent_candidates(const Eigen::MatrixXd &V0, const Eigen::MatrixXd &V1) const;
+
+		/// @brief Assemble the Hessian reusing the cached local Hessians of the collisions that did not move
+		/// @param V Displaced surface vertices
+		/// @return Hessian in the collision mesh dofs
+		StiffnessMatrix incremental_hessian(const Eigen::MatrixXd &V) const;
+
+		/// @brief Identifies a collision by its type and vertices
+		struct CollisionKey
+		{
+			size_t type;
+			std::array<long, 4> vertex_ids;
+
+			bool operator==(const CollisionKey &other) const { return type == other.type && vertex_ids == other.vertex_ids; }
+		};
+
+		struct CollisionKeyHash
+		{
+			size_t operator()(const CollisionKey &key) const;
+		};
+
+		/// @brief Local Hessian of a collision and the vertex positions it was computed at
+		struct HessianBlock
+		{
+			ipc::VectorMax12d dof;
+			ipc::MatrixMax12d hessian;
+			double weight;
+		};
+
+		/// @brief Maximum vertex displacement to reuse a local Hessian, negative to disable
+		double incremental_hessian_tol_ = -1;
+		/// @brief Local Hessians of the active collisions at the last Hessian evaluation
+		mutable std::unordered_map<CollisionKey, HessianBlock, CollisionKeyHash> hessian_blocks_;
+		/// @brief PSD projection used for the cached local Hessians
+		mutable bool hessian_blocks_psd_ = false;
+
+		/// @brief Extra inflation of the persistent broad phase, non-positive to disable it
+		double broad_phase_skin_ = -1;
+		/// @brief Candidates built with an inflation radius dhat / 2 + skin around persistent_vertices_
+		mutable ipc::Candidates persistent_candidates_;
+		/// @brief Vertex positions the persistent candidates were built at
+		mutable Eigen::MatrixXd persistent_vertices_;
+
+		mutable CollisionTimings collision_timings_;
 	};
 } // namespace polyfem::solver
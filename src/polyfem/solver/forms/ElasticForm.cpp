@@ -76,6 +76,14 @@ namespace polyfem::solver
 		gradv = grad;
 	}
 
+	void ElasticForm::value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const
+	{
+		Eigen::MatrixXd grad;
+		val = assembler_.assemble_energy_and_gradient(is_volume_, n_bases_, bases_, geom_bases_,
+													  ass_vals_cache_, t_, dt_, x, x_prev_, grad);
+		gradv = grad;
+	}
+
 	void ElasticForm::second_derivative_unweighted(const Eigen::VectorXd &x, StiffnessMatrix &hessian) const
 	{
 		POLYFEM_SCOPED_TIMER("elastic hessian");
@@ -96,6 +104,44 @@ namespace polyfem::solver
 		}
 	}
 
+	void ElasticForm::second_derivative_apply_unweighted(const Eigen::VectorXd &x, const Eigen::VectorXd &v, Eigen::VectorXd &out) const
+	{
+		POLYFEM_SCOPED_TIMER("elastic hessian apply");
+
+		if (assembler_.is_linear())
+		{
+			assert(cached_stiffness_.rows() == x.size() && cached_stiffness_.cols() == x.size());
+			out = cached_stiffness_ * v;
+		}
+		else
+		{
+			Eigen::MatrixXd tmp;
+			assembler_.assemble_hessian_apply(
+				is_volume_, n_bases_, project_to_psd_, bases_,
+				geom_bases_, ass_vals_cache_, t_, dt_, x, x_prev_, v, tmp);
+			out = tmp;
+		}
+	}
+
+	void ElasticForm::second_derivative_diagonal_unweighted(const Eigen::VectorXd &x, Eigen::VectorXd &diag) const
+	{
+		POLYFEM_SCOPED_TIMER("elastic hessian diagonal");
+
+		if (assembler_.is_linear())
+		{
+			assert(cached_stiffness_.rows() == x.size() && cached_stiffness_.cols() == x.size());
+			diag = cached_stiffness_.diagonal();
+		}
+		else
+		{
+			Eigen::MatrixXd tmp;
+			assembler_.assemble_hessian_diagonal(
+				is_volume_, n_bases_, project_to_psd_, bases_,
+				geom_bases_, ass_vals_cache_, t_, dt_, x, x_prev_, tmp);
+			diag = tmp;
+		}
+	}
+
 	bool ElasticForm::is_step_valid(const Eigen::VectorXd &, const Eigen::VectorXd &x1) const
 	{
 		Eigen::VectorXd grad;
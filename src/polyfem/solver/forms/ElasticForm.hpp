@@ -42,11 +42,28 @@ namespace polyfem::solver
 		/// @param[out] gradv Output gradient of the value wrt x
 		virtual void first_derivative_unweighted(const Eigen::VectorXd &x, Eigen::VectorXd &gradv) const override;
 
+		/// @brief Compute the value and the first derivative wrt x at once, the element values are computed once
+		/// @param[in] x Current solution
+		/// @param[out] val Computed value
+		/// @param[out] gradv Output gradient of the value wrt x
+		void value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const override;
+
 		/// @brief Compute the second derivative of the value wrt x
 		/// @param[in] x Current solution
 		/// @param[out] hessian Output Hessian of the value wrt x
 		void second_derivative_unweighted(const Eigen::VectorXd &x, StiffnessMatrix &hessian) const override;
 
+		/// @brief Compute the product of the second derivative wrt x with v, without assembling the Hessian
+		/// @param[in] x Current solution
+		/// @param[in] v Vector to multiply
+		/// @param[out] out Output product of the Hessian of the value wrt x with v
+		void second_derivative_apply_unweighted(const Eigen::VectorXd &x, const Eigen::VectorXd &v, Eigen::VectorXd &out) const override;
+
+		/// @brief Compute the diagonal of the second derivative wrt x, without assembling the Hessian
+		/// @param[in] x Current solution
+		/// @param[out] diag Output diagonal of the Hessian of the value wrt x
+		void second_derivative_diagonal_unweighted(const Eigen::VectorXd &x, Eigen::VectorXd &diag) const override;
+
 	public:
 		/// @brief Determine if a step from solution x0 to solution x1 is allowed
 		/// @param x0 Current solution
@@ -43,6 +43,17 @@ namespace polyfem::solver
 			gradv *= weight();
 		}
 
+		/// @brief Compute the value and the first derivative wrt x at once, both multiplied with the weigth
+		/// @param[in] x Current solution
+		/// @param[out] val Computed value
+		/// @param[out] gradv Output gradient of the value wrt x
+		inline void value_and_first_derivative(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const
+		{
+			value_and_first_derivative_unweighted(x, val, gradv);
+			val *= weight();
+			gradv *= weight();
+		}
+
 		/// @brief Compute the second derivative of the value wrt x multiplied with the weigth
 		/// @note This is not marked const because ElasticForm needs to cache the matrix assembly.
 		/// @param[in] x Current solution
@@ -53,6 +64,25 @@ namespace polyfem::solver
 			hessian *= weight();
 		}
 
+		/// @brief Compute the product of the second derivative with v multiplied with the weigth
+		/// @param[in] x Current solution
+		/// @param[in] v Vector to multiply
+		/// @param[out] out Output product of the Hessian of the value wrt x with v
+		inline void second_derivative_apply(const Eigen::VectorXd &x, const Eigen::VectorXd &v, Eigen::VectorXd &out) const
+		{
+			second_derivative_apply_unweighted(x, v, out);
+			out *= weight();
+		}
+
+		/// @brief Compute the diagonal of the second derivative multiplied with the weigth
+		/// @param[in] x Current solution
+		/// @param[out] diag Output diagonal of the Hessian of the value wrt x
+		inline void second_derivative_diagonal(const Eigen::VectorXd &x, Eigen::VectorXd &diag) const
+		{
+			second_derivative_diagonal_unweighted(x, diag);
+			diag *= weight();
+		}
+
 		/// @brief Determine if a step from solution x0 to solution x1 is allowed
 		/// @param x0 Current solution
 		/// @param x1 Proposed next solution
@@ -176,9 +206,43 @@ namespace polyfem::solver
 		/// @param[out] gradv Output gradient of the value wrt x
 		virtual void first_derivative_unweighted(const Eigen::VectorXd &x, Eigen::VectorXd &gradv) const = 0;
 
+		/// @brief Compute the value and the first derivative wrt x at once
+		/// @note The default implementation computes them separately, forms should override it to share the intermediates.
+		/// @param[in] x Current solution
+		/// @param[out] val Computed value
+		/// @param[out] gradv Output gradient of the value wrt x
+		virtual void value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const
+		{
+			val = value_unweighted(x);
+			first_derivative_unweighted(x, gradv);
+		}
+
 		/// @brief Compute the second derivative of the value wrt x
 		/// @param[in] x Current solution
 		/// @param[out] hessian Output Hessian of the value wrt x
 		virtual void second_derivative_unweighted(const Eigen::VectorXd &x, StiffnessMatrix &hessian) const = 0;
+
+		/// @brief Compute the product of the second derivative wrt x with v
+		/// @note The default implementation assembles the Hessian, forms should override it to avoid the assembly.
+		/// @param[in] x Current solution
+		/// @param[in] v Vector to multiply
+		/// @param[out] out Output product of the Hessian of the value wrt x with v
+		virtual void second_derivative_apply_unweighted(const Eigen::VectorXd &x, const Eigen::VectorXd &v, Eigen::VectorXd &out) const
+		{
+			StiffnessMatrix hessian;
+			second_derivative_unweighted(x, hessian);
+			out = hessian * v;
+		}
+
+		/// @brief Compute the diagonal of the second derivative wrt x
+		/// @note The default implementation assembles the Hessian, forms should override it to avoid the assembly.
+		/// @param[in] x Current solution
+		/// @param[out] diag Output diagonal of the Hessian of the value wrt x
+		virtual void second_derivative_diagonal_unweighted(const Eigen::VectorXd &x, Eigen::VectorXd &diag) const
+		{
+			StiffnessMatrix hessian;
+			second_derivative_unweighted(x, hessian);
+			diag = hessian.diagonal();
+		}
 	};
 } // namespace polyfem::solver
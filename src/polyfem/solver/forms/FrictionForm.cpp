@@ -114,6 +114,15 @@ namespace polyfem::solver
 		gradv = collision_mesh_.to_full_dof(grad_friction);
 	}
 
+	void FrictionForm::value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const
+	{
+		Eigen::VectorXd grad_friction;
+		val = potential_value_and_gradient(
+				  friction_potential_, friction_collision_set_, collision_mesh_, compute_surface_velocities(x), grad_friction)
+			  / dv_dx();
+		gradv = collision_mesh_.to_full_dof(grad_friction);
+	}
+
 	void FrictionForm::second_derivative_unweighted(const Eigen::VectorXd &x, StiffnessMatrix &hessian) const
 	{
 		POLYFEM_SCOPED_TIMER("friction hessian");
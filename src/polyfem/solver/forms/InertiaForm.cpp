@@ -52,6 +52,13 @@ namespace polyfem::solver
 		gradv = mass_ * (x - time_integrator_.x_tilde());
 	}
 
+	void InertiaForm::value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const
+	{
+		const Eigen::VectorXd tmp = x - time_integrator_.x_tilde();
+		gradv = mass_ * tmp;
+		val = 0.5 * tmp.dot(gradv);
+	}
+
 	void InertiaForm::second_derivative_unweighted(const Eigen::VectorXd &x, StiffnessMatrix &hessian) const
 	{
 		hessian = mass_;
@@ -56,6 +56,12 @@ namespace polyfem::solver
 		/// @param[out] gradv Output gradient of the value wrt x
 		void first_derivative_unweighted(const Eigen::VectorXd &x, Eigen::VectorXd &gradv) const override;
 
+		/// @brief Compute the value and the first derivative wrt x at once, with a single product with the mass matrix
+		/// @param[in] x Current solution
+		/// @param[out] val Value of the inertia
+		/// @param[out] gradv Output gradient of the value wrt x
+		void value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const override;
+
 		/// @brief Compute the second derivative of the value wrt x
 		/// @param[in] x Current solution
 		/// @param[out] hessian Output Hessian of the value wrt x
@@ -113,6 +113,12 @@ namespace polyfem::solver
         gradv = tiled_to_single_grad(gradv);
     }
 
+    void PeriodicContactForm::value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const
+    {
+        ContactForm::value_and_first_derivative_unweighted(single_to_tiled(x), val, gradv);
+        gradv = tiled_to_single_grad(gradv);
+    }
+
     void PeriodicContactForm::second_derivative_unweighted(const Eigen::VectorXd &x, StiffnessMatrix &hessian) const
     {
         StiffnessMatrix hessian_full;
@@ -47,6 +47,12 @@ namespace polyfem::solver
 		/// @param[out] gradv Output gradient of the value wrt x
 		void first_derivative_unweighted(const Eigen::VectorXd &x, Eigen::VectorXd &gradv) const override;
 
+		/// @brief Compute the value and the first derivative wrt x at once
+		/// @param[in] x Current solution
+		/// @param[out] val Value of the contact barrier potential
+		/// @param[out] gradv Output gradient of the value wrt x
+		void value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const override;
+
 		/// @brief Compute the second derivative of the value wrt x
 		/// @param x Current solution
 		/// @param hessian Output Hessian of the value wrt x
@@ -221,8 +221,7 @@ namespace polyfem::solver
 
 					normal = normal * vals.jac_it[0]; // assuming linear geometry
 
-					for (int q = 0; q < u.rows(); q++)
-						interpolation_fn->cache_grid([this](const Eigen::MatrixXd &point, double &distance) { compute_distance(point, distance); }, vals.val.row(q) + u.row(q));
+					interpolation_fn->cache_grid_batch([this](const Eigen::MatrixXd &point, double &distance) { compute_distance(point, distance); }, vals.val + u);
 				}
 			}
 		});
@@ -345,27 +344,17 @@ namespace polyfem::solver
 	{
 		IntegrableFunctional j;
 		auto j_func = [this](const Eigen::MatrixXd &local_pts, const Eigen::MatrixXd &pts, const Eigen::MatrixXd &u, const Eigen::MatrixXd &grad_u, const Eigen::VectorXd &lambda, const Eigen::VectorXd &mu, const Eigen::MatrixXd &reference_normals, const assembler::ElementAssemblyValues &vals, const IntegrableFunctional::ParameterType &params, Eigen::MatrixXd &val) {
-			val.setZero(u.rows(), 1);
-
-			for (int q = 0; q < u.rows(); q++)
-			{
-				double distance;
-				Eigen::MatrixXd unused_grad;
-				interpolation_fn->evaluate(u.row(q) + pts.row(q), distance, unused_grad);
-				val(q) = pow(distance, 2);
-			}
+			Eigen::VectorXd distance;
+			Eigen::MatrixXd unused_grad;
+			interpolation_fn->evaluate_batch(u + pts, distance, unused_grad);
+			val = distance.array().square();
 		};
 
 		auto djdu_func = [this](const Eigen::MatrixXd &local_pts, const Eigen::MatrixXd &pts, const Eigen::MatrixXd &u, const Eigen::MatrixXd &grad_u, const Eigen::VectorXd &lambda, const Eigen::VectorXd &mu, const Eigen::MatrixXd &reference_normals, const assembler::ElementAssemblyValues &vals, const IntegrableFunctional::ParameterType &params, Eigen::MatrixXd &val) {
-			val.setZero(u.rows(), u.cols());
-
-			for (int q = 0; q < u.rows(); q++)
-			{
-				double distance;
-				Eigen::MatrixXd grad;
-				interpolation_fn->evaluate(u.row(q) + pts.row(q), distance, grad);
-				val.row(q) = 2 * distance * grad.transpose();
-			}
+			Eigen::VectorXd distance;
+			Eigen::MatrixXd grad;
+			interpolation_fn->evaluate_batch(u + pts, distance, grad);
+			val = 2 * distance.asDiagonal() * grad;
 		};
 
 		j.set_j(j_func);
@@ -424,13 +413,12 @@ namespace polyfem::solver
 
 					normal = normal * vals.jac_it[0]; // assuming linear geometry
 
-					for (int q = 0; q < u.rows(); q++)
-						interpolation_fn->cache_grid([this](const Eigen::MatrixXd &point, double &distance) {
-							int idx;
-							Eigen::Matrix<double, 1, 3> closest;
-							distance = pow(tree_.squared_distance(V_, F_, point.col(0), idx, closest), 0.5);
-						},
-													 vals.val.row(q) + u.row(q));
+					interpolation_fn->cache_grid_batch([this](const Eigen::MatrixXd &point, double &distance) {
+						int idx;
+						Eigen::Matrix<double, 1, 3> closest;
+						distance = pow(tree_.squared_distance(V_, F_, point.col(0), idx, closest), 0.5);
+					},
+													   vals.val + u);
 				}
 			}
 		});
@@ -440,27 +428,17 @@ namespace polyfem::solver
 	{
 		IntegrableFunctional j;
 		auto j_func = [this](const Eigen::MatrixXd &local_pts, const Eigen::MatrixXd &pts, const Eigen::MatrixXd &u, const Eigen::MatrixXd &grad_u, const Eigen::VectorXd &lambda, const Eigen::VectorXd &mu, const Eigen::MatrixXd &reference_normals, const assembler::ElementAssemblyValues &vals, const IntegrableFunctional::ParameterType &params, Eigen::MatrixXd &val) {
-			val.setZero(u.rows(), 1);
-
-			for (int q = 0; q < u.rows(); q++)
-			{
-				double distance;
-				Eigen::MatrixXd unused_grad;
-				interpolation_fn->evaluate(u.row(q) + pts.row(q), distance, unused_grad);
-				val(q) = pow(distance, 2);
-			}
+			Eigen::VectorXd distance;
+			Eigen::MatrixXd unused_grad;
+			interpolation_fn->evaluate_batch(u + pts, distance, unused_grad);
+			val = distance.array().square();
 		};
 
 		auto djdu_func = [this](const Eigen::MatrixXd &local_pts, const Eigen::MatrixXd &pts, const Eigen::MatrixXd &u, const Eigen::MatrixXd &grad_u, const Eigen::VectorXd &lambda, const Eigen::VectorXd &mu, const Eigen::MatrixXd &reference_normals, const assembler::ElementAssemblyValues &vals, const IntegrableFunctional::ParameterType &params, Eigen::MatrixXd &val) {
-			val.setZero(u.rows(), u.cols());
-
-			for (int q = 0; q < u.rows(); q++)
-			{
-				double distance;
-				Eigen::MatrixXd grad;
-				interpolation_fn->evaluate(u.row(q) + pts.row(q), distance, grad);
-				val.row(q) = 2 * distance * grad.transpose();
-			}
+			Eigen::VectorXd distance;
+			Eigen::MatrixXd grad;
+			interpolation_fn->evaluate_batch(u + pts, distance, grad);
+			val = 2 * distance.asDiagonal() * grad;
 		};
 
 		j.set_j(j_func);
@@ -4,6 +4,10 @@
 #include <polyfem/utils/Logger.hpp>
 #include <polyfem/Common.hpp>
 #include <polyfem/utils/ElasticityUtils.hpp>
+#include <polyfem/utils/MaybeParallelFor.hpp>
+
+#include <algorithm>
+#include <cstdint>
 
 namespace polyfem::solver
 {
@@ -413,7 +417,8 @@ namespace polyfem::solver
 
 	LinearFilter::LinearFilter(const mesh::Mesh &mesh, const double radius)
 	{
-		std::vector<Eigen::Triplet<double>> tt_adjacency_list;
+		if (radius <= 0)
+			log_and_throw_adjoint_error("Filter radius must be positive!");
 
 		Eigen::MatrixXd barycenters;
 		if (mesh.is_volume())
@@ -423,41 +428,108 @@ namespace polyfem::solver
 
 		RowVectorNd min, max;
 		mesh.bounding_box(min, max);
-		// TODO: more efficient way
-		for (int i = 0; i < barycenters.rows(); i++)
+
+		// uniform grid of cells at least radius wide, the neighbors of a barycenter are in the 3^dim cells around its own.
+		// The resolution is clamped so that the linear cell indices (below 2^60) fit in 64 bits, the cells are wider for tiny radii.
+		constexpr std::int64_t max_cells_per_axis = std::int64_t(1) << 20;
+		const int n = barycenters.rows();
+		const int dim = barycenters.cols();
+		using Cell = Eigen::Matrix<std::int64_t, 3, 1>;
+		Cell grid_size = Cell::Ones();
+		Eigen::Vector3d cell_width = Eigen::Vector3d::Constant(radius);
+		for (int d = 0; d < dim; ++d)
 		{
-			auto center_i = barycenters.row(i);
-			for (int j = 0; j <= i; j++)
+			const double extent = max(d) - min(d);
+			cell_width(d) = std::max(radius, extent / (max_cells_per_axis - 1));
+			grid_size(d) = std::min(std::int64_t(extent / cell_width(d)) + 1, max_cells_per_axis);
+		}
+
+		const auto cell_coords = [&](const int i) {
+			Cell coords = Cell::Zero();
+			for (int d = 0; d < dim; ++d)
+				coords(d) = std::clamp(std::int64_t((barycenters(i, d) - min(d)) / cell_width(d)), std::int64_t(0), grid_size(d) - 1);
+			return coords;
+		};
+		const auto cell_index = [&](const Cell &coords) {
+			return (coords(2) * grid_size(1) + coords(1)) * grid_size(0) + coords(0);
+		};
+
+		// barycenters sorted by cell
+		std::vector<std::pair<std::int64_t, int>> cells(n);
+		for (int i = 0; i < n; ++i)
+			cells[i] = std::make_pair(cell_index(cell_coords(i)), i);
+		std::sort(cells.begin(), cells.end());
+
+		std::vector<std::vector<std::pair<int, double>>> rows(n);
+		utils::maybe_parallel_for(n, [&](int start, int end, int thread_id) {
+			for (int i = start; i < end; ++i)
 			{
-				auto center_j = barycenters.row(j);
-				double dist = 0;
-				dist = (center_i - center_j).norm();
-				if (dist < radius)
+				const Cell coords = cell_coords(i);
+				std::vector<std::pair<int, double>> &row = rows[i];
+
+				Cell lo = Cell::Zero(), hi = Cell::Zero();
+				for (int d = 0; d < dim; ++d)
 				{
-					tt_adjacency_list.emplace_back(i, j, radius - dist);
-					if (i != j)
-						tt_adjacency_list.emplace_back(j, i, radius - dist);
+					lo(d) = std::max(coords(d) - 1, std::int64_t(0));
+					hi(d) = std::min(coords(d) + 1, grid_size(d) - 1);
 				}
-			}
-		}
-		tt_radius_adjacency.resize(barycenters.rows(), barycenters.rows());
-		tt_radius_adjacency.setFromTriplets(tt_adjacency_list.begin(), tt_adjacency_list.end());
 
-		tt_radius_adjacency_row_sum.setZero(tt_radius_adjacency.rows());
-		for (int i = 0; i < tt_radius_adjacency.rows(); i++)
-			tt_radius_adjacency_row_sum(i) = tt_radius_adjacency.row(i).sum();
+				Cell c;
+				for (c(2) = lo(2); c(2) <= hi(2); ++c(2))
+					for (c(1) = lo(1); c(1) <= hi(1); ++c(1))
+						for (c(0) = lo(0); c(0) <= hi(0); ++c(0))
+						{
+							const std::int64_t key = cell_index(c);
+							auto it = std::lower_bound(cells.begin(), cells.end(), std::make_pair(key, 0));
+							for (; it != cells.end() && it->first == key; ++it)
+							{
+								const double dist = (barycenters.row(i) - barycenters.row(it->second)).norm();
+								if (dist < radius)
+									row.emplace_back(it->second, radius - dist);
+							}
+						}
+
+				std::sort(row.begin(), row.end());
+
+				double row_sum = 0;
+				for (const auto &[j, w] : row)
+					row_sum += w;
+				for (auto &[j, w] : row)
+					w /= row_sum;
+			}
+		});
+
+		// rows are directly copied in the compressed row storage
+		tt_radius_adjacency.resize(n, n);
+		tt_radius_adjacency.makeCompressed();
+		auto *outer = tt_radius_adjacency.outerIndexPtr();
+		outer[0] = 0;
+		for (int i = 0; i < n; ++i)
+			outer[i + 1] = outer[i] + rows[i].size();
+		tt_radius_adjacency.resizeNonZeros(outer[n]);
+
+		utils::maybe_parallel_for(n, [&](int start, int end, int thread_id) {
+			for (int i = start; i < end; ++i)
+			{
+				for (size_t k = 0; k < rows[i].size(); ++k)
+				{
+					tt_radius_adjacency.innerIndexPtr()[outer[i] + k] = rows[i][k].first;
+					tt_radius_adjacency.valuePtr()[outer[i] + k] = rows[i][k].second;
+				}
+			}
+		});
 	}
 
 	Eigen::VectorXd LinearFilter::eval(const Eigen::VectorXd &x) const
 	{
 		assert(x.size() == tt_radius_adjacency.rows());
-		return (tt_radius_adjacency * x).array() / tt_radius_adjacency_row_sum.array();
+		return tt_radius_adjacency * x;
 	}
 
 	Eigen::VectorXd LinearFilter::apply_jacobian(const Eigen::VectorXd &grad, const Eigen::VectorXd &x) const
 	{
 		assert(x.size() == tt_radius_adjacency.rows());
-		return (tt_radius_adjacency * grad).array() / tt_radius_adjacency_row_sum.array();
+		return tt_radius_adjacency * grad;
 	}
 
 	Eigen::VectorXd ScalarVelocityParametrization::inverse_eval(const Eigen::VectorXd &y)
@@ -164,8 +164,8 @@ namespace polyfem::solver
 		Eigen::VectorXd apply_jacobian(const Eigen::VectorXd &grad, const Eigen::VectorXd &x) const override;
 
 	private:
-		Eigen::SparseMatrix<double> tt_radius_adjacency;
-		Eigen::VectorXd tt_radius_adjacency_row_sum;
+		/// weights radius - distance between the barycenters closer than radius, divided by the row sums
+		Eigen::SparseMatrix<double, Eigen::RowMajor> tt_radius_adjacency;
 	};
 
 	class ScalarVelocityParametrization : public Parametrization
@@ -101,7 +101,14 @@ namespace polyfem
 	{
 		StiffnessMatrix gradu_h(sol.size(), sol.size());
 		if (current_step == 0)
+		{
+			const json &adjoint_storage = args["solver"]["advanced"]["adjoint_storage"];
+			diff_cached.set_storage(
+				adjoint_storage["type"] == "disk" ? solver::DiffCache::Storage::Disk : solver::DiffCache::Storage::Memory,
+				adjoint_storage["memory_steps"],
+				adjoint_storage["directory"].get<std::string>().empty() ? "" : resolve_output_path(adjoint_storage["directory"]));
 			diff_cached.init(mesh->dimension(), ndof(), problem->is_time_dependent() ? args["time"]["time_steps"].get<int>() : 0);
+		}
 
 		ipc::Collisions cur_collision_set;
 		ipc::FrictionCollisions cur_friction_set;
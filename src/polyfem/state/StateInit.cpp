@@ -221,11 +221,15 @@ namespace polyfem
 
 		const unsigned int thread_in = this->args["solver"]["max_threads"];
 		set_max_threads(thread_in);
+		NThread::get().set_affinity(thread_affinity_from_string(this->args["solver"]["thread_affinity"]));
 
 		has_dhat = args_in["contact"].contains("dhat");
 
 		init_time();
 
+		const std::string snapshot_path = resolve_input_path(args["input"]["data"]["snapshot"]);
+		input_snapshot = snapshot_path.empty() ? nullptr : std::make_shared<io::SnapshotReader>(snapshot_path);
+
 		if (is_contact_enabled())
 		{
 			if (args["solver"]["contact"]["friction_iterations"] == 0)
@@ -71,6 +71,7 @@ namespace polyfem
 		set_materials(assemblers);
 
 		timer.stop();
+		timings.loading_mesh_time = timer.getElapsedTime();
 		logger().info(" took {}s", timer.getElapsedTime());
 
 		timer.start();
@@ -83,9 +84,11 @@ namespace polyfem
 			args["root_path"], mesh->dimension());
 
 		timer.stop();
+		timings.loading_mesh_time += timer.getElapsedTime();
 		logger().info(" took {}s", timer.getElapsedTime());
 
 		out_geom.init_sampler(*mesh, args["output"]["paraview"]["vismesh_rel_area"]);
+		out_geom.set_async_writes(args["output"]["paraview"]["async_writes"], args["output"]["paraview"]["options"]["use_hdf5"]);
 	}
 
 	void State::load_mesh(bool non_conforming,
@@ -102,7 +105,9 @@ namespace polyfem
 		timer.start();
 
 		logger().info("Loading mesh ...");
-		if (mesh == nullptr)
+		if (mesh == nullptr && load_mesh_from_snapshot(non_conforming))
+			logger().info("Mesh loaded from snapshot {}", input_snapshot->path());
+		else if (mesh == nullptr)
 		{
 			assert(is_param_valid(args, "geometry"));
 			mesh = mesh::read_fem_geometry(
@@ -139,9 +144,11 @@ namespace polyfem
 		set_materials(assemblers);
 
 		timer.stop();
+		timings.loading_mesh_time = timer.getElapsedTime();
 		logger().info(" took {}s", timer.getElapsedTime());
 
 		out_geom.init_sampler(*mesh, args["output"]["paraview"]["vismesh_rel_area"]);
+		out_geom.set_async_writes(args["output"]["paraview"]["async_writes"], args["output"]["paraview"]["options"]["use_hdf5"]);
 
 		timer.start();
 		logger().info("Loading obstacles...");
@@ -152,6 +159,7 @@ namespace polyfem
 			utils::json_as_array(args["boundary_conditions"]["dirichlet_boundary"]),
 			args["root_path"], mesh->dimension(), names, vertices, cells);
 		timer.stop();
+		timings.loading_mesh_time += timer.getElapsedTime();
 		logger().info(" took {}s", timer.getElapsedTime());
 	}
 
@@ -173,6 +173,8 @@ namespace polyfem
 			stress_path,
 			mises_path,
 			is_contact_enabled(), solution_frames);
+
+		out_geom.flush_writes();
 	}
 
 	void State::save_restart_json(const double t0, const double dt, const int t) const
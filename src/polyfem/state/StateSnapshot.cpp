@@ -0,0 +1,206 @@
+#include <polyfem/State.hpp>
+
+#include <polyfem/time_integrator/ImplicitTimeIntegrator.hpp>
+#include <polyfem/utils/Timer.hpp>
+
+namespace polyfem
+{
+	using namespace io;
+	using namespace mesh;
+
+	namespace
+	{
+		/// position of the finite element nodes, taken from the first element referencing them
+		Eigen::MatrixXd node_positions(const std::vector<basis::ElementBases> &bases, const int n_nodes, const int dim)
+		{
+			Eigen::MatrixXd positions = Eigen::MatrixXd::Zero(n_nodes, dim);
+			std::vector<bool> visited(n_nodes, false);
+			for (const auto &bs : bases)
+				for (const auto &b : bs.bases)
+					for (const auto &lg : b.global())
+						if (lg.index >= 0 && lg.index < n_nodes && !visited[lg.index])
+						{
+							positions.row(lg.index) = lg.node;
+							visited[lg.index] = true;
+						}
+			return positions;
+		}
+
+		/// local boundaries as (element, type, number of primitives) and (global, local) primitive ids
+		void local_boundary_arrays(const std::vector<LocalBoundary> &local_boundary, Eigen::MatrixXi &elements, Eigen::MatrixXi &primitives)
+		{
+			int n_primitives = 0;
+			for (const auto &lb : local_boundary)
+				n_primitives += lb.size();
+
+			elements.resize(local_boundary.size(), 3);
+			primitives.resize(n_primitives, 2);
+			int index = 0;
+			for (int i = 0; i < local_boundary.size(); ++i)
+			{
+				const LocalBoundary &lb = local_boundary[i];
+				elements.row(i) << lb.element_id(), int(lb.type()), lb.size();
+				for (int j = 0; j < lb.size(); ++j, ++index)
+					primitives.row(index) << lb.global_primitive_id(j), lb.local_primitive_id(j);
+			}
+		}
+
+		template <typename A, typename B>
+		bool same_matrix(const A &a, const B &b)
+		{
+			return a.rows() == b.rows() && a.cols() == b.cols() && a == b;
+		}
+
+		Eigen::MatrixXd history(const std::deque<Eigen::VectorXd> &prevs)
+		{
+			Eigen::MatrixXd res(prevs.empty() ? 0 : prevs.front().size(), prevs.size());
+			for (int i = 0; i < prevs.size(); ++i)
+				res.col(i) = prevs[i];
+			return res;
+		}
+
+		/// the snapshot mesh is recreated from its vertices and cells, only possible for linear conforming meshes with one element type
+		bool can_save_mesh(const Mesh &mesh)
+		{
+			if (!mesh.is_conforming() || mesh.has_poly() || !mesh.is_linear() || mesh.is_rational() || mesh.n_elements() == 0)
+				return false;
+
+			const int n_vertices = mesh.n_cell_vertices(0);
+			for (int e = 1; e < mesh.n_elements(); ++e)
+				if (mesh.n_cell_vertices(e) != n_vertices)
+					return false;
+			return true;
+		}
+	} // namespace
+
+	void State::save_snapshot(const std::string &path, const double t0, const double dt, const int t) const
+	{
+		POLYFEM_SCOPED_TIMER("Saving snapshot");
+
+		SnapshotWriter writer;
+
+		const int time_steps = args["time"]["time_steps"];
+		writer.add("time", Eigen::MatrixXd(Eigen::RowVector3d(t0 + dt * t, dt, time_steps - t)));
+
+		if (can_save_mesh(*mesh))
+		{
+			const int n_cell_vertices = mesh->n_cell_vertices(0);
+			Eigen::MatrixXd V(mesh->n_vertices(), mesh->dimension());
+			for (int v = 0; v < mesh->n_vertices(); ++v)
+				V.row(v) = mesh->point(v);
+			Eigen::MatrixXi cells(mesh->n_elements(), n_cell_vertices);
+			for (int e = 0; e < mesh->n_elements(); ++e)
+				for (int lv = 0; lv < n_cell_vertices; ++lv)
+					cells(e, lv) = mesh->element_vertex(e, lv);
+
+			writer.add("mesh/vertices", V);
+			writer.add("mesh/cells", cells);
+			if (mesh->has_body_ids())
+				writer.add("mesh/body_ids", mesh->get_body_ids());
+			if (mesh->has_boundary_ids())
+			{
+				std::vector<int> boundary_ids(mesh->n_boundary_elements());
+				for (int i = 0; i < boundary_ids.size(); ++i)
+					boundary_ids[i] = mesh->get_boundary_id(i);
+				writer.add("mesh/boundary_ids", boundary_ids);
+			}
+		}
+		else
+			logger().debug("The mesh cannot be stored in the snapshot, it will be loaded from the input geometry on restart");
+
+		writer.add("n_bases", Eigen::MatrixXi(Eigen::MatrixXi::Constant(1, 1, n_bases)));
+		writer.add("nodes", node_positions(bases, n_bases - obstacle.n_vertices(), mesh->dimension()));
+		if (in_node_to_node.size() > 0)
+		{
+			writer.add("in_node_to_node", Eigen::MatrixXi(in_node_to_node));
+			writer.add("in_primitive_to_primitive", Eigen::MatrixXi(in_primitive_to_primitive));
+		}
+
+		writer.add("boundary_nodes", boundary_nodes);
+		Eigen::MatrixXi lb_elements, lb_primitives;
+		local_boundary_arrays(local_boundary, lb_elements, lb_primitives);
+		writer.add("local_boundary/elements", lb_elements);
+		writer.add("local_boundary/primitives", lb_primitives);
+
+		if (collision_mesh_data.vertices.size() > 0)
+		{
+			const auto &entries = collision_mesh_data.displacement_map_entries;
+			Eigen::MatrixXd displacement_map(entries.size(), 3);
+			for (int i = 0; i < entries.size(); ++i)
+				displacement_map.row(i) << entries[i].row(), entries[i].col(), entries[i].value();
+
+			writer.add("collision_mesh/vertices", collision_mesh_data.vertices);
+			writer.add("collision_mesh/codim_vertices", Eigen::MatrixXi(collision_mesh_data.codim_vertices));
+			writer.add("collision_mesh/edges", collision_mesh_data.edges);
+			writer.add("collision_mesh/faces", collision_mesh_data.faces);
+			writer.add("collision_mesh/displacement_map", displacement_map);
+			writer.add("collision_mesh/num_fe_vertices", Eigen::MatrixXi(Eigen::MatrixXi::Constant(1, 1, collision_mesh_data.num_fe_vertices)));
+		}
+
+		if (solve_data.time_integrator)
+		{
+			writer.add("u", history(solve_data.time_integrator->x_prevs()));
+			writer.add("v", history(solve_data.time_integrator->v_prevs()));
+			writer.add("a", history(solve_data.time_integrator->a_prevs()));
+		}
+
+		writer.write(path);
+	}
+
+	bool State::load_mesh_from_snapshot(const bool non_conforming)
+	{
+		if (!input_snapshot || !input_snapshot->has("mesh/vertices"))
+			return false;
+
+		mesh = Mesh::create(
+			Eigen::MatrixXd(input_snapshot->matrix("mesh/vertices")),
+			Eigen::MatrixXi(input_snapshot->imatrix("mesh/cells")),
+			non_conforming);
+		if (mesh == nullptr)
+			return false;
+
+		if (input_snapshot->has("mesh/body_ids"))
+			mesh->set_body_ids(input_snapshot->ivector("mesh/body_ids"));
+		if (input_snapshot->has("mesh/boundary_ids"))
+			mesh->set_boundary_ids(input_snapshot->ivector("mesh/boundary_ids"));
+
+		return true;
+	}
+
+	bool State::check_snapshot_nodes() const
+	{
+		if (!input_snapshot->has("nodes") || input_snapshot->imatrix("n_bases")(0) != n_bases)
+		{
+			logger().warn("Snapshot {} was written with a different discretization", input_snapshot->path());
+			return false;
+		}
+
+		const auto nodes = input_snapshot->matrix("nodes");
+		const int n_fe_nodes = n_bases - obstacle.n_vertices();
+		if (nodes.rows() != n_fe_nodes || nodes.cols() != mesh->dimension())
+		{
+			logger().warn("Snapshot {} was written with a different discretization", input_snapshot->path());
+			return false;
+		}
+
+		const double error = (nodes - node_positions(bases, n_fe_nodes, mesh->dimension())).lpNorm<Eigen::Infinity>();
+		if (error > 1e-10 * std::max(1.0, nodes.lpNorm<Eigen::Infinity>()))
+		{
+			logger().warn("Snapshot {} has a different node numbering (max node distance {})", input_snapshot->path(), error);
+			return false;
+		}
+
+		return true;
+	}
+
+	void State::check_snapshot_boundary() const
+	{
+		Eigen::MatrixXi lb_elements, lb_primitives;
+		local_boundary_arrays(local_boundary, lb_elements, lb_primitives);
+
+		if (input_snapshot->ivector("boundary_nodes") != boundary_nodes
+			|| !same_matrix(input_snapshot->imatrix("local_boundary/elements"), lb_elements)
+			|| !same_matrix(input_snapshot->imatrix("local_boundary/primitives"), lb_primitives))
+			logger().warn("The Dirichlet boundary differs from the one in snapshot {}", input_snapshot->path());
+	}
+} // namespace polyfem
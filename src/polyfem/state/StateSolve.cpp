@@ -64,16 +64,35 @@ namespace polyfem
 
 			return true;
 		}
+
+		bool read_initial_x_from_snapshot(
+			const std::shared_ptr<io::SnapshotReader> &snapshot,
+			const bool same_discretization,
+			const std::string &x_name,
+			Eigen::MatrixXd &x)
+		{
+			if (!snapshot || !snapshot->has(x_name))
+				return false;
+
+			// the snapshot stores the history in the numbering of the bases it was written with
+			if (!same_discretization)
+				log_and_throw_error("Snapshot {} was written with a different discretization, unable to restore {}", snapshot->path(), x_name);
+
+			x = snapshot->matrix(x_name);
+			return true;
+		}
 	} // namespace
 
 	void State::initial_solution(Eigen::MatrixXd &solution) const
 	{
 		assert(solve_data.rhs_assembler != nullptr);
 
-		const bool was_solution_loaded = read_initial_x_from_file(
-			resolve_input_path(args["input"]["data"]["state"]), "u",
-			args["input"]["data"]["reorder"], in_node_to_node,
-			mesh->dimension(), solution);
+		const bool was_solution_loaded =
+			read_initial_x_from_snapshot(input_snapshot, use_snapshot_discretization, "u", solution)
+			|| read_initial_x_from_file(
+				resolve_input_path(args["input"]["data"]["state"]), "u",
+				args["input"]["data"]["reorder"], in_node_to_node,
+				mesh->dimension(), solution);
 
 		if (!was_solution_loaded)
 		{
@@ -91,10 +110,12 @@ namespace polyfem
 	{
 		assert(solve_data.rhs_assembler != nullptr);
 
-		const bool was_velocity_loaded = read_initial_x_from_file(
-			resolve_input_path(args["input"]["data"]["state"]), "v",
-			args["input"]["data"]["reorder"], in_node_to_node,
-			mesh->dimension(), velocity);
+		const bool was_velocity_loaded =
+			read_initial_x_from_snapshot(input_snapshot, use_snapshot_discretization, "v", velocity)
+			|| read_initial_x_from_file(
+				resolve_input_path(args["input"]["data"]["state"]), "v",
+				args["input"]["data"]["reorder"], in_node_to_node,
+				mesh->dimension(), velocity);
 
 		if (!was_velocity_loaded)
 			solve_data.rhs_assembler->initial_velocity(velocity);
@@ -104,10 +125,12 @@ namespace polyfem
 	{
 		assert(solve_data.rhs_assembler != nullptr);
 
-		const bool was_acceleration_loaded = read_initial_x_from_file(
-			resolve_input_path(args["input"]["data"]["state"]), "a",
-			args["input"]["data"]["reorder"], in_node_to_node,
-			mesh->dimension(), acceleration);
+		const bool was_acceleration_loaded =
+			read_initial_x_from_snapshot(input_snapshot, use_snapshot_discretization, "a", acceleration)
+			|| read_initial_x_from_file(
+				resolve_input_path(args["input"]["data"]["state"]), "a",
+				args["input"]["data"]["reorder"], in_node_to_node,
+				mesh->dimension(), acceleration);
 
 		if (!was_acceleration_loaded)
 			solve_data.rhs_assembler->initial_acceleration(acceleration);
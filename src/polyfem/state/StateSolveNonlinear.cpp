@@ -128,6 +128,10 @@ namespace polyfem
 			if (!state_path.empty())
 				solve_data.time_integrator->save_state(state_path);
 
+			const std::string snapshot_path = resolve_output_path(fmt::format(args["output"]["data"]["snapshot"], t));
+			if (!snapshot_path.empty())
+				save_snapshot(snapshot_path, t0, dt, t);
+
 			// save restart file
 			save_restart_json(t0, dt, t);
 			if (remesh_enabled)
@@ -259,7 +263,13 @@ namespace polyfem
 			form->set_output_dir(output_dir);
 
 		if (solve_data.contact_form != nullptr)
+		{
 			solve_data.contact_form->save_ccd_debug_meshes = args["output"]["advanced"]["save_ccd_debug_meshes"];
+			solve_data.contact_form->set_incremental_hessian_tolerance(
+				args["solver"]["contact"]["incremental_hessian_tol"].get<double>() * units.characteristic_length());
+			solve_data.contact_form->set_broad_phase_skin(
+				args["solver"]["contact"]["CCD"]["broad_phase_skin"].get<double>() * units.characteristic_length());
+		}
 
 		// --------------------------------------------------------------------
 		// Initialize nonlinear problems
@@ -268,6 +278,9 @@ namespace polyfem
 		solve_data.nl_problem = std::make_shared<NLProblem>(
 			ndof, boundary_nodes, local_boundary, n_boundary_samples(),
 			*solve_data.rhs_assembler, periodic_bc, t, forms);
+		const json &hessian_reuse = args["solver"]["advanced"]["hessian_reuse"];
+		solve_data.nl_problem->set_hessian_reuse(
+			hessian_reuse["max_iterations"], hessian_reuse["convergence_rate"], hessian_reuse["across_time_steps"]);
 		solve_data.nl_problem->init(sol);
 		solve_data.nl_problem->update_quantities(t, sol);
 		// --------------------------------------------------------------------
@@ -312,6 +325,21 @@ namespace polyfem
 				this->solve_data.update_barrier_stiffness(sol);
 			});
 
+		// collision detection timings since the previous subsolve
+		const auto save_contact_timings = [&]() {
+			if (solve_data.contact_form == nullptr)
+				return;
+			const ContactForm::CollisionTimings &timings = solve_data.contact_form->collision_timings();
+			stats.solver_info.back()["contact"] = {
+				{"time_broad_phase", timings.broad_phase.time},
+				{"count_broad_phase", timings.broad_phase.count},
+				{"time_narrow_phase", timings.narrow_phase.time},
+				{"count_narrow_phase", timings.narrow_phase.count},
+				{"time_ccd", timings.ccd.time},
+				{"count_ccd", timings.ccd.count}};
+			solve_data.contact_form->reset_collision_timings();
+		};
+
 		al_solver.post_subsolve = [&](const double al_weight) {
 			stats.solver_info.push_back(
 				{{"type", al_weight > 0 ? "al" : "rc"},
@@ -319,6 +347,7 @@ namespace polyfem
 				 {"info", nl_solver->info()}});
 			if (al_weight > 0)
 				stats.solver_info.back()["weight"] = al_weight;
+			save_contact_timings();
 			save_subsolve(++subsolve_count, t, sol, Eigen::MatrixXd()); // no pressure
 		};
 
@@ -391,6 +420,7 @@ namespace polyfem
 					 {"t", t}, // TODO: null if static?
 					 {"lag_i", lag_i},
 					 {"info", nl_solver->info()}});
+				save_contact_timings();
 				save_subsolve(++subsolve_count, t, sol, Eigen::MatrixXd()); // no pressure
 			}
 		}
@@ -114,11 +114,17 @@ namespace polyfem
 		for (long k = 0; k < def_grad.size(); ++k)
 			def_grad(k) = T(0);
 
-		for (size_t i = 0; i < data.vals.basis_values.size(); ++i)
+		// J^{-T} grad phi, read in place from the packed table if the values come from the packed cache
+		const int n_bases = data.vals.basis_values.size();
+		const bool packed = data.vals.grad_t_m_table.size() > 0;
+		Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 3, 1> grad(size);
+		for (int i = 0; i < n_bases; ++i)
 		{
-			const auto &bs = data.vals.basis_values[i];
-			const Eigen::Matrix<double, Eigen::Dynamic, 1, 0, 3, 1> grad = bs.grad.row(p);
-			assert(grad.size() == size);
+			if (packed)
+				grad = Eigen::Map<const Eigen::VectorXd>(data.vals.grad_t_m_table.data() + (p * n_bases + i) * size, size);
+			else
+				grad = data.vals.basis_values[i].grad_t_m.row(p).transpose();
+			assert(data.vals.basis_values[i].grad_t_m.cols() == size);
 
 			for (int d = 0; d < size; ++d)
 			{
@@ -128,11 +134,6 @@ namespace polyfem
 				}
 			}
 		}
-
-		AutoDiffGradMat jac_it(size, size);
-		for (long k = 0; k < jac_it.size(); ++k)
-			jac_it(k) = T(data.vals.jac_it[p](k));
-		def_grad = def_grad * jac_it;
 	}
 
 	// https://en.wikipedia.org/wiki/Invariants_of_tensors
@@ -9,6 +9,8 @@
 
 #include <tinyexpr.h>
 #include <filesystem>
+#include <memory>
+#include <unordered_map>
 
 #include <iostream>
 
@@ -60,6 +62,65 @@ namespace polyfem
 			return a < b ? 1.0 : 0.0;
 		}
 
+		namespace
+		{
+			/// compiles expr with x, y, z, and t bound to the given variables
+			te_expr *compile(const std::string &expr, double &x, double &y, double &z, double &t, int &err)
+			{
+				const std::vector<te_variable> vars = {
+					{"x", &x, TE_VARIABLE},
+					{"y", &y, TE_VARIABLE},
+					{"z", &z, TE_VARIABLE},
+					{"t", &t, TE_VARIABLE},
+					{"min", (const void *)min, TE_FUNCTION2},
+					{"max", (const void *)max, TE_FUNCTION2},
+					{"smoothstep", (const void *)smoothstep, TE_FUNCTION1},
+					{"half_smoothstep", (const void *)half_smoothstep, TE_FUNCTION1},
+					{"deg2rad", (const void *)deg2rad, TE_FUNCTION1},
+					{"rotate_2D_x", (const void *)rotate_2D_x, TE_FUNCTION3},
+					{"rotate_2D_y", (const void *)rotate_2D_y, TE_FUNCTION3},
+					{"if", (const void *)iflargerthanzerothenelse, TE_FUNCTION3},
+					{"compare", (const void *)compare, TE_FUNCTION2},
+					{"smooth_abs", (const void *)smooth_abs, TE_FUNCTION2},
+					{"sign", (const void *)sign, TE_FUNCTION1},
+				};
+
+				return te_compile(expr.c_str(), vars.data(), vars.size(), &err);
+			}
+
+			/// expression compiled once, evaluated by setting the variable slots
+			struct CompiledExpression
+			{
+				double x = 0, y = 0, z = 0, t = 0;
+				te_expr *expr = nullptr;
+
+				CompiledExpression() = default;
+				CompiledExpression(const CompiledExpression &) = delete;
+				CompiledExpression &operator=(const CompiledExpression &) = delete;
+				~CompiledExpression() { te_free(expr); }
+			};
+
+			/// per thread cache of the compiled expressions, the variable slots are not shared between threads
+			CompiledExpression &compiled_expression(const std::string &expr)
+			{
+				thread_local std::unordered_map<std::string, std::unique_ptr<CompiledExpression>> cache;
+
+				std::unique_ptr<CompiledExpression> &compiled = cache[expr];
+				if (!compiled)
+				{
+					compiled = std::make_unique<CompiledExpression>();
+					int err;
+					compiled->expr = compile(expr, compiled->x, compiled->y, compiled->z, compiled->t, err);
+					if (!compiled->expr)
+					{
+						cache.erase(expr);
+						log_and_throw_error("Unable to parse: {}", expr);
+					}
+				}
+				return *compiled;
+			}
+		} // namespace
+
 		ExpressionValue::ExpressionValue()
 		{
 			clear();
@@ -117,26 +178,8 @@ namespace polyfem
 
 			double x = 0, y = 0, z = 0, t = 0;
 
-			std::vector<te_variable> vars = {
-				{"x", &x, TE_VARIABLE},
-				{"y", &y, TE_VARIABLE},
-				{"z", &z, TE_VARIABLE},
-				{"t", &t, TE_VARIABLE},
-				{"min", (const void *)min, TE_FUNCTION2},
-				{"max", (const void *)max, TE_FUNCTION2},
-				{"smoothstep", (const void *)smoothstep, TE_FUNCTION1},
-				{"half_smoothstep", (const void *)half_smoothstep, TE_FUNCTION1},
-				{"deg2rad", (const void *)deg2rad, TE_FUNCTION1},
-				{"rotate_2D_x", (const void *)rotate_2D_x, TE_FUNCTION3},
-				{"rotate_2D_y", (const void *)rotate_2D_y, TE_FUNCTION3},
-				{"if", (const void *)iflargerthanzerothenelse, TE_FUNCTION3},
-				{"compare", (const void *)compare, TE_FUNCTION2},
-				{"smooth_abs", (const void *)smooth_abs, TE_FUNCTION2},
-				{"sign", (const void *)sign, TE_FUNCTION1},
-			};
-
 			int err;
-			te_expr *tmp = te_compile(expr.c_str(), vars.data(), vars.size(), &err);
+			te_expr *tmp = compile(expr, x, y, z, t, err);
 			if (!tmp)
 			{
 				logger().error("Unable to parse: {}", expr);
@@ -277,29 +320,12 @@ namespace polyfem
 			else
 			{
 
-				std::vector<te_variable> vars = {
-					{"x", &x, TE_VARIABLE},
-					{"y", &y, TE_VARIABLE},
-					{"z", &z, TE_VARIABLE},
-					{"t", &t, TE_VARIABLE},
-					{"min", (const void *)min, TE_FUNCTION2},
-					{"max", (const void *)max, TE_FUNCTION2},
-					{"smoothstep", (const void *)smoothstep, TE_FUNCTION1},
-					{"half_smoothstep", (const void *)half_smoothstep, TE_FUNCTION1},
-					{"deg2rad", (const void *)deg2rad, TE_FUNCTION1},
-					{"rotate_2D_x", (const void *)rotate_2D_x, TE_FUNCTION3},
-					{"rotate_2D_y", (const void *)rotate_2D_y, TE_FUNCTION3},
-					{"if", (const void *)iflargerthanzerothenelse, TE_FUNCTION3},
-					{"compare", (const void *)compare, TE_FUNCTION2},
-					{"smooth_abs", (const void *)smooth_abs, TE_FUNCTION2},
-					{"sign", (const void *)sign, TE_FUNCTION1},
-				};
-
-				int err;
-				te_expr *tmp = te_compile(expr_.c_str(), vars.data(), vars.size(), &err);
-				assert(tmp != nullptr);
-				result = te_eval(tmp);
-				te_free(tmp);
+				CompiledExpression &compiled = compiled_expression(expr_);
+				compiled.x = x;
+				compiled.y = y;
+				compiled.z = z;
+				compiled.t = t;
+				result = te_eval(compiled.expr);
 			}
 
 			if (!unit_.base_units().empty())
@@ -312,5 +338,42 @@ namespace polyfem
 
 			return result;
 		}
+
+		void ExpressionValue::evaluate(const Eigen::MatrixXd &pts, const double t, Eigen::VectorXd &out, const int index) const
+		{
+			assert(unit_type_set_);
+			assert(pts.cols() == 2 || pts.cols() == 3);
+
+			const int n_pts = pts.rows();
+			out.resize(n_pts);
+
+			if (expr_.empty())
+			{
+				for (int p = 0; p < n_pts; ++p)
+					out(p) = (*this)(pts(p, 0), pts(p, 1), pts.cols() == 3 ? pts(p, 2) : 0., t, index);
+				return;
+			}
+
+			CompiledExpression &compiled = compiled_expression(expr_);
+			compiled.t = t;
+			compiled.z = 0;
+			for (int p = 0; p < n_pts; ++p)
+			{
+				compiled.x = pts(p, 0);
+				compiled.y = pts(p, 1);
+				if (pts.cols() == 3)
+					compiled.z = pts(p, 2);
+				out(p) = te_eval(compiled.expr);
+			}
+
+			if (!unit_.base_units().empty())
+			{
+				if (!unit_.is_convertible(unit_type_))
+					log_and_throw_error(fmt::format("Cannot convert {} to {}", units::to_string(unit_), units::to_string(unit_type_)));
+
+				for (int p = 0; p < n_pts; ++p)
+					out(p) = units::convert(out(p), unit_, unit_type_);
+			}
+		}
 	} // namespace utils
 } // namespace polyfem
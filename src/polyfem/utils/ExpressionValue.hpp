@@ -36,6 +36,10 @@ namespace polyfem
 
 			double operator()(double x, double y, double z = 0, double t = 0, int index = -1) const;
 
+			/// evaluates the expression at every row of pts (n x 2 or n x 3), out has one entry per point
+			/// the expression is compiled once per thread and evaluated for the whole block
+			void evaluate(const Eigen::MatrixXd &pts, const double t, Eigen::VectorXd &out, const int index = -1) const;
+
 			void clear();
 
 			bool is_zero() const { return expr_.empty() && fabs(value_) < 1e-10; }
@@ -1,235 +1,267 @@
 #include "LazyCubicInterpolator.hpp"
-#include <mutex>
+
+#include <polyfem/utils/Logger.hpp>
 
 namespace polyfem
 {
-	void LazyCubicInterpolator::bicubic_interpolation(const Eigen::MatrixXd &corner_point, const std::vector<std::string> &keys, const Eigen::MatrixXd &point, double &val, Eigen::MatrixXd &grad) const
+	namespace
+	{
+		/// bits per packed grid coordinate, 3 * 21 fit in a 64 bit key
+		constexpr int key_bits = 21;
+		constexpr int64_t key_offset = int64_t(1) << (key_bits - 1);
+	} // namespace
+
+	uint64_t LazyCubicInterpolator::pack_key(const Bin &bin) const
 	{
-		Eigen::MatrixXd corner_val(4, 1);
-		Eigen::MatrixXd corner_grad(4, 2);
-		Eigen::MatrixXd corner_grad_grad(4, 1);
-		for (int i = 0; i < 4; ++i)
+		uint64_t key = 0;
+		for (int k = 0; k < dim_; ++k)
 		{
-			{
-				std::shared_lock distance_lock(distance_mutex_);
-				corner_val(i) = implicit_function_distance.at(keys[i]);
-			}
-			{
-				std::shared_lock grad_lock(grad_mutex_);
-				auto mixed_grads = implicit_function_grads.at(keys[i]);
-				corner_grad(i, 0) = mixed_grads(0);
-				corner_grad(i, 1) = mixed_grads(1);
-				corner_grad_grad(i, 0) = mixed_grads(2);
-			}
+			const int64_t b = int64_t(bin[k]) + key_offset;
+			if (b < 0 || b >= 2 * key_offset)
+				log_and_throw_error("Grid coordinate {} out of range in the cubic interpolator, increase the grid spacing.", bin[k]);
+			key = (key << key_bits) | uint64_t(b);
 		}
+		return key;
+	}
+
+	LazyCubicInterpolator::Bin LazyCubicInterpolator::point_bin(const double *point) const
+	{
+		Bin bin = {{0, 0, 0}};
+		for (int k = 0; k < dim_; ++k)
+			bin[k] = (int)std::floor(point[k] / delta_);
+		return bin;
+	}
 
-		Eigen::MatrixXd x(16, 1);
-		x << corner_val(0), corner_val(1), corner_val(2), corner_val(3),
-			delta_ * corner_grad(0, 0), delta_ * corner_grad(1, 0), delta_ * corner_grad(2, 0), delta_ * corner_grad(3, 0),
-			delta_ * corner_grad(0, 1), delta_ * corner_grad(1, 1), delta_ * corner_grad(2, 1), delta_ * corner_grad(3, 1),
-			delta_ * delta_ * corner_grad_grad(0, 0), delta_ * delta_ * corner_grad_grad(1, 0), delta_ * delta_ * corner_grad_grad(2, 0), delta_ * delta_ * corner_grad_grad(3, 0);
+	double LazyCubicInterpolator::cached_distance(const std::function<void(const Eigen::MatrixXd &, double &)> &compute_distance, const Bin &bin)
+	{
+		const uint64_t key = pack_key(bin);
+		if (const double *distance = implicit_function_distance.find(key))
+			return *distance;
 
-		Eigen::MatrixXd coeffs = cubic_mat * x;
+		// computed outside of the map lock, concurrent threads may compute the same value
+		Eigen::MatrixXd clamped_point(dim_, 1);
+		for (int k = 0; k < dim_; ++k)
+			clamped_point(k) = (double)bin[k] * delta_;
 
-		auto bar_x = [&corner_point](double x_) { return (x_ - corner_point(0, 0)) / (corner_point(1, 0) - corner_point(0, 0)); };
-		auto bar_y = [&corner_point](double y_) { return (y_ - corner_point(0, 1)) / (corner_point(2, 1) - corner_point(0, 1)); };
+		double distance;
+		compute_distance(clamped_point, distance);
+		return implicit_function_distance.insert(key, distance);
+	}
 
-		val = 0;
-		grad.setZero(2, 1);
-		for (int i = 0; i < 4; ++i)
-			for (int j = 0; j < 4; ++j)
-			{
-				val += coeffs(i + j * 4) * pow(bar_x(point(0)), i) * pow(bar_y(point(1)), j);
-				grad(0) += i == 0 ? 0 : (coeffs(i + j * 4) * i * pow(bar_x(point(0)), i - 1) * pow(bar_y(point(1)), j));
-				grad(1) += j == 0 ? 0 : coeffs(i + j * 4) * pow(bar_x(point(0)), i) * j * pow(bar_y(point(1)), j - 1);
-			}
+	void LazyCubicInterpolator::cache_node(const std::function<void(const Eigen::MatrixXd &, double &)> &compute_distance, const Bin &bin)
+	{
+		cached_distance(compute_distance, bin);
+
+		const uint64_t key = pack_key(bin);
+		if (implicit_function_grads.find(key))
+			return;
+
+		auto centered_fd = [&](const Bin &b, const int k) {
+			Bin b_plus = b, b_minus = b;
+			b_plus[k] += 1;
+			b_minus[k] -= 1;
+			return (1. / 2. / delta_) * (cached_distance(compute_distance, b_plus) - cached_distance(compute_distance, b_minus));
+		};
+		auto centered_mixed_fd = [&](const Bin &b, const int k1, const int k2) {
+			Bin b_plus = b, b_minus = b;
+			b_plus[k1] += 1;
+			b_minus[k1] -= 1;
+			return (1. / 2. / delta_) * (centered_fd(b_plus, k2) - centered_fd(b_minus, k2));
+		};
+		auto centered_mixed_fd_3d = [&](const Bin &b) {
+			Bin b_plus = b, b_minus = b;
+			b_plus[0] += 1;
+			b_minus[0] -= 1;
+			return (1. / 2. / delta_) * (centered_mixed_fd(b_plus, 1, 2) - centered_mixed_fd(b_minus, 1, 2));
+		};
 
-		grad(0) /= (corner_point(1, 0) - corner_point(0, 0));
-		grad(1) /= (corner_point(2, 1) - corner_point(0, 1));
+		MixedGrads mixed_grads;
+		mixed_grads.fill(0);
+		if (dim_ == 2)
+		{
+			mixed_grads[0] = centered_fd(bin, 0);
+			mixed_grads[1] = centered_fd(bin, 1);
+			mixed_grads[2] = centered_mixed_fd(bin, 0, 1);
+		}
+		else if (dim_ == 3)
+		{
+			mixed_grads[0] = centered_fd(bin, 0);
+			mixed_grads[1] = centered_fd(bin, 1);
+			mixed_grads[2] = centered_fd(bin, 2);
+			mixed_grads[3] = centered_mixed_fd(bin, 0, 1);
+			mixed_grads[4] = centered_mixed_fd(bin, 0, 2);
+			mixed_grads[5] = centered_mixed_fd(bin, 1, 2);
+			mixed_grads[6] = centered_mixed_fd_3d(bin);
+		}
 
-		assert(!std::isnan(grad(0)) && !std::isnan(grad(1)));
+		implicit_function_grads.insert(key, mixed_grads);
 	}
 
-	void LazyCubicInterpolator::tricubic_interpolation(const Eigen::MatrixXd &corner_point, const std::vector<std::string> &keys, const Eigen::MatrixXd &point, double &val, Eigen::MatrixXd &grad) const
+	void LazyCubicInterpolator::cell_coefficients(const Bin &bin, Eigen::VectorXd &coeffs) const
 	{
-		Eigen::MatrixXd corner_val(8, 1);
-		Eigen::MatrixXd corner_grad(8, 3);
-		Eigen::MatrixXd corner_grad_grad(8, 3);
-		Eigen::MatrixXd corner_grad_grad_grad(8, 1);
-		for (int i = 0; i < 8; ++i)
+		const int n_corners = 1 << dim_;
+		const int n_grads = dim_ == 2 ? 3 : 7;
+		// order of the derivative of every entry of MixedGrads
+		static const std::array<int, 3> orders_2d = {{1, 1, 2}};
+		static const std::array<int, 7> orders_3d = {{1, 1, 1, 2, 2, 2, 3}};
+		const int *orders = dim_ == 2 ? orders_2d.data() : orders_3d.data();
+
+		Eigen::VectorXd x(n_corners * (n_grads + 1));
+		for (int c = 0; c < n_corners; ++c)
 		{
+			// corners ordered with x the fastest, then y, then z
+			Bin corner = bin;
+			for (int k = 0; k < dim_; ++k)
+				corner[k] += (c >> k) & 1;
+
+			const uint64_t key = pack_key(corner);
+			const double *distance = implicit_function_distance.find(key);
+			const MixedGrads *mixed_grads = implicit_function_grads.find(key);
+			if (distance == nullptr || mixed_grads == nullptr)
+				log_and_throw_error("Grid value not cached in the cubic interpolator, call cache_grid first.");
+
+			x(c) = *distance;
+			for (int m = 0; m < n_grads; ++m)
+				x((m + 1) * n_corners + c) = std::pow(delta_, orders[m]) * (*mixed_grads)[m];
+		}
+
+		coeffs.noalias() = cubic_mat * x;
+	}
+
+	void LazyCubicInterpolator::evaluate_cell(const Bin &bin, const Eigen::VectorXd &coeffs, const double *point, double &val, double *grad) const
+	{
+		// powers of the local coordinates and their derivatives
+		double pw[3][4], dpw[3][4], width[3];
+		for (int k = 0; k < 3; ++k)
+		{
+			pw[k][0] = 1;
+			dpw[k][0] = 0;
+			for (int i = 1; i < 4; ++i)
+				pw[k][i] = dpw[k][i] = 0;
+		}
+		for (int k = 0; k < dim_; ++k)
+		{
+			const double lo = (double)bin[k] * delta_;
+			width[k] = (double)(bin[k] + 1) * delta_ - lo;
+			const double bar = (point[k] - lo) / width[k];
+			for (int i = 1; i < 4; ++i)
 			{
-				std::shared_lock distance_lock(distance_mutex_);
-				corner_val(i) = implicit_function_distance.at(keys[i]);
-			}
-			{
-				std::shared_lock grad_lock(grad_mutex_);
-				auto mixed_grads = implicit_function_grads.at(keys[i]);
-				corner_grad(i, 0) = mixed_grads(0);
-				corner_grad(i, 1) = mixed_grads(1);
-				corner_grad(i, 2) = mixed_grads(2);
-				corner_grad_grad(i, 0) = mixed_grads(3);
-				corner_grad_grad(i, 1) = mixed_grads(4);
-				corner_grad_grad(i, 2) = mixed_grads(5);
-				corner_grad_grad_grad(i, 0) = mixed_grads(6);
+				pw[k][i] = pw[k][i - 1] * bar;
+				dpw[k][i] = i * pw[k][i - 1];
 			}
 		}
-		Eigen::MatrixXd x(64, 1);
-		x << corner_val(0), corner_val(1), corner_val(2), corner_val(3), corner_val(4), corner_val(5), corner_val(6), corner_val(7),
-			delta_ * corner_grad(0, 0), delta_ * corner_grad(1, 0), delta_ * corner_grad(2, 0), delta_ * corner_grad(3, 0), delta_ * corner_grad(4, 0), delta_ * corner_grad(5, 0), delta_ * corner_grad(6, 0), delta_ * corner_grad(7, 0),
-			delta_ * corner_grad(0, 1), delta_ * corner_grad(1, 1), delta_ * corner_grad(2, 1), delta_ * corner_grad(3, 1), delta_ * corner_grad(4, 1), delta_ * corner_grad(5, 1), delta_ * corner_grad(6, 1), delta_ * corner_grad(7, 1),
-			delta_ * corner_grad(0, 2), delta_ * corner_grad(1, 2), delta_ * corner_grad(2, 2), delta_ * corner_grad(3, 2), delta_ * corner_grad(4, 2), delta_ * corner_grad(5, 2), delta_ * corner_grad(6, 2), delta_ * corner_grad(7, 2),
-			delta_ * delta_ * corner_grad_grad(0, 0), delta_ * delta_ * corner_grad_grad(1, 0), delta_ * delta_ * corner_grad_grad(2, 0), delta_ * delta_ * corner_grad_grad(3, 0), delta_ * delta_ * corner_grad_grad(4, 0), delta_ * delta_ * corner_grad_grad(5, 0), delta_ * delta_ * corner_grad_grad(6, 0), delta_ * delta_ * corner_grad_grad(7, 0),
-			delta_ * delta_ * corner_grad_grad(0, 1), delta_ * delta_ * corner_grad_grad(1, 1), delta_ * delta_ * corner_grad_grad(2, 1), delta_ * delta_ * corner_grad_grad(3, 1), delta_ * delta_ * corner_grad_grad(4, 1), delta_ * delta_ * corner_grad_grad(5, 1), delta_ * delta_ * corner_grad_grad(6, 1), delta_ * delta_ * corner_grad_grad(7, 1),
-			delta_ * delta_ * corner_grad_grad(0, 2), delta_ * delta_ * corner_grad_grad(1, 2), delta_ * delta_ * corner_grad_grad(2, 2), delta_ * delta_ * corner_grad_grad(3, 2), delta_ * delta_ * corner_grad_grad(4, 2), delta_ * delta_ * corner_grad_grad(5, 2), delta_ * delta_ * corner_grad_grad(6, 2), delta_ * delta_ * corner_grad_grad(7, 2),
-			delta_ * delta_ * delta_ * corner_grad_grad_grad(0, 0), delta_ * delta_ * delta_ * corner_grad_grad_grad(1, 0), delta_ * delta_ * delta_ * corner_grad_grad_grad(2, 0), delta_ * delta_ * delta_ * corner_grad_grad_grad(3, 0), delta_ * delta_ * delta_ * corner_grad_grad_grad(4, 0), delta_ * delta_ * delta_ * corner_grad_grad_grad(5, 0), delta_ * delta_ * delta_ * corner_grad_grad_grad(6, 0), delta_ * delta_ * delta_ * corner_grad_grad_grad(7, 0);
-
-		Eigen::MatrixXd coeffs = cubic_mat * x;
-
-		auto bar_x = [&corner_point](double x_) { return (x_ - corner_point(0, 0)) / (corner_point(1, 0) - corner_point(0, 0)); };
-		auto bar_y = [&corner_point](double y_) { return (y_ - corner_point(0, 1)) / (corner_point(2, 1) - corner_point(0, 1)); };
-		auto bar_z = [&corner_point](double z_) { return (z_ - corner_point(0, 2)) / (corner_point(4, 2) - corner_point(0, 2)); };
 
 		val = 0;
-		grad.setZero(3, 1);
-		for (int i = 0; i < 4; ++i)
-			for (int j = 0; j < 4; ++j)
-				for (int l = 0; l < 4; ++l)
+		for (int k = 0; k < dim_; ++k)
+			grad[k] = 0;
+
+		if (dim_ == 2)
+		{
+			for (int i = 0; i < 4; ++i)
+				for (int j = 0; j < 4; ++j)
 				{
-					val += coeffs(i + j * 4 + l * 16) * pow(bar_x(point(0)), i) * pow(bar_y(point(1)), j) * pow(bar_z(point(2)), l);
-					grad(0) += i == 0 ? 0 : (coeffs(i + j * 4 + l * 16) * i * pow(bar_x(point(0)), i - 1) * pow(bar_y(point(1)), j)) * pow(bar_z(point(2)), l);
-					grad(1) += j == 0 ? 0 : coeffs(i + j * 4 + l * 16) * pow(bar_x(point(0)), i) * j * pow(bar_y(point(1)), j - 1) * pow(bar_z(point(2)), l);
-					grad(2) += l == 0 ? 0 : coeffs(i + j * 4 + l * 16) * pow(bar_x(point(0)), i) * pow(bar_y(point(1)), j) * l * pow(bar_z(point(2)), l - 1);
+					const double c = coeffs(i + j * 4);
+					val += c * pw[0][i] * pw[1][j];
+					grad[0] += c * dpw[0][i] * pw[1][j];
+					grad[1] += c * pw[0][i] * dpw[1][j];
 				}
+		}
+		else
+		{
+			for (int i = 0; i < 4; ++i)
+				for (int j = 0; j < 4; ++j)
+					for (int l = 0; l < 4; ++l)
+					{
+						const double c = coeffs(i + j * 4 + l * 16);
+						val += c * pw[0][i] * pw[1][j] * pw[2][l];
+						grad[0] += c * dpw[0][i] * pw[1][j] * pw[2][l];
+						grad[1] += c * pw[0][i] * dpw[1][j] * pw[2][l];
+						grad[2] += c * pw[0][i] * pw[1][j] * dpw[2][l];
+					}
+		}
 
-		grad(0) /= (corner_point(1, 0) - corner_point(0, 0));
-		grad(1) /= (corner_point(2, 1) - corner_point(0, 1));
-		grad(2) /= (corner_point(4, 2) - corner_point(0, 2));
-
-		assert(!std::isnan(grad(0)) && !std::isnan(grad(1)) && !std::isnan(grad(2)));
+		for (int k = 0; k < dim_; ++k)
+		{
+			grad[k] /= width[k];
+			if (std::isnan(grad[k]))
+				throw std::runtime_error("Nan found in gradient computation.");
+		}
 	}
 
 	void LazyCubicInterpolator::cache_grid(std::function<void(const Eigen::MatrixXd &, double &)> compute_distance, const Eigen::MatrixXd &point)
 	{
-		Eigen::MatrixXi keys;
-		build_corner_keys(point, keys);
-		std::vector<std::string> keys_string;
-
-		auto safe_compute_distance = [this, compute_distance](const Eigen::MatrixXd &clamped_point, const std::string &key_string) {
-			std::unique_lock lock(distance_mutex_);
-			if (implicit_function_distance.count(key_string) == 0)
-				compute_distance(clamped_point, implicit_function_distance[key_string]);
-		};
-		auto safe_distance = [this, safe_compute_distance](const Eigen::VectorXi &key) {
-			Eigen::MatrixXd point;
-			std::string key_string;
-			double distance;
-			setup_key(key, key_string, point);
-			safe_compute_distance(point, key_string);
-			{
-				std::shared_lock lock(distance_mutex_);
-				distance = implicit_function_distance[key_string];
-			}
-			return distance;
-		};
-		auto centered_fd = [this, safe_distance](const Eigen::VectorXi &key, const int k) {
-			Eigen::MatrixXi key_plus, key_minus;
-			double distance_plus, distance_minus;
-			key_plus = key;
-			key_plus(k) += 1;
-			distance_plus = safe_distance(key_plus);
-			key_minus = key;
-			key_minus(k) -= 1;
-			distance_minus = safe_distance(key_minus);
-			return (1. / 2. / delta_) * (distance_plus - distance_minus);
-		};
-		auto centered_mixed_fd = [this, centered_fd](const Eigen::VectorXi &key, const int k1, const int k2) {
-			Eigen::VectorXi key_plus, key_minus;
-			key_plus = key;
-			key_plus(k1) += 1;
-			key_minus = key;
-			key_minus(k1) -= 1;
-			return (1. / 2. / delta_) * (centered_fd(key_plus, k2) - centered_fd(key_minus, k2));
-		};
-		auto centered_mixed_fd_3d = [this, centered_mixed_fd](const Eigen::VectorXi &key) {
-			Eigen::VectorXi key_plus, key_minus;
-			key_plus = key;
-			key_plus(0) += 1;
-			key_minus = key;
-			key_minus(0) -= 1;
-			return (1. / 2. / delta_) * (centered_mixed_fd(key_plus, 1, 2) - centered_mixed_fd(key_minus, 1, 2));
-		};
-		auto compute_grad = [this, centered_fd, centered_mixed_fd, centered_mixed_fd_3d](const Eigen::VectorXi &key) {
-			Eigen::VectorXd mixed_grads(dim_ == 2 ? 3 : 7);
-			if (dim_ == 2)
-			{
-				mixed_grads(0) = centered_fd(key, 0);
-				mixed_grads(1) = centered_fd(key, 1);
-				mixed_grads(2) = centered_mixed_fd(key, 0, 1);
-			}
-			else if (dim_ == 3)
-			{
-				mixed_grads(0) = centered_fd(key, 0);
-				mixed_grads(1) = centered_fd(key, 1);
-				mixed_grads(2) = centered_fd(key, 2);
-				mixed_grads(3) = centered_mixed_fd(key, 0, 1);
-				mixed_grads(4) = centered_mixed_fd(key, 0, 2);
-				mixed_grads(5) = centered_mixed_fd(key, 1, 2);
-				mixed_grads(6) = centered_mixed_fd_3d(key);
-			}
-			return mixed_grads;
-		};
-		auto safe_compute_grad = [this, compute_grad](const Eigen::VectorXi &key) {
-			std::string key_string;
-			Eigen::MatrixXd point;
-			setup_key(key, key_string, point);
+		assert(point.size() == dim_);
+		const Bin bin = point_bin(point.data());
+		for (int c = 0; c < (1 << dim_); ++c)
+		{
+			Bin corner = bin;
+			for (int k = 0; k < dim_; ++k)
+				corner[k] += (c >> k) & 1;
+			cache_node(compute_distance, corner);
+		}
+	}
+
+	void LazyCubicInterpolator::cache_grid_batch(std::function<void(const Eigen::MatrixXd &, double &)> compute_distance, const Eigen::MatrixXd &points)
+	{
+		assert(points.cols() == dim_);
+		Bin prev_bin;
+		double p[3];
+		for (int i = 0; i < points.rows(); ++i)
+		{
+			for (int k = 0; k < dim_; ++k)
+				p[k] = points(i, k);
+			const Bin bin = point_bin(p);
+			if (i > 0 && bin == prev_bin)
+				continue;
+			prev_bin = bin;
+
+			for (int c = 0; c < (1 << dim_); ++c)
 			{
-				std::unique_lock lock(grad_mutex_);
-				if (implicit_function_grads.count(key_string) == 0)
-				{
-					Eigen::MatrixXd grad = compute_grad(key);
-					implicit_function_grads[key_string] = grad;
-				}
+				Bin corner = bin;
+				for (int k = 0; k < dim_; ++k)
+					corner[k] += (c >> k) & 1;
+				cache_node(compute_distance, corner);
 			}
-		};
-		Eigen::MatrixXd corner_point(keys.rows(), dim_);
-		for (int i = 0; i < keys.rows(); ++i)
-		{
-			std::string key_string;
-			Eigen::MatrixXd clamped_point;
-			setup_key(keys.row(i), key_string, clamped_point);
-			safe_compute_distance(clamped_point, key_string);
-			keys_string.push_back(key_string);
-			corner_point.row(i) = clamped_point.transpose();
-			safe_compute_grad(keys.row(i));
 		}
 	}
 
 	void LazyCubicInterpolator::evaluate(const Eigen::MatrixXd &point, double &val, Eigen::MatrixXd &grad) const
 	{
-		Eigen::MatrixXi keys;
-		build_corner_keys(point, keys);
+		// a single row or column, contiguous in both cases
+		assert(point.size() == dim_);
+		const Bin bin = point_bin(point.data());
+		Eigen::VectorXd coeffs;
+		cell_coefficients(bin, coeffs);
+
+		grad.setZero(dim_, 1);
+		evaluate_cell(bin, coeffs, point.data(), val, grad.data());
+	}
 
-		std::vector<std::string> keys_string;
-		Eigen::MatrixXd corner_point(keys.rows(), dim_);
-		for (int i = 0; i < keys.rows(); ++i)
+	void LazyCubicInterpolator::evaluate_batch(const Eigen::MatrixXd &points, Eigen::VectorXd &vals, Eigen::MatrixXd &grads) const
+	{
+		assert(points.cols() == dim_);
+		vals.resize(points.rows());
+		grads.resize(points.rows(), dim_);
+
+		Bin prev_bin;
+		Eigen::VectorXd coeffs;
+		double p[3], g[3];
+		for (int i = 0; i < points.rows(); ++i)
 		{
-			std::string key_string;
-			Eigen::MatrixXd clamped_point;
-			setup_key(keys.row(i), key_string, clamped_point);
-			keys_string.push_back(key_string);
-			corner_point.row(i) = clamped_point.transpose();
-		}
+			for (int k = 0; k < dim_; ++k)
+				p[k] = points(i, k);
 
-		grad.setZero(dim_, 1);
-		if (dim_ == 2)
-			bicubic_interpolation(corner_point, keys_string, point, val, grad);
-		else if (dim_ == 3)
-			tricubic_interpolation(corner_point, keys_string, point, val, grad);
+			const Bin bin = point_bin(p);
+			if (i == 0 || bin != prev_bin)
+			{
+				cell_coefficients(bin, coeffs);
+				prev_bin = bin;
+			}
 
-		for (int i = 0; i < dim_; ++i)
-			if (std::isnan(grad(i)))
-				throw std::runtime_error("Nan found in gradient computation.");
+			evaluate_cell(bin, coeffs, p, vals(i), g);
+			for (int k = 0; k < dim_; ++k)
+				grads(i, k) = g[k];
+		}
 	}
 
 	void LazyCubicInterpolator::lazy_evaluate(std::function<void(const Eigen::MatrixXd &, double &)> compute_distance, const Eigen::MatrixXd &point, double &val, Eigen::MatrixXd &grad)
@@ -239,4 +271,4 @@ namespace polyfem
 		evaluate(point, val, grad);
 	}
 
-} // namespace polyfem
\ No newline at end of file
+} // namespace polyfem
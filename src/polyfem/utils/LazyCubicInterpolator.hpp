@@ -1,8 +1,13 @@
 #pragma once
 
-#include <map>
-#include <unordered_map>
-#include <shared_mutex>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 #include <Eigen/Dense>
 #include <nanospline/BSpline.h>
 #include <nanospline/BSplinePatch.h>
@@ -105,60 +110,160 @@ namespace polyfem
 			}
 		}
 
-		void bicubic_interpolation(const Eigen::MatrixXd &corner_point, const std::vector<std::string> &keys, const Eigen::MatrixXd &point, double &val, Eigen::MatrixXd &grad) const;
-		void tricubic_interpolation(const Eigen::MatrixXd &corner_point, const std::vector<std::string> &keys, const Eigen::MatrixXd &point, double &val, Eigen::MatrixXd &grad) const;
-		void lazy_evaluate(std::function<void(const Eigen::MatrixXd &, double &)> compute_distance, const Eigen::MatrixXd &point, double &val, Eigen::MatrixXd &grad);
+		/// computes and caches the grid values around point (a 1 x dim or dim x 1 matrix)
 		void cache_grid(std::function<void(const Eigen::MatrixXd &, double &)> compute_distance, const Eigen::MatrixXd &point);
+		/// computes and caches the grid values around every row of points
+		void cache_grid_batch(std::function<void(const Eigen::MatrixXd &, double &)> compute_distance, const Eigen::MatrixXd &points);
+
+		void lazy_evaluate(std::function<void(const Eigen::MatrixXd &, double &)> compute_distance, const Eigen::MatrixXd &point, double &val, Eigen::MatrixXd &grad);
+		/// evaluates the interpolant at point, the grid around it must have been cached
 		void evaluate(const Eigen::MatrixXd &point, double &val, Eigen::MatrixXd &grad) const;
+		/// evaluates the interpolant at every row of points (n x dim), grads is n x dim
+		/// consecutive points in the same grid cell share the interpolation coefficients
+		void evaluate_batch(const Eigen::MatrixXd &points, Eigen::VectorXd &vals, Eigen::MatrixXd &grads) const;
+
+		/// number of cached grid values
+		size_t n_cached_values() const { return implicit_function_distance.size(); }
 
 	private:
-		inline void build_corner_keys(const Eigen::MatrixXd &point, Eigen::MatrixXi &keys) const
+		/// Hash map from packed grid coordinates to values, inserted values are never modified or removed.
+		/// Lookups are lock-free, insertions are serialized and the table grows by publishing a larger copy;
+		/// the old tables are kept alive so that concurrent lookups remain valid.
+		template <typename T>
+		class ConcurrentGridMap
 		{
-			int num_corner_points = dim_ == 2 ? 4 : 8;
-			Eigen::MatrixXi bin(dim_, 1);
-			keys.resize(num_corner_points, dim_);
-			std::vector<std::string> keys_string;
-			for (int k = 0; k < dim_; ++k)
-				bin(k) = (int)std::floor(point(k) / delta_);
-			if (dim_ == 2)
+		public:
+			ConcurrentGridMap()
 			{
-				keys << bin(0), bin(1),
-					bin(0) + 1, bin(1),
-					bin(0), bin(1) + 1,
-					bin(0) + 1, bin(1) + 1;
+				tables_.push_back(std::make_unique<Table>(16));
+				table_.store(tables_.back().get(), std::memory_order_release);
 			}
-			else if (dim_ == 3)
+
+			ConcurrentGridMap(const ConcurrentGridMap &) = delete;
+			ConcurrentGridMap &operator=(const ConcurrentGridMap &) = delete;
+
+			/// nullptr if key is not in the map
+			const T *find(const uint64_t key) const
 			{
-				keys << bin(0), bin(1), bin(2),
-					bin(0) + 1, bin(1), bin(2),
-					bin(0), bin(1) + 1, bin(2),
-					bin(0) + 1, bin(1) + 1, bin(2),
-					bin(0), bin(1), bin(2) + 1,
-					bin(0) + 1, bin(1), bin(2) + 1,
-					bin(0), bin(1) + 1, bin(2) + 1,
-					bin(0) + 1, bin(1) + 1, bin(2) + 1;
+				const Table *table = table_.load(std::memory_order_acquire);
+				for (size_t i = hash(key) & table->mask;; i = (i + 1) & table->mask)
+				{
+					const Node *node = table->slots[i].load(std::memory_order_acquire);
+					if (node == nullptr)
+						return nullptr;
+					if (node->key == key)
+						return &node->value;
+				}
 			}
-		}
-		inline void setup_key(const Eigen::VectorXi &key, std::string &key_string, Eigen::MatrixXd &clamped_point) const
-		{
-			key_string = "";
-			clamped_point.setZero(dim_, 1);
-			for (int k = 0; k < dim_; ++k)
+
+			/// inserts value if key is not in the map, returns the stored value
+			const T &insert(const uint64_t key, const T &value)
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				Table *table = tables_.back().get(); // the published table
+				size_t i = find_slot(*table, key);
+				if (const Node *node = table->slots[i].load(std::memory_order_relaxed))
+					return node->value;
+
+				// keep the load factor below 1/2
+				if (2 * (nodes_.size() + 1) > table->slots.size())
+				{
+					table = grow();
+					i = find_slot(*table, key);
+				}
+
+				nodes_.push_back({key, value});
+				table->slots[i].store(&nodes_.back(), std::memory_order_release);
+				return nodes_.back().value;
+			}
+
+			size_t size() const
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				return nodes_.size();
+			}
+
+		private:
+			struct Node
+			{
+				uint64_t key;
+				T value;
+			};
+
+			struct Table
+			{
+				explicit Table(const size_t capacity) : slots(capacity), mask(capacity - 1)
+				{
+					for (auto &s : slots)
+						s.store(nullptr, std::memory_order_relaxed);
+				}
+
+				std::vector<std::atomic<const Node *>> slots;
+				const size_t mask;
+			};
+
+			static inline size_t hash(uint64_t key)
+			{
+				// splitmix64 finalizer
+				key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+				key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+				return key ^ (key >> 31);
+			}
+
+			/// slot holding key or the empty slot where it would be inserted
+			static size_t find_slot(const Table &table, const uint64_t key)
 			{
-				// key_string += fmt::format("{:d},", key(k));
-				key_string += std::to_string(key(k)) + ",";
-				clamped_point(k) = (double)key(k) * delta_;
+				size_t i = hash(key) & table.mask;
+				for (;; i = (i + 1) & table.mask)
+				{
+					const Node *node = table.slots[i].load(std::memory_order_relaxed);
+					if (node == nullptr || node->key == key)
+						return i;
+				}
 			}
+
+			Table *grow()
+			{
+				const Table &old_table = *tables_.back();
+				tables_.push_back(std::make_unique<Table>(2 * old_table.slots.size()));
+				Table &table = *tables_.back();
+				for (const auto &s : old_table.slots)
+				{
+					const Node *node = s.load(std::memory_order_relaxed);
+					if (node)
+						table.slots[find_slot(table, node->key)].store(node, std::memory_order_relaxed);
+				}
+				table_.store(&table, std::memory_order_release);
+				return &table;
+			}
+
+			std::atomic<const Table *> table_;
+			std::vector<std::unique_ptr<Table>> tables_;
+			std::deque<Node> nodes_; ///< stable storage, pointers are never invalidated
+			mutable std::mutex mutex_;
 		};
 
+		/// f and its mixed derivatives at a grid node: (f_x, f_y, f_xy) in 2d, (f_x, f_y, f_z, f_xy, f_xz, f_yz, f_xyz) in 3d
+		using MixedGrads = std::array<double, 7>;
+		using Bin = std::array<int, 3>;
+
+		/// packs the grid coordinates in 21 bits per coordinate
+		uint64_t pack_key(const Bin &bin) const;
+		/// grid cell containing point (dim_ coordinates)
+		Bin point_bin(const double *point) const;
+
+		double cached_distance(const std::function<void(const Eigen::MatrixXd &, double &)> &compute_distance, const Bin &bin);
+		void cache_node(const std::function<void(const Eigen::MatrixXd &, double &)> &compute_distance, const Bin &bin);
+
+		/// coefficients of the bicubic/tricubic polynomial of the cell with lower corner bin
+		void cell_coefficients(const Bin &bin, Eigen::VectorXd &coeffs) const;
+		void evaluate_cell(const Bin &bin, const Eigen::VectorXd &coeffs, const double *point, double &val, double *grad) const;
+
 		int dim_;
 		double delta_;
-		std::unordered_map<std::string, double> implicit_function_distance;
-		std::unordered_map<std::string, Eigen::VectorXd> implicit_function_grads;
+		ConcurrentGridMap<double> implicit_function_distance;
+		ConcurrentGridMap<MixedGrads> implicit_function_grads;
 
 		Eigen::MatrixXd cubic_mat;
-
-		mutable std::shared_mutex distance_mutex_;
-		mutable std::shared_mutex grad_mutex_;
 	};
 } // namespace polyfem
\ No newline at end of file
@@ -3,8 +3,50 @@
 #include <polyfem/utils/MaybeParallelFor.hpp>
 #include <polyfem/utils/Logger.hpp>
 
+#include <atomic>
+#include <cstring>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
 namespace polyfem::utils
 {
+	namespace
+	{
+		/// lock-free target += value, atomic_ref when available, compiler builtins on the storage of target otherwise
+		inline void atomic_add(double &target, const double value)
+		{
+#if defined(__cpp_lib_atomic_ref) && __cpp_lib_atomic_ref >= 201806L
+			std::atomic_ref<double> a(target);
+			double old = a.load(std::memory_order_relaxed);
+			while (!a.compare_exchange_weak(old, old + value, std::memory_order_relaxed))
+				;
+#elif defined(_MSC_VER) && !defined(__clang__)
+			static_assert(sizeof(double) == sizeof(__int64));
+			volatile __int64 *bits = reinterpret_cast<volatile __int64 *>(&target);
+			__int64 old_bits = *bits;
+			while (true)
+			{
+				double old, sum;
+				std::memcpy(&old, &old_bits, sizeof(double));
+				sum = old + value;
+				__int64 new_bits;
+				std::memcpy(&new_bits, &sum, sizeof(double));
+				const __int64 prev = _InterlockedCompareExchange64(bits, new_bits, old_bits);
+				if (prev == old_bits)
+					break;
+				old_bits = prev;
+			}
+#else
+			double old;
+			__atomic_load(&target, &old, __ATOMIC_RELAXED);
+			double sum = old + value;
+			while (!__atomic_compare_exchange(&target, &old, &sum, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				sum = old + value;
+#endif
+		}
+	} // namespace
+
 	SparseMatrixCache::SparseMatrixCache(const size_t size)
 	{
 		init(size);
@@ -112,6 +154,17 @@ namespace polyfem::utils
 		}
 	}
 
+	void SparseMatrixCache::add_element_value(const int e, const int local_index, const double value)
+	{
+		assert(!mapping().empty());
+		assert(e < second_cache().size());
+		assert(local_index < second_cache()[e].size());
+
+		const size_t index = second_cache()[e][local_index];
+		assert(index < values_.size());
+		atomic_add(values_[index], value);
+	}
+
 	void SparseMatrixCache::prune()
 	{
 		// caches have yet to be constructed (likely because the matrix has yet to be fully assembled)
@@ -76,6 +76,8 @@ namespace polyfem::utils
 		inline size_t triplet_count() const override { return entries_.size() + mat_.nonZeros(); }
 		inline bool is_sparse() const override { return true; }
 		inline size_t mapping_size() const { return mapping_.size(); }
+		/// true once the sparsity pattern and the element to value-slot map (second_cache_) have been built
+		inline bool is_pattern_cached() const { return !mapping().empty(); }
 
 		/// e = element_index, i = global row_index, j = global column_index, value = value to add to matrix
 		/// if the cache is yet to be constructed, save the row, column, and value to be added to the second cache
@@ -83,6 +85,11 @@ namespace polyfem::utils
 		/// otherwise, save the value directly in the second cache
 		///     in this case, modfies values_
 		void add_value(const int e, const int i, const int j, const double value) override;
+		/// e = element_index, local_index = index of the entry in the order it was added by element e when the
+		/// cache was constructed, value = value to add to matrix
+		/// requires the cache to be constructed (is_pattern_cached()), writes directly into values_ with an
+		/// atomic add so it can be called concurrently for different elements without per-thread copies
+		void add_element_value(const int e, const int local_index, const double value);
 		/// if the cache is yet to be constructed, save the 
 		/// cached (ordered) indices in inner_index_ and outer_index_
 		/// then fill in map and second_cache_
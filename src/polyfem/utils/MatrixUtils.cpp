@@ -3,6 +3,7 @@
 #include <polyfem/utils/Logger.hpp>
 #include <polyfem/utils/Timer.hpp>
 
+#include <algorithm>
 #include <vector>
 
 void polyfem::utils::show_matrix_stats(const Eigen::MatrixXd &M)
@@ -159,6 +160,227 @@ void polyfem::utils::full_to_reduced_matrix(
 	reduced.makeCompressed();
 }
 
+void polyfem::utils::FullToReducedMatrixMap::reduce(
+	const std::vector<int> &removed_vars,
+	const StiffnessMatrix &full,
+	StiffnessMatrix &reduced)
+{
+	POLYFEM_SCOPED_TIMER("full to reduced matrix");
+
+	assert(full.rows() == full.cols());
+	if (removed_vars.empty())
+	{
+		reduced = full;
+		return;
+	}
+
+	// the map needs direct access to the values
+	if (!full.isCompressed())
+	{
+		full_to_reduced_matrix(full.rows(), full.rows() - removed_vars.size(), removed_vars, full, reduced);
+		return;
+	}
+
+	if (!matches(removed_vars, full))
+		build(removed_vars, full);
+
+	if (reduced.rows() != reduced_size_ || reduced.cols() != reduced_size_)
+		reduced.resize(reduced_size_, reduced_size_);
+	if (!reduced.isCompressed())
+		reduced.makeCompressed();
+	reduced.resizeNonZeros(value_indices_.size());
+
+	std::copy(reduced_outer_.begin(), reduced_outer_.end(), reduced.outerIndexPtr());
+	std::copy(reduced_inner_.begin(), reduced_inner_.end(), reduced.innerIndexPtr());
+
+	const double *full_values = full.valuePtr();
+	double *values = reduced.valuePtr();
+	for (size_t i = 0; i < value_indices_.size(); ++i)
+		values[i] = full_values[value_indices_[i]];
+}
+
+void polyfem::utils::FullToReducedMatrixMap::clear()
+{
+	removed_vars_.clear();
+	full_outer_.clear();
+	full_inner_.clear();
+	reduced_size_ = 0;
+	reduced_outer_.clear();
+	reduced_inner_.clear();
+	value_indices_.clear();
+}
+
+bool polyfem::utils::FullToReducedMatrixMap::matches(const std::vector<int> &removed_vars, const StiffnessMatrix &full) const
+{
+	// comparing the patterns is much cheaper than rebuilding the map
+	return size_t(full.outerSize() + 1) == full_outer_.size()
+		   && size_t(full.nonZeros()) == full_inner_.size()
+		   && removed_vars == removed_vars_
+		   && std::equal(full_outer_.begin(), full_outer_.end(), full.outerIndexPtr())
+		   && std::equal(full_inner_.begin(), full_inner_.end(), full.innerIndexPtr());
+}
+
+void polyfem::utils::FullToReducedMatrixMap::build(const std::vector<int> &removed_vars, const StiffnessMatrix &full)
+{
+	POLYFEM_SCOPED_TIMER("build full to reduced matrix map");
+	assert(full.isCompressed());
+	assert(std::is_sorted(removed_vars.begin(), removed_vars.end()));
+
+	const int full_size = full.rows();
+	removed_vars_ = removed_vars;
+	full_outer_.assign(full.outerIndexPtr(), full.outerIndexPtr() + full.outerSize() + 1);
+	full_inner_.assign(full.innerIndexPtr(), full.innerIndexPtr() + full.nonZeros());
+
+	std::vector<int> indices(full_size);
+	int index = 0;
+	size_t kk = 0;
+	for (int i = 0; i < full_size; ++i)
+	{
+		if (kk < removed_vars.size() && removed_vars[kk] == i)
+		{
+			++kk;
+			indices[i] = -1;
+		}
+		else
+			indices[i] = index++;
+	}
+	reduced_size_ = index;
+
+	// the indices are increasing, the inner indices of the reduced matrix stay sorted
+	reduced_outer_.assign(1, 0);
+	reduced_outer_.reserve(reduced_size_ + 1);
+	reduced_inner_.clear();
+	value_indices_.clear();
+	for (int k = 0; k < full.outerSize(); ++k)
+	{
+		if (indices[k] < 0)
+			continue;
+
+		for (StorageIndex j = full_outer_[k]; j < full_outer_[k + 1]; ++j)
+		{
+			const int row = indices[full_inner_[j]];
+			if (row < 0)
+				continue;
+			reduced_inner_.push_back(row);
+			value_indices_.push_back(j);
+		}
+		reduced_outer_.push_back(reduced_inner_.size());
+	}
+	assert(reduced_outer_.size() == size_t(reduced_size_ + 1));
+}
+
+void polyfem::utils::SparseMatrixSum::sum(std::vector<StiffnessMatrix> &terms, StiffnessMatrix &sum)
+{
+	POLYFEM_SCOPED_TIMER("sum sparse matrices");
+
+	if (terms.empty())
+	{
+		sum.setZero();
+		return;
+	}
+
+	for (StiffnessMatrix &term : terms)
+	{
+		assert(term.rows() == terms[0].rows() && term.cols() == terms[0].cols());
+		term.makeCompressed();
+	}
+
+	bool valid = terms.size() == terms_.size() && terms[0].rows() == rows_ && terms[0].cols() == cols_;
+	for (size_t i = 0; valid && i < terms.size(); ++i)
+	{
+		if (!terms_[i].matches(terms[i]))
+			valid = map_term(terms[i], terms_[i]);
+	}
+	if (!valid)
+		build(terms);
+
+	sum.resize(rows_, cols_);
+	sum.makeCompressed();
+	sum.resizeNonZeros(inner_.size());
+	std::copy(outer_.begin(), outer_.end(), sum.outerIndexPtr());
+	std::copy(inner_.begin(), inner_.end(), sum.innerIndexPtr());
+
+	double *values = sum.valuePtr();
+	std::fill(values, values + inner_.size(), 0.0);
+	for (size_t i = 0; i < terms.size(); ++i)
+	{
+		const double *term_values = terms[i].valuePtr();
+		const std::vector<StorageIndex> &value_indices = terms_[i].value_indices;
+		for (size_t j = 0; j < value_indices.size(); ++j)
+			values[value_indices[j]] += term_values[j];
+	}
+}
+
+void polyfem::utils::SparseMatrixSum::clear()
+{
+	rows_ = 0;
+	cols_ = 0;
+	outer_.clear();
+	inner_.clear();
+	terms_.clear();
+}
+
+bool polyfem::utils::SparseMatrixSum::Term::matches(const StiffnessMatrix &mat) const
+{
+	return size_t(mat.outerSize() + 1) == outer.size()
+		   && size_t(mat.nonZeros()) == inner.size()
+		   && std::equal(outer.begin(), outer.end(), mat.outerIndexPtr())
+		   && std::equal(inner.begin(), inner.end(), mat.innerIndexPtr());
+}
+
+bool polyfem::utils::SparseMatrixSum::map_term(const StiffnessMatrix &mat, Term &term) const
+{
+	assert(mat.isCompressed());
+
+	term.value_indices.resize(mat.nonZeros());
+	for (int k = 0; k < mat.outerSize(); ++k)
+	{
+		// both patterns are sorted, the union column is scanned once
+		const StorageIndex *begin = inner_.data() + outer_[k];
+		const StorageIndex *end = inner_.data() + outer_[k + 1];
+		for (StorageIndex j = mat.outerIndexPtr()[k]; j < mat.outerIndexPtr()[k + 1]; ++j)
+		{
+			begin = std::lower_bound(begin, end, mat.innerIndexPtr()[j]);
+			if (begin == end || *begin != mat.innerIndexPtr()[j])
+				return false;
+			term.value_indices[j] = begin - inner_.data();
+		}
+	}
+
+	term.outer.assign(mat.outerIndexPtr(), mat.outerIndexPtr() + mat.outerSize() + 1);
+	term.inner.assign(mat.innerIndexPtr(), mat.innerIndexPtr() + mat.nonZeros());
+	return true;
+}
+
+void polyfem::utils::SparseMatrixSum::build(const std::vector<StiffnessMatrix> &terms)
+{
+	POLYFEM_SCOPED_TIMER("build sparse matrix sum pattern");
+
+	rows_ = terms[0].rows();
+	cols_ = terms[0].cols();
+
+	outer_.assign(1, 0);
+	outer_.reserve(cols_ + 1);
+	inner_.clear();
+	std::vector<StorageIndex> column;
+	for (int k = 0; k < cols_; ++k)
+	{
+		column.clear();
+		for (const StiffnessMatrix &term : terms)
+			column.insert(column.end(), term.innerIndexPtr() + term.outerIndexPtr()[k], term.innerIndexPtr() + term.outerIndexPtr()[k + 1]);
+		std::sort(column.begin(), column.end());
+		column.erase(std::unique(column.begin(), column.end()), column.end());
+
+		inner_.insert(inner_.end(), column.begin(), column.end());
+		outer_.push_back(inner_.size());
+	}
+
+	// every term is contained in the union, the mapping cannot fail
+	terms_.resize(terms.size());
+	for (size_t i = 0; i < terms.size(); ++i)
+		map_term(terms[i], terms_[i]);
+}
+
 Eigen::MatrixXd polyfem::utils::reorder_matrix(
 	const Eigen::MatrixXd &in,
 	const Eigen::VectorXi &in_to_out,
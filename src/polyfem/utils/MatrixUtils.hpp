@@ -5,6 +5,8 @@
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
 
+#include <vector>
+
 namespace polyfem
 {
 	namespace utils
@@ -107,6 +109,76 @@ namespace polyfem
 			const StiffnessMatrix &full,
 			StiffnessMatrix &reduced);
 
+		/// @brief Cached version of full_to_reduced_matrix for matrices with a fixed sparsity pattern.
+		/// The reduced pattern and the position in the full values of every reduced entry are computed
+		/// once, the following reductions copy the values in a single pass without triplets.
+		class FullToReducedMatrixMap
+		{
+		public:
+			/// @brief Map a full size matrix to a reduced one by dropping rows and columns.
+			/// The map is rebuilt if the removed variables or the sparsity pattern of full changed.
+			/// @param[in] removed_vars Sorted indices of the variables (rows and columns of full) to remove.
+			/// @param[in] full Full size matrix.
+			/// @param[out] reduced Output reduced size matrix.
+			void reduce(const std::vector<int> &removed_vars, const StiffnessMatrix &full, StiffnessMatrix &reduced);
+
+			/// @brief Forget the cached map.
+			void clear();
+
+		private:
+			using StorageIndex = StiffnessMatrix::StorageIndex;
+
+			bool matches(const std::vector<int> &removed_vars, const StiffnessMatrix &full) const;
+			void build(const std::vector<int> &removed_vars, const StiffnessMatrix &full);
+
+			std::vector<int> removed_vars_;
+			std::vector<StorageIndex> full_outer_; ///< sparsity pattern of the full matrix the map was built for
+			std::vector<StorageIndex> full_inner_;
+
+			int reduced_size_ = 0;
+			std::vector<StorageIndex> reduced_outer_; ///< sparsity pattern of the reduced matrix
+			std::vector<StorageIndex> reduced_inner_;
+			std::vector<StorageIndex> value_indices_; ///< index in the full values of every reduced value
+		};
+
+		/// @brief Sum of sparse matrices with different sparsity patterns (eg the Hessians of the forms) into
+		/// the cached union of their patterns. The position in the sum of every entry of every term is computed
+		/// once, the following sums only accumulate the values. A term whose pattern changed but is contained in
+		/// the union (eg fewer contacts) only rebuilds its own map, the union is rebuilt if an entry is missing.
+		class SparseMatrixSum
+		{
+		public:
+			/// @brief Sum the terms.
+			/// @param[in,out] terms Matrices of the same size, compressed in place if needed.
+			/// @param[out] sum Sum of the terms, with the union pattern (that can contain explicit zeros).
+			void sum(std::vector<StiffnessMatrix> &terms, StiffnessMatrix &sum);
+
+			/// @brief Forget the cached patterns.
+			void clear();
+
+		private:
+			using StorageIndex = StiffnessMatrix::StorageIndex;
+
+			struct Term
+			{
+				std::vector<StorageIndex> outer; ///< sparsity pattern of the term the map was built for
+				std::vector<StorageIndex> inner;
+				std::vector<StorageIndex> value_indices; ///< index in the sum values of every term value
+
+				bool matches(const StiffnessMatrix &mat) const;
+			};
+
+			/// maps the term into the current union, returns false if an entry is not in the union
+			bool map_term(const StiffnessMatrix &mat, Term &term) const;
+			void build(const std::vector<StiffnessMatrix> &terms);
+
+			int rows_ = 0;
+			int cols_ = 0;
+			std::vector<StorageIndex> outer_; ///< union sparsity pattern
+			std::vector<StorageIndex> inner_;
+			std::vector<Term> terms_;
+		};
+
 		/// @brief Reorder row blocks in a matrix.
 		/// @param in Input matrix.
 		/// @param in_to_out Mapping from input blocks to output blocks.
@@ -31,8 +31,10 @@ namespace polyfem
 		inline void maybe_parallel_for(int size, const std::function<void(int)> &body)
 		{
 #if defined(POLYFEM_WITH_CPP_THREADS)
-			for (int i = 0; i < size; ++i)
-				body(i);
+			par_for(size, [&](int start, int end, int thread_id) {
+				for (int i = start; i < end; ++i)
+					body(i);
+			});
 #elif defined(POLYFEM_WITH_TBB)
 			tbb::parallel_for(0, size, body);
 #else
@@ -45,8 +47,18 @@ namespace polyfem
 		inline auto create_thread_storage(const LocalStorage &initial_local_storage)
 		{
 #if defined(POLYFEM_WITH_CPP_THREADS)
-			return std::vector<LocalStorage>(get_n_threads(), initial_local_storage);
+			std::vector<LocalStorage> storage(get_n_threads(), initial_local_storage);
+			// with pinned threads, every thread reallocates its own storage so that it is first-touched on its NUMA node
+			if (NThread::get().affinity() != ThreadAffinity::None)
+			{
+				par_for_each_thread([&](int thread_id) {
+					LocalStorage local(initial_local_storage);
+					std::swap(storage[thread_id], local);
+				});
+			}
+			return storage;
 #elif defined(POLYFEM_WITH_TBB)
+			// the local storages are lazily copied by the thread that uses them first
 			return tbb::enumerable_thread_specific<LocalStorage>(initial_local_storage);
 #else
 			return std::array<LocalStorage, 1>{{initial_local_storage}};
@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace polyfem::utils
+{
+	/// @brief Vector of trivially copyable values stored inline up to N entries.
+	/// Only lists longer than N allocate on the heap, so arrays of mesh entities
+	/// with short connectivity lists are stored in one contiguous block.
+	/// Provides the subset of the std::vector interface used by the mesh code.
+	template <typename T, int N>
+	class SmallVector
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "SmallVector only supports trivially copyable types");
+		static_assert(N > 0, "SmallVector needs a positive inline capacity");
+
+	public:
+		using value_type = T;
+		using size_type = std::size_t;
+		using difference_type = std::ptrdiff_t;
+		using reference = T &;
+		using const_reference = const T &;
+		using pointer = T *;
+		using const_pointer = const T *;
+		using iterator = T *;
+		using const_iterator = const T *;
+
+		SmallVector() = default;
+		explicit SmallVector(const size_type n, const T &value = T()) { resize(n, value); }
+		SmallVector(std::initializer_list<T> init) { assign(init.begin(), init.end()); }
+		SmallVector(const std::vector<T> &other) { assign(other.begin(), other.end()); }
+		template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+		SmallVector(It first, It last) { assign(first, last); }
+
+		SmallVector(const SmallVector &other) { assign(other.begin(), other.end()); }
+		SmallVector(SmallVector &&other) noexcept { steal(other); }
+
+		~SmallVector() { delete[] heap_; }
+
+		SmallVector &operator=(const SmallVector &other)
+		{
+			if (this != &other)
+				assign(other.begin(), other.end());
+			return *this;
+		}
+
+		SmallVector &operator=(SmallVector &&other) noexcept
+		{
+			if (this != &other)
+			{
+				delete[] heap_;
+				heap_ = nullptr;
+				steal(other);
+			}
+			return *this;
+		}
+
+		SmallVector &operator=(const std::vector<T> &other)
+		{
+			assign(other.begin(), other.end());
+			return *this;
+		}
+
+		SmallVector &operator=(std::initializer_list<T> init)
+		{
+			assign(init.begin(), init.end());
+			return *this;
+		}
+
+		operator std::vector<T>() const { return std::vector<T>(begin(), end()); }
+
+		template <typename It>
+		void assign(It first, It last)
+		{
+			const size_type n = std::distance(first, last);
+			size_ = 0;
+			reserve(n);
+			std::copy(first, last, data());
+			size_ = n;
+		}
+
+		inline T *data() { return heap_ ? heap_ : inline_; }
+		inline const T *data() const { return heap_ ? heap_ : inline_; }
+
+		inline iterator begin() { return data(); }
+		inline iterator end() { return data() + size_; }
+		inline const_iterator begin() const { return data(); }
+		inline const_iterator end() const { return data() + size_; }
+		inline const_iterator cbegin() const { return begin(); }
+		inline const_iterator cend() const { return end(); }
+
+		inline size_type size() const { return size_; }
+		inline size_type capacity() const { return capacity_; }
+		inline bool empty() const { return size_ == 0; }
+
+		inline T &operator[](const size_type i)
+		{
+			assert(i < size_);
+			return data()[i];
+		}
+		inline const T &operator[](const size_type i) const
+		{
+			assert(i < size_);
+			return data()[i];
+		}
+
+		inline T &front() { return (*this)[0]; }
+		inline const T &front() const { return (*this)[0]; }
+		inline T &back() { return (*this)[size_ - 1]; }
+		inline const T &back() const { return (*this)[size_ - 1]; }
+
+		void reserve(const size_type n)
+		{
+			if (n <= capacity_)
+				return;
+
+			const size_type new_capacity = std::max<size_type>(n, 2 * capacity_);
+			T *tmp = new T[new_capacity];
+			std::memcpy(tmp, data(), size_ * sizeof(T));
+			delete[] heap_;
+			heap_ = tmp;
+			capacity_ = new_capacity;
+		}
+
+		void resize(const size_type n, const T &value = T())
+		{
+			reserve(n);
+			if (n > size_)
+				std::fill(data() + size_, data() + n, value);
+			size_ = n;
+		}
+
+		inline void clear() { size_ = 0; }
+
+		void push_back(const T &value)
+		{
+			if (size_ == capacity_)
+			{
+				// value may alias an entry of this vector
+				const T tmp = value;
+				reserve(size_ + 1);
+				data()[size_++] = tmp;
+			}
+			else
+				data()[size_++] = value;
+		}
+
+		inline void pop_back()
+		{
+			assert(size_ > 0);
+			--size_;
+		}
+
+		iterator insert(const_iterator pos, const T &value) { return insert(pos, &value, &value + 1); }
+
+		template <typename It, typename = typename std::iterator_traits<It>::iterator_category>
+		iterator insert(const_iterator pos, It first, It last)
+		{
+			const size_type index = pos - begin();
+			const size_type n = std::distance(first, last);
+			if (n == 0)
+				return begin() + index;
+
+			// copies the range first, it may alias this vector
+			const SmallVector tmp(first, last);
+			reserve(size_ + n);
+			T *d = data();
+			std::memmove(d + index + n, d + index, (size_ - index) * sizeof(T));
+			std::memcpy(d + index, tmp.data(), n * sizeof(T));
+			size_ += n;
+			return d + index;
+		}
+
+		iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			const size_type index = first - begin();
+			const size_type n = last - first;
+			T *d = data();
+			std::memmove(d + index, d + index + n, (size_ - index - n) * sizeof(T));
+			size_ -= n;
+			return d + index;
+		}
+
+		/// heap memory used by the vector (in bytes), 0 if the entries are stored inline
+		inline size_type heap_memory() const { return heap_ ? capacity_ * sizeof(T) : 0; }
+
+		friend bool operator==(const SmallVector &a, const SmallVector &b)
+		{
+			return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin());
+		}
+		friend bool operator!=(const SmallVector &a, const SmallVector &b) { return !(a == b); }
+		friend bool operator<(const SmallVector &a, const SmallVector &b)
+		{
+			return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+		}
+
+	private:
+		void steal(SmallVector &other)
+		{
+			size_ = other.size_;
+			capacity_ = other.capacity_;
+			if (other.heap_)
+			{
+				heap_ = other.heap_;
+				other.heap_ = nullptr;
+			}
+			else
+				std::memcpy(inline_, other.inline_, size_ * sizeof(T));
+
+			other.size_ = 0;
+			other.capacity_ = N;
+		}
+
+		T inline_[N] = {};
+		T *heap_ = nullptr;
+		uint32_t size_ = 0;
+		uint32_t capacity_ = N;
+	};
+} // namespace polyfem::utils
@@ -1,32 +1,432 @@
 #include "par_for.hpp"
 
+#include <polyfem/utils/Logger.hpp>
+
 #include <vector>
 #include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#ifdef POLYFEM_WITH_CPP_THREADS
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#endif
 
 namespace polyfem
 {
 	namespace utils
 	{
-		void par_for(const int size, const std::function<void(int, int, int)> &func)
-		{
 #ifdef POLYFEM_WITH_CPP_THREADS
-			const size_t n_threads = get_n_threads();
-			if (n_threads == 1)
-				func(0, size, /*thread_id=*/0); // actually the full for loop
-			else
+		namespace
+		{
+			/// id of the current thread inside a par_for, -1 outside
+			thread_local int current_thread_id = -1;
+
+			/// Persistent pool of n_threads - 1 workers, the calling thread is thread 0.
+			/// The range is split in chunks, each thread first consumes its own contiguous
+			/// set of chunks and then steals from the end of the other threads' sets.
+			class ThreadPool
+			{
+			public:
+				/// number of chunks per thread, more chunks improve the load balancing of uneven work
+				static constexpr int chunks_per_thread = 8;
+
+				ThreadPool(const int n_threads, const ThreadAffinity affinity)
+					: n_threads_(n_threads), affinity_(affinity), queues_(n_threads)
+				{
+					// only the workers are pinned, the calling thread keeps its affinity
+					// (and so do the threads it spawns later, eg by the linear solver)
+					for (int t = 1; t < n_threads_; ++t)
+						workers_.emplace_back([this, t]() {
+							pin_thread(t);
+							worker_loop(t);
+						});
+				}
+
+				~ThreadPool()
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex_);
+						stop_ = true;
+					}
+					start_cv_.notify_all();
+					for (std::thread &w : workers_)
+						w.join();
+				}
+
+				int n_threads() const { return n_threads_; }
+				ThreadAffinity affinity() const { return affinity_; }
+
+				/// if steal is false, the range must have n_threads entries and thread t processes only entry t
+				void run(const int size, const std::function<void(int, int, int)> &func, const bool steal = true)
+				{
+					assert(steal || size == n_threads_);
+					func_ = &func;
+					size_ = size;
+					n_chunks_ = steal ? std::min(size, n_threads_ * chunks_per_thread) : n_threads_;
+					steal_ = steal;
+					exception_ = nullptr;
+
+					for (int t = 0; t < n_threads_; ++t)
+					{
+						queues_[t].begin = t * n_chunks_ / n_threads_;
+						queues_[t].end = (t + 1) * n_chunks_ / n_threads_;
+					}
+
+					{
+						std::lock_guard<std::mutex> lock(mutex_);
+						active_ = n_threads_ - 1;
+						++generation_;
+					}
+					start_cv_.notify_all();
+
+					execute(0);
+
+					{
+						std::unique_lock<std::mutex> lock(mutex_);
+						done_cv_.wait(lock, [this]() { return active_ == 0; });
+					}
+					func_ = nullptr;
+
+					if (exception_)
+						std::rethrow_exception(exception_);
+				}
+
+			private:
+				struct ChunkQueue
+				{
+					std::mutex mutex;
+					int begin = 0; ///< next chunk to process by the owner
+					int end = 0;   ///< one past the last chunk, stolen from the back
+				};
+
+				inline int chunk_start(const int chunk) const { return int(long(chunk) * size_ / n_chunks_); }
+
+				bool pop(const int t, int &chunk)
+				{
+					ChunkQueue &q = queues_[t];
+					std::lock_guard<std::mutex> lock(q.mutex);
+					if (q.begin >= q.end)
+						return false;
+					chunk = q.begin++;
+					return true;
+				}
+
+				bool steal(const int t, int &chunk)
+				{
+					for (int k = 1; k < n_threads_; ++k)
+					{
+						ChunkQueue &q = queues_[(t + k) % n_threads_];
+						std::lock_guard<std::mutex> lock(q.mutex);
+						if (q.begin < q.end)
+						{
+							chunk = --q.end;
+							return true;
+						}
+					}
+					return false;
+				}
+
+				void execute(const int t)
+				{
+					current_thread_id = t;
+					int chunk;
+					while (pop(t, chunk) || (steal_ && steal(t, chunk)))
+					{
+						try
+						{
+							(*func_)(chunk_start(chunk), chunk_start(chunk + 1), t);
+						}
+						catch (...)
+						{
+							std::lock_guard<std::mutex> lock(mutex_);
+							if (!exception_)
+								exception_ = std::current_exception();
+						}
+					}
+					current_thread_id = -1;
+				}
+
+				void worker_loop(const int t)
+				{
+					size_t generation = 0;
+					while (true)
+					{
+						{
+							std::unique_lock<std::mutex> lock(mutex_);
+							start_cv_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+							if (stop_)
+								return;
+							generation = generation_;
+						}
+
+						execute(t);
+
+						{
+							std::lock_guard<std::mutex> lock(mutex_);
+							if (--active_ == 0)
+								done_cv_.notify_one();
+						}
+					}
+				}
+
+				const int n_threads_;
+				const ThreadAffinity affinity_;
+				std::vector<ChunkQueue> queues_;
+				std::vector<std::thread> workers_;
+
+				std::mutex mutex_;
+				std::condition_variable start_cv_;
+				std::condition_variable done_cv_;
+				size_t generation_ = 0;
+				int active_ = 0;
+				bool stop_ = false;
+
+				const std::function<void(int, int, int)> *func_ = nullptr;
+				int size_ = 0;
+				int n_chunks_ = 0;
+				bool steal_ = true;
+				std::exception_ptr exception_;
+			};
+
+			std::mutex pool_mutex;
+			std::unique_ptr<ThreadPool> pool;
+
+			/// runs func on the pool, returns false if the pool cannot be used (single thread, nested, or busy)
+			bool run_on_pool(const int size, const std::function<void(int, int, int)> &func, const bool steal)
 			{
-				std::vector<std::thread> threads(n_threads);
+				const int n_threads = get_n_threads();
+				if (n_threads == 1 || current_thread_id >= 0)
+					return false;
+
+				std::unique_lock<std::mutex> lock(pool_mutex, std::try_to_lock);
+				if (!lock.owns_lock())
+					return false;
 
-				for (int t = 0; t < n_threads; t++)
+				const ThreadAffinity affinity = NThread::get().affinity();
+				if (pool == nullptr || pool->n_threads() != n_threads || pool->affinity() != affinity)
 				{
-					threads[t] = std::thread(std::bind(
-						func,
-						t * size / n_threads,
-						(t + 1) == n_threads ? size : (t + 1) * size / n_threads,
-						t));
+					pool.reset();
+					pool = std::make_unique<ThreadPool>(n_threads, affinity);
 				}
-				std::for_each(threads.begin(), threads.end(), [](std::thread &x) { x.join(); });
+
+				pool->run(size, func, steal);
+				return true;
 			}
+		} // namespace
+#endif
+
+		namespace
+		{
+#ifdef __linux__
+			/// affinity of the process before any thread is pinned, captured on the first call (from set_affinity on the main thread)
+			const cpu_set_t &original_mask()
+			{
+				static const cpu_set_t mask = []() {
+					cpu_set_t m;
+					CPU_ZERO(&m);
+					if (sched_getaffinity(0, sizeof(m), &m) != 0)
+					{
+						for (int c = 0; c < CPU_SETSIZE; ++c)
+							CPU_SET(c, &m);
+					}
+					return m;
+				}();
+				return mask;
+			}
+
+			/// true once a thread has been pinned, the threads are restored to original_mask afterwards
+			std::atomic<bool> has_pinned_threads(false);
+#endif
+
+			/// parses a sysfs cpu list such as "0-3,8,10-11"
+			std::vector<int> parse_cpu_list(const std::string &list)
+			{
+				std::vector<int> cpus;
+				std::stringstream ss(list);
+				std::string range;
+				while (std::getline(ss, range, ','))
+				{
+					if (range.empty())
+						continue;
+					const size_t dash = range.find('-');
+					const int first = std::stoi(range.substr(0, dash));
+					const int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+					for (int c = first; c <= last; ++c)
+						cpus.push_back(c);
+				}
+				return cpus;
+			}
+
+			/// cores available to the process grouped by NUMA node
+			std::vector<std::vector<int>> numa_nodes()
+			{
+				std::vector<std::vector<int>> nodes;
+#ifdef __linux__
+				const cpu_set_t &allowed = original_mask();
+
+				for (int n = 0;; ++n)
+				{
+					std::ifstream file("/sys/devices/system/node/node" + std::to_string(n) + "/cpulist");
+					if (!file.is_open())
+						break;
+
+					std::string list;
+					std::getline(file, list);
+
+					std::vector<int> cpus;
+					for (const int c : parse_cpu_list(list))
+						if (c < CPU_SETSIZE && CPU_ISSET(c, &allowed))
+							cpus.push_back(c);
+					if (!cpus.empty())
+						nodes.push_back(cpus);
+				}
+
+				// no NUMA information, all the allowed cores in a single node
+				if (nodes.empty())
+				{
+					nodes.emplace_back();
+					for (int c = 0; c < CPU_SETSIZE; ++c)
+						if (CPU_ISSET(c, &allowed))
+							nodes.back().push_back(c);
+				}
+#endif
+				return nodes;
+			}
+
+			/// core of every thread id for the given affinity
+			std::vector<int> thread_to_core(const ThreadAffinity affinity)
+			{
+				static const std::vector<std::vector<int>> nodes = numa_nodes();
+
+				std::vector<int> cores;
+				if (affinity == ThreadAffinity::Compact)
+				{
+					for (const auto &node : nodes)
+						cores.insert(cores.end(), node.begin(), node.end());
+				}
+				else if (affinity == ThreadAffinity::Spread)
+				{
+					size_t max_size = 0;
+					for (const auto &node : nodes)
+						max_size = std::max(max_size, node.size());
+					for (size_t i = 0; i < max_size; ++i)
+						for (const auto &node : nodes)
+							if (i < node.size())
+								cores.push_back(node[i]);
+				}
+				return cores;
+			}
+
+#ifdef POLYFEM_WITH_TBB
+			class ThreadPinner : public tbb::task_scheduler_observer
+			{
+			public:
+				ThreadPinner() { observe(true); }
+				~ThreadPinner() { observe(false); }
+
+				void on_scheduler_entry(bool is_worker) override
+				{
+					// the master threads are not pinned, otherwise every thread they spawn would inherit a single core
+					if (is_worker)
+						pin_thread(tbb::this_task_arena::current_thread_index());
+				}
+			};
+#endif
+		} // namespace
+
+		ThreadAffinity thread_affinity_from_string(const std::string &name)
+		{
+			if (name == "none")
+				return ThreadAffinity::None;
+			if (name == "compact")
+				return ThreadAffinity::Compact;
+			if (name == "spread")
+				return ThreadAffinity::Spread;
+
+			log_and_throw_error("Unknown thread affinity {}", name);
+			return ThreadAffinity::None;
+		}
+
+		void NThread::set_affinity(const ThreadAffinity affinity)
+		{
+			affinity_ = affinity;
+#ifndef __linux__
+			if (affinity_ != ThreadAffinity::None)
+				logger().warn("Thread affinity is only supported on Linux");
+#endif
+
+#ifdef __linux__
+			original_mask();
+#endif
+
+#ifdef POLYFEM_WITH_TBB
+			// the pinner stays installed once an affinity has been set, with None it restores
+			// the original affinity of the workers the next time they enter the arena
+			if (affinity_ != ThreadAffinity::None && thread_pinner == nullptr)
+				thread_pinner = std::make_shared<ThreadPinner>();
+#endif
+		}
+
+		void pin_thread(const int thread_id)
+		{
+			const ThreadAffinity affinity = NThread::get().affinity();
+			if (thread_id < 0)
+				return;
+
+#ifdef __linux__
+			if (affinity == ThreadAffinity::None)
+			{
+				if (has_pinned_threads)
+					pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &original_mask());
+				return;
+			}
+
+			static const std::vector<int> compact = thread_to_core(ThreadAffinity::Compact);
+			static const std::vector<int> spread = thread_to_core(ThreadAffinity::Spread);
+			const std::vector<int> &cores = affinity == ThreadAffinity::Compact ? compact : spread;
+			if (cores.empty())
+				return;
+
+			cpu_set_t set;
+			CPU_ZERO(&set);
+			CPU_SET(cores[thread_id % cores.size()], &set);
+			has_pinned_threads = true;
+			if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0)
+				logger().debug("Unable to pin thread {} to core {}", thread_id, cores[thread_id % cores.size()]);
+#endif
+		}
+
+		void par_for(const int size, const std::function<void(int, int, int)> &func)
+		{
+#ifdef POLYFEM_WITH_CPP_THREADS
+			if (size <= 0)
+				return;
+
+			// nested loops or a busy pool run serially on the calling thread
+			if (!run_on_pool(size, func, /*steal=*/true))
+				func(0, size, std::max(current_thread_id, 0)); // actually the full for loop
+#endif
+		}
+
+		void par_for_each_thread(const std::function<void(int)> &func)
+		{
+#ifdef POLYFEM_WITH_CPP_THREADS
+			const int n_threads = get_n_threads();
+			const std::function<void(int, int, int)> each = [&](int start, int end, int thread_id) {
+				for (int t = start; t < end; ++t)
+					func(t);
+			};
+			if (!run_on_pool(n_threads, each, /*steal=*/false))
+				each(0, n_threads, 0);
 #endif
 		}
 	} // namespace utils
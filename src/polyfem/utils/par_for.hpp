@@ -1,18 +1,32 @@
 #pragma once
 
 #include <functional>
+#include <memory>
+#include <string>
 #include <thread>
 
 #include <Eigen/Core>
 
 #ifdef POLYFEM_WITH_TBB
 #include <tbb/global_control.h>
+#include <tbb/task_scheduler_observer.h>
 #endif
 
 namespace polyfem
 {
 	namespace utils
 	{
+		/// placement of the threads on the cores
+		enum class ThreadAffinity
+		{
+			None,    ///< threads are placed by the OS
+			Compact, ///< thread i on the i-th core, filling a NUMA node before the next one
+			Spread   ///< threads distributed round robin over the NUMA nodes
+		};
+
+		/// parses "none", "compact", or "spread"
+		ThreadAffinity thread_affinity_from_string(const std::string &name);
+
 		class NThread
 		{
 		public:
@@ -36,18 +50,35 @@ namespace polyfem
 				Eigen::setNbThreads(num_threads);
 			}
 
+			inline ThreadAffinity affinity() const { return affinity_; }
+
+			/// pins the worker threads used by the parallel loops (only supported on Linux), the calling thread is never pinned
+			void set_affinity(const ThreadAffinity affinity);
+
 		private:
 			NThread() {}
 
 			size_t num_threads_;
+			ThreadAffinity affinity_ = ThreadAffinity::None;
 
 #ifdef POLYFEM_WITH_TBB
 			/// limits the number of used threads
 			std::shared_ptr<tbb::global_control> thread_limiter;
+			/// pins the TBB worker threads when they join the arena
+			std::shared_ptr<tbb::task_scheduler_observer> thread_pinner;
 #endif
 		};
 
+		/// pins the calling thread to the core assigned to thread_id by the current affinity, only called on worker threads
+		/// with None, restores the original affinity of the process if threads have been pinned before
+		void pin_thread(const int thread_id);
+
+		/// calls func(start, end, thread_id) on chunks of [0, size) with the C++ threads backend, the chunks
+		/// are processed by a persistent pool of get_n_threads() threads that steal work from each other
 		void par_for(const int size, const std::function<void(int, int, int)> &func);
+		/// calls func(thread_id) once on each of the get_n_threads() threads of the C++ threads backend,
+		/// used to first-touch per thread storage on the NUMA node of its thread
+		void par_for_each_thread(const std::function<void(int)> &func);
 		inline size_t get_n_threads() { return NThread::get().num_threads(); }
 	} // namespace utils
 } // namespace polyfem
@@ -2,9 +2,21 @@
 
 #include <polyfem/assembler/NeoHookeanElasticity.hpp>
 #include <polyfem/assembler/NeoHookeanElasticityAutodiff.hpp>
+#include <polyfem/assembler/Laplacian.hpp>
+#include <polyfem/assembler/LinearElasticity.hpp>
+#include <polyfem/assembler/Mass.hpp>
+#include <polyfem/basis/LagrangeBasis2d.hpp>
+#include <polyfem/basis/LagrangeBasis3d.hpp>
+#include <polyfem/mesh/mesh2D/Mesh2D.hpp>
+#include <polyfem/mesh/mesh3D/Mesh3D.hpp>
+#include <polyfem/mesh/MeshNodes.hpp>
+#include <polyfem/utils/par_for.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/catch_message.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 #include <iostream>
 
@@ -284,3 +296,623 @@ TEST_CASE("generic_elastic_assembler", "[assembler]")
 		}
 	}
 }
+
+TEST_CASE("packed_assembly_values", "[assembler]")
+{
+	const std::string path = POLYFEM_DATA_DIR;
+	json in_args = json({});
+	in_args["geometry"] = {};
+	in_args["geometry"]["mesh"] = path + "/plane_hole.obj";
+	in_args["geometry"]["surface_selection"] = 7;
+
+	in_args["preset_problem"] = {};
+	in_args["preset_problem"]["type"] = "ElasticExact";
+
+	// all the elastic kernels reading J^{-T}*∇φ from the packed table
+	in_args["materials"] = {};
+	in_args["materials"]["type"] = GENERATE("NeoHookean", "FixedCorotational", "SaintVenant", "LinearElasticity", "MooneyRivlin3ParamSymbolic");
+	if (in_args["materials"]["type"] == "MooneyRivlin3ParamSymbolic")
+	{
+		in_args["materials"]["c1"] = 1e5;
+		in_args["materials"]["c2"] = 1e3;
+		in_args["materials"]["c3"] = 1e3;
+		in_args["materials"]["d1"] = 1e5;
+	}
+	else
+	{
+		in_args["materials"]["E"] = 1e5;
+		in_args["materials"]["nu"] = 0.3;
+	}
+
+	State state;
+	state.init_logger("", spdlog::level::err, spdlog::level::off, false);
+	state.init(in_args, true);
+	state.load_mesh();
+	state.build_basis();
+
+	AssemblyValsCache packed;
+	packed.init(false, state.bases, state.bases, false, AssemblyValsCache::Layout::PACKED);
+	REQUIRE(packed.layout() == AssemblyValsCache::Layout::PACKED);
+	REQUIRE(packed.memory() < state.ass_vals_cache.memory());
+
+	// unpacking an element of the same size reuses the memory of the values
+	{
+		ElementAssemblyValues reused;
+		packed.compute(0, false, state.bases[0], state.bases[0], reused);
+		const double *table = reused.grad_t_m_table.data();
+		const double *grad_t_m = reused.basis_values[0].grad_t_m.data();
+		const AssemblyValues *basis_values = reused.basis_values.data();
+		packed.compute(1, false, state.bases[1], state.bases[1], reused);
+		REQUIRE(reused.basis_values.size() == state.bases[0].bases.size());
+		REQUIRE(reused.grad_t_m_table.data() == table);
+		REQUIRE(reused.basis_values.data() == basis_values);
+		REQUIRE(reused.basis_values[0].grad_t_m.data() == grad_t_m);
+	}
+
+	ElementAssemblyValues vals, packed_vals;
+	for (int e = 0; e < state.bases.size(); ++e)
+	{
+		state.ass_vals_cache.compute(e, false, state.bases[e], state.bases[e], vals);
+		packed.compute(e, false, state.bases[e], state.bases[e], packed_vals);
+
+		REQUIRE(packed_vals.element_id == vals.element_id);
+		REQUIRE(packed_vals.basis_values.size() == vals.basis_values.size());
+		REQUIRE((packed_vals.det - vals.det).norm() == 0);
+		REQUIRE((packed_vals.val - vals.val).norm() == 0);
+		// only the packed values store the gradients table
+		REQUIRE(vals.grad_t_m_table.size() == 0);
+		REQUIRE(packed_vals.grad_t_m_table.size() == vals.det.size() * vals.basis_values.size() * 2);
+		Eigen::MatrixXd grad_t_m, packed_grad_t_m;
+		for (int q = 0; q < vals.det.size(); ++q)
+		{
+			vals.grad_t_m_at(q, grad_t_m);
+			packed_vals.grad_t_m_at(q, packed_grad_t_m);
+			REQUIRE((packed_grad_t_m - grad_t_m).norm() == 0);
+		}
+		for (int i = 0; i < vals.basis_values.size(); ++i)
+		{
+			REQUIRE((packed_vals.basis_values[i].grad_t_m - vals.basis_values[i].grad_t_m).norm() == 0);
+			REQUIRE(packed_vals.basis_values[i].global.size() == vals.basis_values[i].global.size());
+		}
+		for (int q = 0; q < vals.det.size(); ++q)
+			REQUIRE((packed_vals.jac_it[q] - vals.jac_it[q]).norm() == 0);
+	}
+
+	Eigen::MatrixXd disp(state.n_bases * 2, 1);
+	disp.setRandom();
+	disp *= 1e-2;
+
+	SparseMatrixCache mat_cache, packed_mat_cache;
+	StiffnessMatrix hessian, packed_hessian;
+	state.assembler->assemble_hessian(false, state.n_bases, false, state.bases, state.bases, state.ass_vals_cache, 0, 0, disp, Eigen::MatrixXd(), mat_cache, hessian);
+	state.assembler->assemble_hessian(false, state.n_bases, false, state.bases, state.bases, packed, 0, 0, disp, Eigen::MatrixXd(), packed_mat_cache, packed_hessian);
+	REQUIRE((hessian - packed_hessian).norm() == Catch::Approx(0).margin(1e-10));
+
+	Eigen::MatrixXd grad, packed_grad;
+	state.assembler->assemble_gradient(false, state.n_bases, state.bases, state.bases, state.ass_vals_cache, 0, 0, disp, Eigen::MatrixXd(), grad);
+	state.assembler->assemble_gradient(false, state.n_bases, state.bases, state.bases, packed, 0, 0, disp, Eigen::MatrixXd(), packed_grad);
+	REQUIRE((grad - packed_grad).norm() == Catch::Approx(0).margin(1e-10));
+
+	const double energy = state.assembler->assemble_energy(false, state.bases, state.bases, state.ass_vals_cache, 0, 0, disp, Eigen::MatrixXd());
+	const double packed_energy = state.assembler->assemble_energy(false, state.bases, state.bases, packed, 0, 0, disp, Eigen::MatrixXd());
+	REQUIRE(packed_energy == Catch::Approx(energy).margin(1e-10));
+}
+
+TEST_CASE("reference_assembly_values", "[assembler]")
+{
+	const std::string path = POLYFEM_DATA_DIR;
+	json in_args = json({});
+	in_args["geometry"] = {};
+	in_args["geometry"]["mesh"] = path + "/plane_hole.obj";
+	in_args["geometry"]["surface_selection"] = 7;
+
+	in_args["space"]["discr_order"] = 2;
+
+	in_args["preset_problem"] = {};
+	in_args["preset_problem"]["type"] = "ElasticExact";
+
+	in_args["materials"] = {};
+	in_args["materials"]["type"] = "NeoHookean";
+	in_args["materials"]["E"] = 1e5;
+	in_args["materials"]["nu"] = 0.3;
+
+	State state;
+	state.init_logger("", spdlog::level::err, spdlog::level::off, false);
+	state.init(in_args, true);
+	state.load_mesh();
+	state.build_basis();
+
+	for (const bool is_mass : {false, true})
+	{
+		AssemblyValsCache full, reference;
+		full.init(false, state.bases, state.geom_bases(), is_mass);
+		reference.init(false, state.bases, state.geom_bases(), is_mass, AssemblyValsCache::Layout::REFERENCE);
+		REQUIRE(reference.layout() == AssemblyValsCache::Layout::REFERENCE);
+		REQUIRE(reference.n_references() == 1);
+		REQUIRE(reference.memory() < full.memory());
+
+		ElementAssemblyValues vals, reference_vals;
+		for (int e = 0; e < state.bases.size(); ++e)
+		{
+			full.compute(e, false, state.bases[e], state.geom_bases()[e], vals);
+			reference.compute(e, false, state.bases[e], state.geom_bases()[e], reference_vals);
+
+			REQUIRE(reference_vals.element_id == vals.element_id);
+			REQUIRE(reference_vals.basis_values.size() == vals.basis_values.size());
+			REQUIRE((reference_vals.quadrature.weights - vals.quadrature.weights).norm() == 0);
+			REQUIRE((reference_vals.det - vals.det).norm() == Catch::Approx(0).margin(1e-12));
+			REQUIRE((reference_vals.val - vals.val).norm() == Catch::Approx(0).margin(1e-12));
+			for (int i = 0; i < vals.basis_values.size(); ++i)
+			{
+				REQUIRE((reference_vals.basis_values[i].val - vals.basis_values[i].val).norm() == 0);
+				REQUIRE((reference_vals.basis_values[i].grad_t_m - vals.basis_values[i].grad_t_m).norm() == Catch::Approx(0).margin(1e-10));
+				REQUIRE(reference_vals.basis_values[i].global.size() == vals.basis_values[i].global.size());
+			}
+		}
+	}
+}
+
+TEST_CASE("colored_assembly", "[assembler]")
+{
+	const std::string path = POLYFEM_DATA_DIR;
+	json in_args = json({});
+	in_args["geometry"] = {};
+	in_args["geometry"]["mesh"] = path + "/plane_hole.obj";
+	in_args["geometry"]["surface_selection"] = 7;
+
+	in_args["space"]["discr_order"] = 2;
+
+	const bool preset = GENERATE(true, false);
+	if (preset)
+	{
+		// not thread safe, the rhs calls are serialized
+		in_args["preset_problem"] = {};
+		in_args["preset_problem"]["type"] = "ElasticExact";
+	}
+	else
+	{
+		in_args["boundary_conditions"] = {};
+		in_args["boundary_conditions"]["rhs"] = {"x * y", "sin(x) + y"};
+	}
+
+	in_args["materials"] = {};
+	in_args["materials"]["type"] = "LinearElasticity";
+	in_args["materials"]["E"] = 1e5;
+	in_args["materials"]["nu"] = 0.3;
+
+	State state;
+	state.init_logger("", spdlog::level::err, spdlog::level::off, false);
+	state.init(in_args, true);
+	state.load_mesh();
+	state.build_basis();
+
+	AssemblyValsCache colored, colored_mass;
+	colored.init(false, state.bases, state.geom_bases());
+	colored.init_coloring(state.bases);
+	colored_mass.init(false, state.bases, state.geom_bases(), true);
+	colored_mass.init_coloring(state.bases);
+	REQUIRE(!colored.coloring().empty());
+	REQUIRE(colored.coloring().n_elements() == state.bases.size());
+
+	// elements with the same color do not share a node
+	for (int c = 0; c < colored.coloring().n_colors(); ++c)
+	{
+		std::vector<bool> used(state.n_bases, false);
+		for (const int e : colored.coloring().elements(c))
+		{
+			for (const auto &b : state.bases[e].bases)
+			{
+				for (const auto &g : b.global())
+				{
+					REQUIRE(!used[g.index]);
+					used[g.index] = true;
+				}
+			}
+		}
+	}
+
+	StiffnessMatrix stiffness, colored_stiffness;
+	state.assembler->assemble(false, state.n_bases, state.bases, state.geom_bases(), state.ass_vals_cache, 0, stiffness);
+	state.assembler->assemble(false, state.n_bases, state.bases, state.geom_bases(), colored, 0, colored_stiffness);
+	REQUIRE(stiffness.nonZeros() > 0);
+	REQUIRE((stiffness - colored_stiffness).norm() == Catch::Approx(0).margin(1e-10 * stiffness.norm()));
+
+	NeoHookeanElasticity neo_hookean;
+	neo_hookean.set_size(2);
+	neo_hookean.add_multimaterial(0, in_args["materials"], state.units);
+
+	Eigen::MatrixXd disp(state.n_bases * 2, 1);
+	disp.setRandom();
+	disp *= 1e-2;
+
+	Eigen::MatrixXd grad, colored_grad;
+	neo_hookean.assemble_gradient(false, state.n_bases, state.bases, state.geom_bases(), state.ass_vals_cache, 0, 0, disp, disp, grad);
+	neo_hookean.assemble_gradient(false, state.n_bases, state.bases, state.geom_bases(), colored, 0, 0, disp, disp, colored_grad);
+	REQUIRE(grad.norm() > 0);
+	REQUIRE((grad - colored_grad).norm() == Catch::Approx(0).margin(1e-10 * grad.norm()));
+
+	Eigen::MatrixXd rhs, colored_rhs;
+	state.build_rhs_assembler(state.n_bases, state.bases, state.mass_ass_vals_cache)->assemble(state.mass_matrix_assembler->density(), rhs);
+	state.build_rhs_assembler(state.n_bases, state.bases, colored_mass)->assemble(state.mass_matrix_assembler->density(), colored_rhs);
+	REQUIRE(rhs.norm() > 0);
+	REQUIRE((rhs - colored_rhs).norm() == Catch::Approx(0).margin(1e-10 * rhs.norm()));
+}
+
+TEST_CASE("mass_local_assembly", "[assembler]")
+{
+	const std::string path = POLYFEM_DATA_DIR;
+	json in_args = json({});
+	in_args["geometry"] = {};
+	in_args["geometry"]["mesh"] = path + "/plane_hole.obj";
+	in_args["geometry"]["surface_selection"] = 7;
+
+	in_args["space"]["discr_order"] = 2;
+
+	in_args["materials"] = {};
+	in_args["materials"]["type"] = "LinearElasticity";
+	in_args["materials"]["E"] = 1e5;
+	in_args["materials"]["nu"] = 0.3;
+	in_args["materials"]["rho"] = "1 + x * x + y";
+
+	State state;
+	state.init_logger("", spdlog::level::err, spdlog::level::off, false);
+	state.init(in_args, true);
+	state.load_mesh();
+	state.build_basis();
+
+	const Mass &mass = *state.mass_matrix_assembler;
+	const int size = mass.size();
+
+	ElementAssemblyValues vals;
+	for (int e = 0; e < state.bases.size(); ++e)
+	{
+		state.mass_ass_vals_cache.compute(e, false, state.bases[e], state.geom_bases()[e], vals);
+		const QuadratureVector da = vals.det.array() * vals.quadrature.weights.array();
+
+		// the element-wise assembly matches the per entry one
+		Eigen::MatrixXd local;
+		REQUIRE(mass.assemble_local(vals, da, 0, local));
+		REQUIRE(local.rows() == vals.basis_values.size() * size);
+
+		for (int i = 0; i < vals.basis_values.size(); ++i)
+		{
+			for (int j = 0; j < vals.basis_values.size(); ++j)
+			{
+				const auto entry = mass.assemble(LinearAssemblerData(vals, 0, i, j, da));
+				for (int n = 0; n < size; ++n)
+					for (int m = 0; m < size; ++m)
+						REQUIRE(local(i * size + m, j * size + n) == Catch::Approx(entry(n * size + m)).margin(1e-14));
+			}
+		}
+	}
+}
+
+TEST_CASE("packed_assembly_values_benchmark", "[.][assembler][benchmark]")
+{
+	const std::string path = POLYFEM_DATA_DIR;
+	json in_args = json({});
+	in_args["geometry"] = {};
+	in_args["geometry"]["mesh"] = path + "/plane_hole.obj";
+	in_args["geometry"]["surface_selection"] = 7;
+
+	in_args["preset_problem"] = {};
+	in_args["preset_problem"]["type"] = "ElasticExact";
+
+	in_args["materials"] = {};
+	in_args["materials"]["type"] = "NeoHookean";
+	in_args["materials"]["E"] = 1e5;
+	in_args["materials"]["nu"] = 0.3;
+
+	State state;
+	state.init_logger("", spdlog::level::err, spdlog::level::off, false);
+	state.init(in_args, true);
+	state.load_mesh();
+	state.build_basis();
+
+	AssemblyValsCache packed;
+	packed.init(false, state.bases, state.bases, false, AssemblyValsCache::Layout::PACKED);
+	WARN(fmt::format("cache memory unpacked {}B packed {}B", state.ass_vals_cache.memory(), packed.memory()));
+
+	Eigen::MatrixXd disp(state.n_bases * 2, 1);
+	disp.setRandom();
+	disp *= 1e-2;
+
+	SparseMatrixCache mat_cache, packed_mat_cache;
+	StiffnessMatrix hessian, packed_hessian;
+
+	BENCHMARK("hessian unpacked")
+	{
+		state.assembler->assemble_hessian(false, state.n_bases, false, state.bases, state.bases, state.ass_vals_cache, 0, 0, disp, Eigen::MatrixXd(), mat_cache, hessian);
+	};
+	BENCHMARK("hessian packed")
+	{
+		state.assembler->assemble_hessian(false, state.n_bases, false, state.bases, state.bases, packed, 0, 0, disp, Eigen::MatrixXd(), packed_mat_cache, packed_hessian);
+	};
+}
+
+TEST_CASE("parallel_assembly_benchmark", "[.][assembler][benchmark]")
+{
+	// compare the threading backends (POLYFEM_THREADING=TBB or CPP) on the same assembly
+#if defined(POLYFEM_WITH_TBB)
+	const std::string backend = "TBB";
+#elif defined(POLYFEM_WITH_CPP_THREADS)
+	const std::string backend = "CPP";
+#else
+	const std::string backend = "NONE";
+#endif
+
+	const std::string path = POLYFEM_DATA_DIR;
+	json in_args = json({});
+	in_args["geometry"] = {};
+	in_args["geometry"]["mesh"] = path + "/plane_hole.obj";
+	in_args["geometry"]["surface_selection"] = 7;
+
+	in_args["space"]["discr_order"] = 2;
+
+	in_args["preset_problem"] = {};
+	in_args["preset_problem"]["type"] = "ElasticExact";
+
+	in_args["materials"] = {};
+	in_args["materials"]["type"] = "NeoHookean";
+	in_args["materials"]["E"] = 1e5;
+	in_args["materials"]["nu"] = 0.3;
+
+	State state;
+	state.init_logger("", spdlog::level::err, spdlog::level::off, false);
+	state.init(in_args, true);
+	state.load_mesh();
+	state.build_basis();
+
+	WARN(fmt::format("{} backend, {} threads", backend, utils::get_n_threads()));
+
+	Eigen::MatrixXd disp(state.n_bases * 2, 1);
+	disp.setRandom();
+	disp *= 1e-2;
+
+	SparseMatrixCache mat_cache;
+	StiffnessMatrix hessian;
+	Eigen::MatrixXd grad;
+
+	BENCHMARK(backend + " gradient")
+	{
+		state.assembler->assemble_gradient(false, state.n_bases, state.bases, state.geom_bases(), state.ass_vals_cache, 0, 0, disp, Eigen::MatrixXd(), grad);
+	};
+	BENCHMARK(backend + " hessian")
+	{
+		state.assembler->assemble_hessian(false, state.n_bases, false, state.bases, state.geom_bases(), state.ass_vals_cache, 0, 0, disp, Eigen::MatrixXd(), mat_cache, hessian);
+	};
+}
+
+TEST_CASE("numa_assembly_benchmark", "[.][assembler][benchmark]")
+{
+	// assembly scaling with the number of threads and their placement, meant for multi-socket machines
+	const std::string path = POLYFEM_DATA_DIR;
+	json in_args = json({});
+	in_args["geometry"] = {};
+	in_args["geometry"]["mesh"] = path + "/plane_hole.obj";
+	in_args["geometry"]["surface_selection"] = 7;
+	in_args["geometry"]["n_refs"] = 2;
+
+	in_args["space"]["discr_order"] = 2;
+
+	in_args["preset_problem"] = {};
+	in_args["preset_problem"]["type"] = "ElasticExact";
+
+	in_args["materials"] = {};
+	in_args["materials"]["type"] = "NeoHookean";
+	in_args["materials"]["E"] = 1e5;
+	in_args["materials"]["nu"] = 0.3;
+
+	State state;
+	state.init_logger("", spdlog::level::err, spdlog::level::off, false);
+	state.init(in_args, true);
+	state.load_mesh();
+	state.build_basis();
+
+	Eigen::MatrixXd disp(state.n_bases * 2, 1);
+	disp.setRandom();
+	disp *= 1e-2;
+
+	SparseMatrixCache mat_cache;
+	StiffnessMatrix hessian;
+	Eigen::MatrixXd grad;
+
+	const int max_threads = std::thread::hardware_concurrency();
+	for (const std::string affinity : {"none", "compact", "spread"})
+	{
+		utils::NThread::get().set_affinity(utils::thread_affinity_from_string(affinity));
+		for (int n_threads = 1; n_threads <= max_threads; n_threads *= 2)
+		{
+			utils::NThread::get().set_num_threads(n_threads);
+
+			BENCHMARK(fmt::format("{} {} threads gradient", affinity, n_threads))
+			{
+				state.assembler->assemble_gradient(false, state.n_bases, state.bases, state.geom_bases(), state.ass_vals_cache, 0, 0, disp, Eigen::MatrixXd(), grad);
+			};
+			BENCHMARK(fmt::format("{} {} threads hessian", affinity, n_threads))
+			{
+				state.assembler->assemble_hessian(false, state.n_bases, false, state.bases, state.geom_bases(), state.ass_vals_cache, 0, 0, disp, Eigen::MatrixXd(), mat_cache, hessian);
+			};
+		}
+	}
+
+	utils::NThread::get().set_affinity(utils::ThreadAffinity::None);
+	utils::NThread::get().set_num_threads(max_threads);
+}
+
+namespace
+{
+	/// Q_order bases on a n^dim quad or hex grid of the unit square/cube with perturbed interior vertices
+	std::unique_ptr<Mesh> build_tensor_bases(const int dim, const int n, const int order, std::vector<ElementBases> &bases, int &n_bases)
+	{
+		const int n_layers = dim == 2 ? 1 : n + 1;
+		Eigen::MatrixXd V((n + 1) * (n + 1) * n_layers, dim);
+		for (int k = 0, index = 0; k < n_layers; ++k)
+			for (int j = 0; j <= n; ++j)
+				for (int i = 0; i <= n; ++i, ++index)
+				{
+					V.row(index) = Eigen::RowVector3d(i, j, k).head(dim);
+					if (i > 0 && i < n && j > 0 && j < n && (dim == 2 || (k > 0 && k < n)))
+						V.row(index) += 0.2 * Eigen::RowVectorXd::Random(dim);
+				}
+		V /= n;
+
+		// msh ordering of the quad and hex vertices
+		const auto vid = [n](int i, int j, int k) { return (k * (n + 1) + j) * (n + 1) + i; };
+		Eigen::MatrixXi C(dim == 2 ? n * n : n * n * n, dim == 2 ? 4 : 8);
+		for (int k = 0, index = 0; k < std::max(n_layers - 1, 1); ++k)
+			for (int j = 0; j < n; ++j)
+				for (int i = 0; i < n; ++i, ++index)
+				{
+					if (dim == 2)
+						C.row(index) << vid(i, j, 0), vid(i + 1, j, 0), vid(i + 1, j + 1, 0), vid(i, j + 1, 0);
+					else
+						C.row(index) << vid(i, j, k), vid(i + 1, j, k), vid(i + 1, j + 1, k), vid(i, j + 1, k),
+							vid(i, j, k + 1), vid(i + 1, j, k + 1), vid(i + 1, j + 1, k + 1), vid(i, j + 1, k + 1);
+				}
+
+		auto mesh = Mesh::create(V, C);
+		mesh->prepare_mesh();
+
+		std::vector<LocalBoundary> local_boundary;
+		std::map<int, InterfaceData> poly_face_to_data;
+		std::shared_ptr<MeshNodes> nodes;
+		const Eigen::VectorXi orders = Eigen::VectorXi::Constant(mesh->n_elements(), order);
+		if (dim == 2)
+			n_bases = LagrangeBasis2d::build_bases(dynamic_cast<const Mesh2D &>(*mesh), "NeoHookean", -1, -1, orders, false, false, false, bases, local_boundary, poly_face_to_data, nodes);
+		else
+			n_bases = LagrangeBasis3d::build_bases(dynamic_cast<const Mesh3D &>(*mesh), "NeoHookean", -1, -1, orders, false, false, false, bases, local_boundary, poly_face_to_data, nodes);
+
+		return mesh;
+	}
+
+	/// same bases, without the tensor-product structure (dense kernels)
+	std::vector<ElementBases> without_tensor_basis(std::vector<ElementBases> bases)
+	{
+		for (auto &b : bases)
+			b.tensor_basis.reset();
+		return bases;
+	}
+} // namespace
+
+TEST_CASE("sum_factorization", "[assembler]")
+{
+	const json material = {{"E", 1e5}, {"nu", 0.3}};
+	const Units units;
+	const int dim = GENERATE(2, 3);
+	const bool is_volume = dim == 3;
+
+	for (int order = 1; order <= 3; ++order)
+	{
+		std::vector<ElementBases> bases;
+		int n_bases;
+		const auto mesh = build_tensor_bases(dim, dim == 2 ? 3 : 2, order, bases, n_bases);
+		const std::vector<ElementBases> dense_bases = without_tensor_basis(bases);
+		REQUIRE(bases[0].tensor_basis != nullptr);
+
+		AssemblyValsCache cache;
+		cache.init(is_volume, bases, bases);
+
+		// the elements use the quadrature of the tensor-product kernels, another rule with the same number of points does not
+		ElementAssemblyValues vals;
+		cache.compute(0, is_volume, bases[0], bases[0], vals);
+		CHECK(bases[0].tensor_basis->is_quadrature(vals.quadrature));
+		quadrature::Quadrature other = vals.quadrature;
+		other.points.col(0) *= 0.5;
+		CHECK(!bases[0].tensor_basis->is_quadrature(other));
+
+		Laplacian laplacian;
+		laplacian.set_size(1);
+
+		LinearElasticity linear;
+		linear.set_size(dim);
+		linear.add_multimaterial(0, material, units);
+
+		NeoHookeanElasticity neo_hookean;
+		neo_hookean.set_size(dim);
+		neo_hookean.add_multimaterial(0, material, units);
+
+		NeoHookeanAutodiff neo_hookean_autodiff;
+		neo_hookean_autodiff.set_size(dim);
+		neo_hookean_autodiff.add_multimaterial(0, material, units);
+
+		StiffnessMatrix stiffness, dense_stiffness;
+		laplacian.assemble(is_volume, n_bases, bases, bases, cache, 0, stiffness);
+		laplacian.assemble(is_volume, n_bases, dense_bases, dense_bases, cache, 0, dense_stiffness);
+		CHECK((stiffness - dense_stiffness).norm() <= 1e-10 * dense_stiffness.norm());
+
+		linear.assemble(is_volume, n_bases, bases, bases, cache, 0, stiffness);
+		linear.assemble(is_volume, n_bases, dense_bases, dense_bases, cache, 0, dense_stiffness);
+		CHECK((stiffness - dense_stiffness).norm() <= 1e-10 * dense_stiffness.norm());
+
+		Eigen::MatrixXd disp(n_bases * dim, 1);
+		disp.setRandom();
+		disp *= 1e-2;
+
+		for (const Assembler *assembler : std::vector<const Assembler *>{&linear, &neo_hookean, &neo_hookean_autodiff})
+		{
+			Eigen::MatrixXd grad, dense_grad;
+			assembler->assemble_gradient(is_volume, n_bases, bases, bases, cache, 0, 0, disp, Eigen::MatrixXd(), grad);
+			assembler->assemble_gradient(is_volume, n_bases, dense_bases, dense_bases, cache, 0, 0, disp, Eigen::MatrixXd(), dense_grad);
+			CHECK((grad - dense_grad).norm() <= 1e-10 * dense_grad.norm());
+		}
+	}
+}
+
+TEST_CASE("sum_factorization_benchmark", "[.][assembler][benchmark]")
+{
+	// Q3 hexes, sum-factorized against dense local kernels
+	const json material = {{"E", 1e5}, {"nu", 0.3}};
+	const Units units;
+
+	std::vector<ElementBases> bases;
+	int n_bases;
+	const auto mesh = build_tensor_bases(3, 6, 3, bases, n_bases);
+	const std::vector<ElementBases> dense_bases = without_tensor_basis(bases);
+
+	AssemblyValsCache cache;
+	cache.init(true, bases, bases);
+
+	Laplacian laplacian;
+	laplacian.set_size(1);
+
+	LinearElasticity linear;
+	linear.set_size(3);
+	linear.add_multimaterial(0, material, units);
+
+	NeoHookeanElasticity neo_hookean;
+	neo_hookean.set_size(3);
+	neo_hookean.add_multimaterial(0, material, units);
+
+	Eigen::MatrixXd disp(n_bases * 3, 1);
+	disp.setRandom();
+	disp *= 1e-2;
+
+	StiffnessMatrix stiffness;
+	Eigen::MatrixXd grad;
+
+	BENCHMARK("laplacian dense")
+	{
+		laplacian.assemble(true, n_bases, dense_bases, dense_bases, cache, 0, stiffness);
+	};
+	BENCHMARK("laplacian sum factorization")
+	{
+		laplacian.assemble(true, n_bases, bases, bases, cache, 0, stiffness);
+	};
+	BENCHMARK("linear elasticity dense")
+	{
+		linear.assemble(true, n_bases, dense_bases, dense_bases, cache, 0, stiffness);
+	};
+	BENCHMARK("linear elasticity sum factorization")
+	{
+		linear.assemble(true, n_bases, bases, bases, cache, 0, stiffness);
+	};
+	BENCHMARK("neohookean gradient dense")
+	{
+		neo_hookean.assemble_gradient(true, n_bases, dense_bases, dense_bases, cache, 0, 0, disp, Eigen::MatrixXd(), grad);
+	};
+	BENCHMARK("neohookean gradient sum factorization")
+	{
+		neo_hookean.assemble_gradient(true, n_bases, bases, bases, cache, 0, 0, disp, Eigen::MatrixXd(), grad);
+	};
+}
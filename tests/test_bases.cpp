@@ -6,17 +6,25 @@
 #include <polyfem/quadrature/QuadQuadrature.hpp>
 #include <polyfem/quadrature/HexQuadrature.hpp>
 
+#include <polyfem/basis/LagrangeBasis2d.hpp>
 #include <polyfem/basis/LagrangeBasis3d.hpp>
+#include <polyfem/mesh/mesh2D/Mesh2D.hpp>
+#include <polyfem/mesh/mesh3D/Mesh3D.hpp>
+#include <polyfem/mesh/MeshNodes.hpp>
+#include <polyfem/utils/par_for.hpp>
 #include <polyfem/autogen/auto_p_bases.hpp>
 #include <polyfem/autogen/auto_q_bases.hpp>
+#include <polyfem/autogen/auto_fused_bases.hpp>
 
 #include <polyfem/basis/barycentric/MVPolygonalBasis2d.hpp>
 #include <polyfem/basis/barycentric/WSPolygonalBasis2d.hpp>
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
 
 #include <iostream>
+#include <thread>
 ////////////////////////////////////////////////////////////////////////////////
 
 using namespace polyfem;
@@ -1178,3 +1186,171 @@ TEST_CASE("WS_2d", "[bases]")
 		}
 	}
 }
+
+TEST_CASE("fused_bases", "[bases]")
+{
+	using namespace polyfem::autogen;
+
+	const auto check = [](const int dim, FusedBasesFunc fused_val, FusedBasesFunc fused_grad,
+						  const std::function<void(int, const Eigen::MatrixXd &, Eigen::MatrixXd &)> &val_fun,
+						  const std::function<void(int, const Eigen::MatrixXd &, Eigen::MatrixXd &)> &grad_fun) {
+		REQUIRE(fused_val != nullptr);
+		REQUIRE(fused_grad != nullptr);
+
+		const Eigen::MatrixXd uv = (Eigen::MatrixXd::Random(10, dim).array() + 1) / (dim + 1);
+		Eigen::MatrixXd val, grad, expected;
+		fused_val(uv, val);
+		fused_grad(uv, grad);
+
+		REQUIRE(val.rows() == uv.rows());
+		REQUIRE(grad.rows() == uv.rows());
+		REQUIRE(grad.cols() == val.cols() * dim);
+
+		for (int j = 0; j < val.cols(); ++j)
+		{
+			val_fun(j, uv, expected);
+			CHECK((expected - val.col(j)).norm() < 1e-12);
+
+			grad_fun(j, uv, expected);
+			CHECK((expected - grad.middleCols(j * dim, dim)).norm() < 1e-12);
+		}
+	};
+
+	for (int k = 0; k <= MAX_P_BASES; ++k)
+	{
+		check(
+			2, p_fused_basis_value_2d(k), p_fused_grad_basis_value_2d(k),
+			[k](int j, const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { p_basis_value_2d(k, j, uv, val); },
+			[k](int j, const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { p_grad_basis_value_2d(k, j, uv, val); });
+		check(
+			3, p_fused_basis_value_3d(k), p_fused_grad_basis_value_3d(k),
+			[k](int j, const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { p_basis_value_3d(k, j, uv, val); },
+			[k](int j, const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { p_grad_basis_value_3d(k, j, uv, val); });
+	}
+
+	for (int k : {0, 1, 2, 3, -2})
+	{
+		check(
+			2, q_fused_basis_value_2d(k), q_fused_grad_basis_value_2d(k),
+			[k](int j, const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { q_basis_value_2d(k, j, uv, val); },
+			[k](int j, const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { q_grad_basis_value_2d(k, j, uv, val); });
+		check(
+			3, q_fused_basis_value_3d(k), q_fused_grad_basis_value_3d(k),
+			[k](int j, const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { q_basis_value_3d(k, j, uv, val); },
+			[k](int j, const Eigen::MatrixXd &uv, Eigen::MatrixXd &val) { q_grad_basis_value_3d(k, j, uv, val); });
+	}
+
+	CHECK(p_fused_basis_value_3d(MAX_P_BASES + 1) == nullptr);
+}
+
+namespace
+{
+	/// structured quad (2D) or hex (3D) grid of the unit square/cube with perturbed interior vertices
+	std::unique_ptr<Mesh> build_regular_grid(const int dim, const int n)
+	{
+		const int n_vertices_1d = n + 1;
+		const int n_vertices = dim == 2 ? n_vertices_1d * n_vertices_1d : n_vertices_1d * n_vertices_1d * n_vertices_1d;
+		const auto vid = [&](int i, int j, int k) { return (k * n_vertices_1d + j) * n_vertices_1d + i; };
+
+		Eigen::MatrixXd V(n_vertices, dim);
+		for (int k = 0; k < (dim == 2 ? 1 : n_vertices_1d); ++k)
+			for (int j = 0; j < n_vertices_1d; ++j)
+				for (int i = 0; i < n_vertices_1d; ++i)
+				{
+					const bool interior = i > 0 && i < n && j > 0 && j < n && (dim == 2 || (k > 0 && k < n));
+					V.row(vid(i, j, k)) = Eigen::RowVector3d(i, j, k).head(dim) + (interior ? 0.2 : 0.) * Eigen::RowVectorXd::Random(dim);
+				}
+		V /= n;
+
+		Eigen::MatrixXi C(dim == 2 ? n * n : n * n * n, dim == 2 ? 4 : 8);
+		int index = 0;
+		for (int k = 0; k < (dim == 2 ? 1 : n); ++k)
+			for (int j = 0; j < n; ++j)
+				for (int i = 0; i < n; ++i, ++index)
+				{
+					if (dim == 2)
+						C.row(index) << vid(i, j, 0), vid(i + 1, j, 0), vid(i + 1, j + 1, 0), vid(i, j + 1, 0);
+					else
+						C.row(index) << vid(i, j, k), vid(i + 1, j, k), vid(i + 1, j + 1, k), vid(i, j + 1, k),
+							vid(i, j, k + 1), vid(i + 1, j, k + 1), vid(i + 1, j + 1, k + 1), vid(i, j + 1, k + 1);
+				}
+
+		return Mesh::create(V, C);
+	}
+} // namespace
+
+TEST_CASE("parallel_lagrange_bases", "[bases]")
+{
+	const std::string path = POLYFEM_DATA_DIR;
+	const std::string mesh_type = GENERATE("tri", "quad", "tet", "hex");
+	std::unique_ptr<Mesh> mesh;
+	if (mesh_type == "tri")
+		mesh = Mesh::create(path + "/plane_hole.obj");
+	else if (mesh_type == "quad")
+		mesh = build_regular_grid(2, 4);
+	else if (mesh_type == "tet")
+		mesh = Mesh::create(path + "/contact/meshes/3D/simple/cube.msh");
+	else
+		mesh = build_regular_grid(3, 3);
+	REQUIRE(mesh);
+	mesh->prepare_mesh();
+
+	const int order = GENERATE(1, 2, 3);
+	// the geometric bases have disconnected nodes
+	const bool is_geom_bases = GENERATE(false, true);
+
+	const Eigen::VectorXi orders = Eigen::VectorXi::Constant(mesh->n_elements(), order);
+	const auto build = [&](const int n_threads, std::vector<ElementBases> &bases, std::vector<LocalBoundary> &local_boundary, std::shared_ptr<MeshNodes> &nodes) {
+		utils::NThread::get().set_num_threads(n_threads);
+		std::map<int, InterfaceData> poly_to_data;
+		if (mesh->is_volume())
+			return LagrangeBasis3d::build_bases(dynamic_cast<const Mesh3D &>(*mesh), "Laplacian", -1, -1, orders, false, false, is_geom_bases, bases, local_boundary, poly_to_data, nodes);
+		else
+			return LagrangeBasis2d::build_bases(dynamic_cast<const Mesh2D &>(*mesh), "Laplacian", -1, -1, orders, false, false, is_geom_bases, bases, local_boundary, poly_to_data, nodes);
+	};
+
+	const int prev_threads = utils::get_n_threads();
+	const int max_threads = std::max(4u, std::thread::hardware_concurrency());
+
+	std::vector<ElementBases> serial_bases;
+	std::vector<LocalBoundary> serial_boundary;
+	std::shared_ptr<MeshNodes> serial_nodes;
+	const int n_serial = build(1, serial_bases, serial_boundary, serial_nodes);
+
+	for (const int n_threads : {2, max_threads})
+	{
+		std::vector<ElementBases> parallel_bases;
+		std::vector<LocalBoundary> parallel_boundary;
+		std::shared_ptr<MeshNodes> parallel_nodes;
+		const int n_parallel = build(n_threads, parallel_bases, parallel_boundary, parallel_nodes);
+
+		// the numbering does not depend on the number of threads
+		REQUIRE(n_serial == n_parallel);
+		CHECK(serial_nodes->node_to_primitive() == parallel_nodes->node_to_primitive());
+		CHECK(serial_nodes->node_to_primitive_gid() == parallel_nodes->node_to_primitive_gid());
+		CHECK(serial_nodes->primitive_to_node() == parallel_nodes->primitive_to_node());
+
+		REQUIRE(serial_bases.size() == parallel_bases.size());
+		for (int e = 0; e < serial_bases.size(); ++e)
+		{
+			REQUIRE(serial_bases[e].bases.size() == parallel_bases[e].bases.size());
+			CHECK(serial_bases[e].reference_key == parallel_bases[e].reference_key);
+			for (int j = 0; j < serial_bases[e].bases.size(); ++j)
+			{
+				CHECK(serial_bases[e].bases[j].global()[0].index == parallel_bases[e].bases[j].global()[0].index);
+				CHECK(serial_bases[e].bases[j].global()[0].node == parallel_bases[e].bases[j].global()[0].node);
+			}
+		}
+
+		REQUIRE(serial_boundary.size() == parallel_boundary.size());
+		for (int i = 0; i < serial_boundary.size(); ++i)
+		{
+			CHECK(serial_boundary[i].element_id() == parallel_boundary[i].element_id());
+			REQUIRE(serial_boundary[i].size() == parallel_boundary[i].size());
+			for (int j = 0; j < serial_boundary[i].size(); ++j)
+				CHECK(serial_boundary[i].global_primitive_id(j) == parallel_boundary[i].global_primitive_id(j));
+		}
+	}
+
+	utils::NThread::get().set_num_threads(prev_threads);
+}
@@ -133,6 +133,32 @@ namespace
 	}
 } // namespace
 
+TEST_CASE("diff_cache_disk_storage", "[test_adjoint]")
+{
+	const int ndof = 50;
+	const int n_time_steps = 10;
+
+	DiffCache cache;
+	cache.set_storage(DiffCache::Storage::Disk, GENERATE(0, 2));
+	cache.init(2, ndof, n_time_steps);
+
+	std::vector<StiffnessMatrix> jacobians;
+	for (int t = 0; t <= n_time_steps; ++t)
+	{
+		Eigen::MatrixXd dense = Eigen::MatrixXd::Random(ndof, ndof);
+		dense = (dense.array().abs() > 0.8).select(dense, 0);
+		jacobians.push_back(dense.sparseView());
+
+		cache.cache_quantities_transient(
+			t, 1, Eigen::VectorXd::Random(ndof), Eigen::VectorXd::Random(ndof), Eigen::VectorXd::Random(ndof),
+			jacobians.back(), ipc::Collisions(), ipc::FrictionCollisions());
+	}
+
+	// same access order as the transient adjoint solve
+	for (int t = n_time_steps; t >= 0; --t)
+		CHECK((Eigen::MatrixXd(cache.gradu_h(t)) - Eigen::MatrixXd(jacobians[t])).norm() == 0);
+}
+
 TEST_CASE("laplacian", "[test_adjoint]")
 {
 	json opt_args;
@@ -16,6 +16,7 @@
 #include <polyfem/solver/forms/L2ProjectionForm.hpp>
 #include <polyfem/solver/forms/LaggedRegForm.hpp>
 #include <polyfem/solver/forms/RayleighDampingForm.hpp>
+#include <polyfem/solver/NLProblem.hpp>
 
 #include <polyfem/time_integrator/ImplicitEuler.hpp>
 
@@ -24,6 +25,7 @@
 #include <polyfem/State.hpp>
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
 #include <catch2/generators/catch_generators.hpp>
 
 #include <iostream>
@@ -162,6 +164,46 @@ namespace
 
 		return state;
 	}
+
+	/// 1/2 |x|^2 + shift * sum(x), counts the evaluations done by the problem. The notifications
+	/// change shift, so a stale evaluation has the wrong value
+	class CountingForm : public Form
+	{
+	public:
+		std::string name() const override { return "counting"; }
+
+		void solution_changed(const Eigen::VectorXd &new_x) override { shift = new_x.norm(); }
+		void update_quantities(const double t, const Eigen::VectorXd &x) override { shift += 1; }
+		void update_lagging(const Eigen::VectorXd &x, const int iter_num) override { shift += 1; }
+		void set_apply_DBC(const Eigen::VectorXd &x, bool apply_DBC) override { shift += 1; }
+
+		double shift = 0;
+		mutable int n_evaluations = 0;
+
+	protected:
+		double value_unweighted(const Eigen::VectorXd &x) const override
+		{
+			return 0.5 * x.squaredNorm() + shift * x.sum();
+		}
+
+		void first_derivative_unweighted(const Eigen::VectorXd &x, Eigen::VectorXd &gradv) const override
+		{
+			gradv = x.array() + shift;
+		}
+
+		void value_and_first_derivative_unweighted(const Eigen::VectorXd &x, double &val, Eigen::VectorXd &gradv) const override
+		{
+			++n_evaluations;
+			val = value_unweighted(x);
+			first_derivative_unweighted(x, gradv);
+		}
+
+		void second_derivative_unweighted(const Eigen::VectorXd &x, StiffnessMatrix &hessian) const override
+		{
+			hessian.resize(x.size(), x.size());
+			hessian.setIdentity();
+		}
+	};
 } // namespace
 
 template <typename Form>
@@ -196,6 +238,18 @@ void test_form(Form &form, const State &state, double step = 1e-8, double tol =
 			CHECK(fd::compare_gradient(grad, fgrad, tol));
 		}
 
+		// Test the fused value and gradient against the separate evaluations
+		{
+			double val;
+			Eigen::VectorXd grad, expected_grad;
+			form.value_and_first_derivative(x, val, grad);
+			form.first_derivative(x, expected_grad);
+			const double expected_val = form.value(x);
+
+			CHECK(val == Catch::Approx(expected_val).margin(1e-12));
+			CHECK((grad - expected_grad).norm() <= 1e-10 * std::max(1.0, expected_grad.norm()));
+		}
+
 		// Test hessian with finite differences
 		{
 			StiffnessMatrix hess;
@@ -222,6 +276,23 @@ void test_form(Form &form, const State &state, double step = 1e-8, double tol =
 			CHECK(fd::compare_hessian(Eigen::MatrixXd(hess), fhess, tol));
 		}
 
+		// Test matrix-free hessian product and diagonal against the assembled hessian
+		{
+			StiffnessMatrix hess;
+			form.second_derivative(x, hess);
+
+			const Eigen::VectorXd v = Eigen::VectorXd::Random(x.size());
+			const Eigen::VectorXd hv = hess * v;
+			const Eigen::VectorXd hdiag = hess.diagonal();
+
+			Eigen::VectorXd out, diag;
+			form.second_derivative_apply(x, v, out);
+			form.second_derivative_diagonal(x, diag);
+
+			CHECK((out - hv).norm() <= 1e-8 * std::max(1.0, hv.norm()));
+			CHECK((diag - hdiag).norm() <= 1e-8 * std::max(1.0, hdiag.norm()));
+		}
+
 		x.setRandom();
 		x /= 100;
 	}
@@ -304,6 +375,95 @@ TEST_CASE("contact form derivatives", "[form][form_derivatives][contact_form]")
 	test_form(form, *state_ptr);
 }
 
+TEST_CASE("contact form incremental hessian", "[form][contact_form]")
+{
+	const int dim = GENERATE(2, 3);
+	const auto state_ptr = get_state(dim);
+
+	const double dhat = 1e-3;
+	const bool use_convergent_formulation = GENERATE(true, false);
+	const bool project_to_psd = GENERATE(true, false);
+
+	ContactForm form(
+		state_ptr->collision_mesh, dhat, state_ptr->avg_mass,
+		use_convergent_formulation, /*use_adaptive_barrier_stiffness=*/true,
+		/*is_time_dependent=*/true, false, ipc::BroadPhaseMethod::HASH_GRID,
+		/*ccd_tolerance=*/1e-6, /*ccd_max_iterations=*/static_cast<int>(1e6));
+	form.set_project_to_psd(project_to_psd);
+
+	Eigen::VectorXd x = Eigen::VectorXd::Zero(state_ptr->n_bases * dim);
+	form.init(x);
+
+	// with a zero tolerance only the blocks of the collisions that did not move are reused
+	form.set_incremental_hessian_tolerance(0);
+
+	for (int rand = 0; rand < 5; ++rand)
+	{
+		const StiffnessMatrix hess = state_ptr->collision_mesh.to_full_dof(form.barrier_potential().hessian(
+										 form.collision_set(), state_ptr->collision_mesh, form.compute_displaced_surface(x), project_to_psd))
+									 * form.weight();
+
+		for (int k = 0; k < 2; ++k)
+		{
+			StiffnessMatrix incremental_hess;
+			form.second_derivative(x, incremental_hess);
+			CHECK((Eigen::MatrixXd(incremental_hess) - Eigen::MatrixXd(hess)).norm() <= 1e-10 * std::max(1.0, hess.norm()));
+		}
+
+		// move only part of the dofs so that some blocks are reused and some recomputed
+		if (rand % 2 == 0)
+			x.head(x.size() / 2) += Eigen::VectorXd::Random(x.size() / 2) / 1000;
+		else
+		{
+			x.setRandom();
+			x /= 100;
+		}
+		form.solution_changed(x);
+	}
+}
+
+TEST_CASE("contact form persistent broad phase", "[form][contact_form]")
+{
+	const int dim = GENERATE(2, 3);
+	const auto state_ptr = get_state(dim);
+	const ipc::CollisionMesh &collision_mesh = state_ptr->collision_mesh;
+
+	const double dhat = 1e-3;
+	const ipc::BroadPhaseMethod broad_phase_method = ipc::BroadPhaseMethod::HASH_GRID;
+
+	ContactForm form(
+		collision_mesh, dhat, state_ptr->avg_mass,
+		/*use_convergent_formulation=*/false, /*use_adaptive_barrier_stiffness=*/true,
+		/*is_time_dependent=*/true, false, broad_phase_method,
+		/*ccd_tolerance=*/1e-6, /*ccd_max_iterations=*/static_cast<int>(1e6));
+	form.set_broad_phase_skin(GENERATE(1e-3, 1e-2));
+
+	Eigen::VectorXd x = Eigen::VectorXd::Zero(state_ptr->n_bases * dim);
+	form.init(x);
+
+	for (int rand = 0; rand < 5; ++rand)
+	{
+		Eigen::VectorXd x1 = x + Eigen::VectorXd::Random(x.size()) / 1000;
+		form.solution_changed(x1);
+
+		const Eigen::MatrixXd V = form.compute_displaced_surface(x1);
+		ipc::Collisions collisions;
+		collisions.build(collision_mesh, V, dhat, /*dmin=*/0, broad_phase_method);
+		CHECK(form.collision_set().size() == collisions.size());
+
+		const Eigen::MatrixXd V0 = form.compute_displaced_surface(x);
+		ipc::Candidates candidates;
+		candidates.build(collision_mesh, V0, V, /*inflation_radius=*/dhat / 2, broad_phase_method);
+		const double max_step = candidates.compute_collision_free_stepsize(
+			collision_mesh, V0, V, /*min_distance=*/0, /*tolerance=*/1e-6, /*max_iterations=*/1e6);
+		CHECK(form.max_step_size(x, x1) == Catch::Approx(max_step));
+
+		x = x1;
+	}
+
+	CHECK(form.collision_timings().narrow_phase.count > 0);
+}
+
 TEST_CASE("elastic form derivatives", "[form][form_derivatives][elastic_form]")
 {
 	const int dim = GENERATE(2, 3);
@@ -320,6 +480,92 @@ TEST_CASE("elastic form derivatives", "[form][form_derivatives][elastic_form]")
 	test_form(form, *state_ptr, 1e-7);
 }
 
+TEST_CASE("hessian reuse", "[form][hessian_reuse]")
+{
+	const int dim = GENERATE(2, 3);
+	const auto state_ptr = get_state(dim);
+	const State &state = *state_ptr;
+	const auto rhs_assembler = state.build_rhs_assembler();
+
+	std::vector<std::shared_ptr<Form>> forms;
+	forms.push_back(std::make_shared<ElasticForm>(
+		state.n_bases,
+		state.bases,
+		state.geom_bases(),
+		*state.assembler,
+		state.ass_vals_cache,
+		0,
+		state.args["time"]["dt"],
+		state.mesh->is_volume()));
+
+	NLProblem problem(
+		state.n_bases * dim, state.boundary_nodes, state.local_boundary, state.n_boundary_samples(),
+		*rhs_assembler, state.periodic_bc, 0, forms);
+	problem.init(Eigen::VectorXd::Zero(problem.full_size()));
+
+	// the gradient vanishes at rest, so both points are displaced
+	const Eigen::VectorXd x = Eigen::VectorXd::Random(problem.reduced_size()) / 100;
+	const Eigen::VectorXd y = Eigen::VectorXd::Random(problem.reduced_size()) / 100;
+
+	const auto same = [](const StiffnessMatrix &a, const StiffnessMatrix &b) {
+		return a.rows() == b.rows() && (a - b).norm() == 0;
+	};
+
+	Eigen::VectorXd grad;
+	StiffnessMatrix hess_x, hess_y, hess;
+	problem.hessian(x, hess_x);
+	problem.hessian(y, hess_y);
+	REQUIRE(!same(hess_x, hess_y));
+
+	// the gradient norm does not decrease, the Hessian is reused only with a convergence rate of 1
+	problem.set_hessian_reuse(2, 0.5, false);
+	problem.gradient(x, grad);
+	problem.hessian(x, hess);
+	problem.gradient(x, grad);
+	problem.hessian(y, hess);
+	CHECK(same(hess, hess_y));
+
+	problem.set_hessian_reuse(2, 1, false);
+	problem.gradient(x, grad);
+	problem.hessian(x, hess);
+	CHECK(same(hess, hess_x));
+	for (int i = 0; i < 2; ++i)
+	{
+		problem.gradient(x, grad);
+		problem.hessian(y, hess);
+		CHECK(same(hess, hess_x));
+	}
+
+	// too many reuses
+	problem.gradient(x, grad);
+	problem.hessian(y, hess);
+	CHECK(same(hess, hess_y));
+
+	problem.invalidate_hessian();
+	problem.gradient(x, grad);
+	problem.hessian(x, hess);
+	CHECK(same(hess, hess_x));
+
+	// a new time step reassembles the Hessian unless it is kept across time steps
+	problem.update_quantities(0, x);
+	problem.gradient(x, grad);
+	problem.hessian(y, hess);
+	CHECK(same(hess, hess_y));
+
+	problem.set_hessian_reuse(2, 1, true);
+	problem.gradient(x, grad);
+	problem.hessian(x, hess);
+	problem.update_quantities(0, x);
+	problem.gradient(x, grad);
+	problem.hessian(y, hess);
+	CHECK(same(hess, hess_x));
+
+	// without a gradient since the new time step the convergence rate is unknown, the Hessian is reassembled
+	problem.update_quantities(0, x);
+	problem.hessian(y, hess);
+	CHECK(same(hess, hess_y));
+}
+
 TEST_CASE("pressure form derivatives", "[form][form_derivatives][pressure_form]")
 {
 	const int dim = GENERATE(3);
@@ -580,3 +826,79 @@ TEST_CASE("Fixed corotational form derivatives", "[form][form_derivatives][elast
 	form.update_quantities(0, Eigen::VectorXd::Ones(state_ptr->n_bases * dim));
 	test_form(form, *state_ptr, 1e-7, 1e-4);
 }
+
+TEST_CASE("form evaluation cache", "[form][evaluation_cache]")
+{
+	const auto state_ptr = get_state(2);
+	const State &state = *state_ptr;
+	const auto rhs_assembler = state.build_rhs_assembler();
+
+	const auto a = std::make_shared<CountingForm>();
+	const auto b = std::make_shared<CountingForm>();
+
+	NLProblem problem(
+		state.n_bases * 2, state.boundary_nodes, state.local_boundary, state.n_boundary_samples(),
+		*rhs_assembler, state.periodic_bc, 0, {a, b});
+	problem.init(Eigen::VectorXd::Zero(problem.full_size()));
+
+	const Eigen::VectorXd x = Eigen::VectorXd::Random(problem.reduced_size());
+	const Eigen::VectorXd y = Eigen::VectorXd::Random(problem.reduced_size());
+
+	// value and gradient of the forms in their current state, without using the cache
+	const auto check = [&](const Eigen::VectorXd &reduced) {
+		const Eigen::VectorXd full = problem.reduced_to_full(reduced);
+		Eigen::VectorXd grad_a, grad_b, grad;
+		a->first_derivative(full, grad_a);
+		b->first_derivative(full, grad_b);
+
+		double val;
+		problem.value_and_gradient(reduced, val, grad);
+		CHECK(val == Catch::Approx(a->value(full) + b->value(full)));
+		CHECK((grad - problem.full_to_reduced_grad(grad_a + grad_b)).norm() <= 1e-12 * grad.norm());
+	};
+	const auto n_evaluations = [&]() { return std::make_pair(a->n_evaluations, b->n_evaluations); };
+
+	// the gradient after the value at the same x is reused
+	problem.value(x);
+	REQUIRE(n_evaluations() == std::make_pair(1, 1));
+	Eigen::VectorXd grad;
+	problem.gradient(x, grad);
+	check(x);
+	CHECK(n_evaluations() == std::make_pair(1, 1));
+
+	// only the last x is kept
+	problem.value(y);
+	problem.value(x);
+	CHECK(n_evaluations() == std::make_pair(3, 3));
+
+	// only the form whose weight changed is evaluated again
+	b->set_weight(2);
+	check(x);
+	CHECK(n_evaluations() == std::make_pair(3, 4));
+
+	// the notifications changing the forms discard the cache
+	problem.update_quantities(0.1, x);
+	check(x);
+	CHECK(n_evaluations() == std::make_pair(4, 5));
+
+	problem.update_lagging(x, 1);
+	check(x);
+	CHECK(n_evaluations() == std::make_pair(5, 6));
+
+	problem.set_apply_DBC(x, false);
+	check(x);
+	CHECK(n_evaluations() == std::make_pair(6, 7));
+
+	problem.solution_changed(y);
+	check(x);
+	CHECK(n_evaluations() == std::make_pair(7, 8));
+
+	// the forms were already updated for this solution
+	problem.solution_changed(y);
+	check(x);
+	CHECK(n_evaluations() == std::make_pair(7, 8));
+
+	problem.invalidate_evaluation_cache();
+	check(x);
+	CHECK(n_evaluations() == std::make_pair(8, 9));
+}
@@ -246,4 +246,130 @@ TEST_CASE("cache", "[matrix]")
 	REQUIRE(tmp2.coeff(0, 1) == 2);
 	REQUIRE(tmp2.coeff(9, 4) == 6);
 	REQUIRE(tmp2.coeff(9, 9) == 4);
+
+	///////////////////
+	SparseMatrixCache cache3(10);
+	cache3.add_value(0, 0, 0, 1);
+	cache3.add_value(0, 0, 1, 2);
+	cache3.add_value(0, 9, 4, 3);
+	cache3.add_value(0, 9, 4, 3);
+	cache3.add_value(0, 9, 9, 4);
+	cache3.get_matrix();
+	REQUIRE(cache3.is_pattern_cached());
+
+	// same element and insertion order as above, written directly in the cached values
+	cache3.add_element_value(0, 0, 1);
+	cache3.add_element_value(0, 1, 2);
+	cache3.add_element_value(0, 2, 3);
+	cache3.add_element_value(0, 3, 3);
+	cache3.add_element_value(0, 4, 4);
+
+	const auto tmp3 = cache3.get_matrix();
+
+	REQUIRE(tmp3.coeff(0, 0) == 1);
+	REQUIRE(tmp3.coeff(0, 1) == 2);
+	REQUIRE(tmp3.coeff(9, 4) == 6);
+	REQUIRE(tmp3.coeff(9, 9) == 4);
+}
+
+TEST_CASE("full_to_reduced_matrix_map", "[matrix]")
+{
+	const int n = 50;
+	const auto random_matrix = [n](const double density) {
+		std::vector<Eigen::Triplet<double>> entries;
+		for (int i = 0; i < n; ++i)
+		{
+			entries.emplace_back(i, i, 1);
+			for (int j = 0; j < n; ++j)
+				if (std::abs(Eigen::internal::random<double>(-1, 1)) < density)
+					entries.emplace_back(i, j, Eigen::internal::random<double>(-1, 1));
+		}
+		StiffnessMatrix mat(n, n);
+		mat.setFromTriplets(entries.begin(), entries.end());
+		mat.makeCompressed();
+		return mat;
+	};
+
+	const auto check = [](const StiffnessMatrix &a, const StiffnessMatrix &b) {
+		REQUIRE(a.rows() == b.rows());
+		REQUIRE(a.cols() == b.cols());
+		REQUIRE(a.nonZeros() == b.nonZeros());
+		REQUIRE((a - b).norm() == 0);
+	};
+
+	std::vector<int> removed_vars = {0, 3, 4, 17, 49};
+	FullToReducedMatrixMap map;
+	StiffnessMatrix full = random_matrix(0.1);
+	StiffnessMatrix reduced, expected;
+
+	for (int i = 0; i < 2; ++i)
+	{
+		map.reduce(removed_vars, full, reduced);
+		full_to_reduced_matrix(n, n - removed_vars.size(), removed_vars, full, expected);
+		check(reduced, expected);
+
+		// same pattern, new values
+		full.coeffs() *= 2;
+		map.reduce(removed_vars, full, reduced);
+		full_to_reduced_matrix(n, n - removed_vars.size(), removed_vars, full, expected);
+		check(reduced, expected);
+
+		// new pattern
+		full = random_matrix(0.2);
+		map.reduce(removed_vars, full, reduced);
+		full_to_reduced_matrix(n, n - removed_vars.size(), removed_vars, full, expected);
+		check(reduced, expected);
+
+		// new removed variables
+		removed_vars = {1, 2, 10};
+	}
+}
+
+TEST_CASE("sparse_matrix_sum", "[matrix]")
+{
+	const int n = 50;
+	const auto random_matrix = [n](const double density) {
+		std::vector<Eigen::Triplet<double>> entries;
+		for (int i = 0; i < n; ++i)
+			for (int j = 0; j < n; ++j)
+				if (std::abs(Eigen::internal::random<double>(-1, 1)) < density)
+					entries.emplace_back(i, j, Eigen::internal::random<double>(-1, 1));
+		StiffnessMatrix mat(n, n);
+		mat.setFromTriplets(entries.begin(), entries.end());
+		return mat;
+	};
+
+	const auto check = [n](std::vector<StiffnessMatrix> &terms, SparseMatrixSum &sum) {
+		StiffnessMatrix res, expected(n, n);
+		sum.sum(terms, res);
+		for (const StiffnessMatrix &term : terms)
+			expected += term;
+
+		REQUIRE(res.rows() == n);
+		REQUIRE(res.cols() == n);
+		REQUIRE(res.nonZeros() >= expected.nonZeros());
+		REQUIRE((res - expected).norm() < 1e-14);
+	};
+
+	SparseMatrixSum sum;
+	std::vector<StiffnessMatrix> terms = {random_matrix(0.1), random_matrix(0.05), random_matrix(0)};
+	check(terms, sum);
+
+	// same patterns, new values
+	for (StiffnessMatrix &term : terms)
+		term.coeffs() *= -3;
+	check(terms, sum);
+
+	// a pattern contained in the union
+	terms[2] = terms[0];
+	terms[2].prune([](const int i, const int j, const double) { return i != j; });
+	check(terms, sum);
+
+	// new entries
+	terms[2] = random_matrix(0.2);
+	check(terms, sum);
+
+	// different number of terms
+	terms.pop_back();
+	check(terms, sum);
 }
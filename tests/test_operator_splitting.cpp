@@ -0,0 +1,181 @@
+#include <polyfem/State.hpp>
+#include <polyfem/solver/OperatorSplittingSolver.hpp>
+#include <polyfem/autogen/auto_p_bases.hpp>
+#include <polyfem/autogen/auto_q_bases.hpp>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <algorithm>
+
+using namespace polyfem;
+using namespace polyfem::solver;
+
+namespace
+{
+	std::shared_ptr<State> build_state(const std::string &mesh_path)
+	{
+		json in_args = json({});
+		in_args["geometry"] = {};
+		in_args["geometry"]["mesh"] = mesh_path;
+
+		in_args["materials"] = {};
+		in_args["materials"]["type"] = "LinearElasticity";
+		in_args["materials"]["E"] = 1e5;
+		in_args["materials"]["nu"] = 0.3;
+
+		auto state = std::make_shared<State>();
+		state->init_logger("", spdlog::level::err, spdlog::level::off, false);
+		state->init(in_args, true);
+		state->load_mesh();
+		state->build_basis();
+
+		return state;
+	}
+
+	std::unique_ptr<OperatorSplittingSolver> build_solver(const State &state)
+	{
+		const int n_el = state.bases.size();
+		const int shape = state.geom_bases()[0].bases.size();
+		return std::make_unique<OperatorSplittingSolver>(*state.mesh, shape, n_el, state.local_boundary, std::vector<int>());
+	}
+
+	/// first element containing pos by testing all the elements, -1 if outside
+	int brute_force_cell(OperatorSplittingSolver &ss, const std::vector<basis::ElementBases> &gbases, const RowVectorNd &pos, Eigen::MatrixXd &local)
+	{
+		for (int e = 0; e < ss.n_el; ++e)
+		{
+			ss.calculate_local_pts(gbases[e], e, pos, local);
+			if (ss.inside_element(local))
+				return e;
+		}
+		return -1;
+	}
+
+	std::string mesh_path(const bool is_volume)
+	{
+		const std::string path = POLYFEM_DATA_DIR;
+		return is_volume ? path + "/contact/meshes/3D/simple/cube.msh" : path + "/plane_hole.obj";
+	}
+} // namespace
+
+TEST_CASE("operator_splitting_locate", "[solver]")
+{
+	const bool is_volume = GENERATE(false, true);
+	const auto state = build_state(mesh_path(is_volume));
+	const auto &gbases = state->geom_bases();
+	const auto ss = build_solver(*state);
+	const int dim = ss->dim;
+
+	// random points in the bounding box, some of them are outside of the domain
+	const int n_pts = 500;
+	Eigen::MatrixXd pts = (Eigen::MatrixXd::Random(n_pts, dim).array() + 1) / 2;
+	for (int d = 0; d < dim; ++d)
+		pts.col(d) = ss->min_domain(d) + pts.col(d).array() * (ss->max_domain(d) - ss->min_domain(d));
+
+	std::vector<int> brute_cells(n_pts);
+	Eigen::MatrixXd local;
+	for (int i = 0; i < n_pts; ++i)
+		brute_cells[i] = brute_force_cell(*ss, gbases, pts.row(i), local);
+	REQUIRE(std::count(brute_cells.begin(), brute_cells.end(), -1) < n_pts);
+
+	// without hints, with the cell of the previous point as hint (mostly wrong), and with the right cell
+	std::vector<int> previous_hints(n_pts, -1);
+	for (int i = 1; i < n_pts; ++i)
+		previous_hints[i] = brute_cells[i - 1];
+
+	for (const auto &hints : {std::vector<int>(), previous_hints, brute_cells})
+	{
+		std::vector<int> cells;
+		Eigen::MatrixXd local_pts;
+		ss->locate(gbases, pts, hints, cells, local_pts);
+		REQUIRE(cells.size() == n_pts);
+		REQUIRE(local_pts.rows() == n_pts);
+
+		for (int i = 0; i < n_pts; ++i)
+		{
+			if (brute_cells[i] < 0)
+			{
+				REQUIRE(cells[i] == -1);
+				continue;
+			}
+
+			// the points on shared faces can be in several elements, the located one must contain the point
+			REQUIRE(cells[i] >= 0);
+			REQUIRE(ss->inside_element(local_pts.row(i)));
+
+			Eigen::MatrixXd mapped;
+			gbases[cells[i]].eval_geom_mapping(local_pts.row(i), mapped);
+			REQUIRE((mapped - pts.row(i)).norm() == Catch::Approx(0).margin(1e-8));
+		}
+	}
+}
+
+TEST_CASE("operator_splitting_advection", "[solver]")
+{
+	const bool is_volume = GENERATE(false, true);
+	const auto state = build_state(mesh_path(is_volume));
+	const auto &gbases = state->geom_bases();
+	const auto &bases = state->bases;
+	const auto ss = build_solver(*state);
+	const int dim = ss->dim;
+
+	// nodes of the P1/Q1 bases, as in State::solve_transient_navier_stokes_split
+	Eigen::MatrixXd local_pts;
+	const bool simplex = ss->shape == dim + 1;
+	if (is_volume)
+		simplex ? autogen::p_nodes_3d(1, local_pts) : autogen::q_nodes_3d(1, local_pts);
+	else
+		simplex ? autogen::p_nodes_2d(1, local_pts) : autogen::q_nodes_2d(1, local_pts);
+
+	// rotating velocity, large enough for the departure points to cross elements and leave the domain
+	const int n_nodes = state->n_bases;
+	Eigen::MatrixXd sol(n_nodes * dim, 1);
+	for (const auto &b : bases)
+	{
+		for (const auto &basis : b.bases)
+		{
+			const auto &g = basis.global()[0];
+			sol(g.index * dim + 0) = -g.node(1);
+			sol(g.index * dim + 1) = g.node(0);
+			if (dim == 3)
+				sol(g.index * dim + 2) = 0.5 * g.node(0) * g.node(1);
+		}
+	}
+	const double dt = 0.05 * (ss->max_domain - ss->min_domain).maxCoeff() / std::max(sol.cwiseAbs().maxCoeff(), 1e-10);
+
+	// semi-Lagrangian advection with the departure points located by testing all the elements
+	Eigen::MatrixXd expected = Eigen::MatrixXd::Zero(sol.rows(), 1);
+	std::vector<bool> done(n_nodes, false);
+	for (int e = 0; e < ss->n_el; ++e)
+	{
+		Eigen::MatrixXd mapped;
+		gbases[e].eval_geom_mapping(local_pts, mapped);
+		for (int i = 0; i < local_pts.rows(); ++i)
+		{
+			const int global = bases[e].bases[i].global()[0].index;
+			if (done[global])
+				continue;
+			done[global] = true;
+
+			RowVectorNd pos = mapped.row(i) - sol.block(global * dim, 0, dim, 1).transpose() * dt;
+			Eigen::MatrixXd local;
+			int cell = brute_force_cell(*ss, gbases, pos, local);
+			if (cell < 0)
+			{
+				cell = ss->handle_boundary_advection(pos);
+				ss->calculate_local_pts(gbases[cell], cell, pos, local);
+			}
+
+			RowVectorNd vel;
+			ss->interpolate_velocity(gbases, bases, cell, local, sol, vel);
+			expected.block(global * dim, 0, dim, 1) = vel.transpose();
+		}
+	}
+
+	Eigen::MatrixXd advected = sol;
+	ss->advection(*state->mesh, gbases, bases, advected, dt, local_pts);
+
+	REQUIRE((advected - expected).norm() == Catch::Approx(0).margin(1e-8 * expected.norm()));
+}
@@ -5,9 +5,17 @@
 #include <polyfem/State.hpp>
 #include <polyfem/Common.hpp>
 #include <polyfem/utils/JSONUtils.hpp>
+#include <polyfem/io/Evaluator.hpp>
+#include <polyfem/io/AsyncFileWriter.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <future>
 #include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 ////////////////////////////////////////////////////////////////////////////////
 
 using namespace polyfem;
@@ -23,6 +31,7 @@ TEST_CASE("full sim", "[.][full_sim]")
 #endif
 {
 	const std::string scene = GENERATE("2D/unit-tests/5-squares", "3D/unit-tests/5-cubes-fast", "3D/unit-tests/edge-edge-parallel");
+	const int async_writes = GENERATE(0, 2);
 	const std::string scene_file = fmt::format("{}/contact/examples/{}.json", POLYFEM_DATA_DIR, scene);
 
 	json args;
@@ -51,6 +60,7 @@ TEST_CASE("full sim", "[.][full_sim]")
 			"acceleration": true
 		}
 	})"_json;
+	args["/output/paraview/async_writes"_json_pointer] = async_writes;
 	args["/solver/linear/solver"_json_pointer] = "Eigen::SimplicialLDLT";
 	args["/output/log/level"_json_pointer] = "warning";
 
@@ -79,6 +89,182 @@ TEST_CASE("full sim", "[.][full_sim]")
 
 	CHECK(std::filesystem::exists(outdir));
 	CHECK(std::filesystem::exists(outdir / "sim.pvd"));
+	// the queued time steps are written when solve_problem returns
+	if (state.problem->is_time_dependent())
+	{
+		CHECK(std::filesystem::exists(outdir / "step_0.vtu"));
+		CHECK(std::filesystem::exists(outdir / "step_0_surf.vtu"));
+	}
 
 	std::filesystem::remove_all(outdir);
 }
+
+TEST_CASE("sampled_values_cache", "[output]")
+{
+	const std::string path = POLYFEM_DATA_DIR;
+	json in_args = json({});
+	in_args["geometry"] = {};
+	in_args["geometry"]["mesh"] = path + "/plane_hole.obj";
+	in_args["geometry"]["surface_selection"] = 7;
+
+	in_args["preset_problem"] = {};
+	in_args["preset_problem"]["type"] = "ElasticExact";
+
+	in_args["materials"] = {};
+	in_args["materials"]["type"] = "NeoHookean";
+	in_args["materials"]["E"] = 1e5;
+	in_args["materials"]["nu"] = 0.3;
+
+	State state;
+	state.init_logger("", spdlog::level::err, spdlog::level::off, false);
+	state.init(in_args, true);
+	state.load_mesh();
+	state.build_basis();
+
+	const bool use_sampler = GENERATE(true, false);
+
+	utils::RefElementSampler sampler;
+	sampler.init(state.mesh->is_volume(), state.mesh->n_elements(), 1e-3);
+
+	Eigen::MatrixXd sol(state.n_bases * 2, 1);
+	sol.setRandom();
+	sol *= 1e-2;
+
+	io::SampledValuesCache cache;
+	cache.init(*state.mesh, state.bases, state.geom_bases(), state.disc_orders, state.polys, state.polys_3d, sampler, use_sampler, false);
+	REQUIRE(cache.matches(use_sampler, false));
+	REQUIRE(!cache.matches(!use_sampler, false));
+
+	const int n_points = cache.offset(state.bases.size());
+	REQUIRE(n_points > 0);
+
+	std::vector<Assembler::NamedMatrix> expected, cached;
+	io::Evaluator::compute_tensor_value(
+		*state.mesh, false, state.bases, state.geom_bases(), state.disc_orders, state.polys, state.polys_3d,
+		*state.assembler, sampler, n_points, sol, 0, expected, use_sampler, false);
+	io::Evaluator::compute_tensor_value(
+		*state.mesh, false, state.bases, state.geom_bases(), state.disc_orders, state.polys, state.polys_3d,
+		*state.assembler, sampler, n_points, sol, 0, cached, use_sampler, false, &cache);
+
+	REQUIRE(expected.size() == cached.size());
+	for (int k = 0; k < expected.size(); ++k)
+	{
+		CHECK(expected[k].first == cached[k].first);
+		CHECK((expected[k].second - cached[k].second).norm() <= 1e-10 * std::max(1.0, expected[k].second.norm()));
+	}
+
+	if (!use_sampler)
+	{
+		std::vector<Assembler::NamedMatrix> expected_avg, cached_avg, tensor;
+		io::Evaluator::average_grad_based_function(
+			*state.mesh, false, state.n_bases, state.bases, state.geom_bases(), state.disc_orders, state.polys, state.polys_3d,
+			*state.assembler, sampler, 0, n_points, sol, expected_avg, tensor, use_sampler, false);
+		io::Evaluator::average_grad_based_function(
+			*state.mesh, false, state.n_bases, state.bases, state.geom_bases(), state.disc_orders, state.polys, state.polys_3d,
+			*state.assembler, sampler, 0, n_points, sol, cached_avg, tensor, use_sampler, false, &cache);
+
+		REQUIRE(expected_avg.size() == cached_avg.size());
+		for (int k = 0; k < expected_avg.size(); ++k)
+			CHECK((expected_avg[k].second - cached_avg[k].second).norm() <= 1e-10 * std::max(1.0, expected_avg[k].second.norm()));
+	}
+}
+
+TEST_CASE("async_file_writer", "[output]")
+{
+	SECTION("order")
+	{
+		std::vector<int> written;
+		{
+			io::AsyncFileWriter writer(3);
+			for (int i = 0; i < 100; ++i)
+				writer.push([&written, i]() { written.push_back(i); });
+			writer.flush();
+			REQUIRE(written.size() == 100);
+
+			for (int i = 100; i < 200; ++i)
+				writer.push([&written, i]() { written.push_back(i); });
+			// the destructor executes the pending writes
+		}
+
+		REQUIRE(written.size() == 200);
+		for (int i = 0; i < written.size(); ++i)
+			REQUIRE(written[i] == i);
+	}
+
+	SECTION("bounded queue")
+	{
+		io::AsyncFileWriter writer(2);
+		REQUIRE(writer.max_pending() == 2);
+
+		std::promise<void> release;
+		std::shared_future<void> released = release.get_future().share();
+
+		// one write in progress and one queued fill the queue
+		writer.push([released]() { released.wait(); });
+		writer.push([]() {});
+
+		std::atomic<bool> pushed(false);
+		std::thread producer([&]() {
+			writer.push([]() {});
+			pushed = true;
+		});
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		CHECK(!pushed);
+
+		release.set_value();
+		producer.join();
+		REQUIRE(pushed);
+		writer.flush();
+	}
+
+	SECTION("errors")
+	{
+		std::atomic<int> n_written(0);
+		io::AsyncFileWriter writer(4);
+
+		writer.push([]() { throw std::runtime_error("write failed"); });
+		REQUIRE_THROWS_AS(writer.flush(), std::runtime_error);
+
+		// the error is reported once, the writer is usable afterwards
+		writer.push([&n_written]() { ++n_written; });
+		REQUIRE_NOTHROW(writer.flush());
+		REQUIRE(n_written == 1);
+
+		// an error is also reported by the next push
+		writer.push([]() { throw std::runtime_error("write failed"); });
+		while (true)
+		{
+			try
+			{
+				writer.push([&n_written]() { ++n_written; });
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+			catch (const std::runtime_error &)
+			{
+				break;
+			}
+		}
+		REQUIRE_NOTHROW(writer.flush());
+	}
+
+	SECTION("error on destruction")
+	{
+		std::atomic<int> n_written(0);
+		// the destructor logs the error of a failed write instead of throwing and still runs the pending writes
+		REQUIRE_NOTHROW([&]() {
+			std::promise<void> release;
+			std::shared_future<void> released = release.get_future().share();
+
+			io::AsyncFileWriter writer(4);
+			// fails after the second write is queued
+			writer.push([released]() {
+				released.wait();
+				throw std::runtime_error("write failed");
+			});
+			writer.push([&n_written]() { ++n_written; });
+			release.set_value();
+		}());
+		REQUIRE(n_written == 1);
+	}
+}
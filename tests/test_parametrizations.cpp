@@ -66,4 +66,81 @@ TEST_CASE("bbw-test", "[parametrization]")
 	verify_apply_jacobian(lbs_with_bbw, y);
 }
 
+TEST_CASE("linear-filter", "[parametrization]")
+{
+	// perturbed triangle or hex grid of the unit square/cube
+	const int dim = GENERATE(2, 3);
+	const int n = dim == 2 ? 8 : 5;
+	const int n_layers = dim == 2 ? 1 : n + 1;
+	const auto vid = [n](int i, int j, int k) { return (k * (n + 1) + j) * (n + 1) + i; };
+
+	Eigen::MatrixXd V((n + 1) * (n + 1) * n_layers, dim);
+	for (int k = 0; k < n_layers; ++k)
+		for (int j = 0; j <= n; ++j)
+			for (int i = 0; i <= n; ++i)
+				V.row(vid(i, j, k)) = (Eigen::RowVector3d(i, j, k).head(dim) + 0.2 * Eigen::RowVectorXd::Random(dim)) / n;
+
+	Eigen::MatrixXi C;
+	if (dim == 2)
+	{
+		C.resize(2 * n * n, 3);
+		for (int j = 0, index = 0; j < n; ++j)
+			for (int i = 0; i < n; ++i)
+			{
+				C.row(index++) << vid(i, j, 0), vid(i + 1, j, 0), vid(i + 1, j + 1, 0);
+				C.row(index++) << vid(i, j, 0), vid(i + 1, j + 1, 0), vid(i, j + 1, 0);
+			}
+	}
+	else
+	{
+		C.resize(n * n * n, 8);
+		for (int k = 0, index = 0; k < n; ++k)
+			for (int j = 0; j < n; ++j)
+				for (int i = 0; i < n; ++i)
+					C.row(index++) << vid(i, j, k), vid(i + 1, j, k), vid(i + 1, j + 1, k), vid(i, j + 1, k),
+						vid(i, j, k + 1), vid(i + 1, j, k + 1), vid(i + 1, j + 1, k + 1), vid(i, j + 1, k + 1);
+	}
+
+	const auto mesh = mesh::Mesh::create(V, C);
+	REQUIRE(mesh);
+	mesh->prepare_mesh();
+
+	Eigen::MatrixXd barycenters;
+	if (mesh->is_volume())
+		mesh->cell_barycenters(barycenters);
+	else
+		mesh->face_barycenters(barycenters);
+	const int n_elements = barycenters.rows();
+
+	CHECK_THROWS(LinearFilter(*mesh, 0));
+
+	// the tiny radius clamps the grid resolution, the largest one connects all the elements
+	for (const double radius : {1e-12, 0.1, 0.3, 10.})
+	{
+		LinearFilter filter(*mesh, radius);
+
+		// O(n^2) construction of the weights
+		Eigen::MatrixXd weights = Eigen::MatrixXd::Zero(n_elements, n_elements);
+		for (int i = 0; i < n_elements; ++i)
+		{
+			for (int j = 0; j < n_elements; ++j)
+			{
+				const double dist = (barycenters.row(i) - barycenters.row(j)).norm();
+				if (dist < radius)
+					weights(i, j) = radius - dist;
+			}
+			weights.row(i) /= weights.row(i).sum();
+		}
+
+		// the filter applied to the unit vectors gives the columns of the weights
+		for (int j = 0; j < n_elements; ++j)
+		{
+			Eigen::VectorXd unit = Eigen::VectorXd::Zero(n_elements);
+			unit(j) = 1;
+			REQUIRE((filter.eval(unit) - weights.col(j)).norm() == Catch::Approx(0).margin(1e-12));
+			REQUIRE((filter.apply_jacobian(unit, unit) - weights.col(j)).norm() == Catch::Approx(0).margin(1e-12));
+		}
+	}
+}
+
 #endif
@@ -1,12 +1,16 @@
 ////////////////////////////////////////////////////////////////////////////////
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
 
 #include <polyfem/State.hpp>
 #include <polyfem/Common.hpp>
 #include <polyfem/utils/Logger.hpp>
 #include <polyfem/utils/JSONUtils.hpp>
+#include <polyfem/io/Snapshot.hpp>
 
+#include <cstdint>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -122,3 +126,92 @@ TEST_CASE("restart", "[.][restart]")
 
 	std::filesystem::remove_all(outdir);
 }
+
+TEST_CASE("snapshot_io", "[restart]")
+{
+	const std::filesystem::path path = std::filesystem::current_path() / "DELETE_ME_snapshot.bin";
+
+	const Eigen::MatrixXd A = Eigen::MatrixXd::Random(17, 3);
+	const Eigen::MatrixXi B = Eigen::MatrixXi::Random(5, 4);
+	const std::vector<int> c = {4, 8, 15, 16, 23, 42};
+
+	io::SnapshotWriter writer;
+	writer.add("A", A);
+	writer.add("B", B);
+	writer.add("c", c);
+	writer.add("empty", Eigen::MatrixXd());
+	CHECK_THROWS(writer.add("A", A));
+	writer.write(path.string());
+
+	{
+		const io::SnapshotReader reader(path.string());
+		CHECK(reader.has("A"));
+		CHECK(!reader.has("D"));
+		CHECK(reader.matrix("A") == A);
+		CHECK(reader.imatrix("B") == B);
+		CHECK(reader.ivector("c") == c);
+		CHECK(reader.matrix("empty").size() == 0);
+		CHECK(reinterpret_cast<std::uintptr_t>(reader.matrix("A").data()) % 16 == 0);
+		CHECK_THROWS(reader.imatrix("A"));
+		CHECK_THROWS(reader.matrix("D"));
+	}
+
+	// rows * cols * sizeof(double) of the first array wraps around to a small size
+	{
+		std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+		const int64_t dims[2] = {(int64_t(1) << 61) + 1, 8};
+		file.seekp(64 + io::snapshot::MAX_NAME_SIZE + 8);
+		file.write(reinterpret_cast<const char *>(dims), sizeof(dims));
+	}
+	CHECK_THROWS(io::SnapshotReader(path.string()));
+
+	// truncated file
+	std::filesystem::resize_file(path, std::filesystem::file_size(path) - 8);
+	CHECK_THROWS(io::SnapshotReader(path.string()));
+
+	std::filesystem::remove(path);
+}
+
+TEST_CASE("restart_snapshot", "[.][restart]")
+{
+	const std::string scene_file = POLYFEM_DATA_DIR "/contact/examples/3D/unit-tests/2-cubes.json";
+	constexpr int total_time_steps = 10;
+	constexpr int restart_time_steps = total_time_steps / 2;
+	constexpr double margin = 1e-3;
+
+	const std::filesystem::path outdir = std::filesystem::current_path() / "DELETE_ME_restart_snapshot_test_output";
+	const std::filesystem::path full_outdir = outdir / "full";
+	const std::filesystem::path restart_outdir = outdir / "restart";
+
+	json args = load_sim_json(scene_file, total_time_steps);
+
+	State state;
+
+	args["/output/directory"_json_pointer] = full_outdir.string();
+	args["/output/data/snapshot"_json_pointer] = "snapshot_{:d}.bin";
+	const auto full_sol = run_sim(state, args);
+
+	// same as main.cpp --snapshot
+	const std::string snapshot_path = (full_outdir / fmt::format("snapshot_{:d}.bin", restart_time_steps)).string();
+	{
+		const io::SnapshotReader snapshot(snapshot_path);
+		const auto time = snapshot.matrix("time");
+		CHECK(time(0) == Catch::Approx(args["/time/dt"_json_pointer].get<double>() * restart_time_steps));
+		CHECK(int(time(2)) == total_time_steps - restart_time_steps);
+		CHECK(snapshot.has("mesh/vertices"));
+		CHECK(snapshot.has("collision_mesh/vertices"));
+	}
+
+	args["/output/directory"_json_pointer] = restart_outdir.string();
+	args["/input/data/snapshot"_json_pointer] = snapshot_path;
+	args["/time/t0"_json_pointer] = args["/time/dt"_json_pointer].get<double>() * restart_time_steps;
+	args["time"]["time_steps"] = total_time_steps - restart_time_steps;
+	const auto restart_sol = run_sim(state, args);
+
+	CHECK(full_sol.rows() == restart_sol.rows());
+	CHECK(full_sol.cols() == restart_sol.cols());
+	CAPTURE((full_sol - restart_sol).lpNorm<Eigen::Infinity>());
+	CHECK(full_sol.isApprox(restart_sol, margin));
+
+	std::filesystem::remove_all(outdir);
+}
@@ -3,9 +3,11 @@
 #include <polyfem/utils/RBFInterpolation.hpp>
 #include <polyfem/utils/Bessel.hpp>
 #include <polyfem/utils/ExpressionValue.hpp>
+#include <polyfem/utils/LazyCubicInterpolator.hpp>
 #include <polyfem/io/MshReader.hpp>
 #include <polyfem/mesh/Mesh.hpp>
 #include <polyfem/utils/MatrixUtils.hpp>
+#include <polyfem/utils/SmallVector.hpp>
 
 #include <wmtk/TriMesh.h>
 
@@ -13,6 +15,12 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
 ////////////////////////////////////////////////////////////////////////////////
 
 using namespace polyfem;
@@ -107,6 +115,156 @@ TEST_CASE("expression", "[utils]")
 	REQUIRE(val(2, 3, 4) == Catch::Approx(1).margin(1e-16));
 }
 
+TEST_CASE("expression_batch", "[utils]")
+{
+	utils::ExpressionValue expr;
+	expr.init(json("x^2+sqrt(x*y)+sin(z)*x+t"));
+	utils::ExpressionValue val;
+	val.init(json(1));
+	utils::ExpressionValue mat;
+	mat.init(Eigen::MatrixXd(Eigen::Vector3d(4, 5, 6)));
+
+	expr.set_unit_type("");
+	val.set_unit_type("");
+	mat.set_unit_type("");
+
+	const Eigen::MatrixXd pts = Eigen::MatrixXd::Random(20, 3).array().abs();
+	const double t = 0.5;
+
+	Eigen::VectorXd out;
+	expr.evaluate(pts, t, out);
+	REQUIRE(out.size() == pts.rows());
+	for (int i = 0; i < pts.rows(); ++i)
+	{
+		const double x = pts(i, 0), y = pts(i, 1), z = pts(i, 2);
+		REQUIRE(out(i) == Catch::Approx(x * x + sqrt(x * y) + sin(z) * x + t).margin(1e-10));
+		REQUIRE(out(i) == Catch::Approx(expr(x, y, z, t)).margin(1e-14));
+	}
+
+	// 2d points, z is zero
+	expr.evaluate(pts.leftCols(2), t, out);
+	for (int i = 0; i < pts.rows(); ++i)
+		REQUIRE(out(i) == Catch::Approx(expr(pts(i, 0), pts(i, 1), 0, t)).margin(1e-14));
+
+	val.evaluate(pts, t, out);
+	REQUIRE(out.size() == pts.rows());
+	REQUIRE((out.array() == 1).all());
+
+	mat.evaluate(pts, t, out, 1);
+	REQUIRE((out.array() == 5).all());
+
+	// copies share the same compiled expression
+	utils::ExpressionValue copy = expr;
+	Eigen::VectorXd out_copy;
+	copy.evaluate(pts * 2, t, out_copy);
+	expr.evaluate(pts, t, out);
+	for (int i = 0; i < pts.rows(); ++i)
+		REQUIRE(out_copy(i) == Catch::Approx(copy(2 * pts(i, 0), 2 * pts(i, 1), 2 * pts(i, 2), t)).margin(1e-14));
+}
+
+TEST_CASE("lazy_cubic_interpolator", "[utils]")
+{
+	const int dim = GENERATE(2, 3);
+	const double delta = 0.05;
+
+	// quadratic, reproduced exactly by the finite differences and the cubic interpolant
+	auto f = [](const Eigen::MatrixXd &p, double &d) { d = p.squaredNorm() + p(0); };
+
+	LazyCubicInterpolator interpolator(dim, delta);
+	const Eigen::MatrixXd pts = Eigen::MatrixXd::Random(200, dim);
+
+	std::vector<std::thread> threads;
+	for (int t = 0; t < 4; ++t)
+		threads.emplace_back([&, t]() { interpolator.cache_grid_batch(f, pts.middleRows(t * 50, 50)); });
+	for (auto &t : threads)
+		t.join();
+
+	Eigen::VectorXd vals;
+	Eigen::MatrixXd grads;
+	interpolator.evaluate_batch(pts, vals, grads);
+	REQUIRE(vals.size() == pts.rows());
+	REQUIRE(grads.rows() == pts.rows());
+	REQUIRE(grads.cols() == dim);
+
+	for (int i = 0; i < pts.rows(); ++i)
+	{
+		double expected;
+		f(pts.row(i), expected);
+		Eigen::RowVectorXd expected_grad = 2 * pts.row(i);
+		expected_grad(0) += 1;
+
+		CHECK(vals(i) == Catch::Approx(expected).margin(1e-10));
+		CHECK((grads.row(i) - expected_grad).norm() == Catch::Approx(0).margin(1e-8));
+
+		double val;
+		Eigen::MatrixXd grad;
+		interpolator.evaluate(pts.row(i), val, grad);
+		CHECK(val == Catch::Approx(vals(i)).margin(1e-14));
+		CHECK((grad.transpose() - grads.row(i)).norm() == Catch::Approx(0).margin(1e-14));
+	}
+
+	Eigen::MatrixXd far = Eigen::MatrixXd::Constant(1, dim, 10);
+	REQUIRE_THROWS(interpolator.evaluate_batch(far, vals, grads));
+}
+
+TEST_CASE("lazy_cubic_interpolator_benchmark", "[.][utils][benchmark]")
+{
+	const int dim = 3;
+	const double delta = 0.02;
+	auto f = [](const Eigen::MatrixXd &p, double &d) { d = p.norm() - 0.5; };
+
+	const Eigen::MatrixXd pts = Eigen::MatrixXd::Random(10000, dim) * 0.7;
+	LazyCubicInterpolator interpolator(dim, delta);
+	interpolator.cache_grid_batch(f, pts);
+
+	// previous cache layout: string keys in a map guarded by a shared mutex
+	std::unordered_map<std::string, double> string_cache;
+	std::shared_mutex mutex;
+	for (int i = 0; i < pts.rows(); ++i)
+		for (int c = 0; c < 8; ++c)
+		{
+			std::string key;
+			for (int k = 0; k < dim; ++k)
+				key += std::to_string((int)std::floor(pts(i, k) / delta) + ((c >> k) & 1)) + ",";
+			string_cache[key] = 0;
+		}
+
+	BENCHMARK("string keyed corner lookups")
+	{
+		double sum = 0;
+		for (int i = 0; i < pts.rows(); ++i)
+			for (int c = 0; c < 8; ++c)
+			{
+				std::string key;
+				for (int k = 0; k < dim; ++k)
+					key += std::to_string((int)std::floor(pts(i, k) / delta) + ((c >> k) & 1)) + ",";
+				std::shared_lock lock(mutex);
+				sum += string_cache.at(key);
+			}
+		return sum;
+	};
+
+	BENCHMARK("evaluate")
+	{
+		double sum = 0, val;
+		Eigen::MatrixXd grad;
+		for (int i = 0; i < pts.rows(); ++i)
+		{
+			interpolator.evaluate(pts.row(i), val, grad);
+			sum += val;
+		}
+		return sum;
+	};
+
+	Eigen::VectorXd vals;
+	Eigen::MatrixXd grads;
+	BENCHMARK("evaluate_batch")
+	{
+		interpolator.evaluate_batch(pts, vals, grads);
+		return vals.sum();
+	};
+}
+
 TEST_CASE("mshreader", "[utils]")
 {
 	const std::string path = POLYFEM_DATA_DIR;
@@ -130,6 +288,51 @@ TEST_CASE("inverse", "[utils]")
 	REQUIRE(((utils::inverse(mat3) - mat3_inv)).norm() == Catch::Approx(0).margin(1e-12));
 }
 
+TEST_CASE("small_vector", "[utils]")
+{
+	SmallVector<uint32_t, 4> v;
+	std::vector<uint32_t> ref;
+	REQUIRE(v.empty());
+
+	// grows past the inline capacity
+	for (uint32_t i = 0; i < 10; ++i)
+	{
+		v.push_back(9 - i);
+		ref.push_back(9 - i);
+	}
+	REQUIRE(v.size() == 10);
+	REQUIRE(v.heap_memory() > 0);
+	CHECK(std::vector<uint32_t>(v) == ref);
+
+	std::sort(v.begin(), v.end());
+	std::sort(ref.begin(), ref.end());
+	CHECK(std::vector<uint32_t>(v) == ref);
+
+	// aliasing insert and erase
+	v.insert(v.end(), v.begin(), v.begin() + 3);
+	ref.insert(ref.end(), ref.begin(), ref.begin() + 3);
+	std::sort(v.begin(), v.end());
+	v.erase(std::unique(v.begin(), v.end()), v.end());
+	std::sort(ref.begin(), ref.end());
+	ref.erase(std::unique(ref.begin(), ref.end()), ref.end());
+	CHECK(std::vector<uint32_t>(v) == ref);
+
+	SmallVector<uint32_t, 4> small = {1, 2, 3};
+	CHECK(small.heap_memory() == 0);
+	small.resize(4, 7);
+	CHECK(small.back() == 7);
+
+	SmallVector<uint32_t, 4> copy = v;
+	CHECK(copy == v);
+	SmallVector<uint32_t, 4> moved = std::move(copy);
+	CHECK(moved == v);
+	CHECK(copy.empty());
+
+	moved = small;
+	CHECK(moved == small);
+	CHECK(moved != v);
+}
+
 TEST_CASE("wmtk_instatiation", "[utils]")
 {
 	wmtk::TriMesh mesh;